@@ -18,6 +18,9 @@ using namespace std;
 // BLAKE2b components per vector
 #define BLAKE2B_COMPONENTS_PER_VECTOR 4
 
+// BLAKE2b number of header parts before nonce part
+#define BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART (HEADER_SIZE / BLAKE2B_BUFFER_SIZE)
+
 // BLAKE2b initial working state
 static const uint64_t BLAKE2B_INITIAL_WORKING_STATE[] = {7640891576939301160, 13503953896175478587ULL, 4354685564936845355, 11912009170470909681ULL, 5840696475078001361, 11170449401992604703ULL, 2270897969802886507, 6620516959819538809, 7640891576956012808, 13503953896175478587ULL, 4354685564936845355, 11912009170470909681ULL, 5840696475078001233, 11170449401992604703ULL, 2270897969802886507, 6620516959819538809};
 
@@ -44,109 +47,65 @@ static const uint8_t BLAKE2B_SIGMA[][16] = {
 };
 
 
+// Structures
+
+// BLAKE2b midstate structure (A header's state after compressing its parts that come before the part that includes the nonce, so only the nonce part has to be compressed for each nonce)
+struct Blake2bMidstate {
+
+	// State first half
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) stateFirstHalf;
+	
+	// State second half
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) stateSecondHalf;
+	
+	// Nonce part (The end of the header padded with zeros where the nonce is appended)
+	uint64_t noncePart[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)];
+};
+
+
 // Function prototypes
 
+// Set BLAKE2b midstate
+static inline void setBlake2bMidstate(Blake2bMidstate &midstate, const uint8_t header[HEADER_SIZE]) noexcept;
+
 // BLAKE2b
-static inline void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &result, const uint8_t header[HEADER_SIZE], uint64_t nonce) noexcept;
+static inline CPU_FEATURE_DISPATCH_VARIANTS void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &result, const Blake2bMidstate &midstate, const uint64_t nonce) noexcept;
+
+// BLAKE2b (Gets the results for consecutive nonces starting at the first nonce with each nonce in its own vector lane)
+template<const unsigned int numberOfNonces> static inline CPU_FEATURE_DISPATCH_VARIANTS void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) results[numberOfNonces], const Blake2bMidstate &midstate, const uint64_t firstNonce) noexcept;
+
+// Set BLAKE2b nonce part's nonce
+static inline void setBlake2bNoncePartNonce(uint64_t noncePart[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)], uint64_t nonce) noexcept;
 
 // BLAKE2b step
-static inline void blake2bStep(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ a, uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ b, uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ c, uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ d, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ x, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ y) noexcept;
+template<const unsigned int numberOfComponents> static inline void blake2bStep(uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ a, uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ b, uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ c, uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ d, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ x, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ y) noexcept;
 
 
 // Supporting function implementation
 
-// BLAKE2b
-void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &result, const uint8_t header[HEADER_SIZE], uint64_t nonce) noexcept {
+// Set BLAKE2b midstate
+void setBlake2bMidstate(Blake2bMidstate &midstate, const uint8_t header[HEADER_SIZE]) noexcept {
 
 	// Throw error if header size is invalid
-	static_assert(HEADER_SIZE + sizeof(nonce) > BLAKE2B_BUFFER_SIZE && HEADER_SIZE + sizeof(nonce) <= BLAKE2B_BUFFER_SIZE * 3, "Header's size is invalid");
-	
-	// Set buffer to beginning of header
-	uint64_t buffer[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)] = {};
-	memcpy(buffer, header, sizeof(buffer));
-	
-	// Go through all rounds
-	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) a = BLAKE2B_INITIAL_STATE_FIRST_HALF;
-	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) b = BLAKE2B_INITIAL_STATE_SECOND_HALF;
-	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) c = {BLAKE2B_INITIAL_WORKING_STATE[8], BLAKE2B_INITIAL_WORKING_STATE[9], BLAKE2B_INITIAL_WORKING_STATE[10], BLAKE2B_INITIAL_WORKING_STATE[11]};
-	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) d = {BLAKE2B_INITIAL_WORKING_STATE[12], BLAKE2B_INITIAL_WORKING_STATE[13], BLAKE2B_INITIAL_WORKING_STATE[14], BLAKE2B_INITIAL_WORKING_STATE[15]};
-	
-	for(uint_fast8_t i = 0; i < BLAKE2B_NUMBER_OF_ROUNDS; ++i) {
-	
-		// Set x and y for column step
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) x = {buffer[BLAKE2B_SIGMA[i][0]], buffer[BLAKE2B_SIGMA[i][2]], buffer[BLAKE2B_SIGMA[i][4]], buffer[BLAKE2B_SIGMA[i][6]]};
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) y = {buffer[BLAKE2B_SIGMA[i][1]], buffer[BLAKE2B_SIGMA[i][3]], buffer[BLAKE2B_SIGMA[i][5]], buffer[BLAKE2B_SIGMA[i][7]]};
-		
-		// Perform column step
-		blake2bStep(a, b, c, d, x, y);
-		
-		// Update b, c, and d for diagonal step
-		b = __builtin_shufflevector(b, b, 1, 2, 3, 0);
-		c = __builtin_shufflevector(c, c, 2, 3, 0, 1);
-		d = __builtin_shufflevector(d, d, 3, 0, 1, 2);
-		
-		// Set x, and y for diagonal step
-		x = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){buffer[BLAKE2B_SIGMA[i][8]], buffer[BLAKE2B_SIGMA[i][10]], buffer[BLAKE2B_SIGMA[i][12]], buffer[BLAKE2B_SIGMA[i][14]]};
-		y = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){buffer[BLAKE2B_SIGMA[i][9]], buffer[BLAKE2B_SIGMA[i][11]], buffer[BLAKE2B_SIGMA[i][13]], buffer[BLAKE2B_SIGMA[i][15]]};
-		
-		// Perform diagonal step
-		blake2bStep(a, b, c, d, x, y);
-		
-		// Update b, c, and d for column step
-		b = __builtin_shufflevector(b, b, 3, 0, 1, 2);
-		c = __builtin_shufflevector(c, c, 2, 3, 0, 1);
-		d = __builtin_shufflevector(d, d, 1, 2, 3, 0);
-	}
+	static_assert(HEADER_SIZE + sizeof(uint64_t) > BLAKE2B_BUFFER_SIZE && HEADER_SIZE + sizeof(uint64_t) <= BLAKE2B_BUFFER_SIZE * 3, "Header's size is invalid");
 	
-	// Check if using Windows
-	#ifdef _WIN32
+	// Throw error if header's nonce isn't in one part
+	static_assert(HEADER_SIZE % BLAKE2B_BUFFER_SIZE + sizeof(uint64_t) <= BLAKE2B_BUFFER_SIZE, "Header's nonce isn't in one part");
 	
-		// Make nonce big endian
-		nonce = _byteswap_uint64(nonce);
-		
-	// Otherwise check if using an Apple device
-	#elif defined __APPLE__
-	
-		// Make nonce big endian
-		nonce = OSSwapHostToBigInt64(nonce);
-		
-	// Otherwise
-	#else
-	
-		// Make nonce big endian
-		nonce = htobe64(nonce);
-	#endif
-	
-	// Check if stratum server uses one mining algorithm
-	#if STRATUM_SERVER_NUMBER_OF_MINING_ALGORITHMS == 1
-	
-		// Set buffer to end of header
-		memcpy(buffer, &header[sizeof(buffer)], HEADER_SIZE - sizeof(buffer));
-		
-		// Append nonce in big endian to buffer
-		memcpy(&reinterpret_cast<uint8_t *>(buffer)[HEADER_SIZE - sizeof(buffer)], &nonce, sizeof(nonce));
-		
-		// Pad buffer with zeros
-		memset(&reinterpret_cast<uint8_t *>(buffer)[HEADER_SIZE - sizeof(buffer) + sizeof(nonce)], 0, sizeof(buffer) - (HEADER_SIZE - sizeof(buffer) + sizeof(nonce)));
-		
-		// Prepare values for next rounds
-		a ^= BLAKE2B_INITIAL_STATE_FIRST_HALF ^ c;
-		b ^= BLAKE2B_INITIAL_STATE_SECOND_HALF ^ d;
-		const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) initialStateCurrentPartFirstHalf = a;
-		
-	// Otherwise
-	#else
+	// Go through all parts of the header before the nonce part
+	midstate.stateFirstHalf = BLAKE2B_INITIAL_STATE_FIRST_HALF;
+	midstate.stateSecondHalf = BLAKE2B_INITIAL_STATE_SECOND_HALF;
+	for(uint_fast8_t part = 0; part < BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART; ++part) {
 	
-		// Set buffer to next part of header
-		memcpy(buffer, &header[sizeof(buffer)], sizeof(buffer));
+		// Set buffer to part of header
+		uint64_t buffer[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)];
+		memcpy(buffer, &header[sizeof(buffer) * part], sizeof(buffer));
 		
 		// Go through all rounds
-		a ^= BLAKE2B_INITIAL_STATE_FIRST_HALF ^ c;
-		b ^= BLAKE2B_INITIAL_STATE_SECOND_HALF ^ d;
-		c = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){BLAKE2B_INITIAL_WORKING_STATE[8], BLAKE2B_INITIAL_WORKING_STATE[9], BLAKE2B_INITIAL_WORKING_STATE[10], BLAKE2B_INITIAL_WORKING_STATE[11]};
-		d = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){BLAKE2B_INITIAL_WORKING_STATE[12] ^ (sizeof(buffer) ^ (sizeof(buffer) * 2)), BLAKE2B_INITIAL_WORKING_STATE[13], BLAKE2B_INITIAL_WORKING_STATE[14], BLAKE2B_INITIAL_WORKING_STATE[15]};
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) initialStateCurrentPartFirstHalf = a;
-		const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) initialStateCurrentPartSecondHalf = b;
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) a = midstate.stateFirstHalf;
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) b = midstate.stateSecondHalf;
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) c = {BLAKE2B_INITIAL_WORKING_STATE[8], BLAKE2B_INITIAL_WORKING_STATE[9], BLAKE2B_INITIAL_WORKING_STATE[10], BLAKE2B_INITIAL_WORKING_STATE[11]};
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) d = {BLAKE2B_INITIAL_WORKING_STATE[12] ^ (sizeof(buffer) ^ (sizeof(buffer) * (part + 1))), BLAKE2B_INITIAL_WORKING_STATE[13], BLAKE2B_INITIAL_WORKING_STATE[14], BLAKE2B_INITIAL_WORKING_STATE[15]};
 		
 		for(uint_fast8_t i = 0; i < BLAKE2B_NUMBER_OF_ROUNDS; ++i) {
 		
@@ -155,7 +114,7 @@ void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMP
 			uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) y = {buffer[BLAKE2B_SIGMA[i][1]], buffer[BLAKE2B_SIGMA[i][3]], buffer[BLAKE2B_SIGMA[i][5]], buffer[BLAKE2B_SIGMA[i][7]]};
 			
 			// Perform column step
-			blake2bStep(a, b, c, d, x, y);
+			blake2bStep<BLAKE2B_COMPONENTS_PER_VECTOR>(a, b, c, d, x, y);
 			
 			// Update b, c, and d for diagonal step
 			b = __builtin_shufflevector(b, b, 1, 2, 3, 0);
@@ -167,7 +126,7 @@ void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMP
 			y = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){buffer[BLAKE2B_SIGMA[i][9]], buffer[BLAKE2B_SIGMA[i][11]], buffer[BLAKE2B_SIGMA[i][13]], buffer[BLAKE2B_SIGMA[i][15]]};
 			
 			// Perform diagonal step
-			blake2bStep(a, b, c, d, x, y);
+			blake2bStep<BLAKE2B_COMPONENTS_PER_VECTOR>(a, b, c, d, x, y);
 			
 			// Update b, c, and d for column step
 			b = __builtin_shufflevector(b, b, 3, 0, 1, 2);
@@ -175,25 +134,32 @@ void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMP
 			d = __builtin_shufflevector(d, d, 1, 2, 3, 0);
 		}
 		
-		// Set buffer to end of header
-		memcpy(buffer, &header[sizeof(buffer) * 2], HEADER_SIZE - sizeof(buffer) * 2);
-		
-		// Append nonce in big endian to buffer
-		memcpy(&reinterpret_cast<uint8_t *>(buffer)[HEADER_SIZE - sizeof(buffer) * 2], &nonce, sizeof(nonce));
-		
-		// Pad buffer with zeros
-		memset(&reinterpret_cast<uint8_t *>(buffer)[HEADER_SIZE - sizeof(buffer) * 2 + sizeof(nonce)], 0, sizeof(buffer) - (HEADER_SIZE - sizeof(buffer) * 2 + sizeof(nonce)));
-		
-		// Prepare values for next rounds
-		a ^= initialStateCurrentPartFirstHalf ^ c;
-		b ^= initialStateCurrentPartSecondHalf ^ d;
-		initialStateCurrentPartFirstHalf = a;
-	#endif
+		// Update state with the part's working state
+		midstate.stateFirstHalf ^= a ^ c;
+		midstate.stateSecondHalf ^= b ^ d;
+	}
+	
+	// Set nonce part to end of header
+	memcpy(midstate.noncePart, &header[sizeof(midstate.noncePart) * BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART], HEADER_SIZE - sizeof(midstate.noncePart) * BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART);
+	
+	// Pad nonce part with zeros
+	memset(&reinterpret_cast<uint8_t *>(midstate.noncePart)[HEADER_SIZE - sizeof(midstate.noncePart) * BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART], 0, sizeof(midstate.noncePart) - (HEADER_SIZE - sizeof(midstate.noncePart) * BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART));
+}
+
+// BLAKE2b
+void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &result, const Blake2bMidstate &midstate, const uint64_t nonce) noexcept {
+
+	// Set buffer to nonce part with the nonce
+	uint64_t buffer[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)];
+	memcpy(buffer, midstate.noncePart, sizeof(buffer));
+	setBlake2bNoncePartNonce(buffer, nonce);
 	
 	// Go through all rounds
-	c = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){BLAKE2B_INITIAL_WORKING_STATE[8], BLAKE2B_INITIAL_WORKING_STATE[9], BLAKE2B_INITIAL_WORKING_STATE[10], BLAKE2B_INITIAL_WORKING_STATE[11]};
-	d = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){BLAKE2B_INITIAL_WORKING_STATE[12] ^ (sizeof(buffer) ^ (HEADER_SIZE + sizeof(nonce))), BLAKE2B_INITIAL_WORKING_STATE[13], BLAKE2B_INITIAL_WORKING_STATE[14] ^ UINT64_MAX, BLAKE2B_INITIAL_WORKING_STATE[15]};
-		
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) a = midstate.stateFirstHalf;
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) b = midstate.stateSecondHalf;
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) c = {BLAKE2B_INITIAL_WORKING_STATE[8], BLAKE2B_INITIAL_WORKING_STATE[9], BLAKE2B_INITIAL_WORKING_STATE[10], BLAKE2B_INITIAL_WORKING_STATE[11]};
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) d = {BLAKE2B_INITIAL_WORKING_STATE[12] ^ (sizeof(buffer) ^ (HEADER_SIZE + sizeof(nonce))), BLAKE2B_INITIAL_WORKING_STATE[13], BLAKE2B_INITIAL_WORKING_STATE[14] ^ UINT64_MAX, BLAKE2B_INITIAL_WORKING_STATE[15]};
+	
 	for(uint_fast8_t i = 0; i < BLAKE2B_NUMBER_OF_ROUNDS; ++i) {
 	
 		// Set x and y for column step
@@ -201,7 +167,7 @@ void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMP
 		uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) y = {buffer[BLAKE2B_SIGMA[i][1]], buffer[BLAKE2B_SIGMA[i][3]], buffer[BLAKE2B_SIGMA[i][5]], buffer[BLAKE2B_SIGMA[i][7]]};
 		
 		// Perform column step
-		blake2bStep(a, b, c, d, x, y);
+		blake2bStep<BLAKE2B_COMPONENTS_PER_VECTOR>(a, b, c, d, x, y);
 		
 		// Update b, c, and d for diagonal step
 		b = __builtin_shufflevector(b, b, 1, 2, 3, 0);
@@ -213,7 +179,7 @@ void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMP
 		y = (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){buffer[BLAKE2B_SIGMA[i][9]], buffer[BLAKE2B_SIGMA[i][11]], buffer[BLAKE2B_SIGMA[i][13]], buffer[BLAKE2B_SIGMA[i][15]]};
 		
 		// Perform diagonal step
-		blake2bStep(a, b, c, d, x, y);
+		blake2bStep<BLAKE2B_COMPONENTS_PER_VECTOR>(a, b, c, d, x, y);
 		
 		// Update b, c, and d for column step
 		b = __builtin_shufflevector(b, b, 3, 0, 1, 2);
@@ -222,11 +188,96 @@ void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMP
 	}
 	
 	// Get result from working state
-	result = initialStateCurrentPartFirstHalf ^ a ^ c;
+	result = midstate.stateFirstHalf ^ a ^ c;
+}
+
+// BLAKE2b
+template<const unsigned int numberOfNonces> void blake2b(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) results[numberOfNonces], const Blake2bMidstate &midstate, const uint64_t firstNonce) noexcept {
+
+	// Go through all nonces
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfNonces))) buffer[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)];
+	for(unsigned int i = 0; i < numberOfNonces; ++i) {
+	
+		// Set nonce's buffer to nonce part with the nonce
+		uint64_t nonceBuffer[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)];
+		memcpy(nonceBuffer, midstate.noncePart, sizeof(nonceBuffer));
+		setBlake2bNoncePartNonce(nonceBuffer, firstNonce + i);
+		
+		// Go through all of the nonce's buffer's values
+		for(uint_fast8_t j = 0; j < BLAKE2B_BUFFER_SIZE / sizeof(uint64_t); ++j) {
+		
+			// Set value in the nonce's lane of the buffer
+			buffer[j][i] = nonceBuffer[j];
+		}
+	}
+	
+	// Go through all of the working state's values (Each value of the working state is in its own vector with each nonce in its own lane)
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfNonces))) workingState[sizeof(BLAKE2B_INITIAL_WORKING_STATE) / sizeof(BLAKE2B_INITIAL_WORKING_STATE[0])] = {};
+	for(uint_fast8_t i = 0; i < BLAKE2B_COMPONENTS_PER_VECTOR; ++i) {
+	
+		// Set all lanes of the working state's values to the state and initial working state
+		workingState[i] += midstate.stateFirstHalf[i];
+		workingState[BLAKE2B_COMPONENTS_PER_VECTOR + i] += midstate.stateSecondHalf[i];
+		workingState[BLAKE2B_COMPONENTS_PER_VECTOR * 2 + i] += BLAKE2B_INITIAL_WORKING_STATE[BLAKE2B_COMPONENTS_PER_VECTOR * 2 + i];
+		workingState[BLAKE2B_COMPONENTS_PER_VECTOR * 3 + i] += BLAKE2B_INITIAL_WORKING_STATE[BLAKE2B_COMPONENTS_PER_VECTOR * 3 + i];
+	}
+	
+	// Set working state's counter to the header and nonce's size and set that the nonce part is the last part
+	workingState[BLAKE2B_COMPONENTS_PER_VECTOR * 3] ^= BLAKE2B_BUFFER_SIZE ^ (HEADER_SIZE + sizeof(firstNonce));
+	workingState[BLAKE2B_COMPONENTS_PER_VECTOR * 3 + 2] ^= UINT64_MAX;
+	
+	// Go through all rounds
+	for(uint_fast8_t i = 0; i < BLAKE2B_NUMBER_OF_ROUNDS; ++i) {
+	
+		// Perform column steps
+		blake2bStep<numberOfNonces>(workingState[0], workingState[4], workingState[8], workingState[12], buffer[BLAKE2B_SIGMA[i][0]], buffer[BLAKE2B_SIGMA[i][1]]);
+		blake2bStep<numberOfNonces>(workingState[1], workingState[5], workingState[9], workingState[13], buffer[BLAKE2B_SIGMA[i][2]], buffer[BLAKE2B_SIGMA[i][3]]);
+		blake2bStep<numberOfNonces>(workingState[2], workingState[6], workingState[10], workingState[14], buffer[BLAKE2B_SIGMA[i][4]], buffer[BLAKE2B_SIGMA[i][5]]);
+		blake2bStep<numberOfNonces>(workingState[3], workingState[7], workingState[11], workingState[15], buffer[BLAKE2B_SIGMA[i][6]], buffer[BLAKE2B_SIGMA[i][7]]);
+		
+		// Perform diagonal steps
+		blake2bStep<numberOfNonces>(workingState[0], workingState[5], workingState[10], workingState[15], buffer[BLAKE2B_SIGMA[i][8]], buffer[BLAKE2B_SIGMA[i][9]]);
+		blake2bStep<numberOfNonces>(workingState[1], workingState[6], workingState[11], workingState[12], buffer[BLAKE2B_SIGMA[i][10]], buffer[BLAKE2B_SIGMA[i][11]]);
+		blake2bStep<numberOfNonces>(workingState[2], workingState[7], workingState[8], workingState[13], buffer[BLAKE2B_SIGMA[i][12]], buffer[BLAKE2B_SIGMA[i][13]]);
+		blake2bStep<numberOfNonces>(workingState[3], workingState[4], workingState[9], workingState[14], buffer[BLAKE2B_SIGMA[i][14]], buffer[BLAKE2B_SIGMA[i][15]]);
+	}
+	
+	// Go through all nonces
+	for(unsigned int i = 0; i < numberOfNonces; ++i) {
+	
+		// Get nonce's result from the nonce's lane of the working state
+		results[i] = midstate.stateFirstHalf ^ (const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR)))){workingState[0][i] ^ workingState[8][i], workingState[1][i] ^ workingState[9][i], workingState[2][i] ^ workingState[10][i], workingState[3][i] ^ workingState[11][i]};
+	}
+}
+
+// Set BLAKE2b nonce part's nonce
+void setBlake2bNoncePartNonce(uint64_t noncePart[BLAKE2B_BUFFER_SIZE / sizeof(uint64_t)], uint64_t nonce) noexcept {
+
+	// Check if using Windows
+	#ifdef _WIN32
+	
+		// Make nonce big endian
+		nonce = _byteswap_uint64(nonce);
+		
+	// Otherwise check if using an Apple device
+	#elif defined __APPLE__
+	
+		// Make nonce big endian
+		nonce = OSSwapHostToBigInt64(nonce);
+		
+	// Otherwise
+	#else
+	
+		// Make nonce big endian
+		nonce = htobe64(nonce);
+	#endif
+	
+	// Append nonce in big endian to the end of the header in the nonce part
+	memcpy(&reinterpret_cast<uint8_t *>(noncePart)[HEADER_SIZE - BLAKE2B_BUFFER_SIZE * BLAKE2B_NUMBER_OF_HEADER_PARTS_BEFORE_NONCE_PART], &nonce, sizeof(nonce));
 }
 
 // BLAKE2b step
-void blake2bStep(uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ a, uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ b, uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ c, uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ d, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ x, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * BLAKE2B_COMPONENTS_PER_VECTOR))) &__restrict__ y) noexcept {
+template<const unsigned int numberOfComponents> void blake2bStep(uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ a, uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ b, uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ c, uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ d, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ x, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * numberOfComponents))) &__restrict__ y) noexcept {
 
 	// Perform step on values
 	a += b + x;
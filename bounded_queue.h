@@ -0,0 +1,191 @@
+// Header guard
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Bounded queue class (Lock-free multiple producer and multiple consumer queue where each cell's sequence number says if it's ready to be written to or read from, so producers and consumers only contend on their own position)
+template<typename ValueType> class BoundedQueue final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit BoundedQueue(const size_t minimumCapacity) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Push
+		inline void push(const ValueType &value) noexcept;
+		
+		// Pop
+		inline void pop(ValueType &value) noexcept;
+		
+	// Private
+	private:
+	
+		// Cell
+		struct Cell {
+		
+			// Sequence
+			atomic<size_t> sequence;
+			
+			// Value
+			ValueType value;
+		};
+		
+		// Mask
+		const size_t mask;
+		
+		// Cells
+		const unique_ptr<Cell[]> cells;
+		
+		// Enqueue position (This is on a different cache line than the dequeue position since they're written by different threads)
+		alignas(64) atomic<size_t> enqueuePosition;
+		
+		// Dequeue position
+		alignas(64) atomic<size_t> dequeuePosition;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+template<typename ValueType> BoundedQueue<ValueType>::BoundedQueue(const size_t minimumCapacity) noexcept :
+
+	// Set mask to the capacity rounded up to a power of two minus one
+	mask(bit_ceil(max(minimumCapacity, static_cast<size_t>(2))) - 1),
+	
+	// Create cells
+	cells(new(nothrow) Cell[mask + 1]),
+	
+	// Set enqueue position to zero
+	enqueuePosition(0),
+	
+	// Set dequeue position to zero
+	dequeuePosition(0)
+{
+
+	// Check if creating cells was successful
+	if(cells) {
+	
+		// Go through all cells
+		for(size_t i = 0; i <= mask; ++i) {
+		
+			// Set that the cell is ready to be written to at its position
+			cells[i].sequence.store(i, memory_order_relaxed);
+		}
+	}
+}
+
+// Bool operator
+template<typename ValueType> BoundedQueue<ValueType>::operator bool() const noexcept {
+
+	// Return if cells exist
+	return static_cast<bool>(cells);
+}
+
+// Push
+template<typename ValueType> void BoundedQueue<ValueType>::push(const ValueType &value) noexcept {
+
+	// Loop forever
+	for(size_t position = enqueuePosition.load(memory_order_relaxed);;) {
+	
+		// Check if cell at the position is ready to be written to
+		Cell &cell = cells[position & mask];
+		const size_t sequence = cell.sequence.load(memory_order_acquire);
+		const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+		if(!difference) {
+		
+			// Check if claiming the position was successful
+			if(enqueuePosition.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+			
+				// Set cell's value
+				cell.value = value;
+				
+				// Set that the cell is ready to be read from (This releases the cell's value to the consumer)
+				cell.sequence.store(position + 1, memory_order_release);
+				
+				// Notify consumers that are sleeping
+				cell.sequence.notify_all();
+				
+				// Return
+				return;
+			}
+		}
+		
+		// Otherwise check if the queue is full
+		else if(difference < 0) {
+		
+			// Sleep until the cell is read from
+			cell.sequence.wait(sequence, memory_order_acquire);
+			
+			// Get enqueue position
+			position = enqueuePosition.load(memory_order_relaxed);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Get enqueue position since another producer claimed the position
+			position = enqueuePosition.load(memory_order_relaxed);
+		}
+	}
+}
+
+// Pop
+template<typename ValueType> void BoundedQueue<ValueType>::pop(ValueType &value) noexcept {
+
+	// Loop forever
+	for(size_t position = dequeuePosition.load(memory_order_relaxed);;) {
+	
+		// Check if cell at the position is ready to be read from
+		Cell &cell = cells[position & mask];
+		const size_t sequence = cell.sequence.load(memory_order_acquire);
+		const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - (position + 1));
+		if(!difference) {
+		
+			// Check if claiming the position was successful
+			if(dequeuePosition.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+			
+				// Get cell's value
+				value = cell.value;
+				
+				// Set that the cell is ready to be written to when the queue wraps around to it (This releases the cell to the producer)
+				cell.sequence.store(position + mask + 1, memory_order_release);
+				
+				// Notify producers that are sleeping
+				cell.sequence.notify_all();
+				
+				// Return
+				return;
+			}
+		}
+		
+		// Otherwise check if the queue is empty
+		else if(difference < 0) {
+		
+			// Sleep until the cell is written to
+			cell.sequence.wait(sequence, memory_order_acquire);
+			
+			// Get dequeue position
+			position = dequeuePosition.load(memory_order_relaxed);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Get dequeue position since another consumer claimed the position
+			position = dequeuePosition.load(memory_order_relaxed);
+		}
+	}
+}
+
+
+#endif
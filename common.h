@@ -21,6 +21,9 @@ using namespace std;
 // Min local RAM kilobytes
 #define MIN_LOCAL_RAM_KILOBYTES 32
 
+// Max local RAM kilobytes
+#define MAX_LOCAL_RAM_KILOBYTES 256
+
 
 // Checks
 
@@ -42,12 +45,23 @@ static_assert(SLEAN_TRIMMING_PARTS >= 2 && SLEAN_TRIMMING_PARTS <= MAX_SLEAN_TRI
 static_assert(has_single_bit(static_cast<unsigned int>(SLEAN_TRIMMING_PARTS)), "Slean trimming parts isn't a power of two");
 
 // Throw error if local RAM kilobytes is invalid
-static_assert(LOCAL_RAM_KILOBYTES >= MIN_LOCAL_RAM_KILOBYTES && LOCAL_RAM_KILOBYTES <= 256, "Local RAM kilobytes is outside of the accepted range");
+static_assert(LOCAL_RAM_KILOBYTES >= MIN_LOCAL_RAM_KILOBYTES && LOCAL_RAM_KILOBYTES <= MAX_LOCAL_RAM_KILOBYTES, "Local RAM kilobytes is outside of the accepted range");
 static_assert(has_single_bit(static_cast<unsigned int>(LOCAL_RAM_KILOBYTES)), "Local RAM kilobytes isn't a power of two");
 
 // Throw error if stratum server number of mining algorithms is invalid
 static_assert(STRATUM_SERVER_NUMBER_OF_MINING_ALGORITHMS >= 1 && STRATUM_SERVER_NUMBER_OF_MINING_ALGORITHMS <= 10, "Stratum server number of mining algorithms is outside of the accepted range");
 
+// Check if using CPU feature dispatch
+#ifdef USE_CPU_FEATURE_DISPATCH
+
+	// Check if compiler isn't GCC or host isn't an x86-64 CPU that uses ELF binaries
+	#if defined __clang__ || !defined __x86_64__ || !defined __ELF__
+	
+		// Throw error if CPU feature dispatch isn't supported
+		static_assert(false, "CPU feature dispatch isn't supported for this host");
+	#endif
+#endif
+
 // Throw error if the size of a vector of a type isn't the same as the size of an array of that type
 static_assert(sizeof(uint64_t __attribute__((vector_size(8)))) == sizeof(uint64_t[1]), "Vector vs array size mismatch");
 
@@ -97,6 +111,19 @@ static_assert(sizeof(uint64_t __attribute__((vector_size(8)))) == sizeof(uint64_
 // Node mask
 #define NODE_MASK (NUMBER_OF_EDGES - 1)
 
+// Check if using CPU feature dispatch
+#ifdef USE_CPU_FEATURE_DISPATCH
+
+	// CPU feature dispatch variants (Functions with these variants are compiled for each x86-64 microarchitecture level, and the variant for the best level that the CPU supports is chosen when this program starts)
+	#define CPU_FEATURE_DISPATCH_VARIANTS __attribute__((target_clones("arch=x86-64-v4", "arch=x86-64-v3", "arch=x86-64-v2", "default")))
+	
+// Otherwise
+#else
+
+	// CPU feature dispatch variants
+	#define CPU_FEATURE_DISPATCH_VARIANTS
+#endif
+
 // BLAKE2b hash size
 #define BLAKE2B_HASH_SIZE 32
 
@@ -144,6 +171,13 @@ static_assert(sizeof(uint64_t __attribute__((vector_size(8)))) == sizeof(uint64_
 // GNOME inhibit suspending session
 #define GNOME_INHIBIT_SUSPENDING_SESSION (1 << 2)
 
+// Check if not using an Apple device or using OpenCL
+#if !defined __APPLE__ || defined USE_OPENCL
+
+	// OpenCL CPU device work items per vector lane
+	#define OPENCL_CPU_DEVICE_WORK_ITEMS_PER_VECTOR_LANE 16
+#endif
+
 
 // Classes
 
@@ -290,6 +324,16 @@ static inline unsigned int getNumberOfCpuCores() noexcept;
 // Get number of high performance CPU cores
 static inline unsigned int getNumberOfHighPerformanceCpuCores() noexcept;
 
+// Check if not using an Apple device or using OpenCL
+#if !defined __APPLE__ || defined USE_OPENCL
+
+	// Get OpenCL device max work group size
+	static inline bool getOpenClDeviceMaxWorkGroupSize(const cl_device_id device, size_t &maxWorkGroupSize) noexcept;
+	
+	// Get OpenCL device work group memory size
+	static inline bool getOpenClDeviceWorkGroupMemorySize(const cl_device_id device, cl_ulong &workGroupMemorySize) noexcept;
+#endif
+
 
 // Supporting function implementation
 
@@ -805,5 +849,69 @@ unsigned int getNumberOfHighPerformanceCpuCores() noexcept {
 	return max(thread::hardware_concurrency(), static_cast<unsigned int>(1));
 }
 
+// Check if not using an Apple device or using OpenCL
+#if !defined __APPLE__ || defined USE_OPENCL
+
+	// Get OpenCL device max work group size
+	bool getOpenClDeviceMaxWorkGroupSize(const cl_device_id device, size_t &maxWorkGroupSize) noexcept {
+	
+		// Check if getting device's max work group size or type failed, or its max work group size doesn't exist
+		cl_device_type type;
+		if(clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(maxWorkGroupSize), &maxWorkGroupSize, nullptr) != CL_SUCCESS || clGetDeviceInfo(device, CL_DEVICE_TYPE, sizeof(type), &type, nullptr) != CL_SUCCESS || !maxWorkGroupSize) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if device is a CPU
+		if(type & CL_DEVICE_TYPE_CPU) {
+		
+			// Check if getting device's preferred int vector width failed
+			cl_uint preferredVectorWidth;
+			if(clGetDeviceInfo(device, CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT, sizeof(preferredVectorWidth), &preferredVectorWidth, nullptr) != CL_SUCCESS) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Limit max work group size to a few work items per vector lane since CPU runtimes run each work group as a loop on one core and vectorize across its work items
+			maxWorkGroupSize = min(maxWorkGroupSize, static_cast<size_t>(bit_floor(max(preferredVectorWidth, static_cast<cl_uint>(1)))) * OPENCL_CPU_DEVICE_WORK_ITEMS_PER_VECTOR_LANE);
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Get OpenCL device work group memory size
+	bool getOpenClDeviceWorkGroupMemorySize(const cl_device_id device, cl_ulong &workGroupMemorySize) noexcept {
+	
+		// Check if getting device's work group memory size or type failed
+		cl_device_type type;
+		if(clGetDeviceInfo(device, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(workGroupMemorySize), &workGroupMemorySize, nullptr) != CL_SUCCESS || clGetDeviceInfo(device, CL_DEVICE_TYPE, sizeof(type), &type, nullptr) != CL_SUCCESS) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if device is a CPU
+		if(type & CL_DEVICE_TYPE_CPU) {
+		
+			// Check if getting device's cache size failed
+			cl_ulong cacheSize;
+			if(clGetDeviceInfo(device, CL_DEVICE_GLOBAL_MEM_CACHE_SIZE, sizeof(cacheSize), &cacheSize, nullptr) != CL_SUCCESS) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Limit work group memory size to what fits in the CPU's cache since CPU runtimes emulate local memory with regular memory
+			workGroupMemorySize = min(workGroupMemorySize, clamp(cacheSize, static_cast<cl_ulong>(LOCAL_RAM_KILOBYTES * BYTES_IN_A_KILOBYTE), static_cast<cl_ulong>(MAX_LOCAL_RAM_KILOBYTES * BYTES_IN_A_KILOBYTE)));
+		}
+		
+		// Return true
+		return true;
+	}
+#endif
+
 
 #endif
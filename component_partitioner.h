@@ -0,0 +1,754 @@
+// Header guard
+#ifndef COMPONENT_PARTITIONER_H
+#define COMPONENT_PARTITIONER_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Component partitioner class (Finds the connected components of renamed edges' node pairs and gives each thread whole components that contain a cycle and have at least the minimum number of edges, and edges that have been removed aren't part of any component. The largest component is split across threads instead when it has more edges than an even share of them, and since a cycle is found when its last edge is searched, the first thread searches most of the component's edges and the following threads search halving shares of the rest after adding all of the component's edges before theirs. Partitioning is skipped and all edges that haven't been removed are split across threads that way when there's too few edges to have more than one component with enough edges, or when the split component had most of the edges the last time that it was done since most graphs have one component that contains most of their edges)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> class ComponentPartitioner final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit ComponentPartitioner(const unsigned int numberOfThreads) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Partition
+		inline void partition(const uint32_t *edges, const uint64_t numberOfEdges, const bool *edgesRemoved, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+		// Get thread's edges
+		inline const uint32_t *getThreadsEdges(const unsigned int threadIndex) const noexcept;
+		
+		// Get thread's number of edges
+		inline uint32_t getThreadsNumberOfEdges(const unsigned int threadIndex) const noexcept;
+		
+		// Get thread's preceding edges
+		inline const uint32_t *getThreadsPrecedingEdges(const unsigned int threadIndex) const noexcept;
+		
+		// Get thread's number of preceding edges
+		inline uint32_t getThreadsNumberOfPrecedingEdges(const unsigned int threadIndex) const noexcept;
+		
+	// Private
+	private:
+	
+		// Cycle flag
+		static const uint32_t CYCLE_FLAG;
+		
+		// No thread
+		static const uint32_t NO_THREAD;
+		
+		// Split component thread
+		static const uint32_t SPLIT_COMPONENT_THREAD;
+		
+		// No component
+		static const uint32_t NO_COMPONENT;
+		
+		// First thread search split component's edges percent
+		static const double FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT;
+		
+		// Maximum number of threads searching split component's edges
+		static const unsigned int MAXIMUM_NUMBER_OF_THREADS_SEARCHING_SPLIT_COMPONENTS_EDGES;
+		
+		// Number of skipped partitions
+		static const uint32_t NUMBER_OF_SKIPPED_PARTITIONS;
+		
+		// Number of cached components
+		static const uint32_t NUMBER_OF_CACHED_COMPONENTS;
+		
+		// Find
+		inline uint32_t find(uint32_t vertex) noexcept;
+		
+		// Join
+		inline bool join(uint32_t firstVertex, uint32_t secondVertex) noexcept;
+		
+		// Add component's number of edges
+		inline void addComponentsNumberOfEdges(const uint32_t component, const uint32_t numberOfEdges) noexcept;
+		
+		// Get edge's thread
+		inline uint32_t getEdgesThread(const uint64_t edge, const bool *edgesRemoved, const bool partitioned) const noexcept;
+		
+		// Get thread's split component's edges
+		inline void getThreadsSplitComponentsEdges(const uint32_t numberOfSplitComponentsEdges, const unsigned int threadIndex, uint32_t &splitComponentsEdgesStart, uint32_t &splitComponentsEdgesEnd) const noexcept;
+		
+		// Gather
+		inline void gather(const uint64_t numberOfEdges, const bool *edgesRemoved, const bool partitioned, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Vertices (Each vertex is a node pair, and each vertex is its parent while joining, its component's number of edges combined with the cycle flag while counting, and its component's thread or the split component thread after counting)
+		unique_ptr<uint32_t[]> vertices;
+		
+		// Edges' components (Each edge's component is combined with the cycle flag if the edge joined two vertices that were already in the same component)
+		unique_ptr<uint32_t[]> edgesComponents;
+		
+		// Components (Each component is its number of edges in the upper 32 bits and its vertex in the lower 32 bits)
+		unique_ptr<uint64_t[]> components;
+		
+		// Number of components
+		uint32_t numberOfComponents;
+		
+		// Number of component edges (This is the number of edges that haven't been removed)
+		uint32_t numberOfComponentEdges;
+		
+		// Split component's edges (The split component's edges are in the order that they appear in the edges so that each thread can add the ones before its share of them)
+		unique_ptr<uint32_t[]> splitComponentsEdges;
+		
+		// Threads' edges (Each thread's share of the split component's edges is followed by its components' edges, and both are in the order that they appear in the edges)
+		unique_ptr<uint32_t[]> threadsEdges;
+		
+		// Threads' edges start
+		unique_ptr<uint32_t[]> threadsEdgesStart;
+		
+		// Threads' number of edges
+		unique_ptr<uint32_t[]> threadsNumberOfEdges;
+		
+		// Threads' split component's edges start
+		unique_ptr<uint32_t[]> threadsSplitComponentsEdgesStart;
+		
+		// Threads' split component's edges end
+		unique_ptr<uint32_t[]> threadsSplitComponentsEdgesEnd;
+		
+		// Ranges' number of edges (Each thread's edge range has the number of its edges that were given to each thread followed by the number of its edges in the split component so that threads can append their edges to the threads' edges and the split component's edges at offsets gotten from a prefix sum of them)
+		unique_ptr<uint32_t[]> rangesNumberOfEdges;
+		
+		// Threads' number of partitions to skip (Each thread keeps its own count so that all threads skip the same partitions without synchronizing)
+		unique_ptr<uint32_t[]> threadsNumberOfPartitionsToSkip;
+		
+		// Split component has most edges
+		bool splitComponentHasMostEdges;
+};
+
+
+// Constants
+
+// Component partitioner cycle flag
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::CYCLE_FLAG = static_cast<uint32_t>(1) << 31;
+
+// Component partitioner no thread
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::NO_THREAD = UINT32_MAX;
+
+// Component partitioner split component thread
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::SPLIT_COMPONENT_THREAD = UINT32_MAX - 1;
+
+// Component partitioner no component
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::NO_COMPONENT = UINT32_MAX;
+
+// Component partitioner first thread search split component's edges percent (Adding the edges before a thread's share costs about as much as searching them since only edges that close a cycle in a large enough component are searched from, and most of that searching happens in the last few percent of the edges once the nodes have several connections, so the first thread searches nearly all of the edges and the following threads split the rest)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const double ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT = 0.97;
+
+// Component partitioner maximum number of threads searching split component's edges (Each thread after the first searches at most half as many of the split component's edges as the one before it while adding all of the edges before them, so more threads don't search enough edges to make up for that)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const unsigned int ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::MAXIMUM_NUMBER_OF_THREADS_SEARCHING_SPLIT_COMPONENTS_EDGES = 4;
+
+// Component partitioner number of skipped partitions (Partitioning is tried again after this many graphs when the split component had most of the edges)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::NUMBER_OF_SKIPPED_PARTITIONS = 63;
+
+// Component partitioner number of cached components (Threads count their edges' components' number of edges in a small cache before adding them to the shared counts since most edges are in one component)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::NUMBER_OF_CACHED_COMPONENTS = 64;
+
+
+// Supporting function implementation
+
+// Constructor
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::ComponentPartitioner(const unsigned int numberOfThreads) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Create vertices
+	vertices(new(nothrow) uint32_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2]),
+	
+	// Create edges' components
+	edgesComponents(new(nothrow) uint32_t[maximumNumberOfEdges]),
+	
+	// Create components
+	components(new(nothrow) uint64_t[maximumNumberOfEdges / minimumNumberOfComponentEdges + 1]),
+	
+	// Create split component's edges
+	splitComponentsEdges(new(nothrow) uint32_t[maximumNumberOfEdges]),
+	
+	// Create threads' edges
+	threadsEdges(new(nothrow) uint32_t[maximumNumberOfEdges]),
+	
+	// Create threads' edges start
+	threadsEdgesStart(new(nothrow) uint32_t[numberOfThreads]),
+	
+	// Create threads' number of edges
+	threadsNumberOfEdges(new(nothrow) uint32_t[numberOfThreads]),
+	
+	// Create threads' split component's edges start
+	threadsSplitComponentsEdgesStart(new(nothrow) uint32_t[numberOfThreads]),
+	
+	// Create threads' split component's edges end
+	threadsSplitComponentsEdgesEnd(new(nothrow) uint32_t[numberOfThreads]),
+	
+	// Create ranges' number of edges
+	rangesNumberOfEdges(new(nothrow) uint32_t[numberOfThreads * (numberOfThreads + 1)]),
+	
+	// Create threads' number of partitions to skip
+	threadsNumberOfPartitionsToSkip(new(nothrow) uint32_t[numberOfThreads]())
+{
+
+	// Throw error if maximum number of edges or minimum number of component edges is invalid
+	static_assert(maximumNumberOfEdges && maximumNumberOfEdges <= CYCLE_FLAG / 2 && minimumNumberOfComponentEdges, "Component partitioner's maximum number of edges or minimum number of component edges is invalid");
+}
+
+// Bool operator
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::operator bool() const noexcept {
+
+	// Return if creating vertices, edges' components, components, split component's edges, threads' edges, threads' edges start, threads' number of edges, threads' split component's edges start, threads' split component's edges end, ranges' number of edges, and threads' number of partitions to skip was successful
+	return vertices && edgesComponents && components && splitComponentsEdges && threadsEdges && threadsEdgesStart && threadsNumberOfEdges && threadsSplitComponentsEdgesStart && threadsSplitComponentsEdgesEnd && rangesNumberOfEdges && threadsNumberOfPartitionsToSkip;
+}
+
+// Partition
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> void ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::partition(const uint32_t *edges, const uint64_t numberOfEdges, const bool *edgesRemoved, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Check if there's only one thread
+	if(numberOfThreads == 1) {
+	
+		// Go through all edges
+		uint32_t *threadEdges = threadsEdges.get();
+		for(uint64_t edge = 0; edge < numberOfEdges; ++edge) {
+		
+			// Check if edge hasn't been removed
+			if(!edgesRemoved || !edgesRemoved[edge]) {
+			
+				// Append edge to the thread's edges
+				*threadEdges++ = edge;
+			}
+		}
+		
+		// Set thread's edges start, number of edges, and that it doesn't have any of a split component's edges
+		threadsEdgesStart[threadIndex] = 0;
+		threadsNumberOfEdges[threadIndex] = threadEdges - threadsEdges.get();
+		threadsSplitComponentsEdgesStart[threadIndex] = 0;
+		threadsSplitComponentsEdgesEnd[threadIndex] = 0;
+		
+		// Return
+		return;
+	}
+	
+	// Check if partitioning can't give threads different components or it's being skipped (Fewer than twice the minimum number of component edges can only have one component with enough edges)
+	if(numberOfEdges < static_cast<uint64_t>(minimumNumberOfComponentEdges) * 2 || threadsNumberOfPartitionsToSkip[threadIndex]) {
+	
+		// Check if partitioning is being skipped
+		if(threadsNumberOfPartitionsToSkip[threadIndex]) {
+		
+			// Decrement thread's number of partitions to skip
+			--threadsNumberOfPartitionsToSkip[threadIndex];
+		}
+		
+		// Split all edges that haven't been removed across threads
+		gather(numberOfEdges, edgesRemoved, false, threadIndex, threadsBarrier);
+		
+		// Return
+		return;
+	}
+	
+	// Get thread's edges start and end
+	const uint64_t edgesStart = min((numberOfEdges + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges);
+	const uint64_t edgesEnd = min((numberOfEdges + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges);
+	
+	// Get thread's vertices start and end (Vertices for the first partition's pairs are before the vertices for the second partition's pairs)
+	const uint64_t verticesStart = min((numberOfEdges * 2 + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges * 2);
+	const uint64_t verticesEnd = min((numberOfEdges * 2 + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges * 2);
+	
+	// Go through all of the thread's vertices
+	for(uint64_t vertex = verticesStart; vertex < verticesEnd; ++vertex) {
+	
+		// Set vertex to be the root of a component that only contains itself
+		vertices[vertex] = vertex;
+	}
+	
+	// Check if the first thread
+	if(!threadIndex) {
+	
+		// Set number of components and number of component edges to zero
+		numberOfComponents = 0;
+		numberOfComponentEdges = 0;
+	}
+	
+	// Wait for all threads to finish setting their vertices
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all of the thread's edges
+	for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+	
+		// Check if edge has been removed
+		if(edgesRemoved && edgesRemoved[edge]) {
+		
+			// Set that edge doesn't have a component
+			edgesComponents[edge] = NO_COMPONENT;
+			
+			// Continue
+			continue;
+		}
+		
+		// Join the edge's vertices and set that the edge is part of a cycle if they were already in the same component
+		edgesComponents[edge] = join(edges[edge * EDGE_NUMBER_OF_COMPONENTS + 1] >> 1, numberOfEdges + (edges[edge * EDGE_NUMBER_OF_COMPONENTS + 2] >> 1)) ? 0 : CYCLE_FLAG;
+	}
+	
+	// Wait for all threads to finish joining their edges' vertices
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all of the thread's edges
+	for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+	
+		// Check if edge has a component
+		if(edgesComponents[edge] != NO_COMPONENT) {
+		
+			// Set edge's component
+			edgesComponents[edge] |= find(edges[edge * EDGE_NUMBER_OF_COMPONENTS + 1] >> 1);
+		}
+	}
+	
+	// Wait for all threads to finish getting their edges' components
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all of the thread's vertices
+	for(uint64_t vertex = verticesStart; vertex < verticesEnd; ++vertex) {
+	
+		// Set vertex's component's number of edges to zero
+		vertices[vertex] = 0;
+	}
+	
+	// Wait for all threads to finish setting their components' number of edges to zero
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all cached components
+	uint32_t cachedComponents[NUMBER_OF_CACHED_COMPONENTS];
+	uint32_t cachedComponentsNumberOfEdges[NUMBER_OF_CACHED_COMPONENTS];
+	for(uint32_t i = 0; i < NUMBER_OF_CACHED_COMPONENTS; ++i) {
+	
+		// Set that cached component doesn't exist
+		cachedComponents[i] = NO_COMPONENT;
+	}
+	
+	// Go through all of the thread's edges
+	for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+	
+		// Check if edge has a component
+		if(edgesComponents[edge] != NO_COMPONENT) {
+		
+			// Check if edge's component isn't cached
+			const uint32_t component = edgesComponents[edge] & ~CYCLE_FLAG;
+			const uint32_t cacheIndex = component % NUMBER_OF_CACHED_COMPONENTS;
+			if(cachedComponents[cacheIndex] != component) {
+			
+				// Check if another component is cached at the component's index
+				if(cachedComponents[cacheIndex] != NO_COMPONENT) {
+				
+					// Add cached component's number of edges to the component's number of edges
+					addComponentsNumberOfEdges(cachedComponents[cacheIndex], cachedComponentsNumberOfEdges[cacheIndex]);
+				}
+				
+				// Cache the component
+				cachedComponents[cacheIndex] = component;
+				cachedComponentsNumberOfEdges[cacheIndex] = 0;
+			}
+			
+			// Increment cached component's number of edges and set that it contains a cycle if the edge is part of a cycle
+			cachedComponentsNumberOfEdges[cacheIndex] = (cachedComponentsNumberOfEdges[cacheIndex] + 1) | (edgesComponents[edge] & CYCLE_FLAG);
+		}
+	}
+	
+	// Go through all cached components
+	for(uint32_t i = 0; i < NUMBER_OF_CACHED_COMPONENTS; ++i) {
+	
+		// Check if cached component exists
+		if(cachedComponents[i] != NO_COMPONENT) {
+		
+			// Add cached component's number of edges to the component's number of edges
+			addComponentsNumberOfEdges(cachedComponents[i], cachedComponentsNumberOfEdges[i]);
+		}
+	}
+	
+	// Wait for all threads to finish counting their edges' components' number of edges
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all of the thread's vertices
+	uint32_t threadsNumberOfComponentEdges = 0;
+	for(uint64_t vertex = verticesStart; vertex < verticesEnd; ++vertex) {
+	
+		// Check if vertex's component contains a cycle and has enough edges
+		if((vertices[vertex] & CYCLE_FLAG) && (vertices[vertex] & ~CYCLE_FLAG) >= minimumNumberOfComponentEdges) {
+		
+			// Append component to the components
+			components[atomic_ref<uint32_t>(numberOfComponents).fetch_add(1, memory_order_relaxed)] = static_cast<uint64_t>(vertices[vertex] & ~CYCLE_FLAG) << 32 | vertex;
+		}
+		
+		// Add vertex's component's number of edges to the thread's number of component edges
+		threadsNumberOfComponentEdges += vertices[vertex] & ~CYCLE_FLAG;
+		
+		// Set that vertex's component doesn't have a thread
+		vertices[vertex] = NO_THREAD;
+	}
+	
+	// Add thread's number of component edges to the number of component edges
+	atomic_ref<uint32_t>(numberOfComponentEdges).fetch_add(threadsNumberOfComponentEdges, memory_order_relaxed);
+	
+	// Wait for all threads to finish finding their components that have enough edges
+	threadsBarrier.arrive_and_wait();
+	
+	// Check if the first thread
+	if(!threadIndex) {
+	
+		// Sort components in descending order of their number of edges
+		sort(components.get(), components.get() + numberOfComponents, greater<uint64_t>());
+		
+		// Go through all components
+		uint32_t numberOfGivenEdges = 0;
+		for(uint32_t i = 0; i < numberOfComponents; ++i) {
+		
+			// Add component's number of edges to the number of given edges
+			numberOfGivenEdges += components[i] >> 32;
+		}
+		
+		// Check if the largest component has more edges than an even share of the given edges
+		uint32_t threadsNumberOfGivenEdges[numberOfThreads];
+		uint32_t firstWholeComponent = 0;
+		if(numberOfComponents && (components[0] >> 32) * numberOfThreads > numberOfGivenEdges) {
+		
+			// Set that the largest component is split across threads
+			vertices[components[0] & UINT32_MAX] = SPLIT_COMPONENT_THREAD;
+			firstWholeComponent = 1;
+			
+			// Go through all threads
+			for(unsigned int currentThreadIndex = 0; currentThreadIndex < numberOfThreads; ++currentThreadIndex) {
+			
+				// Set thread's number of given edges to its share of the split component's edges
+				uint32_t splitComponentsEdgesStart;
+				uint32_t splitComponentsEdgesEnd;
+				getThreadsSplitComponentsEdges(components[0] >> 32, currentThreadIndex, splitComponentsEdgesStart, splitComponentsEdgesEnd);
+				threadsNumberOfGivenEdges[currentThreadIndex] = splitComponentsEdgesEnd - splitComponentsEdgesStart;
+			}
+			
+			// Set split component has most edges to if the split component has at least three quarters of the edges that have a component
+			splitComponentHasMostEdges = (components[0] >> 32) * 4 >= static_cast<uint64_t>(numberOfComponentEdges) * 3;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Go through all threads
+			for(unsigned int currentThreadIndex = 0; currentThreadIndex < numberOfThreads; ++currentThreadIndex) {
+			
+				// Set thread's number of given edges to zero
+				threadsNumberOfGivenEdges[currentThreadIndex] = 0;
+			}
+			
+			// Set split component has most edges to false
+			splitComponentHasMostEdges = false;
+		}
+		
+		// Go through all whole components
+		for(uint32_t i = firstWholeComponent; i < numberOfComponents; ++i) {
+		
+			// Go through all threads
+			unsigned int leastBusyThreadIndex = 0;
+			for(unsigned int currentThreadIndex = 1; currentThreadIndex < numberOfThreads; ++currentThreadIndex) {
+			
+				// Check if thread was given fewer edges than the least busy thread
+				if(threadsNumberOfGivenEdges[currentThreadIndex] < threadsNumberOfGivenEdges[leastBusyThreadIndex]) {
+				
+					// Set least busy thread to the thread
+					leastBusyThreadIndex = currentThreadIndex;
+				}
+			}
+			
+			// Give component to the least busy thread
+			vertices[components[i] & UINT32_MAX] = leastBusyThreadIndex;
+			threadsNumberOfGivenEdges[leastBusyThreadIndex] += components[i] >> 32;
+		}
+	}
+	
+	// Wait for the first thread to finish giving components to threads
+	threadsBarrier.arrive_and_wait();
+	
+	// Check if the split component had most of the edges
+	if(splitComponentHasMostEdges) {
+	
+		// Skip partitioning for the next graphs
+		threadsNumberOfPartitionsToSkip[threadIndex] = NUMBER_OF_SKIPPED_PARTITIONS;
+	}
+	
+	// Give threads their components' edges and their shares of the split component's edges
+	gather(numberOfEdges, edgesRemoved, true, threadIndex, threadsBarrier);
+}
+
+// Get thread's edges
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t *ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::getThreadsEdges(const unsigned int threadIndex) const noexcept {
+
+	// Return thread's edges
+	return &threadsEdges[threadsEdgesStart[threadIndex]];
+}
+
+// Get thread's number of edges
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::getThreadsNumberOfEdges(const unsigned int threadIndex) const noexcept {
+
+	// Return thread's number of edges
+	return threadsNumberOfEdges[threadIndex];
+}
+
+// Get thread's preceding edges (These are the split component's edges before the thread's share of them, and they must be added before the thread's edges are searched)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> const uint32_t *ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::getThreadsPrecedingEdges([[maybe_unused]] const unsigned int threadIndex) const noexcept {
+
+	// Return split component's edges
+	return splitComponentsEdges.get();
+}
+
+// Get thread's number of preceding edges
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::getThreadsNumberOfPrecedingEdges(const unsigned int threadIndex) const noexcept {
+
+	// Return the thread's split component's edges start if the thread has any of the split component's edges otherwise return zero
+	return (threadsSplitComponentsEdgesStart[threadIndex] < threadsSplitComponentsEdgesEnd[threadIndex]) ? threadsSplitComponentsEdgesStart[threadIndex] : 0;
+}
+
+// Find
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::find(uint32_t vertex) noexcept {
+
+	// Loop while vertex isn't a root
+	for(uint32_t parent = atomic_ref<uint32_t>(vertices[vertex]).load(memory_order_relaxed); parent != vertex; parent = atomic_ref<uint32_t>(vertices[vertex]).load(memory_order_relaxed)) {
+	
+		// Check if vertex's parent isn't a root
+		const uint32_t grandparent = atomic_ref<uint32_t>(vertices[parent]).load(memory_order_relaxed);
+		if(grandparent != parent) {
+		
+			// Set vertex's parent to its grandparent (Parents are always less than their children, so any ancestor is a valid parent even if another thread changed it)
+			atomic_ref<uint32_t>(vertices[vertex]).store(grandparent, memory_order_relaxed);
+		}
+		
+		// Go to vertex's parent
+		vertex = grandparent;
+	}
+	
+	// Return vertex
+	return vertex;
+}
+
+// Join
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> bool ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::join(uint32_t firstVertex, uint32_t secondVertex) noexcept {
+
+	// Loop forever
+	while(true) {
+	
+		// Get vertices' roots
+		firstVertex = find(firstVertex);
+		secondVertex = find(secondVertex);
+		
+		// Check if roots are the same
+		if(firstVertex == secondVertex) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if first root is less than the second root
+		if(firstVertex < secondVertex) {
+		
+			// Swap roots
+			swap(firstVertex, secondVertex);
+		}
+		
+		// Check if setting the first root's parent to the second root while it's still a root was successful
+		if(atomic_ref<uint32_t>(vertices[firstVertex]).compare_exchange_strong(firstVertex, secondVertex, memory_order_relaxed)) {
+		
+			// Return true
+			return true;
+		}
+	}
+}
+
+
+// Add component's number of edges
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> void ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::addComponentsNumberOfEdges(const uint32_t component, const uint32_t numberOfEdges) noexcept {
+
+	// Add number of edges to the component's number of edges
+	atomic_ref<uint32_t>(vertices[component]).fetch_add(numberOfEdges & ~CYCLE_FLAG, memory_order_relaxed);
+	
+	// Check if number of edges includes the cycle flag
+	if(numberOfEdges & CYCLE_FLAG) {
+	
+		// Set that component contains a cycle
+		atomic_ref<uint32_t>(vertices[component]).fetch_or(CYCLE_FLAG, memory_order_relaxed);
+	}
+}
+
+// Get edge's thread
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> uint32_t ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::getEdgesThread(const uint64_t edge, const bool *edgesRemoved, const bool partitioned) const noexcept {
+
+	// Check if partitioned
+	if(partitioned) {
+	
+		// Return no thread if the edge doesn't have a component otherwise return its component's thread
+		return (edgesComponents[edge] == NO_COMPONENT) ? NO_THREAD : vertices[edgesComponents[edge] & ~CYCLE_FLAG];
+	}
+	
+	// Otherwise
+	else {
+	
+		// Return no thread if the edge has been removed otherwise return the split component thread since all edges are split across threads
+		return (edgesRemoved && edgesRemoved[edge]) ? NO_THREAD : SPLIT_COMPONENT_THREAD;
+	}
+}
+
+// Get thread's split component's edges (The first thread searches the first percent of the split component's edges plus its share of the rest, and each following thread searches half as many of the rest as the one before it except for the last thread which searches the remaining ones)
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> void ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::getThreadsSplitComponentsEdges(const uint32_t numberOfSplitComponentsEdges, const unsigned int threadIndex, uint32_t &splitComponentsEdgesStart, uint32_t &splitComponentsEdgesEnd) const noexcept {
+
+	// Get number of threads searching split component's edges (Threads that would search less than one edge don't search any)
+	const unsigned int numberOfThreadsSearchingSplitComponentsEdges = min(min(numberOfThreads, MAXIMUM_NUMBER_OF_THREADS_SEARCHING_SPLIT_COMPONENTS_EDGES), 1 + static_cast<unsigned int>(ceil(log2(max(numberOfSplitComponentsEdges * (1 - FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT), 1.0)))));
+	
+	// Check if thread isn't searching split component's edges
+	if(threadIndex >= numberOfThreadsSearchingSplitComponentsEdges) {
+	
+		// Set thread's split component's edges start and end to the end of the split component's edges
+		splitComponentsEdgesStart = numberOfSplitComponentsEdges;
+		splitComponentsEdgesEnd = numberOfSplitComponentsEdges;
+		
+		// Return
+		return;
+	}
+	
+	// Get first thread's split component's edges end
+	const uint32_t firstThreadsSplitComponentsEdgesEnd = min(static_cast<uint32_t>(ceil(numberOfSplitComponentsEdges * FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT + numberOfSplitComponentsEdges * (1 - FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT) / pow(2, numberOfThreadsSearchingSplitComponentsEdges - 1))), numberOfSplitComponentsEdges);
+	
+	// Set thread's split component's edges start
+	splitComponentsEdgesStart = threadIndex ? min(firstThreadsSplitComponentsEdgesEnd + static_cast<uint32_t>((1 - 1 / pow(2, threadIndex - 1)) * numberOfSplitComponentsEdges * (1 - FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT)), numberOfSplitComponentsEdges) : 0;
+	
+	// Set thread's split component's edges end to the end of the split component's edges if it's the last thread searching them
+	splitComponentsEdgesEnd = (threadIndex == numberOfThreadsSearchingSplitComponentsEdges - 1) ? numberOfSplitComponentsEdges : min(firstThreadsSplitComponentsEdgesEnd + static_cast<uint32_t>((1 - 1 / pow(2, threadIndex)) * numberOfSplitComponentsEdges * (1 - FIRST_THREAD_SEARCH_SPLIT_COMPONENTS_EDGES_PERCENT)), numberOfSplitComponentsEdges);
+}
+
+// Gather
+template<const uint32_t maximumNumberOfEdges, const uint32_t minimumNumberOfComponentEdges> void ComponentPartitioner<maximumNumberOfEdges, minimumNumberOfComponentEdges>::gather(const uint64_t numberOfEdges, const bool *edgesRemoved, const bool partitioned, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Get thread's edges start and end
+	const uint64_t edgesStart = min((numberOfEdges + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges);
+	const uint64_t edgesEnd = min((numberOfEdges + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges);
+	
+	// Go through all threads and the split component
+	uint32_t *rangesThreadsNumberOfEdges = &rangesNumberOfEdges[threadIndex * (numberOfThreads + 1)];
+	for(unsigned int currentThreadIndex = 0; currentThreadIndex <= numberOfThreads; ++currentThreadIndex) {
+	
+		// Set thread's or split component's number of edges in the thread's edge range to zero
+		rangesThreadsNumberOfEdges[currentThreadIndex] = 0;
+	}
+	
+	// Go through all of the thread's edges
+	for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+	
+		// Check if edge was given to a thread
+		const uint32_t edgesThread = getEdgesThread(edge, edgesRemoved, partitioned);
+		if(edgesThread != NO_THREAD) {
+		
+			// Increment the split component's number of edges in the thread's edge range if the edge is in the split component otherwise increment its thread's
+			++rangesThreadsNumberOfEdges[(edgesThread == SPLIT_COMPONENT_THREAD) ? numberOfThreads : edgesThread];
+		}
+	}
+	
+	// Wait for all threads to finish counting their edges' threads
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all edge ranges
+	uint32_t numberOfSplitComponentsEdges = 0;
+	uint32_t splitComponentsEdgesIndex = 0;
+	for(unsigned int rangeIndex = 0; rangeIndex < numberOfThreads; ++rangeIndex) {
+	
+		// Check if edge range is before the thread's edge range
+		if(rangeIndex < threadIndex) {
+		
+			// Add split component's number of edges in the edge range to the split component's edges index
+			splitComponentsEdgesIndex += rangesNumberOfEdges[rangeIndex * (numberOfThreads + 1) + numberOfThreads];
+		}
+		
+		// Add split component's number of edges in the edge range to the split component's number of edges
+		numberOfSplitComponentsEdges += rangesNumberOfEdges[rangeIndex * (numberOfThreads + 1) + numberOfThreads];
+	}
+	
+	// Go through all threads
+	uint32_t threadsSplitComponentsEdgesStartIndices[numberOfThreads];
+	uint32_t threadsSplitComponentsEdgesEnds[numberOfThreads];
+	uint32_t threadsEdgesIndices[numberOfThreads];
+	for(uint32_t currentThreadIndex = 0, nextEdgesStart = 0; currentThreadIndex < numberOfThreads; ++currentThreadIndex) {
+	
+		// Get thread's split component's edges
+		uint32_t splitComponentsEdgesStart;
+		getThreadsSplitComponentsEdges(numberOfSplitComponentsEdges, currentThreadIndex, splitComponentsEdgesStart, threadsSplitComponentsEdgesEnds[currentThreadIndex]);
+		
+		// Set thread's split component's edges start index to where the split component's edge at the start of the thread's share of them goes in the threads' edges (Each thread's share of the split component's edges is before its components' edges)
+		threadsSplitComponentsEdgesStartIndices[currentThreadIndex] = nextEdgesStart - splitComponentsEdgesStart;
+		
+		// Set thread's edges index to after the thread's share of the split component's edges
+		threadsEdgesIndices[currentThreadIndex] = nextEdgesStart + threadsSplitComponentsEdgesEnds[currentThreadIndex] - splitComponentsEdgesStart;
+		
+		// Go through all edge ranges
+		uint32_t currentThreadsNumberOfEdges = threadsSplitComponentsEdgesEnds[currentThreadIndex] - splitComponentsEdgesStart;
+		for(unsigned int rangeIndex = 0; rangeIndex < numberOfThreads; ++rangeIndex) {
+		
+			// Check if edge range is before the thread's edge range
+			if(rangeIndex < threadIndex) {
+			
+				// Add thread's number of edges in the edge range to the thread's edges index
+				threadsEdgesIndices[currentThreadIndex] += rangesNumberOfEdges[rangeIndex * (numberOfThreads + 1) + currentThreadIndex];
+			}
+			
+			// Add thread's number of edges in the edge range to the thread's number of edges
+			currentThreadsNumberOfEdges += rangesNumberOfEdges[rangeIndex * (numberOfThreads + 1) + currentThreadIndex];
+		}
+		
+		// Check if the thread
+		if(currentThreadIndex == threadIndex) {
+		
+			// Set thread's edges start, number of edges, and split component's edges start and end
+			threadsEdgesStart[threadIndex] = nextEdgesStart;
+			threadsNumberOfEdges[threadIndex] = currentThreadsNumberOfEdges;
+			threadsSplitComponentsEdgesStart[threadIndex] = splitComponentsEdgesStart;
+			threadsSplitComponentsEdgesEnd[threadIndex] = threadsSplitComponentsEdgesEnds[currentThreadIndex];
+		}
+		
+		// Go to next thread's edges start
+		nextEdgesStart += currentThreadsNumberOfEdges;
+	}
+	
+	// Go through all of the thread's edges
+	unsigned int splitComponentsEdgesThreadIndex = 0;
+	for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+	
+		// Check if edge is in the split component
+		const uint32_t edgesThread = getEdgesThread(edge, edgesRemoved, partitioned);
+		if(edgesThread == SPLIT_COMPONENT_THREAD) {
+		
+			// Loop while the edge is after the thread's share of the split component's edges
+			while(splitComponentsEdgesIndex >= threadsSplitComponentsEdgesEnds[splitComponentsEdgesThreadIndex]) {
+			
+				// Go to next thread
+				++splitComponentsEdgesThreadIndex;
+			}
+			
+			// Append edge to the split component's edges and to its thread's edges
+			threadsEdges[threadsSplitComponentsEdgesStartIndices[splitComponentsEdgesThreadIndex] + splitComponentsEdgesIndex] = edge;
+			splitComponentsEdges[splitComponentsEdgesIndex++] = edge;
+		}
+		
+		// Otherwise check if edge was given to a thread
+		else if(edgesThread != NO_THREAD) {
+		
+			// Append edge to its thread's edges
+			threadsEdges[threadsEdgesIndices[edgesThread]++] = edge;
+		}
+	}
+	
+	// Wait for all threads to finish appending their edges to the threads' edges
+	threadsBarrier.arrive_and_wait();
+}
+
+
+#endif
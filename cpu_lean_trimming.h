@@ -0,0 +1,519 @@
+// Header guard
+#ifndef CPU_LEAN_TRIMMING_H
+#define CPU_LEAN_TRIMMING_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// CPU lean trimming number of edges per SipHash (Edges' nodes are computed this many edges at a time so that SipHash-2-4 can use wide vectors)
+#define CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH 16
+
+// CPU lean trimming number of units per block (Trimming threads take this many units of the edges bitmap at a time so that they stream through it in blocks that fit in their cache)
+#define CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK min(static_cast<uint64_t>(512), EDGES_BITMAP_SIZE)
+
+
+// Constants
+
+// CPU lean trimming required RAM bytes
+#define CPU_LEAN_TRIMMING_REQUIRED_RAM_BYTES (NUMBER_OF_EDGES / BITS_IN_A_BYTE * 2)
+
+// CPU lean trimming number of blocks
+#define CPU_LEAN_TRIMMING_NUMBER_OF_BLOCKS ((EDGES_BITMAP_SIZE + CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK - 1) / CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK)
+
+
+// Function prototypes
+
+// Perform CPU lean trimming loop
+static inline bool performCpuLeanTrimmingLoop(const unsigned int numberOfThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const unsigned int cpuCoresNameOffset) noexcept;
+
+// CPU lean trim edges
+static inline bool cpuLeanTrimEdges(uint64_t *__restrict__ edgesBitmap, uint64_t *__restrict__ nodesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const unsigned int numberOfTrimmingRounds, const uint64_t height, bool &abandoned, uint64_t stepsNextBlock[2], const unsigned int threadIndex, const unsigned int numberOfThreads, barrier<> &threadsBarrier) noexcept;
+
+// CPU lean trim edges step one
+static inline CPU_FEATURE_DISPATCH_VARIANTS void cpuLeanTrimEdgesStepOne(uint64_t *__restrict__ nodesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept;
+
+// CPU lean trim edges step two
+static inline CPU_FEATURE_DISPATCH_VARIANTS void cpuLeanTrimEdgesStepTwo(uint64_t *__restrict__ edgesBitmap, const uint64_t *__restrict__ nodesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept;
+
+// CPU lean trim edges step three
+static inline CPU_FEATURE_DISPATCH_VARIANTS void cpuLeanTrimEdgesStepThree(const uint64_t *__restrict__ edgesBitmap, uint64_t *__restrict__ nodesBitmap, const uint8_t nodesInSecondPartition, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept;
+
+// CPU lean trim edges step four
+static inline CPU_FEATURE_DISPATCH_VARIANTS void cpuLeanTrimEdgesStepFour(uint64_t *__restrict__ edgesBitmap, const uint64_t *__restrict__ nodesBitmap, const uint8_t nodesInSecondPartition, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept;
+
+
+// Supporting function implementation
+
+// Perform CPU lean trimming loop
+bool performCpuLeanTrimmingLoop(const unsigned int numberOfThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const unsigned int cpuCoresNameOffset) noexcept {
+
+	// Check if creating edges bitmap or nodes bitmap failed
+	const unique_ptr<uint64_t[]> edgesBitmap(new(nothrow) uint64_t[EDGES_BITMAP_SIZE]);
+	const unique_ptr<uint64_t[]> nodesBitmap(new(nothrow) uint64_t[NUMBER_OF_EDGES / BITMAP_UNIT_WIDTH]);
+	if(!edgesBitmap || !nodesBitmap) {
+	
+		// Display message
+		cout << "Allocating memory failed." << endl;
+		
+		// Return false
+		return false;
+	}
+	
+	// Display message
+	cout << "Using " << numberOfThreads << " CPU core(s) for trimming: ";
+	
+	// Go through all trimming threads
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Check if using Windows
+		#ifdef _WIN32
+		
+			// Display message
+			cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
+			
+		// Otherwise check if using an Apple device
+		#elif defined __APPLE__
+		
+			// Display message
+			cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
+			
+		// Otherwise
+		#else
+		
+			// Display message
+			cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
+		#endif
+	}
+	
+	// Display new line
+	cout << endl;
+	
+	// Go through all trimming threads except the last one which is this thread
+	thread trimmingThreads[numberOfThreads - 1];
+	barrier trimmingThreadsBarrier(numberOfThreads);
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+	unsigned int numberOfTrimmingRounds;
+	uint64_t height;
+	bool abandoned;
+	uint64_t stepsNextBlock[2];
+	bool closeTrimmingThreads = false;
+	
+	for(unsigned int i = 0; i < numberOfThreads - 1; ++i) {
+	
+		// Create trimming thread
+		trimmingThreads[i] = thread([numberOfThreads, firstThreadIndex, numberOfApplicableCpuCores, edgesBitmap = edgesBitmap.get(), nodesBitmap = nodesBitmap.get(), &trimmingThreadsBarrier, &sipHashKeys, &numberOfTrimmingRounds, &height, &abandoned, &stepsNextBlock, &closeTrimmingThreads, trimmingThreadIndex = i]() noexcept {
+		
+			// Set thread's priority and affinity (Trimming works on any CPU core, so failing to do this isn't an error)
+			setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + trimmingThreadIndex) % numberOfApplicableCpuCores));
+			
+			// Loop forever
+			while(true) {
+			
+				// Wait until starting trimming threads
+				trimmingThreadsBarrier.arrive_and_wait();
+				
+				// Check if closing thread
+				if(closeTrimmingThreads) {
+				
+					// Return
+					return;
+				}
+				
+				// Trim edges
+				cpuLeanTrimEdges(edgesBitmap, nodesBitmap, sipHashKeys, numberOfTrimmingRounds, height, abandoned, stepsNextBlock, trimmingThreadIndex, numberOfThreads, trimmingThreadsBarrier);
+			}
+		});
+	}
+	
+	// Display message
+	cout << "Mining started" << endl << endl << "Mining info:" << endl << "\tMining rate:\t 0 graph(s)/second" << endl << "\tGraphs checked:\t 0" << endl;
+	
+	// Check if not tuning
+	#ifndef TUNING
+	
+		// Display message
+		cout << "\tSolutions found: 0" << endl;
+	#endif
+	
+	// Display message
+	cout << "Pipeline stages:" << endl;
+	
+	// Set previous graph processed time to now
+	previousGraphProcessedTime = chrono::high_resolution_clock::now();
+	
+	// While not closing
+	while(!closing) {
+	
+		// Record start time
+		const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+		
+		// Get SipHash keys from job's header and nonce
+		height = jobHeight;
+		const uint64_t id = jobId;
+		const uint64_t nonce = jobNonce++;
+		blake2b(sipHashKeys, jobHeaderMidstate, nonce);
+		
+		// Get number of trimming rounds (The pipeline balancer can change this between graphs)
+		numberOfTrimmingRounds = TRIMMING_ROUNDS + extraTrimmingRounds;
+		
+		// Start trimming threads
+		trimmingThreadsBarrier.arrive_and_wait();
+		
+		// Check if tuning
+		#ifdef TUNING
+		
+			// Trim edges
+			cpuLeanTrimEdges(edgesBitmap.get(), nodesBitmap.get(), sipHashKeys, numberOfTrimmingRounds, height, abandoned, stepsNextBlock, numberOfThreads - 1, numberOfThreads, trimmingThreadsBarrier);
+			
+		// Otherwise
+		#else
+		
+			// Trim edges
+			const bool trimmed = cpuLeanTrimEdges(edgesBitmap.get(), nodesBitmap.get(), sipHashKeys, numberOfTrimmingRounds, height, abandoned, stepsNextBlock, numberOfThreads - 1, numberOfThreads, trimmingThreadsBarrier);
+		#endif
+		
+		// Record end time
+		const chrono::high_resolution_clock::time_point endTime = chrono::high_resolution_clock::now();
+		
+		// Get trimming time
+		const double trimmingTime = static_cast<chrono::duration<double>>(endTime - startTime).count();
+		
+		// Check if not tuning
+		#ifndef TUNING
+		
+			// Check if trimming the graph wasn't abandoned
+			static double previousTrimmingTime;
+			if(trimmed) {
+			
+				// Update previous trimming time
+				previousTrimmingTime = trimmingTime;
+			}
+			
+			// Otherwise
+			else {
+			
+				// Add the trimming time that wasn't spent on the graph to the stale time saved (Trimming finished counts the graph as stale)
+				staleTimeSaved += max(previousTrimmingTime - trimmingTime, 0.0);
+			}
+		#endif
+		
+		// Display message
+		cout << "\tTrimming time:\t " << trimmingTime << " second(s)" << endl;
+		
+		// Trimming finished
+		trimmingFinished(edgesBitmap.get(), sipHashKeys, height, id, nonce);
+	}
+	
+	// Close trimming threads
+	closeTrimmingThreads = true;
+	trimmingThreadsBarrier.arrive_and_wait();
+	
+	// Go through all trimming threads except the last one which is this thread
+	for(unsigned int i = 0; i < numberOfThreads - 1; ++i) {
+	
+		// Join trimming thread
+		trimmingThreads[i].join();
+	}
+	
+	// Return true
+	return true;
+}
+
+// CPU lean trim edges
+bool cpuLeanTrimEdges(uint64_t *__restrict__ edgesBitmap, uint64_t *__restrict__ nodesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const unsigned int numberOfTrimmingRounds, const uint64_t height, bool &abandoned, uint64_t stepsNextBlock[2], const unsigned int threadIndex, const unsigned int numberOfThreads, barrier<> &threadsBarrier) noexcept {
+
+	// Get thread's nodes bitmap start and end
+	const uint64_t nodesBitmapStart = min((NUMBER_OF_EDGES / BITMAP_UNIT_WIDTH + numberOfThreads - 1) / numberOfThreads * threadIndex, NUMBER_OF_EDGES / BITMAP_UNIT_WIDTH);
+	const uint64_t nodesBitmapEnd = min((NUMBER_OF_EDGES / BITMAP_UNIT_WIDTH + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), NUMBER_OF_EDGES / BITMAP_UNIT_WIDTH);
+	
+	// Go through all trimming rounds
+	for(unsigned int i = 0; i < numberOfTrimmingRounds; ++i) {
+	
+		// Clear thread's nodes bitmap
+		memset(&nodesBitmap[nodesBitmapStart], 0, sizeof(uint64_t) * (nodesBitmapEnd - nodesBitmapStart));
+		
+		// Check if the first thread
+		if(!threadIndex) {
+		
+			// Set steps' next blocks to the first block (All threads finished the previous round's steps before this round started)
+			stepsNextBlock[0] = 0;
+			stepsNextBlock[1] = 0;
+			
+			// Set abandoned to if a job for a different block than the graph's was received (The other threads only read this after the next barrier, so they all stop at the same round)
+			abandoned = isStaleGraph(height);
+		}
+		
+		// Wait for all threads to finish clearing their nodes bitmap
+		threadsBarrier.arrive_and_wait();
+		
+		// Check if abandoned
+		if(abandoned) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if the first trimming round
+		if(!i) {
+		
+			// Perform step one
+			cpuLeanTrimEdgesStepOne(nodesBitmap, sipHashKeys, stepsNextBlock[0]);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Perform step three
+			cpuLeanTrimEdgesStepThree(edgesBitmap, nodesBitmap, i % 2, sipHashKeys, stepsNextBlock[0]);
+		}
+		
+		// Wait for all threads to finish setting their edges' nodes in the nodes bitmap
+		threadsBarrier.arrive_and_wait();
+		
+		// Check if the first trimming round
+		if(!i) {
+		
+			// Perform step two
+			cpuLeanTrimEdgesStepTwo(edgesBitmap, nodesBitmap, sipHashKeys, stepsNextBlock[1]);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Perform step four
+			cpuLeanTrimEdgesStepFour(edgesBitmap, nodesBitmap, i % 2, sipHashKeys, stepsNextBlock[1]);
+		}
+		
+		// Wait for all threads to finish removing their edges from the edges bitmap
+		threadsBarrier.arrive_and_wait();
+	}
+	
+	// Return true
+	return true;
+}
+
+// CPU lean trim edges step one
+void cpuLeanTrimEdgesStepOne(uint64_t *__restrict__ nodesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept {
+
+	// Throw error if CPU lean trimming number of edges per SipHash is invalid
+	static_assert(CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH && BITMAP_UNIT_WIDTH % CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH == 0, "CPU lean trimming number of edges per SipHash is invalid");
+	
+	// Go through all blocks that the thread gets
+	for(uint64_t block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED); block < CPU_LEAN_TRIMMING_NUMBER_OF_BLOCKS; block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED)) {
+	
+		// Go through all edges in the block
+		for(uint64_t edgeIndex = block * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK * BITMAP_UNIT_WIDTH; edgeIndex < min((block + 1) * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK, EDGES_BITMAP_SIZE) * BITMAP_UNIT_WIDTH; edgeIndex += CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+		
+			// Go through all edges that get their nodes at the same time
+			uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nonces;
+			for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+			
+				// Set edge's nonce from its index
+				nonces[i] = (edgeIndex + i) * 2;
+			}
+			
+			// Get nodes from the nonces
+			uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+			sipHash24<CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+			
+			// Go through all nodes
+			for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+			
+				// Prefetch node's unit in the nodes bitmap (Atomic operations wait for their unit, so this lets all of the nodes' units be fetched at the same time)
+				__builtin_prefetch(&nodesBitmap[nodes[i] / BITMAP_UNIT_WIDTH], 1);
+			}
+			
+			// Go through all nodes
+			for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+			
+				// Enable node in nodes bitmap
+				__atomic_fetch_or(&nodesBitmap[nodes[i] / BITMAP_UNIT_WIDTH], static_cast<uint64_t>(1) << (nodes[i] % BITMAP_UNIT_WIDTH), __ATOMIC_RELAXED);
+			}
+		}
+	}
+}
+
+// CPU lean trim edges step two
+void cpuLeanTrimEdgesStepTwo(uint64_t *__restrict__ edgesBitmap, const uint64_t *__restrict__ nodesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept {
+
+	// Go through all blocks that the thread gets
+	for(uint64_t block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED); block < CPU_LEAN_TRIMMING_NUMBER_OF_BLOCKS; block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED)) {
+	
+		// Go through all units in the block
+		for(uint64_t unitIndex = block * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK; unitIndex < min((block + 1) * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK, EDGES_BITMAP_SIZE); ++unitIndex) {
+		
+			// Go through all edges in the unit
+			uint64_t unit = 0;
+			for(uint_fast8_t unitBitIndex = 0; unitBitIndex < BITMAP_UNIT_WIDTH; unitBitIndex += CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+			
+				// Go through all edges that get their nodes at the same time
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nonces;
+				for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+				
+					// Set edge's nonce from its index
+					nonces[i] = (unitIndex * BITMAP_UNIT_WIDTH + unitBitIndex + i) * 2;
+				}
+				
+				// Get nodes from the nonces
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+				sipHash24<CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+				
+				// Go through all nodes
+				for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+				
+					// Enable edge if its node has a pair in the nodes bitmap
+					unit |= static_cast<uint64_t>((nodesBitmap[(nodes[i] ^ 1) / BITMAP_UNIT_WIDTH] >> ((nodes[i] ^ 1) % BITMAP_UNIT_WIDTH)) & 1) << (unitBitIndex + i);
+				}
+			}
+			
+			// Set unit in edges bitmap
+			edgesBitmap[unitIndex] = unit;
+		}
+	}
+}
+
+// CPU lean trim edges step three
+void cpuLeanTrimEdgesStepThree(const uint64_t *__restrict__ edgesBitmap, uint64_t *__restrict__ nodesBitmap, const uint8_t nodesInSecondPartition, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept {
+
+	// Go through all blocks that the thread gets (Edges from any of the thread's blocks can get their nodes at the same time)
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nonces = {};
+	uint_fast8_t numberOfEdgesWithoutNodes = 0;
+	for(uint64_t block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED); block < CPU_LEAN_TRIMMING_NUMBER_OF_BLOCKS; block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED)) {
+	
+		// Go through all units in the block
+		for(uint64_t unitIndex = block * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK; unitIndex < min((block + 1) * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK, EDGES_BITMAP_SIZE); ++unitIndex) {
+		
+			// Go through all enabled edges in the unit
+			uint64_t unit = edgesBitmap[unitIndex];
+			for(uint_fast8_t unitCurrentBitIndex = __builtin_ffsll(unit), unitPreviousBitIndex = 0; unitCurrentBitIndex; unit >>= unitCurrentBitIndex, unitPreviousBitIndex += unitCurrentBitIndex, unitCurrentBitIndex = __builtin_ffsll(unit)) {
+			
+				// Set edge's nonce from its index
+				nonces[numberOfEdgesWithoutNodes] = ((unitIndex * BITMAP_UNIT_WIDTH + (unitCurrentBitIndex - 1) + unitPreviousBitIndex) * 2) | nodesInSecondPartition;
+				
+				// Check if enough edges don't have their nodes set
+				if(++numberOfEdgesWithoutNodes == CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+				
+					// Get nodes from the nonces
+					uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+					sipHash24<CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+					
+					// Go through all nodes
+					for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+					
+						// Prefetch node's unit in the nodes bitmap (Atomic operations wait for their unit, so this lets all of the nodes' units be fetched at the same time)
+						__builtin_prefetch(&nodesBitmap[nodes[i] / BITMAP_UNIT_WIDTH], 1);
+					}
+					
+					// Go through all nodes
+					for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+					
+						// Enable node in nodes bitmap
+						__atomic_fetch_or(&nodesBitmap[nodes[i] / BITMAP_UNIT_WIDTH], static_cast<uint64_t>(1) << (nodes[i] % BITMAP_UNIT_WIDTH), __ATOMIC_RELAXED);
+					}
+					
+					// Set number of edges without nodes to zero
+					numberOfEdgesWithoutNodes = 0;
+				}
+				
+				// Check if shifting by the entire unit
+				if(unitCurrentBitIndex == BITMAP_UNIT_WIDTH) {
+				
+					// Break
+					break;
+				}
+			}
+		}
+	}
+	
+	// Check if edges don't have their nodes set
+	if(numberOfEdgesWithoutNodes) {
+	
+		// Get nodes from the nonces
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+		sipHash24<CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+		
+		// Go through all edges without nodes
+		for(uint_fast8_t i = 0; i < numberOfEdgesWithoutNodes; ++i) {
+		
+			// Enable edge's node in nodes bitmap
+			__atomic_fetch_or(&nodesBitmap[nodes[i] / BITMAP_UNIT_WIDTH], static_cast<uint64_t>(1) << (nodes[i] % BITMAP_UNIT_WIDTH), __ATOMIC_RELAXED);
+		}
+	}
+}
+
+// CPU lean trim edges step four
+void cpuLeanTrimEdgesStepFour(uint64_t *__restrict__ edgesBitmap, const uint64_t *__restrict__ nodesBitmap, const uint8_t nodesInSecondPartition, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, uint64_t &nextBlock) noexcept {
+
+	// Go through all blocks that the thread gets (The thread is the only one that changes the units in its blocks, so edges from any of them can get their nodes at the same time)
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nonces = {};
+	uint_fast8_t numberOfEdgesWithoutNodes = 0;
+	for(uint64_t block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED); block < CPU_LEAN_TRIMMING_NUMBER_OF_BLOCKS; block = __atomic_fetch_add(&nextBlock, 1, __ATOMIC_RELAXED)) {
+	
+		// Go through all units in the block
+		for(uint64_t unitIndex = block * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK; unitIndex < min((block + 1) * CPU_LEAN_TRIMMING_NUMBER_OF_UNITS_PER_BLOCK, EDGES_BITMAP_SIZE); ++unitIndex) {
+		
+			// Go through all enabled edges in the unit
+			uint64_t unit = edgesBitmap[unitIndex];
+			for(uint_fast8_t unitCurrentBitIndex = __builtin_ffsll(unit), unitPreviousBitIndex = 0; unitCurrentBitIndex; unit >>= unitCurrentBitIndex, unitPreviousBitIndex += unitCurrentBitIndex, unitCurrentBitIndex = __builtin_ffsll(unit)) {
+			
+				// Set edge's nonce from its index
+				nonces[numberOfEdgesWithoutNodes] = ((unitIndex * BITMAP_UNIT_WIDTH + (unitCurrentBitIndex - 1) + unitPreviousBitIndex) * 2) | nodesInSecondPartition;
+				
+				// Check if enough edges don't have their nodes checked
+				if(++numberOfEdgesWithoutNodes == CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+				
+					// Get nodes from the nonces
+					uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+					sipHash24<CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+					
+					// Go through all nodes
+					for(uint_fast8_t i = 0; i < CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+					
+						// Check if node doesn't have a pair in the nodes bitmap
+						if(!((nodesBitmap[(nodes[i] ^ 1) / BITMAP_UNIT_WIDTH] >> ((nodes[i] ^ 1) % BITMAP_UNIT_WIDTH)) & 1)) {
+						
+							// Disable edge in edges bitmap
+							edgesBitmap[nonces[i] / 2 / BITMAP_UNIT_WIDTH] &= ~(static_cast<uint64_t>(1) << ((nonces[i] / 2) % BITMAP_UNIT_WIDTH));
+						}
+					}
+					
+					// Set number of edges without nodes to zero
+					numberOfEdgesWithoutNodes = 0;
+				}
+				
+				// Check if shifting by the entire unit
+				if(unitCurrentBitIndex == BITMAP_UNIT_WIDTH) {
+				
+					// Break
+					break;
+				}
+			}
+		}
+	}
+	
+	// Check if edges don't have their nodes checked
+	if(numberOfEdgesWithoutNodes) {
+	
+		// Get nodes from the nonces
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+		sipHash24<CPU_LEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+		
+		// Go through all edges without nodes
+		for(uint_fast8_t i = 0; i < numberOfEdgesWithoutNodes; ++i) {
+		
+			// Check if edge's node doesn't have a pair in the nodes bitmap
+			if(!((nodesBitmap[(nodes[i] ^ 1) / BITMAP_UNIT_WIDTH] >> ((nodes[i] ^ 1) % BITMAP_UNIT_WIDTH)) & 1)) {
+			
+				// Disable edge in edges bitmap
+				edgesBitmap[nonces[i] / 2 / BITMAP_UNIT_WIDTH] &= ~(static_cast<uint64_t>(1) << ((nonces[i] / 2) % BITMAP_UNIT_WIDTH));
+			}
+		}
+	}
+}
+
+
+#endif
@@ -0,0 +1,718 @@
+// Header guard
+#ifndef CPU_MEAN_TRIMMING_H
+#define CPU_MEAN_TRIMMING_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// CPU mean trimming number of bitmap bytes (Each bucket's nodes bitmap should fit in a CPU core's L2 cache, and there's at least 16 buckets so that multiple threads can trim them)
+#define CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES min(static_cast<uint64_t>(256 * BYTES_IN_A_KILOBYTE), NUMBER_OF_EDGES / BITS_IN_A_BYTE / 16)
+
+// CPU mean trimming number of edges per SipHash (Edges' nodes are computed this many edges at a time so that SipHash-2-4 can use wide vectors)
+#define CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH 16
+
+// CPU mean trimming write combining buffer size (Each thread collects each bucket's edges in a buffer this size so that they're written to the bucket a cache line at a time)
+#define CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_SIZE 64
+
+
+// Constants
+
+// CPU mean trimming number of buckets
+#define CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS ((NUMBER_OF_EDGES / BITS_IN_A_BYTE) / CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES)
+
+// CPU mean trimming number of least significant bits ignored during bucket sorting
+#define CPU_MEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING (EDGE_BITS - bit_width(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS) + 1)
+
+// CPU mean trimming number of items per bucket
+#define CPU_MEAN_TRIMMING_NUMBER_OF_ITEMS_PER_BUCKET (NUMBER_OF_EDGES / CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS)
+
+// CPU mean trimming initial max number of edges per bucket
+#define CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET (static_cast<uint32_t>(CPU_MEAN_TRIMMING_NUMBER_OF_ITEMS_PER_BUCKET * 1.05))
+
+// CPU mean trimming after trimming round max number of edges per bucket
+#define CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET (static_cast<uint32_t>(CPU_MEAN_TRIMMING_NUMBER_OF_ITEMS_PER_BUCKET * 0.73))
+
+// CPU mean trimming write combining buffer number of words
+#define CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_NUMBER_OF_WORDS (CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_SIZE / sizeof(uint32_t))
+
+// CPU mean trimming required RAM bytes (Each thread also uses a bitmap, its bucket's nodes, and its write combining buffers)
+#define CPU_MEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + static_cast<uint64_t>(CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) * 2 + sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t))
+
+
+// Structures
+
+// CPU mean trimming write combining buffer structure
+struct alignas(CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_SIZE) CpuMeanTrimmingWriteCombiningBuffer {
+
+	// Words
+	uint32_t words[CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_NUMBER_OF_WORDS];
+};
+
+
+// Classes
+
+// CPU mean trimmer class (Performs mean trimming's bucket sort on the CPU. Edges are records of their index for the first two trimming rounds, their index and next partition's node for the third trimming round, and their index and both nodes for the remaining trimming rounds)
+class CpuMeanTrimmer final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit CpuMeanTrimmer(const unsigned int numberOfThreads) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Prepare
+		inline void prepare(const unsigned int threadIndex) noexcept;
+		
+		// Trim
+		inline void trim(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+		// Get remaining edges
+		inline const uint32_t *getRemainingEdges() const noexcept;
+		
+	// Private
+	private:
+	
+		// Trim edges step one
+		inline CPU_FEATURE_DISPATCH_VARIANTS void trimEdgesStepOne(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const unsigned int threadIndex) noexcept;
+		
+		// Trim edges round
+		template<const unsigned int sourceRecordSize, const unsigned int destinationRecordSize> inline CPU_FEATURE_DISPATCH_VARIANTS void trimEdgesRound(const uint32_t *sourceBuckets, uint32_t *numberOfEdgesPerSourceBucket, const uint32_t sourceBucketSize, uint32_t *destinationBuckets, uint32_t *numberOfEdgesPerDestinationBucket, const uint32_t destinationBucketSize, const uint8_t nodesInSecondPartition, const bool isLastRound, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const unsigned int threadIndex) noexcept;
+		
+		// Append record
+		template<const unsigned int recordSize> inline void appendRecord(const uint32_t record[recordSize], const uint32_t writeCombiningBufferIndex, uint32_t *bucket, uint32_t &numberOfEdgesInBucket, const uint64_t maxNumberOfEdgesInBucket) noexcept;
+		
+		// Flush write combining buffer
+		template<const unsigned int recordSize> inline void flushWriteCombiningBuffer(const uint32_t writeCombiningBufferIndex, uint32_t *bucket, uint32_t &numberOfEdgesInBucket, const uint64_t maxNumberOfEdgesInBucket) noexcept;
+		
+		// Flush write combining buffers
+		template<const unsigned int recordSize> inline void flushWriteCombiningBuffers(uint32_t *buckets, uint32_t *numberOfEdgesPerBucket, const uint32_t bucketSize, const unsigned int threadIndex) noexcept;
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Buckets one
+		unique_ptr<uint32_t[]> bucketsOne;
+		
+		// Number of edges per bucket one
+		unique_ptr<uint32_t[]> numberOfEdgesPerBucketOne;
+		
+		// Buckets two
+		unique_ptr<uint32_t[]> bucketsTwo;
+		
+		// Number of edges per bucket two
+		unique_ptr<uint32_t[]> numberOfEdgesPerBucketTwo;
+		
+		// Remaining edges (The first item is the number of remaining edges, and the rest are the remaining edges' indices and nodes)
+		unique_ptr<uint32_t[]> remainingEdges;
+		
+		// Threads' bitmaps
+		unique_ptr<uint64_t[]> threadsBitmaps;
+		
+		// Threads' nodes (Each thread's bucket's nodes are kept here when they're computed instead of being part of the bucket's records)
+		unique_ptr<uint32_t[]> threadsNodes;
+		
+		// Threads' write combining buffers (Each thread has one for each bucket and one for the remaining edges)
+		unique_ptr<CpuMeanTrimmingWriteCombiningBuffer[]> threadsWriteCombiningBuffers;
+		
+		// Threads' write combining buffers' number of words
+		unique_ptr<uint8_t[]> threadsWriteCombiningBuffersNumberOfWords;
+};
+
+
+// Function prototypes
+
+// Perform CPU mean trimming loop
+static inline bool performCpuMeanTrimmingLoop(const unsigned int numberOfThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const unsigned int cpuCoresNameOffset) noexcept;
+
+
+// Supporting function implementation
+
+// Constructor
+CpuMeanTrimmer::CpuMeanTrimmer(const unsigned int numberOfThreads) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Create buckets one
+	bucketsOne(new(nothrow) uint32_t[static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS]),
+	
+	// Create number of edges per bucket one
+	numberOfEdgesPerBucketOne(new(nothrow) uint32_t[CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS]),
+	
+	// Create buckets two
+	bucketsTwo(new(nothrow) uint32_t[static_cast<uint64_t>(CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS]),
+	
+	// Create number of edges per bucket two
+	numberOfEdgesPerBucketTwo(new(nothrow) uint32_t[CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS]),
+	
+	// Create remaining edges
+	remainingEdges(new(nothrow) uint32_t[1 + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS]),
+	
+	// Create threads' bitmaps
+	threadsBitmaps(new(nothrow) uint64_t[CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES / sizeof(uint64_t) * numberOfThreads]),
+	
+	// Create threads' nodes
+	threadsNodes(new(nothrow) uint32_t[static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * numberOfThreads]),
+	
+	// Create threads' write combining buffers
+	threadsWriteCombiningBuffers(new(nothrow) CpuMeanTrimmingWriteCombiningBuffer[(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * numberOfThreads]),
+	
+	// Create threads' write combining buffers' number of words
+	threadsWriteCombiningBuffersNumberOfWords(new(nothrow) uint8_t[(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * numberOfThreads])
+{
+
+	// Throw error if CPU mean trimming number of bitmap bytes is invalid
+	static_assert(CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES >= sizeof(uint64_t) && has_single_bit(CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES), "CPU mean trimming number of bitmap bytes is invalid");
+	
+	// Throw error if CPU mean trimming number of edges per SipHash is invalid
+	static_assert(CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH && NUMBER_OF_EDGES % CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH == 0, "CPU mean trimming number of edges per SipHash is invalid");
+	
+	// Throw error if CPU mean trimming write combining buffer size is invalid
+	static_assert(CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_NUMBER_OF_WORDS >= EDGE_NUMBER_OF_COMPONENTS && CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_NUMBER_OF_WORDS <= UINT8_MAX, "CPU mean trimming write combining buffer size is invalid");
+}
+
+// Bool operator
+CpuMeanTrimmer::operator bool() const noexcept {
+
+	// Return if creating buckets, number of edges per buckets, remaining edges, threads' bitmaps, threads' nodes, and threads' write combining buffers was successful
+	return bucketsOne && numberOfEdgesPerBucketOne && bucketsTwo && numberOfEdgesPerBucketTwo && remainingEdges && threadsBitmaps && threadsNodes && threadsWriteCombiningBuffers && threadsWriteCombiningBuffersNumberOfWords;
+}
+
+// Prepare
+void CpuMeanTrimmer::prepare(const unsigned int threadIndex) noexcept {
+
+	// Get thread's buckets start and end
+	const uint32_t bucketsStart = min((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + numberOfThreads - 1) / numberOfThreads * threadIndex, CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS);
+	const uint32_t bucketsEnd = min((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS);
+	
+	// Clear thread's buckets (Memory is placed on the NUMA node of the CPU core that first uses it, so this places the thread's buckets on its NUMA node)
+	memset(&bucketsOne[static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * bucketsStart], 0, sizeof(uint32_t) * CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET * (bucketsEnd - bucketsStart));
+	memset(&bucketsTwo[static_cast<uint64_t>(CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * bucketsStart], 0, sizeof(uint32_t) * CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET * (bucketsEnd - bucketsStart));
+	
+	// Clear thread's bitmap, nodes, and write combining buffers
+	memset(&threadsBitmaps[CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES / sizeof(uint64_t) * threadIndex], 0, CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES);
+	memset(&threadsNodes[static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * threadIndex], 0, sizeof(uint32_t) * CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET);
+	memset(&threadsWriteCombiningBuffers[(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex], 0, sizeof(CpuMeanTrimmingWriteCombiningBuffer) * (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1));
+	memset(&threadsWriteCombiningBuffersNumberOfWords[(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex], 0, sizeof(uint8_t) * (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1));
+}
+
+// Trim
+void CpuMeanTrimmer::trim(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Get thread's buckets start and end
+	const uint32_t bucketsStart = min((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + numberOfThreads - 1) / numberOfThreads * threadIndex, CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS);
+	const uint32_t bucketsEnd = min((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS);
+	
+	// Clear thread's buckets' number of edges
+	memset(&numberOfEdgesPerBucketOne[bucketsStart], 0, sizeof(uint32_t) * (bucketsEnd - bucketsStart));
+	memset(&numberOfEdgesPerBucketTwo[bucketsStart], 0, sizeof(uint32_t) * (bucketsEnd - bucketsStart));
+	
+	// Check if the first thread
+	if(!threadIndex) {
+	
+		// Set number of remaining edges to zero
+		remainingEdges[0] = 0;
+	}
+	
+	// Wait for all threads to finish clearing their buckets' number of edges
+	threadsBarrier.arrive_and_wait();
+	
+	// Perform step one
+	trimEdgesStepOne(sipHashKeys, threadIndex);
+	
+	// Wait for all threads to finish sorting their edges into buckets
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all trimming rounds
+	for(unsigned int i = 0; i < TRIMMING_ROUNDS; ++i) {
+	
+		// Get trimming round's source and destination buckets (Rounds alternate between the buckets)
+		const bool sourceIsBucketsOne = !(i % 2);
+		uint32_t *sourceBuckets = sourceIsBucketsOne ? bucketsOne.get() : bucketsTwo.get();
+		uint32_t *numberOfEdgesPerSourceBucket = sourceIsBucketsOne ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get();
+		const uint32_t sourceBucketSize = sourceIsBucketsOne ? CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET : CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET;
+		uint32_t *destinationBuckets = sourceIsBucketsOne ? bucketsTwo.get() : bucketsOne.get();
+		uint32_t *numberOfEdgesPerDestinationBucket = sourceIsBucketsOne ? numberOfEdgesPerBucketTwo.get() : numberOfEdgesPerBucketOne.get();
+		const uint32_t destinationBucketSize = sourceIsBucketsOne ? CPU_MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET : CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET;
+		
+		// Check trimming round
+		const bool isLastRound = i + 1 == TRIMMING_ROUNDS;
+		switch(i) {
+		
+			// First
+			case 0:
+			
+				// Trim edges round using edges' indices to create edges' indices
+				trimEdgesRound<1, 1>(sourceBuckets, numberOfEdgesPerSourceBucket, sourceBucketSize, destinationBuckets, numberOfEdgesPerDestinationBucket, destinationBucketSize, i % 2, isLastRound, sipHashKeys, threadIndex);
+				
+				// Break
+				break;
+				
+			// Second
+			case 1:
+			
+				// Trim edges round using edges' indices to create edges' indices and nodes
+				trimEdgesRound<1, 2>(sourceBuckets, numberOfEdgesPerSourceBucket, sourceBucketSize, destinationBuckets, numberOfEdgesPerDestinationBucket, destinationBucketSize, i % 2, isLastRound, sipHashKeys, threadIndex);
+				
+				// Break
+				break;
+				
+			// Third
+			case 2:
+			
+				// Trim edges round using edges' indices and nodes to create edges' indices and both nodes
+				trimEdgesRound<2, EDGE_NUMBER_OF_COMPONENTS>(sourceBuckets, numberOfEdgesPerSourceBucket, sourceBucketSize, destinationBuckets, numberOfEdgesPerDestinationBucket, destinationBucketSize, i % 2, isLastRound, sipHashKeys, threadIndex);
+				
+				// Break
+				break;
+				
+			// Default
+			default:
+			
+				// Trim edges round using edges' indices and both nodes to create edges' indices and both nodes
+				trimEdgesRound<EDGE_NUMBER_OF_COMPONENTS, EDGE_NUMBER_OF_COMPONENTS>(sourceBuckets, numberOfEdgesPerSourceBucket, sourceBucketSize, destinationBuckets, numberOfEdgesPerDestinationBucket, destinationBucketSize, i % 2, isLastRound, sipHashKeys, threadIndex);
+				
+				// Break
+				break;
+		}
+		
+		// Clear thread's source buckets' number of edges (Only this thread uses its source buckets' number of edges during this trimming round, and other threads only start adding edges to them during the next trimming round)
+		memset(&numberOfEdgesPerSourceBucket[bucketsStart], 0, sizeof(uint32_t) * (bucketsEnd - bucketsStart));
+		
+		// Wait for all threads to finish trimming their buckets
+		threadsBarrier.arrive_and_wait();
+	}
+}
+
+// Get remaining edges
+const uint32_t *CpuMeanTrimmer::getRemainingEdges() const noexcept {
+
+	// Return remaining edges
+	return remainingEdges.get();
+}
+
+// Trim edges step one
+void CpuMeanTrimmer::trimEdgesStepOne(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const unsigned int threadIndex) noexcept {
+
+	// Get thread's edges start and end
+	const uint64_t edgesStart = min((NUMBER_OF_EDGES / CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH + numberOfThreads - 1) / numberOfThreads * threadIndex, NUMBER_OF_EDGES / CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH;
+	const uint64_t edgesEnd = min((NUMBER_OF_EDGES / CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), NUMBER_OF_EDGES / CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH;
+	
+	// Go through all of the thread's edges
+	for(uint64_t edgeIndex = edgesStart; edgeIndex < edgesEnd; edgeIndex += CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+	
+		// Go through all edges that get their nodes at the same time
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nonces;
+		for(uint_fast8_t i = 0; i < CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+		
+			// Set edge's nonce from its index
+			nonces[i] = (edgeIndex + i) * 2;
+		}
+		
+		// Get nodes from the nonces
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nodes;
+		sipHash24<CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&nodes, sipHashKeys, &nonces);
+		
+		// Go through all nodes
+		for(uint_fast8_t i = 0; i < CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++i) {
+		
+			// Append edge's index to its node's bucket
+			const uint32_t bucketIndex = nodes[i] >> CPU_MEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING;
+			const uint32_t record[] = {static_cast<uint32_t>(edgeIndex + i)};
+			appendRecord<1>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + bucketIndex, &bucketsOne[static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * bucketIndex], numberOfEdgesPerBucketOne[bucketIndex], CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET);
+		}
+	}
+	
+	// Flush write combining buffers
+	flushWriteCombiningBuffers<1>(bucketsOne.get(), numberOfEdgesPerBucketOne.get(), CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET, threadIndex);
+}
+
+// Trim edges round
+template<const unsigned int sourceRecordSize, const unsigned int destinationRecordSize> void CpuMeanTrimmer::trimEdgesRound(const uint32_t *sourceBuckets, uint32_t *numberOfEdgesPerSourceBucket, const uint32_t sourceBucketSize, uint32_t *destinationBuckets, uint32_t *numberOfEdgesPerDestinationBucket, const uint32_t destinationBucketSize, const uint8_t nodesInSecondPartition, const bool isLastRound, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const unsigned int threadIndex) noexcept {
+
+	// Get thread's buckets start and end
+	const uint32_t bucketsStart = min((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + numberOfThreads - 1) / numberOfThreads * threadIndex, CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS);
+	const uint32_t bucketsEnd = min((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS);
+	
+	// Get thread's bitmap and nodes
+	uint64_t *bitmap = &threadsBitmaps[CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES / sizeof(uint64_t) * threadIndex];
+	uint32_t *nodes = &threadsNodes[static_cast<uint64_t>(CPU_MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * threadIndex];
+	
+	// Create append edges without other nodes (Edges whose records don't include their other node get their other nodes at the same time and are then appended to their other node's bucket)
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) otherNonces = {};
+	uint32_t edgesWithoutOtherNodesNodes[CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH];
+	uint_fast8_t numberOfEdgesWithoutOtherNodes = 0;
+	const auto appendEdgesWithoutOtherNodes = [this, &otherNonces, &edgesWithoutOtherNodesNodes, &numberOfEdgesWithoutOtherNodes, destinationBuckets, numberOfEdgesPerDestinationBucket, destinationBucketSize, nodesInSecondPartition, isLastRound, &sipHashKeys, threadIndex]() noexcept {
+	
+		// Get other nodes from the other nonces
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) otherNodes;
+		sipHash24<CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&otherNodes, sipHashKeys, &otherNonces);
+		
+		// Go through all edges without other nodes
+		for(uint_fast8_t i = 0; i < numberOfEdgesWithoutOtherNodes; ++i) {
+		
+			// Check if the last trimming round
+			const uint32_t edgeIndex = otherNonces[i] / 2;
+			const uint32_t otherNode = otherNodes[i];
+			if(isLastRound) {
+			
+				// Append edge to the remaining edges
+				const uint32_t record[] = {edgeIndex, nodesInSecondPartition ? otherNode : edgesWithoutOtherNodesNodes[i], nodesInSecondPartition ? edgesWithoutOtherNodesNodes[i] : otherNode};
+				appendRecord<EDGE_NUMBER_OF_COMPONENTS>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS, &remainingEdges[1], remainingEdges[0], MAX_NUMBER_OF_EDGES_AFTER_TRIMMING);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Get other node's bucket
+				const uint32_t bucketIndex = otherNode >> CPU_MEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING;
+				uint32_t *bucket = &destinationBuckets[static_cast<uint64_t>(destinationBucketSize) * bucketIndex];
+				
+				// Check if destination records include the edge's nodes
+				if constexpr(destinationRecordSize == EDGE_NUMBER_OF_COMPONENTS) {
+				
+					// Append edge to its other node's bucket
+					const uint32_t record[] = {edgeIndex, otherNode, edgesWithoutOtherNodesNodes[i]};
+					appendRecord<EDGE_NUMBER_OF_COMPONENTS>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + bucketIndex, bucket, numberOfEdgesPerDestinationBucket[bucketIndex], destinationBucketSize / EDGE_NUMBER_OF_COMPONENTS);
+				}
+				
+				// Otherwise check if destination records include the edge's other node
+				else if constexpr(destinationRecordSize == 2) {
+				
+					// Append edge to its other node's bucket
+					const uint32_t record[] = {edgeIndex, otherNode};
+					appendRecord<2>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + bucketIndex, bucket, numberOfEdgesPerDestinationBucket[bucketIndex], destinationBucketSize / 2);
+				}
+				
+				// Otherwise
+				else {
+				
+					// Append edge to its other node's bucket
+					const uint32_t record[] = {edgeIndex};
+					appendRecord<1>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + bucketIndex, bucket, numberOfEdgesPerDestinationBucket[bucketIndex], destinationBucketSize);
+				}
+			}
+		}
+		
+		// Set number of edges without other nodes to zero
+		numberOfEdgesWithoutOtherNodes = 0;
+	};
+	
+	// Go through all of the thread's buckets
+	for(uint32_t bucketIndex = bucketsStart; bucketIndex < bucketsEnd; ++bucketIndex) {
+	
+		// Get bucket's records
+		const uint32_t numberOfEdges = min(numberOfEdgesPerSourceBucket[bucketIndex], sourceBucketSize / static_cast<uint32_t>(sourceRecordSize));
+		const uint32_t *records = &sourceBuckets[static_cast<uint64_t>(sourceBucketSize) * bucketIndex];
+		
+		// Clear bitmap
+		memset(bitmap, 0, CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES);
+		
+		// Check if records don't include their nodes
+		if constexpr(sourceRecordSize == 1) {
+		
+			// Go through all of the bucket's edges
+			for(uint32_t i = 0; i < numberOfEdges; i += CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+			
+				// Go through all edges that get their nodes at the same time
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) nonces;
+				for(uint_fast8_t j = 0; j < CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH; ++j) {
+				
+					// Set edge's nonce from its index
+					nonces[j] = (static_cast<uint64_t>(records[min(i + j, numberOfEdges - 1)]) * 2) | nodesInSecondPartition;
+				}
+				
+				// Get nodes from the nonces
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH))) edgesNodes;
+				sipHash24<CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH>(&edgesNodes, sipHashKeys, &nonces);
+				
+				// Go through all of the edges' nodes
+				for(uint_fast8_t j = 0; j < CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH && i + j < numberOfEdges; ++j) {
+				
+					// Save node
+					nodes[i + j] = edgesNodes[j];
+					
+					// Enable node in bitmap
+					bitmap[(edgesNodes[j] & (CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES * BITS_IN_A_BYTE - 1)) / BITMAP_UNIT_WIDTH] |= static_cast<uint64_t>(1) << (edgesNodes[j] % BITMAP_UNIT_WIDTH);
+				}
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Go through all of the bucket's edges
+			for(uint32_t i = 0; i < numberOfEdges; ++i) {
+			
+				// Enable edge's node in bitmap
+				const uint32_t node = records[i * sourceRecordSize + 1];
+				bitmap[(node & (CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES * BITS_IN_A_BYTE - 1)) / BITMAP_UNIT_WIDTH] |= static_cast<uint64_t>(1) << (node % BITMAP_UNIT_WIDTH);
+			}
+		}
+		
+		// Go through all of the bucket's edges
+		for(uint32_t i = 0; i < numberOfEdges; ++i) {
+		
+			// Check if edge's node has a pair in the bitmap
+			const uint32_t node = (sourceRecordSize == 1) ? nodes[i] : records[i * sourceRecordSize + 1];
+			const uint32_t pairIndex = (node & (CPU_MEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES * BITS_IN_A_BYTE - 1)) ^ 1;
+			if((bitmap[pairIndex / BITMAP_UNIT_WIDTH] >> (pairIndex % BITMAP_UNIT_WIDTH)) & 1) {
+			
+				// Check if record includes the edge's other node
+				if constexpr(sourceRecordSize == EDGE_NUMBER_OF_COMPONENTS) {
+				
+					// Check if the last trimming round
+					const uint32_t otherNode = records[i * sourceRecordSize + 2];
+					if(isLastRound) {
+					
+						// Append edge to the remaining edges
+						const uint32_t record[] = {records[i * sourceRecordSize], nodesInSecondPartition ? otherNode : node, nodesInSecondPartition ? node : otherNode};
+						appendRecord<EDGE_NUMBER_OF_COMPONENTS>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS, &remainingEdges[1], remainingEdges[0], MAX_NUMBER_OF_EDGES_AFTER_TRIMMING);
+					}
+					
+					// Otherwise
+					else {
+					
+						// Append edge to its other node's bucket
+						const uint32_t otherNodeBucketIndex = otherNode >> CPU_MEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING;
+						const uint32_t record[] = {records[i * sourceRecordSize], otherNode, node};
+						appendRecord<EDGE_NUMBER_OF_COMPONENTS>(record, (CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + otherNodeBucketIndex, &destinationBuckets[static_cast<uint64_t>(destinationBucketSize) * otherNodeBucketIndex], numberOfEdgesPerDestinationBucket[otherNodeBucketIndex], destinationBucketSize / EDGE_NUMBER_OF_COMPONENTS);
+					}
+				}
+				
+				// Otherwise
+				else {
+				
+					// Set edge's other nonce from its index
+					otherNonces[numberOfEdgesWithoutOtherNodes] = (static_cast<uint64_t>(records[i * sourceRecordSize]) * 2) | (nodesInSecondPartition ^ 1);
+					edgesWithoutOtherNodesNodes[numberOfEdgesWithoutOtherNodes] = node;
+					
+					// Check if enough edges don't have their other nodes
+					if(++numberOfEdgesWithoutOtherNodes == CPU_MEAN_TRIMMING_NUMBER_OF_EDGES_PER_SIPHASH) {
+					
+						// Append edges without other nodes
+						appendEdgesWithoutOtherNodes();
+					}
+				}
+			}
+		}
+	}
+	
+	// Check if edges don't have their other nodes
+	if(numberOfEdgesWithoutOtherNodes) {
+	
+		// Append edges without other nodes
+		appendEdgesWithoutOtherNodes();
+	}
+	
+	// Check if the last trimming round and the remaining edges' write combining buffer isn't empty
+	if(isLastRound && threadsWriteCombiningBuffersNumberOfWords[(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS]) {
+	
+		// Flush remaining edges' write combining buffer
+		flushWriteCombiningBuffer<EDGE_NUMBER_OF_COMPONENTS>((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS, &remainingEdges[1], remainingEdges[0], MAX_NUMBER_OF_EDGES_AFTER_TRIMMING);
+	}
+	
+	// Flush write combining buffers
+	flushWriteCombiningBuffers<destinationRecordSize>(destinationBuckets, numberOfEdgesPerDestinationBucket, destinationBucketSize, threadIndex);
+}
+
+// Append record
+template<const unsigned int recordSize> void CpuMeanTrimmer::appendRecord(const uint32_t record[recordSize], const uint32_t writeCombiningBufferIndex, uint32_t *bucket, uint32_t &numberOfEdgesInBucket, const uint64_t maxNumberOfEdgesInBucket) noexcept {
+
+	// Append record to the write combining buffer
+	uint8_t &numberOfWords = threadsWriteCombiningBuffersNumberOfWords[writeCombiningBufferIndex];
+	memcpy(&threadsWriteCombiningBuffers[writeCombiningBufferIndex].words[numberOfWords], record, sizeof(uint32_t) * recordSize);
+	numberOfWords += recordSize;
+	
+	// Check if write combining buffer can't fit another record
+	if(numberOfWords + recordSize > CPU_MEAN_TRIMMING_WRITE_COMBINING_BUFFER_NUMBER_OF_WORDS) {
+	
+		// Flush write combining buffer
+		flushWriteCombiningBuffer<recordSize>(writeCombiningBufferIndex, bucket, numberOfEdgesInBucket, maxNumberOfEdgesInBucket);
+	}
+}
+
+// Flush write combining buffer
+template<const unsigned int recordSize> void CpuMeanTrimmer::flushWriteCombiningBuffer(const uint32_t writeCombiningBufferIndex, uint32_t *bucket, uint32_t &numberOfEdgesInBucket, const uint64_t maxNumberOfEdgesInBucket) noexcept {
+
+	// Get bucket's next edge index
+	uint8_t &numberOfWords = threadsWriteCombiningBuffersNumberOfWords[writeCombiningBufferIndex];
+	const uint32_t numberOfRecords = numberOfWords / recordSize;
+	const uint32_t nextEdgeIndex = __atomic_fetch_add(&numberOfEdgesInBucket, numberOfRecords, __ATOMIC_RELAXED);
+	
+	// Check if bucket isn't full
+	if(nextEdgeIndex < maxNumberOfEdgesInBucket) {
+	
+		// Write the records that fit in the bucket to the bucket (Records that don't fit are dropped like mean trimming does on the GPU)
+		memcpy(&bucket[static_cast<uint64_t>(nextEdgeIndex) * recordSize], threadsWriteCombiningBuffers[writeCombiningBufferIndex].words, sizeof(uint32_t) * min(static_cast<uint64_t>(numberOfRecords), maxNumberOfEdgesInBucket - nextEdgeIndex) * recordSize);
+	}
+	
+	// Set write combining buffer's number of words to zero
+	numberOfWords = 0;
+}
+
+// Flush write combining buffers
+template<const unsigned int recordSize> void CpuMeanTrimmer::flushWriteCombiningBuffers(uint32_t *buckets, uint32_t *numberOfEdgesPerBucket, const uint32_t bucketSize, const unsigned int threadIndex) noexcept {
+
+	// Go through all buckets
+	for(uint32_t i = 0; i < CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS; ++i) {
+	
+		// Check if bucket's write combining buffer isn't empty
+		if(threadsWriteCombiningBuffersNumberOfWords[(CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + i]) {
+		
+			// Flush bucket's write combining buffer
+			flushWriteCombiningBuffer<recordSize>((CPU_MEAN_TRIMMING_NUMBER_OF_BUCKETS + 1) * threadIndex + i, &buckets[static_cast<uint64_t>(bucketSize) * i], numberOfEdgesPerBucket[i], bucketSize / recordSize);
+		}
+	}
+}
+
+// Perform CPU mean trimming loop
+bool performCpuMeanTrimmingLoop(const unsigned int numberOfThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const unsigned int cpuCoresNameOffset) noexcept {
+
+	// Check if creating CPU mean trimmer failed
+	CpuMeanTrimmer cpuMeanTrimmer(numberOfThreads);
+	if(!cpuMeanTrimmer) {
+	
+		// Display message
+		cout << "Allocating memory failed." << endl;
+		
+		// Return false
+		return false;
+	}
+	
+	// Display message
+	cout << "Using " << numberOfThreads << " CPU core(s) for trimming: ";
+	
+	// Go through all trimming threads
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Check if using Windows
+		#ifdef _WIN32
+		
+			// Display message
+			cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
+			
+		// Otherwise check if using an Apple device
+		#elif defined __APPLE__
+		
+			// Display message
+			cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
+			
+		// Otherwise
+		#else
+		
+			// Display message
+			cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
+		#endif
+	}
+	
+	// Display new line
+	cout << endl;
+	
+	// Go through all trimming threads except the last one which is this thread
+	thread trimmingThreads[numberOfThreads - 1];
+	barrier trimmingThreadsBarrier(numberOfThreads);
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+	bool closeTrimmingThreads = false;
+	
+	for(unsigned int i = 0; i < numberOfThreads - 1; ++i) {
+	
+		// Create trimming thread
+		trimmingThreads[i] = thread([firstThreadIndex, numberOfApplicableCpuCores, &cpuMeanTrimmer, &trimmingThreadsBarrier, &sipHashKeys, &closeTrimmingThreads, trimmingThreadIndex = i]() noexcept {
+		
+			// Set thread's priority and affinity (Trimming works on any CPU core, so failing to do this isn't an error)
+			setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + trimmingThreadIndex) % numberOfApplicableCpuCores));
+			
+			// Prepare CPU mean trimmer
+			cpuMeanTrimmer.prepare(trimmingThreadIndex);
+			
+			// Loop forever
+			while(true) {
+			
+				// Wait until starting trimming threads
+				trimmingThreadsBarrier.arrive_and_wait();
+				
+				// Check if closing thread
+				if(closeTrimmingThreads) {
+				
+					// Return
+					return;
+				}
+				
+				// Trim
+				cpuMeanTrimmer.trim(sipHashKeys, trimmingThreadIndex, trimmingThreadsBarrier);
+			}
+		});
+	}
+	
+	// Prepare CPU mean trimmer
+	cpuMeanTrimmer.prepare(numberOfThreads - 1);
+	
+	// Display message
+	cout << "Mining started" << endl << endl << "Mining info:" << endl << "\tMining rate:\t 0 graph(s)/second" << endl << "\tGraphs checked:\t 0" << endl;
+	
+	// Check if not tuning
+	#ifndef TUNING
+	
+		// Display message
+		cout << "\tSolutions found: 0" << endl;
+	#endif
+	
+	// Display message
+	cout << "Pipeline stages:" << endl;
+	
+	// Set previous graph processed time to now
+	previousGraphProcessedTime = chrono::high_resolution_clock::now();
+	
+	// While not closing
+	while(!closing) {
+	
+		// Record start time
+		const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+		
+		// Get SipHash keys from job's header and nonce
+		const uint64_t height = jobHeight;
+		const uint64_t id = jobId;
+		const uint64_t nonce = jobNonce++;
+		blake2b(sipHashKeys, jobHeaderMidstate, nonce);
+		
+		// Start trimming threads
+		trimmingThreadsBarrier.arrive_and_wait();
+		
+		// Trim
+		cpuMeanTrimmer.trim(sipHashKeys, numberOfThreads - 1, trimmingThreadsBarrier);
+		
+		// Record end time
+		const chrono::high_resolution_clock::time_point endTime = chrono::high_resolution_clock::now();
+		
+		// Display message
+		cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(endTime - startTime).count() << " second(s)" << endl;
+		
+		// Trimming finished
+		trimmingFinished(cpuMeanTrimmer.getRemainingEdges(), sipHashKeys, height, id, nonce);
+	}
+	
+	// Close trimming threads
+	closeTrimmingThreads = true;
+	trimmingThreadsBarrier.arrive_and_wait();
+	
+	// Go through all trimming threads except the last one which is this thread
+	for(unsigned int i = 0; i < numberOfThreads - 1; ++i) {
+	
+		// Join trimming thread
+		trimmingThreads[i].join();
+	}
+	
+	// Return true
+	return true;
+}
+
+
+#endif
@@ -0,0 +1,591 @@
+// Header guard
+#ifndef CPU_TOPOLOGY_H
+#define CPU_TOPOLOGY_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// CPU topology max number of caches (The number of cache indices looked at for each CPU core when finding its L3 cache)
+#define CPU_TOPOLOGY_MAX_NUMBER_OF_CACHES 10
+
+// CPU topology unknown NUMA node
+#define CPU_TOPOLOGY_UNKNOWN_NUMA_NODE -1
+
+
+// Classes
+
+// CPU topology class (Orders the CPU cores so that the simple arithmetic that splits thread indices between instances keeps each instance in as few L3 caches and NUMA nodes as possible, with the NUMA node closest to the GPU first, and so that each instance's threads use one CPU core per physical core before using their SMT siblings)
+class CpuTopology final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit CpuTopology(const unsigned int numberOfCpuCores) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Get CPU core
+		inline unsigned int getCpuCore(const unsigned int index) const noexcept;
+		
+		// Set instance
+		inline void setInstance(const unsigned int firstThreadIndex, const unsigned int numberOfThreads) noexcept;
+		
+		// Set closest NUMA node
+		inline bool setClosestNumaNode(const int numaNode) noexcept;
+		
+		// Is on NUMA node
+		inline bool isOnNumaNode(const unsigned int firstThreadIndex, const unsigned int numberOfThreads, const int numaNode) const noexcept;
+		
+		// Display
+		inline void display(const unsigned int firstThreadIndex, const unsigned int numberOfThreads) const noexcept;
+		
+	// Private
+	private:
+	
+		// CPU core
+		struct CpuCore {
+		
+			// Index
+			unsigned int index;
+			
+			// NUMA node
+			int numaNode;
+			
+			// Cache (The first CPU core that shares the CPU core's L3 cache)
+			unsigned int cache;
+			
+			// Physical core (The first CPU core that shares the CPU core's physical core)
+			unsigned int physicalCore;
+			
+			// SMT thread (The CPU core's position in its physical core)
+			unsigned int smtThread;
+		};
+		
+		// Discover
+		inline bool discover() noexcept;
+		
+		// Sort
+		inline void sort() noexcept;
+		
+		// Get number of distinct
+		template<typename Function> inline unsigned int getNumberOfDistinct(const unsigned int firstThreadIndex, const unsigned int numberOfThreads, const Function &function) const noexcept;
+		
+		// For each CPU core in list
+		template<typename Function> static inline bool forEachCpuCoreInList(const char *path, const Function &function) noexcept;
+		
+		// Number of CPU cores
+		const unsigned int numberOfCpuCores;
+		
+		// CPU cores
+		const unique_ptr<CpuCore[]> cpuCores;
+		
+		// Instance's first thread index
+		unsigned int instancesFirstThreadIndex;
+		
+		// Instance's number of threads
+		unsigned int instancesNumberOfThreads;
+		
+		// Closest NUMA node
+		int closestNumaNode;
+		
+		// Discovered
+		bool discovered;
+};
+
+
+// Global variables
+
+// CPU topology
+static unique_ptr<CpuTopology> cpuTopology;
+
+
+// Function prototypes
+
+// Create CPU topology
+static inline void createCpuTopology(const unsigned int numberOfApplicableCpuCores) noexcept;
+
+// Get CPU core
+static inline unsigned int getCpuCore(const unsigned int threadIndex) noexcept;
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Place threads near OpenCL context
+	static inline void placeThreadsNearOpenClContext(const cl_context context, const unsigned int firstThreadIndex, const unsigned int numberOfThreads, const unsigned int numberOfApplicableCpuCores) noexcept;
+#endif
+
+
+// Supporting function implementation
+
+// Constructor
+CpuTopology::CpuTopology(const unsigned int numberOfCpuCores) noexcept :
+
+	// Set number of CPU cores
+	numberOfCpuCores(numberOfCpuCores),
+	
+	// Create CPU cores
+	cpuCores(new(nothrow) CpuCore[numberOfCpuCores]),
+	
+	// Set instance's first thread index to zero
+	instancesFirstThreadIndex(0),
+	
+	// Set instance's number of threads to zero
+	instancesNumberOfThreads(0),
+	
+	// Set closest NUMA node to unknown
+	closestNumaNode(CPU_TOPOLOGY_UNKNOWN_NUMA_NODE),
+	
+	// Set discovered to false
+	discovered(false)
+{
+
+	// Check if creating CPU cores was successful
+	if(cpuCores) {
+	
+		// Set discovered to if discovering the CPU cores' topology was successful
+		discovered = discover();
+		
+		// Check if discovered
+		if(discovered) {
+		
+			// Sort CPU cores
+			sort();
+		}
+	}
+}
+
+// Bool operator
+CpuTopology::operator bool() const noexcept {
+
+	// Return if discovered
+	return discovered;
+}
+
+// Get CPU core
+unsigned int CpuTopology::getCpuCore(const unsigned int index) const noexcept {
+
+	// Return CPU core at the index
+	return cpuCores[index].index;
+}
+
+// Set instance
+void CpuTopology::setInstance(const unsigned int firstThreadIndex, const unsigned int numberOfThreads) noexcept {
+
+	// Set instance's first thread index and number of threads
+	instancesFirstThreadIndex = firstThreadIndex;
+	instancesNumberOfThreads = numberOfThreads;
+	
+	// Sort CPU cores
+	sort();
+}
+
+// Set closest NUMA node
+bool CpuTopology::setClosestNumaNode(const int numaNode) noexcept {
+
+	// Check if NUMA node is unknown or is already the closest NUMA node
+	if(numaNode == CPU_TOPOLOGY_UNKNOWN_NUMA_NODE || numaNode == closestNumaNode) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set closest NUMA node
+	closestNumaNode = numaNode;
+	
+	// Sort CPU cores
+	sort();
+	
+	// Return true
+	return true;
+}
+
+// Is on NUMA node
+bool CpuTopology::isOnNumaNode(const unsigned int firstThreadIndex, const unsigned int numberOfThreads, const int numaNode) const noexcept {
+
+	// Go through all threads
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Check if thread's CPU core is on the NUMA node
+		if(cpuCores[(firstThreadIndex + i) % numberOfCpuCores].numaNode == numaNode) {
+		
+			// Return true
+			return true;
+		}
+	}
+	
+	// Return false
+	return false;
+}
+
+// Display
+void CpuTopology::display(const unsigned int firstThreadIndex, const unsigned int numberOfThreads) const noexcept {
+
+	// Get physical core function
+	const auto getPhysicalCore = [](const CpuCore &cpuCore) noexcept -> unsigned int {
+	
+		// Return CPU core's physical core
+		return cpuCore.physicalCore;
+	};
+	
+	// Get cache function
+	const auto getCache = [](const CpuCore &cpuCore) noexcept -> unsigned int {
+	
+		// Return CPU core's cache
+		return cpuCore.cache;
+	};
+	
+	// Get NUMA node function
+	const auto getNumaNode = [](const CpuCore &cpuCore) noexcept -> unsigned int {
+	
+		// Return CPU core's NUMA node
+		return cpuCore.numaNode;
+	};
+	
+	// Display message
+	cout << "This instance's " << numberOfThreads << " thread(s) are on " << getNumberOfDistinct(firstThreadIndex, numberOfThreads, getPhysicalCore) << " physical core(s) sharing " << getNumberOfDistinct(firstThreadIndex, numberOfThreads, getCache) << " L3 cache(s) on " << getNumberOfDistinct(firstThreadIndex, numberOfThreads, getNumaNode) << " NUMA node(s) out of the CPU's " << getNumberOfDistinct(0, numberOfCpuCores, getPhysicalCore) << " physical core(s), " << getNumberOfDistinct(0, numberOfCpuCores, getCache) << " L3 cache(s), and " << getNumberOfDistinct(0, numberOfCpuCores, getNumaNode) << " NUMA node(s)" << endl;
+}
+
+// Discover
+bool CpuTopology::discover() noexcept {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if getting the online CPU cores failed or they aren't the applicable CPU cores
+		unsigned int numberOfOnlineCpuCores = 0;
+		if(!forEachCpuCoreInList("/sys/devices/system/cpu/online", [this, &numberOfOnlineCpuCores](const unsigned int cpuCore, __attribute__((unused)) const unsigned int firstCpuCore, __attribute__((unused)) const unsigned int position) noexcept -> bool {
+		
+			// Check if there's more online CPU cores than applicable CPU cores
+			if(numberOfOnlineCpuCores == numberOfCpuCores) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Set CPU core's index and default topology (Each CPU core is its own physical core and L3 cache until finding otherwise)
+			cpuCores[numberOfOnlineCpuCores].index = cpuCore;
+			cpuCores[numberOfOnlineCpuCores].numaNode = CPU_TOPOLOGY_UNKNOWN_NUMA_NODE;
+			cpuCores[numberOfOnlineCpuCores].cache = cpuCore;
+			cpuCores[numberOfOnlineCpuCores].physicalCore = cpuCore;
+			cpuCores[numberOfOnlineCpuCores++].smtThread = 0;
+			
+			// Return true
+			return true;
+		}) || numberOfOnlineCpuCores != numberOfCpuCores) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Go through all CPU cores
+		for(unsigned int i = 0; i < numberOfCpuCores; ++i) {
+		
+			// Set physical core function
+			const auto setPhysicalCore = [&cpuCore = cpuCores[i]](const unsigned int otherCpuCore, const unsigned int firstCpuCore, const unsigned int position) noexcept -> bool {
+			
+				// Check if the other CPU core is the CPU core
+				if(otherCpuCore == cpuCore.index) {
+				
+					// Set CPU core's physical core and SMT thread
+					cpuCore.physicalCore = firstCpuCore;
+					cpuCore.smtThread = position;
+				}
+				
+				// Return true
+				return true;
+			};
+			
+			// Check if going through all of the CPU core's physical core's CPU cores failed
+			char path[sizeof("/sys/devices/system/cpu/cpu/topology/thread_siblings_list") + sizeof("4294967295") - sizeof('\0')];
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_cpus_list", cpuCores[i].index);
+			if(!forEachCpuCoreInList(path, setPhysicalCore)) {
+			
+				// Go through all of the CPU core's physical core's CPU cores (Older kernels only have the thread siblings list)
+				snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", cpuCores[i].index);
+				forEachCpuCoreInList(path, setPhysicalCore);
+			}
+			
+			// Go through all of the CPU core's caches
+			bool cacheFound = false;
+			for(unsigned int j = 0; j < CPU_TOPOLOGY_MAX_NUMBER_OF_CACHES && !cacheFound; ++j) {
+			
+				// Check if getting the cache's level was successful and it's an L3 cache
+				char cachePath[sizeof("/sys/devices/system/cpu/cpu/cache/index/shared_cpu_list") + sizeof("4294967295") - sizeof('\0') + sizeof("4294967295") - sizeof('\0')];
+				snprintf(cachePath, sizeof(cachePath), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpuCores[i].index, j);
+				const unique_ptr<FILE, decltype(&fclose)> levelFile(fopen(cachePath, "r"), fclose);
+				unsigned int level;
+				if(levelFile && fscanf(levelFile.get(), "%u", &level) == 1 && level == 3) {
+				
+					// Go through all of the cache's CPU cores
+					snprintf(cachePath, sizeof(cachePath), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpuCores[i].index, j);
+					cacheFound = forEachCpuCoreInList(cachePath, [&cpuCore = cpuCores[i]](__attribute__((unused)) const unsigned int otherCpuCore, const unsigned int firstCpuCore, __attribute__((unused)) const unsigned int position) noexcept -> bool {
+					
+						// Set CPU core's cache
+						cpuCore.cache = firstCpuCore;
+						
+						// Return true
+						return true;
+					});
+				}
+			}
+			
+			// Check if the CPU core's L3 cache wasn't found
+			if(!cacheFound) {
+			
+				// Set cache function
+				const auto setCache = [&cpuCore = cpuCores[i]](__attribute__((unused)) const unsigned int otherCpuCore, const unsigned int firstCpuCore, __attribute__((unused)) const unsigned int position) noexcept -> bool {
+				
+					// Set CPU core's cache
+					cpuCore.cache = firstCpuCore;
+					
+					// Return true
+					return true;
+				};
+				
+				// Check if going through all of the CPU core's package's CPU cores failed (The CPU core's package is used as its L3 cache when the CPU doesn't report one)
+				snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/package_cpus_list", cpuCores[i].index);
+				if(!forEachCpuCoreInList(path, setCache)) {
+				
+					// Go through all of the CPU core's package's CPU cores (Older kernels only have the core siblings list)
+					snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_siblings_list", cpuCores[i].index);
+					forEachCpuCoreInList(path, setCache);
+				}
+			}
+		}
+		
+		// Go through all online NUMA nodes (NUMA nodes stay unknown if the kernel doesn't report them)
+		forEachCpuCoreInList("/sys/devices/system/node/online", [this](const unsigned int numaNode, __attribute__((unused)) const unsigned int firstNumaNode, __attribute__((unused)) const unsigned int position) noexcept -> bool {
+		
+			// Go through all of the NUMA node's CPU cores
+			char path[sizeof("/sys/devices/system/node/node/cpulist") + sizeof("4294967295") - sizeof('\0')];
+			snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", numaNode);
+			forEachCpuCoreInList(path, [this, numaNode](const unsigned int cpuCore, __attribute__((unused)) const unsigned int firstCpuCore, __attribute__((unused)) const unsigned int position) noexcept -> bool {
+			
+				// Go through all CPU cores
+				for(unsigned int i = 0; i < numberOfCpuCores; ++i) {
+				
+					// Check if CPU core is the NUMA node's CPU core
+					if(cpuCores[i].index == cpuCore) {
+					
+						// Set CPU core's NUMA node
+						cpuCores[i].numaNode = numaNode;
+						
+						// Break
+						break;
+					}
+				}
+				
+				// Return true
+				return true;
+			});
+			
+			// Return true
+			return true;
+		});
+		
+		// Return true
+		return true;
+		
+	// Otherwise
+	#else
+	
+		// Return false
+		return false;
+	#endif
+}
+
+// Sort
+void CpuTopology::sort() noexcept {
+
+	// Sort CPU cores by their NUMA node with the closest NUMA node first, then by their L3 cache, then by their position in their physical core so that splitting the CPU cores between instances keeps each instance in as few L3 caches as possible without instances sharing physical cores
+	std::sort(cpuCores.get(), cpuCores.get() + numberOfCpuCores, [this](const CpuCore &first, const CpuCore &second) noexcept -> bool {
+	
+		// Return if the first CPU core comes before the second CPU core
+		return make_tuple(first.numaNode != closestNumaNode, first.numaNode, first.cache, first.smtThread, first.physicalCore) < make_tuple(second.numaNode != closestNumaNode, second.numaNode, second.cache, second.smtThread, second.physicalCore);
+	});
+	
+	// Check if the instance's CPU cores don't wrap around
+	if(instancesFirstThreadIndex + instancesNumberOfThreads <= numberOfCpuCores) {
+	
+		// Sort the instance's CPU cores by their position in their physical core so that the instance's first threads, which are its searching threads, use one CPU core per physical core before any of them use an SMT sibling
+		stable_sort(&cpuCores[instancesFirstThreadIndex], &cpuCores[instancesFirstThreadIndex + instancesNumberOfThreads], [](const CpuCore &first, const CpuCore &second) noexcept -> bool {
+		
+			// Return if the first CPU core comes before the second CPU core
+			return first.smtThread < second.smtThread;
+		});
+	}
+}
+
+// Get number of distinct
+template<typename Function> unsigned int CpuTopology::getNumberOfDistinct(const unsigned int firstThreadIndex, const unsigned int numberOfThreads, const Function &function) const noexcept {
+
+	// Go through all threads
+	unsigned int numberOfDistinct = 0;
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Go through all previous threads while the thread's value isn't found
+		const unsigned int value = function(cpuCores[(firstThreadIndex + i) % numberOfCpuCores]);
+		unsigned int j = 0;
+		while(j < i && function(cpuCores[(firstThreadIndex + j) % numberOfCpuCores]) != value) {
+		
+			// Go to next thread
+			++j;
+		}
+		
+		// Check if the thread's value wasn't found
+		if(j == i) {
+		
+			// Increment number of distinct
+			++numberOfDistinct;
+		}
+	}
+	
+	// Return number of distinct
+	return numberOfDistinct;
+}
+
+// For each CPU core in list
+template<typename Function> bool CpuTopology::forEachCpuCoreInList(const char *path, const Function &function) noexcept {
+
+	// Check if opening the list failed
+	const unique_ptr<FILE, decltype(&fclose)> file(fopen(path, "r"), fclose);
+	if(!file) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all ranges in the list (The list looks like 0-3,8,10-11)
+	unsigned int firstCpuCore = 0;
+	unsigned int position = 0;
+	for(unsigned int start, end; fscanf(file.get(), "%u", &start) == 1; fgetc(file.get())) {
+	
+		// Check if the range has an end
+		end = start;
+		const int separator = fgetc(file.get());
+		if(separator == '-') {
+		
+			// Check if getting the range's end failed
+			if(fscanf(file.get(), "%u", &end) != 1 || end < start) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Put back separator
+			ungetc(separator, file.get());
+		}
+		
+		// Check if the range is the first range
+		if(!position) {
+		
+			// Set first CPU core
+			firstCpuCore = start;
+		}
+		
+		// Go through all CPU cores in the range
+		for(unsigned int i = start; i <= end; ++i) {
+		
+			// Check if performing function on the CPU core failed
+			if(!function(i, firstCpuCore, position++)) {
+			
+				// Return false
+				return false;
+			}
+		}
+	}
+	
+	// Return if the list wasn't empty
+	return position;
+}
+
+// Create CPU topology
+void createCpuTopology(const unsigned int numberOfApplicableCpuCores) noexcept {
+
+	// Create CPU topology
+	cpuTopology = unique_ptr<CpuTopology>(new(nothrow) CpuTopology(numberOfApplicableCpuCores));
+	
+	// Check if creating CPU topology or discovering the CPU's topology failed
+	if(!cpuTopology || !*cpuTopology) {
+	
+		// Free CPU topology (Thread indices are then used as CPU cores)
+		cpuTopology.reset();
+	}
+}
+
+// Get CPU core
+unsigned int getCpuCore(const unsigned int threadIndex) noexcept {
+
+	// Return the CPU core for the thread index if using a CPU topology, otherwise the thread index
+	return cpuTopology ? cpuTopology->getCpuCore(threadIndex) : threadIndex;
+}
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Place threads near OpenCL context
+	void placeThreadsNearOpenClContext(const cl_context context, const unsigned int firstThreadIndex, const unsigned int numberOfThreads, const unsigned int numberOfApplicableCpuCores) noexcept {
+	
+		// Check if not using a CPU topology
+		if(!cpuTopology) {
+		
+			// Return
+			return;
+		}
+		
+		// Check if getting the context's device was successful (Contexts are created with one device)
+		cl_device_id device;
+		if(clGetContextInfo(context, CL_CONTEXT_DEVICES, sizeof(device), &device, nullptr) == CL_SUCCESS) {
+		
+			// Check if getting the device's PCI bus info was successful
+			cl_device_pci_bus_info_khr pciBusInfo;
+			if(clGetDeviceInfo(device, CL_DEVICE_PCI_BUS_INFO_KHR, sizeof(pciBusInfo), &pciBusInfo, nullptr) == CL_SUCCESS) {
+			
+				// Check if getting the device's NUMA node was successful
+				char path[sizeof("/sys/bus/pci/devices/:::./numa_node") + sizeof("4294967295") - sizeof('\0') + sizeof("4294967295") - sizeof('\0') + sizeof("4294967295") - sizeof('\0') + sizeof("4294967295") - sizeof('\0')];
+				snprintf(path, sizeof(path), "/sys/bus/pci/devices/%04x:%02x:%02x.%x/numa_node", pciBusInfo.pci_domain, pciBusInfo.pci_bus, pciBusInfo.pci_device, pciBusInfo.pci_function);
+				const unique_ptr<FILE, decltype(&fclose)> file(fopen(path, "r"), fclose);
+				int numaNode;
+				if(file && fscanf(file.get(), "%d", &numaNode) == 1 && numaNode != CPU_TOPOLOGY_UNKNOWN_NUMA_NODE) {
+				
+					// Check if this instance uses all CPU cores (Instances that share the CPU cores have to order them the same way, so only a lone instance can order them for its GPU)
+					if(numberOfThreads == numberOfApplicableCpuCores) {
+					
+						// Check if setting the CPU topology's closest NUMA node to the GPU's NUMA node changed the order of the CPU cores
+						if(cpuTopology->setClosestNumaNode(numaNode)) {
+						
+							// Display message
+							cout << "Using the CPU cores on NUMA node " << numaNode << " first since it's closest to the GPU." << endl;
+							
+							// Display CPU topology
+							cpuTopology->display(firstThreadIndex, numberOfThreads);
+							
+							// Set thread's priority and affinity to its CPU core in the new order (Failing to do this isn't an error since the thread already has its priority)
+							setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + numberOfThreads - 1) % numberOfApplicableCpuCores));
+						}
+					}
+					
+					// Otherwise check if none of this instance's CPU cores are on the GPU's NUMA node
+					else if(!cpuTopology->isOnNumaNode(firstThreadIndex, numberOfThreads, numaNode)) {
+					
+						// Display message
+						cout << "This instance's CPU cores aren't on NUMA node " << numaNode << ", which is closest to the GPU. You should change this instance's index or the GPU that it uses." << endl;
+					}
+				}
+			}
+		}
+	}
+#endif
+
+
+#endif
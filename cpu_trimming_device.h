@@ -0,0 +1,640 @@
+// Header guard
+#ifndef CPU_TRIMMING_DEVICE_H
+#define CPU_TRIMMING_DEVICE_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// CPU trimming device stage times weight (Measured stage times are averaged with previous measurements using this weight for the newest measurement)
+#define CPU_TRIMMING_DEVICE_STAGE_TIMES_WEIGHT 0.25
+
+// CPU trimming device min searching threads idle fraction (Searching threads that are idle less than this fraction of the time are considered to be the slowest stage, so the CPU trimming device uses one less CPU core)
+#define CPU_TRIMMING_DEVICE_MIN_SEARCHING_THREADS_IDLE_FRACTION 0.02
+
+
+// Classes
+
+// CPU trimming device class (Trims whole graphs with CPU lean trimming on the CPU cores that aren't searching while a GPU trims other graphs, and only uses as many of those CPU cores as are needed to fill the time that the searching threads are idle)
+class CpuTrimmingDevice final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit CpuTrimmingDevice(const unsigned int numberOfThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const bool createRemainingEdges) noexcept;
+		
+		// Destructor
+		inline ~CpuTrimmingDevice() noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Is trimming
+		inline bool isTrimming() const noexcept;
+		
+		// Is finished
+		inline bool isFinished() const noexcept;
+		
+		// Start
+		inline void start(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce, const unsigned int numberOfActiveThreads) noexcept;
+		
+		// Searched
+		inline void searched() noexcept;
+		
+		// Add GPU graph
+		inline void addGpuGraph(const double searchingTime) noexcept;
+		
+		// Add CPU graph
+		inline void addCpuGraph(const double searchingTime) noexcept;
+		
+		// Searching threads idle
+		inline void searchingThreadsIdle() noexcept;
+		
+		// Get number of threads to use
+		inline unsigned int getNumberOfThreadsToUse() const noexcept;
+		
+		// Get number of threads
+		inline unsigned int getNumberOfThreads() const noexcept;
+		
+		// Get number of active threads
+		inline unsigned int getNumberOfActiveThreads() const noexcept;
+		
+		// Get result
+		inline const void *getResult() const noexcept;
+		
+		// Get SipHash keys
+		inline const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &getSipHashKeys() const noexcept;
+		
+		// Get height
+		inline uint64_t getHeight() const noexcept;
+		
+		// Get ID
+		inline uint64_t getId() const noexcept;
+		
+		// Get nonce
+		inline uint64_t getNonce() const noexcept;
+		
+		// Get trimming time
+		inline double getTrimmingTime() const noexcept;
+		
+	// Private
+	private:
+	
+		// State
+		enum class State : uint8_t {
+		
+			// Idle state
+			IDLE,
+			
+			// Trimming state
+			TRIMMING,
+			
+			// Finished state
+			FINISHED
+		};
+		
+		// Run thread
+		inline void runThread(const unsigned int threadIndex, const unsigned int cpuCoreIndex) noexcept;
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Edges bitmap
+		const unique_ptr<uint64_t[]> edgesBitmap;
+		
+		// Nodes bitmap
+		const unique_ptr<uint64_t[]> nodesBitmap;
+		
+		// Remaining edges (The first item is the number of remaining edges, and the rest are the remaining edges' indices and nodes)
+		const unique_ptr<uint32_t[]> remainingEdges;
+		
+		// Threads' barriers (Each number of active threads has its own barrier)
+		unique_ptr<unique_ptr<barrier<>>[]> threadsBarriers;
+		
+		// Threads
+		unique_ptr<thread[]> threads;
+		
+		// Threads mutex
+		mutex threadsMutex;
+		
+		// Start threads conditional variable
+		condition_variable startThreadsConditionalVariable;
+		
+		// Threads generation
+		uint64_t threadsGeneration;
+		
+		// Close threads
+		bool closeThreads;
+		
+		// State
+		State state;
+		
+		// Number of active threads
+		unsigned int numberOfActiveThreads;
+		
+		// Steps' next block
+		uint64_t stepsNextBlock[2];
+		
+		// Abandoned
+		bool abandoned;
+		
+		// SipHash keys
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+		
+		// Height
+		uint64_t height;
+		
+		// ID
+		uint64_t id;
+		
+		// Nonce
+		uint64_t nonce;
+		
+		// Start time
+		chrono::high_resolution_clock::time_point startTime;
+		
+		// Trimming time
+		double trimmingTime;
+		
+		// Previous GPU graph time
+		chrono::high_resolution_clock::time_point previousGpuGraphTime;
+		
+		// Searching threads idle time
+		chrono::high_resolution_clock::time_point searchingThreadsIdleTime;
+		
+		// GPU graph interval
+		double gpuGraphInterval;
+		
+		// Searching threads idle time per GPU graph
+		double searchingThreadsIdleTimePerGpuGraph;
+		
+		// CPU searching time
+		double cpuSearchingTime;
+		
+		// CPU thread seconds per graph
+		double cpuThreadSecondsPerGraph;
+		
+		// Number of threads to use
+		unsigned int numberOfThreadsToUse;
+};
+
+
+// Global variables
+
+// CPU trimming device
+static unique_ptr<CpuTrimmingDevice> cpuTrimmingDevice;
+
+
+// Function prototypes
+
+// Create CPU trimming device
+static inline void createCpuTrimmingDevice(const unsigned int numberOfThreads, const unsigned int numberOfSearchingThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const unsigned int cpuCoresNameOffset, const bool createRemainingEdges) noexcept;
+
+// Get remaining edges from edges bitmap
+static inline CPU_FEATURE_DISPATCH_VARIANTS void getRemainingEdgesFromEdgesBitmap(uint32_t *__restrict__ remainingEdges, const uint64_t *__restrict__ edgesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys) noexcept;
+
+
+// Supporting function implementation
+
+// Constructor
+CpuTrimmingDevice::CpuTrimmingDevice(const unsigned int numberOfThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const bool createRemainingEdges) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Create edges bitmap
+	edgesBitmap(new(nothrow) uint64_t[EDGES_BITMAP_SIZE]),
+	
+	// Create nodes bitmap
+	nodesBitmap(new(nothrow) uint64_t[NUMBER_OF_EDGES / BITMAP_UNIT_WIDTH]),
+	
+	// Create remaining edges if creating remaining edges
+	remainingEdges(createRemainingEdges ? new(nothrow) uint32_t[1 + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS] : nullptr),
+	
+	// Create threads' barriers
+	threadsBarriers(new(nothrow) unique_ptr<barrier<>>[numberOfThreads]),
+	
+	// Set threads generation to zero
+	threadsGeneration(0),
+	
+	// Set close threads to false
+	closeThreads(false),
+	
+	// Set state to idle
+	state(State::IDLE),
+	
+	// Set number of active threads to zero
+	numberOfActiveThreads(0),
+	
+	// Set trimming time to zero
+	trimmingTime(0),
+	
+	// Set GPU graph interval to zero
+	gpuGraphInterval(0),
+	
+	// Set searching threads idle time per GPU graph to zero
+	searchingThreadsIdleTimePerGpuGraph(0),
+	
+	// Set CPU searching time to zero
+	cpuSearchingTime(0),
+	
+	// Set CPU thread seconds per graph to zero
+	cpuThreadSecondsPerGraph(0),
+	
+	// Set number of threads to use to the number of threads (All threads are used until the stage times are measured)
+	numberOfThreadsToUse(numberOfThreads)
+{
+
+	// Check if creating edges bitmap, nodes bitmap, remaining edges, or threads' barriers failed
+	if(!edgesBitmap || !nodesBitmap || (createRemainingEdges && !remainingEdges) || !threadsBarriers) {
+	
+		// Return
+		return;
+	}
+	
+	// Go through all numbers of active threads
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Check if creating number of active threads' barrier failed
+		threadsBarriers[i] = unique_ptr<barrier<>>(new(nothrow) barrier<>(i + 1));
+		if(!threadsBarriers[i]) {
+		
+			// Free threads' barriers
+			threadsBarriers.reset();
+			
+			// Return
+			return;
+		}
+	}
+	
+	// Check if creating threads failed
+	threads = unique_ptr<thread[]>(new(nothrow) thread[numberOfThreads]);
+	if(!threads) {
+	
+		// Return
+		return;
+	}
+	
+	// Go through all threads
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Create thread
+		threads[i] = thread(&CpuTrimmingDevice::runThread, this, i, getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores));
+	}
+}
+
+// Destructor
+CpuTrimmingDevice::~CpuTrimmingDevice() noexcept {
+
+	// Check if threads exist
+	if(threads) {
+	
+		// Lock threads mutex
+		threadsMutex.lock();
+		
+		// Set close threads to true
+		closeThreads = true;
+		
+		// Unlock threads mutex
+		threadsMutex.unlock();
+		
+		// Close threads
+		startThreadsConditionalVariable.notify_all();
+		
+		// Go through all threads
+		for(unsigned int i = 0; i < numberOfThreads; ++i) {
+		
+			// Join thread
+			threads[i].join();
+		}
+	}
+}
+
+// Bool operator
+CpuTrimmingDevice::operator bool() const noexcept {
+
+	// Return if creating edges bitmap, nodes bitmap, remaining edges, threads' barriers, and threads was successful
+	return edgesBitmap && nodesBitmap && threadsBarriers && threads;
+}
+
+// Is trimming
+bool CpuTrimmingDevice::isTrimming() const noexcept {
+
+	// Return if trimming
+	return __atomic_load_n(&state, __ATOMIC_ACQUIRE) == State::TRIMMING;
+}
+
+// Is finished
+bool CpuTrimmingDevice::isFinished() const noexcept {
+
+	// Return if finished
+	return __atomic_load_n(&state, __ATOMIC_ACQUIRE) == State::FINISHED;
+}
+
+// Start
+void CpuTrimmingDevice::start(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce, const unsigned int numberOfActiveThreads) noexcept {
+
+	// Set graph's SipHash keys, height, ID, and nonce
+	this->sipHashKeys = sipHashKeys;
+	this->height = height;
+	this->id = id;
+	this->nonce = nonce;
+	
+	// Record start time
+	startTime = chrono::high_resolution_clock::now();
+	
+	// Set state to trimming
+	__atomic_store_n(&state, State::TRIMMING, __ATOMIC_RELAXED);
+	
+	// Lock threads mutex
+	threadsMutex.lock();
+	
+	// Set number of active threads
+	this->numberOfActiveThreads = numberOfActiveThreads;
+	
+	// Increment threads generation
+	++threadsGeneration;
+	
+	// Unlock threads mutex
+	threadsMutex.unlock();
+	
+	// Start threads
+	startThreadsConditionalVariable.notify_all();
+}
+
+// Searched
+void CpuTrimmingDevice::searched() noexcept {
+
+	// Set state to idle
+	__atomic_store_n(&state, State::IDLE, __ATOMIC_RELAXED);
+}
+
+// Add GPU graph
+void CpuTrimmingDevice::addGpuGraph(const double searchingTime) noexcept {
+
+	// Check if a GPU graph was previously added
+	const chrono::high_resolution_clock::time_point currentTime = chrono::high_resolution_clock::now();
+	if(previousGpuGraphTime != chrono::high_resolution_clock::time_point()) {
+	
+		// Update GPU graph interval and searching threads idle time per GPU graph (Searching threads are idle from when they finished searching until the GPU finished its next graph)
+		const double interval = static_cast<chrono::duration<double>>(currentTime - previousGpuGraphTime).count();
+		const double idleTime = max(static_cast<chrono::duration<double>>(currentTime - searchingThreadsIdleTime).count() - searchingTime, 0.0);
+		gpuGraphInterval = gpuGraphInterval ? gpuGraphInterval + (interval - gpuGraphInterval) * CPU_TRIMMING_DEVICE_STAGE_TIMES_WEIGHT : interval;
+		searchingThreadsIdleTimePerGpuGraph = searchingThreadsIdleTimePerGpuGraph ? searchingThreadsIdleTimePerGpuGraph + (idleTime - searchingThreadsIdleTimePerGpuGraph) * CPU_TRIMMING_DEVICE_STAGE_TIMES_WEIGHT : idleTime;
+		
+		// Check if CPU graphs have been measured
+		if(cpuThreadSecondsPerGraph) {
+		
+			// Check if searching threads are the slowest stage
+			const double searchingThreadsIdleFraction = searchingThreadsIdleTimePerGpuGraph / gpuGraphInterval;
+			if(searchingThreadsIdleFraction < CPU_TRIMMING_DEVICE_MIN_SEARCHING_THREADS_IDLE_FRACTION) {
+			
+				// Use one less thread
+				numberOfThreadsToUse -= numberOfThreadsToUse ? 1 : 0;
+			}
+			
+			// Otherwise
+			else {
+			
+				// Use more threads to trim as many more graphs as the searching threads have time to search
+				numberOfThreadsToUse = min(numberOfThreadsToUse + static_cast<unsigned int>(searchingThreadsIdleFraction / cpuSearchingTime * cpuThreadSecondsPerGraph), numberOfThreads);
+			}
+		}
+	}
+	
+	// Update previous GPU graph time
+	previousGpuGraphTime = currentTime;
+}
+
+// Add CPU graph
+void CpuTrimmingDevice::addCpuGraph(const double searchingTime) noexcept {
+
+	// Update CPU searching time
+	cpuSearchingTime = cpuSearchingTime ? cpuSearchingTime + (searchingTime - cpuSearchingTime) * CPU_TRIMMING_DEVICE_STAGE_TIMES_WEIGHT : searchingTime;
+	
+	// Update CPU thread seconds per graph (Lean trimming's work is split evenly between the active threads)
+	const double threadSeconds = trimmingTime * numberOfActiveThreads;
+	cpuThreadSecondsPerGraph = cpuThreadSecondsPerGraph ? cpuThreadSecondsPerGraph + (threadSeconds - cpuThreadSecondsPerGraph) * CPU_TRIMMING_DEVICE_STAGE_TIMES_WEIGHT : threadSeconds;
+}
+
+// Searching threads idle
+void CpuTrimmingDevice::searchingThreadsIdle() noexcept {
+
+	// Record searching threads idle time
+	searchingThreadsIdleTime = chrono::high_resolution_clock::now();
+}
+
+// Get number of threads to use
+unsigned int CpuTrimmingDevice::getNumberOfThreadsToUse() const noexcept {
+
+	// Return number of threads to use
+	return numberOfThreadsToUse;
+}
+
+// Get number of threads
+unsigned int CpuTrimmingDevice::getNumberOfThreads() const noexcept {
+
+	// Return number of threads
+	return numberOfThreads;
+}
+
+// Get number of active threads
+unsigned int CpuTrimmingDevice::getNumberOfActiveThreads() const noexcept {
+
+	// Return number of active threads
+	return numberOfActiveThreads;
+}
+
+// Get result
+const void *CpuTrimmingDevice::getResult() const noexcept {
+
+	// Return remaining edges if they exist otherwise edges bitmap
+	return remainingEdges ? static_cast<const void *>(remainingEdges.get()) : static_cast<const void *>(edgesBitmap.get());
+}
+
+// Get SipHash keys
+const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &CpuTrimmingDevice::getSipHashKeys() const noexcept {
+
+	// Return SipHash keys
+	return sipHashKeys;
+}
+
+// Get height
+uint64_t CpuTrimmingDevice::getHeight() const noexcept {
+
+	// Return height
+	return height;
+}
+
+// Get ID
+uint64_t CpuTrimmingDevice::getId() const noexcept {
+
+	// Return ID
+	return id;
+}
+
+// Get nonce
+uint64_t CpuTrimmingDevice::getNonce() const noexcept {
+
+	// Return nonce
+	return nonce;
+}
+
+// Get trimming time
+double CpuTrimmingDevice::getTrimmingTime() const noexcept {
+
+	// Return trimming time
+	return trimmingTime;
+}
+
+// Run thread
+void CpuTrimmingDevice::runThread(const unsigned int threadIndex, const unsigned int cpuCoreIndex) noexcept {
+
+	// Set thread's priority and affinity (Trimming works on any CPU core, so failing to do this isn't an error)
+	setThreadPriorityAndAffinity(cpuCoreIndex);
+	
+	// Loop forever
+	uint64_t previousThreadsGeneration = 0;
+	while(true) {
+	
+		// Wait until starting threads or closing threads
+		unique_lock lock(threadsMutex);
+		startThreadsConditionalVariable.wait(lock, [this, previousThreadsGeneration]() noexcept -> bool {
+		
+			// Return if starting threads or closing threads
+			return threadsGeneration != previousThreadsGeneration || closeThreads;
+		});
+		
+		// Check if closing thread
+		if(closeThreads) {
+		
+			// Return
+			return;
+		}
+		
+		// Get the graph's number of active threads
+		previousThreadsGeneration = threadsGeneration;
+		const unsigned int graphNumberOfActiveThreads = numberOfActiveThreads;
+		lock.unlock();
+		
+		// Check if thread is active for the graph
+		if(threadIndex < graphNumberOfActiveThreads) {
+		
+			// Trim edges
+			const bool trimmed = cpuLeanTrimEdges(edgesBitmap.get(), nodesBitmap.get(), sipHashKeys, TRIMMING_ROUNDS, height, abandoned, stepsNextBlock, threadIndex, graphNumberOfActiveThreads, *threadsBarriers[graphNumberOfActiveThreads - 1]);
+			
+			// Check if the first thread
+			if(!threadIndex) {
+			
+				// Check if remaining edges exist and trimming the graph wasn't abandoned (Abandoned graphs are stale, so they aren't searched)
+				if(remainingEdges && trimmed) {
+				
+					// Get remaining edges from edges bitmap
+					getRemainingEdgesFromEdgesBitmap(remainingEdges.get(), edgesBitmap.get(), sipHashKeys);
+				}
+				
+				// Set trimming time
+				trimmingTime = static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+				
+				// Set state to finished
+				__atomic_store_n(&state, State::FINISHED, __ATOMIC_RELEASE);
+			}
+		}
+	}
+}
+
+// Create CPU trimming device
+void createCpuTrimmingDevice(const unsigned int numberOfThreads, const unsigned int numberOfSearchingThreads, const unsigned int firstThreadIndex, const unsigned int numberOfApplicableCpuCores, const unsigned int cpuCoresNameOffset, const bool createRemainingEdges) noexcept {
+
+	// Check if there's no CPU cores that aren't searching or used by this thread
+	if(numberOfThreads <= numberOfSearchingThreads + 1) {
+	
+		// Return
+		return;
+	}
+	
+	// Check if creating CPU trimming device failed
+	const unsigned int numberOfCpuTrimmingDeviceThreads = numberOfThreads - numberOfSearchingThreads - 1;
+	cpuTrimmingDevice = unique_ptr<CpuTrimmingDevice>(new(nothrow) CpuTrimmingDevice(numberOfCpuTrimmingDeviceThreads, firstThreadIndex + numberOfSearchingThreads, numberOfApplicableCpuCores, createRemainingEdges));
+	if(!cpuTrimmingDevice || !*cpuTrimmingDevice) {
+	
+		// Free CPU trimming device
+		cpuTrimmingDevice.reset();
+		
+		// Display message
+		cout << "Allocating memory for CPU trimming failed. Mining without it." << endl;
+		
+		// Return
+		return;
+	}
+	
+	// Display message
+	cout << "Using up to " << numberOfCpuTrimmingDeviceThreads << " CPU core(s) for CPU trimming: ";
+	
+	// Go through all CPU trimming device threads
+	for(unsigned int i = 0; i < numberOfCpuTrimmingDeviceThreads; ++i) {
+	
+		// Check if using Windows
+		#ifdef _WIN32
+		
+			// Display message
+			cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + numberOfSearchingThreads + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
+			
+		// Otherwise check if using an Apple device
+		#elif defined __APPLE__
+		
+			// Display message
+			cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + numberOfSearchingThreads + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
+			
+		// Otherwise
+		#else
+		
+			// Display message
+			cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + numberOfSearchingThreads + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
+		#endif
+	}
+	
+	// Display new line
+	cout << endl;
+}
+
+// Get remaining edges from edges bitmap
+void getRemainingEdgesFromEdgesBitmap(uint32_t *__restrict__ remainingEdges, const uint64_t *__restrict__ edgesBitmap, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys) noexcept {
+
+	// Go through all units in the edges bitmap
+	uint32_t numberOfRemainingEdges = 0;
+	for(uint64_t i = 0; i < EDGES_BITMAP_SIZE; ++i) {
+	
+		// Go through all edges in the unit
+		for(uint64_t unit = edgesBitmap[i]; unit; unit &= unit - 1) {
+		
+			// Check if remaining edges isn't full
+			if(numberOfRemainingEdges < MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
+			
+				// Get edge's nodes
+				const uint32_t edgeIndex = i * BITMAP_UNIT_WIDTH + countr_zero(unit);
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * (EDGE_NUMBER_OF_COMPONENTS - 1)))) nonces = {static_cast<uint64_t>(edgeIndex) * 2, static_cast<uint64_t>(edgeIndex) * 2 + 1};
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * (EDGE_NUMBER_OF_COMPONENTS - 1)))) nodes;
+				sipHash24<EDGE_NUMBER_OF_COMPONENTS - 1>(&nodes, sipHashKeys, &nonces);
+				
+				// Append edge to the remaining edges
+				remainingEdges[1 + numberOfRemainingEdges * EDGE_NUMBER_OF_COMPONENTS] = edgeIndex;
+				remainingEdges[1 + numberOfRemainingEdges * EDGE_NUMBER_OF_COMPONENTS + 1] = nodes[0];
+				remainingEdges[1 + numberOfRemainingEdges * EDGE_NUMBER_OF_COMPONENTS + 2] = nodes[1];
+			}
+			
+			// Increment number of remaining edges (The number of remaining edges can be greater than the max like with mean trimming)
+			++numberOfRemainingEdges;
+		}
+	}
+	
+	// Set number of remaining edges
+	remainingEdges[0] = numberOfRemainingEdges;
+}
+
+
+#endif
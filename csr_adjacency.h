@@ -0,0 +1,216 @@
+// Header guard
+#ifndef CSR_ADJACENCY_H
+#define CSR_ADJACENCY_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// CSR adjacency class (Stores each node's edges next to each other in ascending order so that a node's connections are found by walking backwards from its newest connection, each searching thread keeps its own nodes' newest connections so that threads can add different edges to the same adjacency, connections are referenced by their index in the adjacent edges plus one so that zero can mean no connection, and partition is zero for the first partition and one for the second partition)
+template<const uint32_t maximumNumberOfEdges> class CsrAdjacency final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit CsrAdjacency(const unsigned int numberOfThreads) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Build
+		inline void build(const uint32_t *edges, const uint64_t numberOfEdges, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+		// Get edge's connection
+		inline uint32_t getEdgesConnection(const uint32_t edge, const uint_fast8_t partition) const noexcept;
+		
+		// Get previous connection
+		inline uint32_t getPreviousConnection(const uint32_t connection) const noexcept;
+		
+		// Get connection's edge
+		inline uint32_t getConnectionsEdge(const uint32_t connection) const noexcept;
+		
+	// Private
+	private:
+	
+		// Digit number of bits
+		static const uint_fast8_t DIGIT_NUMBER_OF_BITS;
+		
+		// Number of digits
+		static const uint32_t NUMBER_OF_DIGITS;
+		
+		// First adjacent edge flag
+		static const uint32_t FIRST_ADJACENT_EDGE_FLAG;
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Entries (Each entry is its node and partition in the upper 32 bits and its edge in the lower 32 bits)
+		unique_ptr<uint64_t[]> entries;
+		
+		// Sorted entries
+		unique_ptr<uint64_t[]> sortedEntries;
+		
+		// Threads' digit counts
+		unique_ptr<uint32_t[]> threadsDigitCounts;
+		
+		// Adjacent edges (Each node's first adjacent edge has the first adjacent edge flag set)
+		unique_ptr<uint32_t[]> adjacentEdges;
+		
+		// Edges' adjacent edges indices
+		unique_ptr<uint32_t[]> edgesAdjacentEdgesIndices;
+};
+
+
+// Constants
+
+// CSR adjacency digit number of bits
+template<const uint32_t maximumNumberOfEdges> const uint_fast8_t CsrAdjacency<maximumNumberOfEdges>::DIGIT_NUMBER_OF_BITS = 8;
+
+// CSR adjacency number of digits
+template<const uint32_t maximumNumberOfEdges> const uint32_t CsrAdjacency<maximumNumberOfEdges>::NUMBER_OF_DIGITS = 1 << DIGIT_NUMBER_OF_BITS;
+
+// CSR adjacency first adjacent edge flag
+template<const uint32_t maximumNumberOfEdges> const uint32_t CsrAdjacency<maximumNumberOfEdges>::FIRST_ADJACENT_EDGE_FLAG = static_cast<uint32_t>(1) << 31;
+
+
+// Supporting function implementation
+
+// Constructor
+template<const uint32_t maximumNumberOfEdges> CsrAdjacency<maximumNumberOfEdges>::CsrAdjacency(const unsigned int numberOfThreads) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Create entries
+	entries(new(nothrow) uint64_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2]),
+	
+	// Create sorted entries
+	sortedEntries(new(nothrow) uint64_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2]),
+	
+	// Create threads' digit counts
+	threadsDigitCounts(new(nothrow) uint32_t[numberOfThreads * NUMBER_OF_DIGITS]),
+	
+	// Create adjacent edges
+	adjacentEdges(new(nothrow) uint32_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2]),
+	
+	// Create edges' adjacent edges indices
+	edgesAdjacentEdgesIndices(new(nothrow) uint32_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2])
+{
+
+	// Throw error if maximum number of edges is invalid
+	static_assert(maximumNumberOfEdges && maximumNumberOfEdges <= (static_cast<uint64_t>(UINT32_MAX) + 1) / 4, "CSR adjacency's maximum number of edges is invalid");
+}
+
+// Bool operator
+template<const uint32_t maximumNumberOfEdges> CsrAdjacency<maximumNumberOfEdges>::operator bool() const noexcept {
+
+	// Return if creating entries, sorted entries, threads' digit counts, adjacent edges, and edges' adjacent edges indices was successful
+	return entries && sortedEntries && threadsDigitCounts && adjacentEdges && edgesAdjacentEdgesIndices;
+}
+
+// Build
+template<const uint32_t maximumNumberOfEdges> void CsrAdjacency<maximumNumberOfEdges>::build(const uint32_t *edges, const uint64_t numberOfEdges, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Get thread's entries start and end
+	const uint64_t entriesStart = min((numberOfEdges * 2 + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges * 2);
+	const uint64_t entriesEnd = min((numberOfEdges * 2 + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges * 2);
+	
+	// Go through all of the thread's entries
+	for(uint64_t entriesIndex = entriesStart; entriesIndex < entriesEnd; ++entriesIndex) {
+	
+		// Set entry to its node and partition combined with its edge
+		entries[entriesIndex] = static_cast<uint64_t>((edges[entriesIndex / 2 * EDGE_NUMBER_OF_COMPONENTS + 1 + (entriesIndex & 1)] << 1) | (entriesIndex & 1)) << 32 | (entriesIndex / 2);
+	}
+	
+	// Go through all digits in the entries' nodes and partitions
+	uint64_t *source = entries.get();
+	uint64_t *destination = sortedEntries.get();
+	for(uint_fast8_t shift = 32; shift < 32 + bit_width(max(numberOfEdges * 4, static_cast<uint64_t>(2)) - 1); shift += DIGIT_NUMBER_OF_BITS) {
+	
+		// Go through all of the thread's entries
+		uint32_t *digitCounts = &threadsDigitCounts[threadIndex * NUMBER_OF_DIGITS];
+		memset(digitCounts, 0, sizeof(uint32_t) * NUMBER_OF_DIGITS);
+		for(uint64_t entriesIndex = entriesStart; entriesIndex < entriesEnd; ++entriesIndex) {
+		
+			// Increment entry's digit's count
+			++digitCounts[(source[entriesIndex] >> shift) & (NUMBER_OF_DIGITS - 1)];
+		}
+		
+		// Wait for all threads to finish counting their entries' digits
+		threadsBarrier.arrive_and_wait();
+		
+		// Go through all digits
+		uint32_t digitOffsets[NUMBER_OF_DIGITS];
+		for(uint32_t digit = 0, offset = 0; digit < NUMBER_OF_DIGITS; ++digit) {
+		
+			// Go through all threads
+			for(unsigned int currentThreadIndex = 0; currentThreadIndex < numberOfThreads; ++currentThreadIndex) {
+			
+				// Check if thread is this thread
+				if(currentThreadIndex == threadIndex) {
+				
+					// Set digit's offset to the offset
+					digitOffsets[digit] = offset;
+				}
+				
+				// Add thread's digit's count to the offset
+				offset += threadsDigitCounts[currentThreadIndex * NUMBER_OF_DIGITS + digit];
+			}
+		}
+		
+		// Go through all of the thread's entries
+		for(uint64_t entriesIndex = entriesStart; entriesIndex < entriesEnd; ++entriesIndex) {
+		
+			// Move entry to its digit's next offset
+			destination[digitOffsets[(source[entriesIndex] >> shift) & (NUMBER_OF_DIGITS - 1)]++] = source[entriesIndex];
+		}
+		
+		// Wait for all threads to finish moving their entries
+		threadsBarrier.arrive_and_wait();
+		
+		// Swap source and destination
+		swap(source, destination);
+	}
+	
+	// Go through all of the thread's sorted entries
+	for(uint64_t entriesIndex = entriesStart; entriesIndex < entriesEnd; ++entriesIndex) {
+	
+		// Set adjacent edge to the entry's edge and set if it's its node's first adjacent edge
+		const uint32_t edge = source[entriesIndex] & UINT32_MAX;
+		adjacentEdges[entriesIndex] = edge | ((!entriesIndex || (source[entriesIndex] >> 32) != (source[entriesIndex - 1] >> 32)) ? FIRST_ADJACENT_EDGE_FLAG : 0);
+		
+		// Set edge's adjacent edge index in the entry's partition
+		edgesAdjacentEdgesIndices[edge * 2 + ((source[entriesIndex] >> 32) & 1)] = entriesIndex;
+	}
+	
+	// Wait for all threads to finish setting their adjacent edges
+	threadsBarrier.arrive_and_wait();
+}
+
+// Get edge's connection
+template<const uint32_t maximumNumberOfEdges> uint32_t CsrAdjacency<maximumNumberOfEdges>::getEdgesConnection(const uint32_t edge, const uint_fast8_t partition) const noexcept {
+
+	// Return edge's adjacent edge in the partition
+	return edgesAdjacentEdgesIndices[edge * 2 + partition] + 1;
+}
+
+// Get previous connection
+template<const uint32_t maximumNumberOfEdges> uint32_t CsrAdjacency<maximumNumberOfEdges>::getPreviousConnection(const uint32_t connection) const noexcept {
+
+	// Return no connection if the connection is its node's first adjacent edge otherwise return the adjacent edge before it
+	return (adjacentEdges[connection - 1] & FIRST_ADJACENT_EDGE_FLAG) ? 0 : connection - 1;
+}
+
+// Get connection's edge
+template<const uint32_t maximumNumberOfEdges> uint32_t CsrAdjacency<maximumNumberOfEdges>::getConnectionsEdge(const uint32_t connection) const noexcept {
+
+	// Return connection's adjacent edge without its flag
+	return adjacentEdges[connection - 1] & ~FIRST_ADJACENT_EDGE_FLAG;
+}
+
+
+#endif
@@ -9,78 +9,187 @@ using namespace std;
 
 // Structures
 
-// Cuckatoo node connections link structure
+// Cuckatoo node connections link structure (Node connection links are referenced by their index in the node connections, and an edge's node connection links are at indices edge * 2 + 1 and edge * 2 + 2 so that index zero can mean no node connection link)
 struct CuckatooNodeConnectionsLink {
 
 	// Previous node connection link
-	const CuckatooNodeConnectionsLink *previousNodeConnectionLink;
+	uint32_t previousNodeConnectionLink;
 	
 	// Node
 	uint32_t node;
+};
+
+// Cuckatoo search frame structure
+struct CuckatooSearchFrame {
+
+	// Node connection
+	uint32_t nodeConnection;
 	
-	// Edge index
-	uint32_t edgeIndex;
+	// Visited node pair index
+	uint32_t visitedNodePairIndex;
 };
 
 
 // Global variables
 
-// Cuckatoo newest node connections
-thread_local static HashTable<CuckatooNodeConnectionsLink, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooUNewestNodeConnections;
-thread_local static HashTable<CuckatooNodeConnectionsLink, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooVNewestNodeConnections;
+// Check if using hash table searching
+#ifdef USE_HASH_TABLE_SEARCHING
 
-// Cuckatoo visited pairs
-thread_local static HashTable<uint32_t, SOLUTION_SIZE / 2> cuckatooUVisitedNodePairs;
-thread_local static HashTable<uint32_t, SOLUTION_SIZE / 2> cuckatooVVisitedNodePairs;
+	// Cuckatoo newest node connections
+	thread_local static HashTable<uint32_t, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooUNewestNodeConnections;
+	thread_local static HashTable<uint32_t, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooVNewestNodeConnections;
+	
+	// Cuckatoo visited pairs
+	thread_local static HashTable<uint32_t, SOLUTION_SIZE / 2> cuckatooUVisitedNodePairs;
+	thread_local static HashTable<uint32_t, SOLUTION_SIZE / 2> cuckatooVVisitedNodePairs;
+	
+// Otherwise
+#else
+
+	// Cuckatoo newest node connections (Edges' nodes are renamed to dense identifiers before searching when there's trimming rounds and are already less than the number of edges otherwise, so nodes are less than twice the number of edges)
+	thread_local static DenseTable<uint32_t, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooUNewestNodeConnections;
+	thread_local static DenseTable<uint32_t, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooVNewestNodeConnections;
+	
+	// Cuckatoo visited pairs
+	thread_local static DenseTable<uint32_t, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE / 2> cuckatooUVisitedNodePairs;
+	thread_local static DenseTable<uint32_t, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE / 2> cuckatooVVisitedNodePairs;
+#endif
 
 // Cuckatoo root node
 thread_local static uint32_t cuckatooRootNode;
 
+// Cuckatoo node connections
+thread_local static CuckatooNodeConnectionsLink *cuckatooNodeConnections;
+
+// Cuckatoo edges
+thread_local static const uint32_t *cuckatooEdges;
+
+// Cuckatoo components (Each edge is an element and edges are joined when they share a node pair, and they're only used when filtering cycles)
+thread_local static DisjointSet<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> cuckatooComponents;
+
 
 // Function prototypes
 
 // Initialize cuckatoo thread local global variables
-static inline bool initializeCuckatooThreadLocalGlobalVariables() noexcept;
+static inline bool initializeCuckatooThreadLocalGlobalVariables(CuckatooNodeConnectionsLink *nodeConnections, const uint32_t *edges) noexcept;
 
-// Get cuckatoo solution
-static inline bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectionsLink *__restrict__ nodeConnections, const uint32_t *__restrict__ edges, const uint64_t numberOfEdges) noexcept;
+// Add cuckatoo edge
+static inline bool addCuckatooEdge(const uint32_t edge, const bool filterCycles) noexcept;
 
-// Search node connections for cuckatoo solution first partition
-static inline bool searchNodeConnectionsForCuckatooSolutionFirstPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept;
+// Get cuckatoo edge's component
+static inline uint32_t getCuckatooEdgesComponent(const uint32_t nodeConnection) noexcept;
 
-// Search node connections for cuckatoo solution second partition
-static inline bool searchNodeConnectionsForCuckatooSolutionSecondPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept;
+// Get cuckatoo solutions
+static inline CPU_FEATURE_DISPATCH_VARIANTS uint32_t getCuckatooSolutions(uint32_t solutions[][SOLUTION_SIZE], const uint32_t maximumNumberOfSolutions, const uint32_t *searchingEdges, const uint32_t numberOfSearchingEdges, const bool filterCycles) noexcept;
+
+// Add cuckatoo solution from visited node pairs
+static inline CPU_FEATURE_DISPATCH_VARIANTS bool addCuckatooSolutionFromVisitedNodePairs(uint32_t solutions[][SOLUTION_SIZE], uint32_t &numberOfSolutions, const uint32_t maximumNumberOfSolutions, const uint32_t lastNodePair, const uint32_t lastNodeConnection) noexcept;
+
+// Search node connections for cuckatoo solutions
+template<const uint_fast8_t solutionSize> static inline CPU_FEATURE_DISPATCH_VARIANTS bool searchNodeConnectionsForCuckatooSolutions(uint32_t solutions[][SOLUTION_SIZE], uint32_t &numberOfSolutions, const uint32_t maximumNumberOfSolutions, uint_fast8_t cycleSize, const uint32_t node, const uint32_t edgeNodeConnection) noexcept;
+
+// Add cuckatoo CSR edge
+static inline bool addCuckatooCsrEdge(CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &csrAdjacency, const uint32_t edge, const bool filterCycles) noexcept;
+
+// Get cuckatoo solutions from CSR adjacency
+static inline CPU_FEATURE_DISPATCH_VARIANTS uint32_t getCuckatooSolutionsFromCsrAdjacency(uint32_t solutions[][SOLUTION_SIZE], const uint32_t maximumNumberOfSolutions, CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &csrAdjacency, const uint32_t *searchingEdges, const uint32_t numberOfSearchingEdges, const bool filterCycles) noexcept;
+
+// Search CSR adjacency for cuckatoo solutions
+template<const uint_fast8_t solutionSize> static inline CPU_FEATURE_DISPATCH_VARIANTS bool searchCsrAdjacencyForCuckatooSolutions(uint32_t solutions[][SOLUTION_SIZE], uint32_t &numberOfSolutions, const uint32_t maximumNumberOfSolutions, const CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &csrAdjacency, uint_fast8_t cycleSize, const uint32_t node, const uint32_t edgeNodeConnection) noexcept;
 
 
 // Supporting function implementation
 
 // Initialize cuckatoo thread local global variables
-bool initializeCuckatooThreadLocalGlobalVariables() noexcept {
+bool initializeCuckatooThreadLocalGlobalVariables(CuckatooNodeConnectionsLink *nodeConnections, const uint32_t *edges) noexcept {
 
 	// Return if creating thread local global variables was successful
 	cuckatooRootNode = 0;
-	return cuckatooUNewestNodeConnections && cuckatooVNewestNodeConnections && cuckatooUVisitedNodePairs && cuckatooVVisitedNodePairs;
+	cuckatooNodeConnections = nodeConnections;
+	cuckatooEdges = edges;
+	return cuckatooUNewestNodeConnections && cuckatooVNewestNodeConnections && cuckatooUVisitedNodePairs && cuckatooVVisitedNodePairs && cuckatooComponents;
 }
 
-// Get cuckatoo solution
-bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectionsLink *__restrict__ nodeConnections, const uint32_t *__restrict__ edges, const uint64_t numberOfEdges) noexcept {
+// Add cuckatoo edge (Filtering cycles only pays off for trimmed graphs since most of an untrimmed graph's edges are in one component)
+bool addCuckatooEdge(const uint32_t edge, const bool filterCycles) noexcept {
 
-	// Go through all edges
-	for(uint64_t nodeConnectionsIndex = 0, edgesIndex = 0; nodeConnectionsIndex < numberOfEdges * 2; nodeConnectionsIndex += 2, edgesIndex += EDGE_NUMBER_OF_COMPONENTS) {
-		
-		// Get edge's index and nodes
-		const uint32_t *index = &edges[edgesIndex];
-		uint32_t node = edges[edgesIndex + 1];
-		cuckatooRootNode = edges[edgesIndex + 2];
-		
-		// Replace newest node connection for the node on the first partition and add node connection to list
-		nodeConnections[nodeConnectionsIndex] = {cuckatooUNewestNodeConnections.replace(node, &nodeConnections[nodeConnectionsIndex]), node, edges[edgesIndex]};
+	// Get edge's nodes and node connections
+	const uint32_t firstPartitionNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 1];
+	const uint32_t secondPartitionNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 2];
+	const uint32_t firstPartitionNodeConnection = edge * 2 + 1;
+	const uint32_t secondPartitionNodeConnection = edge * 2 + 2;
+	
+	// Get newest node connections for the nodes' pairs
+	const uint32_t firstPartitionPairNodeConnection = cuckatooUNewestNodeConnections.get(firstPartitionNode ^ 1);
+	const uint32_t secondPartitionPairNodeConnection = cuckatooVNewestNodeConnections.get(secondPartitionNode ^ 1);
+	
+	// Replace newest node connection for the node on the first partition and add node connection to list
+	cuckatooNodeConnections[firstPartitionNodeConnection] = {cuckatooUNewestNodeConnections.replace(firstPartitionNode, firstPartitionNodeConnection), firstPartitionNode};
+	
+	// Replace newest node connection for the node on the second partition and add node connection to list
+	cuckatooNodeConnections[secondPartitionNodeConnection] = {cuckatooVNewestNodeConnections.replace(secondPartitionNode, secondPartitionNodeConnection), secondPartitionNode};
+	
+	// Check if not filtering cycles
+	if(!filterCycles) {
+	
+		// Return if both nodes have a pair
+		return firstPartitionPairNodeConnection && secondPartitionPairNodeConnection;
+	}
+	
+	// Set closes cycle to false
+	bool closesCycle = false;
+	
+	// Check if both nodes have a pair
+	if(firstPartitionPairNodeConnection && secondPartitionPairNodeConnection) {
+	
+		// Check if the pairs are already connected by a component that has enough edges to complete a solution with this edge
+		const uint32_t firstPartitionPairComponent = getCuckatooEdgesComponent(firstPartitionPairNodeConnection);
+		closesCycle = firstPartitionPairComponent == getCuckatooEdgesComponent(secondPartitionPairNodeConnection) && cuckatooComponents.getSize(firstPartitionPairComponent) >= SOLUTION_SIZE - 1;
+	}
+	
+	// Create component for the edge
+	uint32_t component = edge;
+	cuckatooComponents.add(component);
+	
+	// Go through all of the edge's neighbors
+	for(const uint32_t neighbor : {firstPartitionPairNodeConnection, secondPartitionPairNodeConnection, cuckatooNodeConnections[firstPartitionNodeConnection].previousNodeConnectionLink, cuckatooNodeConnections[secondPartitionNodeConnection].previousNodeConnectionLink}) {
+	
+		// Check if neighbor exists
+		if(neighbor) {
 		
-		// Replace newest node connection for the node on the second partition and add node connection to list
-		nodeConnections[nodeConnectionsIndex + 1] = {cuckatooVNewestNodeConnections.replace(cuckatooRootNode, &nodeConnections[nodeConnectionsIndex + 1]), cuckatooRootNode, edges[edgesIndex]};
+			// Join neighbor's component with the edge's component
+			component = cuckatooComponents.join(component, getCuckatooEdgesComponent(neighbor));
+		}
+	}
+	
+	// Return if edge closes a cycle
+	return closesCycle;
+}
+
+// Get cuckatoo edge's component
+uint32_t getCuckatooEdgesComponent(const uint32_t nodeConnection) noexcept {
+
+	// Return the component of the node connection's edge
+	return cuckatooComponents.find((nodeConnection - 1) / 2);
+}
+
+// Get cuckatoo solutions (Every cycle is found when its last edge is added and it's only searched for in one direction from that edge, so each solution is only found once)
+uint32_t getCuckatooSolutions(uint32_t solutions[][SOLUTION_SIZE], const uint32_t maximumNumberOfSolutions, const uint32_t *searchingEdges, const uint32_t numberOfSearchingEdges, const bool filterCycles) noexcept {
+
+	// Set number of solutions to zero
+	uint32_t numberOfSolutions = 0;
+
+	// Go through all searching edges
+	for(uint32_t i = 0; i < numberOfSearchingEdges; ++i) {
+	
+		// Get edge's node connection and nodes
+		const uint32_t edge = searchingEdges[i];
+		uint32_t edgeNodeConnection = edge * 2 + 1;
+		uint32_t node = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 1];
+		cuckatooRootNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 2];
 		
-		// Check if both nodes have a pair
-		if(cuckatooUNewestNodeConnections.contains(node ^ 1) && cuckatooVNewestNodeConnections.contains(cuckatooRootNode ^ 1)) {
+		// Check if adding edge closes a cycle that could be a solution
+		if(addCuckatooEdge(edge, filterCycles)) {
 		
 			// Reset visited nodes
 			cuckatooUVisitedNodePairs.clear();
@@ -88,36 +197,28 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 			
 			// Go through all nodes in the cycle
 			for(uint_fast8_t cycleSize = 1;; cycleSize += 2) {
-				
+			
 				// Set that node pair has been visited
-				cuckatooUVisitedNodePairs.setUnique(node >> 1, index);
+				cuckatooUVisitedNodePairs.setUnique(node >> 1, edgeNodeConnection);
 				
 				// Check if node's pair has more than one connection
-				const CuckatooNodeConnectionsLink *nodeConnection = cuckatooUNewestNodeConnections.get(node ^ 1);
-				if(nodeConnection->previousNodeConnectionLink) {
+				uint32_t nodeConnection = cuckatooUNewestNodeConnections.get(node ^ 1);
+				if(cuckatooNodeConnections[nodeConnection].previousNodeConnectionLink) {
 				
 					// Go through all of the node's pair's connections
-					for(; nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+					for(; nodeConnection; nodeConnection = cuckatooNodeConnections[nodeConnection].previousNodeConnectionLink) {
 					
 						// Check if the connected node's pair wasn't already visited
-						if(!cuckatooVVisitedNodePairs.contains((nodeConnection + 1)->node >> 1)) {
+						if(!cuckatooVVisitedNodePairs.contains(cuckatooNodeConnections[nodeConnection + 1].node >> 1)) {
 						
 							// Check if cycle is complete
-							if(((nodeConnection + 1)->node ^ 1) == cuckatooRootNode) {
+							if((cuckatooNodeConnections[nodeConnection + 1].node ^ 1) == cuckatooRootNode) {
 							
-								// Check if cycle is a solution
-								if(cycleSize == SOLUTION_SIZE - 1) {
+								// Check if cycle is a solution and adding it made the solutions full
+								if(cycleSize == SOLUTION_SIZE - 1 && addCuckatooSolutionFromVisitedNodePairs(solutions, numberOfSolutions, maximumNumberOfSolutions, cuckatooNodeConnections[nodeConnection + 1].node >> 1, nodeConnection + 1)) {
 								
-									// Get solution from visited nodes
-									cuckatooUVisitedNodePairs.getValues(solution);
-									cuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
-									solution[SOLUTION_SIZE - 1] = (nodeConnection + 1)->edgeIndex;
-									
-									// Sort solution in ascending order
-									sort(solution, solution + SOLUTION_SIZE);
-									
-									// Return true
-									return true;
+									// Return number of solutions
+									return numberOfSolutions;
 								}
 							}
 							
@@ -125,20 +226,13 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 							else if(cycleSize != SOLUTION_SIZE - 1) {
 							
 								// Check if the connected node has a pair
-								if(cuckatooVNewestNodeConnections.contains((nodeConnection + 1)->node ^ 1)) {
+								if(cuckatooVNewestNodeConnections.contains(cuckatooNodeConnections[nodeConnection + 1].node ^ 1)) {
 								
-									// Check if solution was found at the connected node's pair
-									if(searchNodeConnectionsForCuckatooSolutionSecondPartition(cycleSize + 1, (nodeConnection + 1)->node ^ 1, &(nodeConnection + 1)->edgeIndex)) {
+									// Check if searching at the connected node's pair made the solutions full
+									if(searchNodeConnectionsForCuckatooSolutions<SOLUTION_SIZE>(solutions, numberOfSolutions, maximumNumberOfSolutions, cycleSize + 1, cuckatooNodeConnections[nodeConnection + 1].node ^ 1, nodeConnection + 1)) {
 									
-										// Get solution from visited nodes
-										cuckatooUVisitedNodePairs.getValues(solution);
-										cuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
-										
-										// Sort solution in ascending order
-										sort(solution, solution + SOLUTION_SIZE);
-										
-										// Return true
-										return true;
+										// Return number of solutions
+										return numberOfSolutions;
 									}
 								}
 							}
@@ -149,9 +243,9 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 					break;
 				}
 				
-				// Go to node's pair opposite end and get its edge index
-				index = &(nodeConnection + 1)->edgeIndex;
-				node = (nodeConnection + 1)->node;
+				// Go to node's pair opposite end and get its edge's node connection
+				edgeNodeConnection = nodeConnection + 1;
+				node = cuckatooNodeConnections[edgeNodeConnection].node;
 				
 				// Check if node pair was already visited
 				if(cuckatooVVisitedNodePairs.contains(node >> 1)) {
@@ -163,19 +257,11 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 				// Check if cycle is complete
 				if((node ^ 1) == cuckatooRootNode) {
 				
-					// Check if cycle is a solution
-					if(cycleSize == SOLUTION_SIZE - 1) {
+					// Check if cycle is a solution and adding it made the solutions full
+					if(cycleSize == SOLUTION_SIZE - 1 && addCuckatooSolutionFromVisitedNodePairs(solutions, numberOfSolutions, maximumNumberOfSolutions, node >> 1, edgeNodeConnection)) {
 					
-						// Get solution from visited nodes
-						cuckatooUVisitedNodePairs.getValues(solution);
-						cuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
-						solution[SOLUTION_SIZE - 1] = *index;
-						
-						// Sort solution in ascending order
-						sort(solution, solution + SOLUTION_SIZE);
-						
-						// Return true
-						return true;
+						// Return number of solutions
+						return numberOfSolutions;
 					}
 					
 					// Break
@@ -197,33 +283,26 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 				}
 				
 				// Set that node pair has been visited
-				cuckatooVVisitedNodePairs.setUnique(node >> 1, index);
+				cuckatooVVisitedNodePairs.setUnique(node >> 1, edgeNodeConnection);
 				
 				// Check if node's pair has more than one connection
 				nodeConnection = cuckatooVNewestNodeConnections.get(node ^ 1);
-				if(nodeConnection->previousNodeConnectionLink) {
+				if(cuckatooNodeConnections[nodeConnection].previousNodeConnectionLink) {
 				
 					// Go through all of the node's pair's connections
-					for(; nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+					for(; nodeConnection; nodeConnection = cuckatooNodeConnections[nodeConnection].previousNodeConnectionLink) {
 					
 						// Check if the connected node has a pair
-						if(cuckatooUNewestNodeConnections.contains((nodeConnection - 1)->node ^ 1)) {
+						if(cuckatooUNewestNodeConnections.contains(cuckatooNodeConnections[nodeConnection - 1].node ^ 1)) {
 						
 							// Check if the connected node's pair wasn't already visited
-							if(!cuckatooUVisitedNodePairs.contains((nodeConnection - 1)->node >> 1)) {
+							if(!cuckatooUVisitedNodePairs.contains(cuckatooNodeConnections[nodeConnection - 1].node >> 1)) {
 							
-								// Check if solution was found at the connected node's pair
-								if(searchNodeConnectionsForCuckatooSolutionFirstPartition(cycleSize + 2, (nodeConnection - 1)->node ^ 1, &(nodeConnection - 1)->edgeIndex)) {
+								// Check if searching at the connected node's pair made the solutions full
+								if(searchNodeConnectionsForCuckatooSolutions<SOLUTION_SIZE>(solutions, numberOfSolutions, maximumNumberOfSolutions, cycleSize + 2, cuckatooNodeConnections[nodeConnection - 1].node ^ 1, nodeConnection - 1)) {
 								
-									// Get solution from visited nodes
-									cuckatooUVisitedNodePairs.getValues(solution);
-									cuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
-									
-									// Sort solution in ascending order
-									sort(solution, solution + SOLUTION_SIZE);
-									
-									// Return true
-									return true;
+									// Return number of solutions
+									return numberOfSolutions;
 								}
 							}
 						}
@@ -233,9 +312,9 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 					break;
 				}
 				
-				// Go to node's pair opposite end and get its edge index
-				index = &(nodeConnection - 1)->edgeIndex;
-				node = (nodeConnection - 1)->node;
+				// Go to node's pair opposite end and get its edge's node connection
+				edgeNodeConnection = nodeConnection - 1;
+				node = cuckatooNodeConnections[edgeNodeConnection].node;
 				
 				// Check if node pair was already visited
 				if(cuckatooUVisitedNodePairs.contains(node >> 1)) {
@@ -254,91 +333,340 @@ bool getCuckatooSolution(uint32_t solution[SOLUTION_SIZE], CuckatooNodeConnectio
 		}
 	}
 	
-	// Return false
-	return false;
+	// Return number of solutions
+	return numberOfSolutions;
 }
 
-// Search node connections for cuckatoo solution first partition
-bool searchNodeConnectionsForCuckatooSolutionFirstPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept {
+// Add cuckatoo solution from visited node pairs
+bool addCuckatooSolutionFromVisitedNodePairs(uint32_t solutions[][SOLUTION_SIZE], uint32_t &numberOfSolutions, const uint32_t maximumNumberOfSolutions, const uint32_t lastNodePair, const uint32_t lastNodeConnection) noexcept {
 
-	// Set that node pair has been visited
-	const uint32_t visitedNodePairIndex = cuckatooUVisitedNodePairs.setUniqueAndGetIndex(node >> 1, index);
+	// Set that the last node pair has been visited
+	const uint32_t lastNodePairIndex = cuckatooVVisitedNodePairs.setUniqueAndGetIndex(lastNodePair, lastNodeConnection);
+
+	// Get the node connections of the visited node pairs' edges
+	uint32_t *solution = solutions[numberOfSolutions++];
+	cuckatooUVisitedNodePairs.getValues(solution);
+	cuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
+	
+	// Set that the last node pair hasn't been visited so that searching can continue
+	cuckatooVVisitedNodePairs.removeMostRecentSetUique(lastNodePairIndex);
+	
+	// Go through all of the solution's node connections
+	for(uint_fast8_t i = 0; i < SOLUTION_SIZE; ++i) {
+	
+		// Set solution's edge to the node connection's edge index
+		solution[i] = cuckatooEdges[(solution[i] - 1) / 2 * EDGE_NUMBER_OF_COMPONENTS];
+	}
 	
-	// Go through all of the node's connections
-	for(const CuckatooNodeConnectionsLink *nodeConnection = cuckatooUNewestNodeConnections.get(node); nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+	// Sort solution in ascending order
+	sort(solution, solution + SOLUTION_SIZE);
 	
-		// Check if the connected node's pair wasn't already visited
-		if(!cuckatooVVisitedNodePairs.contains((nodeConnection + 1)->node >> 1)) {
+	// Return if solutions are full
+	return numberOfSolutions == maximumNumberOfSolutions;
+}
+
+// Search node connections for cuckatoo solutions
+template<const uint_fast8_t solutionSize> bool searchNodeConnectionsForCuckatooSolutions(uint32_t solutions[][SOLUTION_SIZE], uint32_t &numberOfSolutions, const uint32_t maximumNumberOfSolutions, uint_fast8_t cycleSize, const uint32_t node, const uint32_t edgeNodeConnection) noexcept {
+
+	// Check if node is on the first partition (Odd cycle sizes are on the first partition and even cycle sizes are on the second partition)
+	CuckatooSearchFrame frames[solutionSize];
+	CuckatooSearchFrame *frame = frames;
+	if(cycleSize & 1) {
+	
+		// Set that node pair has been visited and start at the node's newest connection
+		*frame = {cuckatooUNewestNodeConnections.get(node), cuckatooUVisitedNodePairs.setUniqueAndGetIndex(node >> 1, edgeNodeConnection)};
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set that node pair has been visited and start at the node's newest connection
+		*frame = {cuckatooVNewestNodeConnections.get(node), cuckatooVVisitedNodePairs.setUniqueAndGetIndex(node >> 1, edgeNodeConnection)};
+	}
+	
+	// Loop forever
+	while(true) {
+	
+		// Check if all of the frame's node connections were searched
+		if(!frame->nodeConnection) {
 		
-			// Check if cycle is complete
-			if(((nodeConnection + 1)->node ^ 1) == cuckatooRootNode) {
+			// Check if node is on the first partition
+			if(cycleSize & 1) {
 			
-				// Check if cycle is a solution
-				if(cycleSize == SOLUTION_SIZE - 1) {
-				
-					// Set that the connected node's pair has been visited
-					cuckatooVVisitedNodePairs.setUnique((nodeConnection + 1)->node >> 1, &(nodeConnection + 1)->edgeIndex);
-					
-					// Return true
-					return true;
-				}
+				// Set that node pair hasn't been visited
+				cuckatooUVisitedNodePairs.removeMostRecentSetUique(frame->visitedNodePairIndex);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Set that node pair hasn't been visited
+				cuckatooVVisitedNodePairs.removeMostRecentSetUique(frame->visitedNodePairIndex);
+			}
+			
+			// Check if frame is the first frame
+			if(frame == frames) {
+			
+				// Return false
+				return false;
 			}
 			
-			// Otherwise check if cycle could be as solution
-			else if(cycleSize != SOLUTION_SIZE - 1) {
+			// Go to previous frame and its next node connection
+			--frame;
+			--cycleSize;
+			frame->nodeConnection = cuckatooNodeConnections[frame->nodeConnection].previousNodeConnectionLink;
+			
+			// Continue
+			continue;
+		}
+		
+		// Check if node is on the first partition
+		if(cycleSize & 1) {
+		
+			// Check if the connected node's pair wasn't already visited
+			const uint32_t connectedNodeConnection = frame->nodeConnection + 1;
+			const uint32_t connectedNode = cuckatooNodeConnections[connectedNodeConnection].node;
+			if(!cuckatooVVisitedNodePairs.contains(connectedNode >> 1)) {
 			
-				// Check if the connected node has a pair
-				if(cuckatooVNewestNodeConnections.contains((nodeConnection + 1)->node ^ 1)) {
+				// Check if cycle is complete
+				if((connectedNode ^ 1) == cuckatooRootNode) {
 				
-					// Check if solution was found at the connected node's pair
-					if(searchNodeConnectionsForCuckatooSolutionSecondPartition(cycleSize + 1, (nodeConnection + 1)->node ^ 1, &(nodeConnection + 1)->edgeIndex)) {
+					// Check if cycle is a solution and adding it made the solutions full
+					if(cycleSize == solutionSize - 1 && addCuckatooSolutionFromVisitedNodePairs(solutions, numberOfSolutions, maximumNumberOfSolutions, connectedNode >> 1, connectedNodeConnection)) {
 					
 						// Return true
 						return true;
 					}
 				}
+
+				// Otherwise check if cycle could be as solution and the connected node has a pair
+				else if(cycleSize != solutionSize - 1 && cuckatooVNewestNodeConnections.contains(connectedNode ^ 1)) {
+				
+					// Go to next frame and set that the connected node's pair has been visited
+					*++frame = {cuckatooVNewestNodeConnections.get(connectedNode ^ 1), cuckatooVVisitedNodePairs.setUniqueAndGetIndex(connectedNode >> 1, connectedNodeConnection)};
+					++cycleSize;
+					
+					// Continue
+					continue;
+				}
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if the connected node has a pair and the connected node's pair wasn't already visited
+			const uint32_t connectedNodeConnection = frame->nodeConnection - 1;
+			const uint32_t connectedNode = cuckatooNodeConnections[connectedNodeConnection].node;
+			if(cuckatooUNewestNodeConnections.contains(connectedNode ^ 1) && !cuckatooUVisitedNodePairs.contains(connectedNode >> 1)) {
+			
+				// Go to next frame and set that the connected node's pair has been visited
+				*++frame = {cuckatooUNewestNodeConnections.get(connectedNode ^ 1), cuckatooUVisitedNodePairs.setUniqueAndGetIndex(connectedNode >> 1, connectedNodeConnection)};
+				++cycleSize;
+				
+				// Continue
+				continue;
 			}
 		}
+		
+		// Go to frame's next node connection
+		frame->nodeConnection = cuckatooNodeConnections[frame->nodeConnection].previousNodeConnectionLink;
+	}
+}
+
+// Add cuckatoo CSR edge
+bool addCuckatooCsrEdge(CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &csrAdjacency, const uint32_t edge, const bool filterCycles) noexcept {
+
+	// Get edge's nodes
+	const uint32_t firstPartitionNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 1];
+	const uint32_t secondPartitionNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 2];
+	
+	// Get newest connections for the nodes' pairs
+	const uint32_t firstPartitionPairConnection = cuckatooUNewestNodeConnections.get(firstPartitionNode ^ 1);
+	const uint32_t secondPartitionPairConnection = cuckatooVNewestNodeConnections.get(secondPartitionNode ^ 1);
+	
+	// Set nodes' newest connections to the edge's connections and get their previous newest connections
+	const uint32_t firstPartitionPreviousConnection = cuckatooUNewestNodeConnections.replace(firstPartitionNode, csrAdjacency.getEdgesConnection(edge, 0));
+	const uint32_t secondPartitionPreviousConnection = cuckatooVNewestNodeConnections.replace(secondPartitionNode, csrAdjacency.getEdgesConnection(edge, 1));
+	
+	// Check if not filtering cycles
+	if(!filterCycles) {
+	
+		// Return if both nodes have a pair
+		return firstPartitionPairConnection && secondPartitionPairConnection;
 	}
 	
-	// Set that node pair hasn't been visited
-	cuckatooUVisitedNodePairs.removeMostRecentSetUique(visitedNodePairIndex);
+	// Set closes cycle to false
+	bool closesCycle = false;
+	
+	// Check if both nodes have a pair
+	if(firstPartitionPairConnection && secondPartitionPairConnection) {
+	
+		// Check if the pairs are already connected by a component that has enough edges to complete a solution with this edge
+		const uint32_t firstPartitionPairComponent = cuckatooComponents.find(csrAdjacency.getConnectionsEdge(firstPartitionPairConnection));
+		closesCycle = firstPartitionPairComponent == cuckatooComponents.find(csrAdjacency.getConnectionsEdge(secondPartitionPairConnection)) && cuckatooComponents.getSize(firstPartitionPairComponent) >= SOLUTION_SIZE - 1;
+	}
+	
+	// Create component for the edge
+	uint32_t component = edge;
+	cuckatooComponents.add(component);
+	
+	// Go through all of the edge's neighbors
+	for(const uint32_t neighbor : {firstPartitionPairConnection, secondPartitionPairConnection, firstPartitionPreviousConnection, secondPartitionPreviousConnection}) {
+	
+		// Check if neighbor exists
+		if(neighbor) {
+		
+			// Join neighbor's component with the edge's component
+			component = cuckatooComponents.join(component, cuckatooComponents.find(csrAdjacency.getConnectionsEdge(neighbor)));
+		}
+	}
+	
+	// Return if edge closes a cycle
+	return closesCycle;
+}
+
+// Get cuckatoo solutions from CSR adjacency (Searching edges must be in ascending order)
+uint32_t getCuckatooSolutionsFromCsrAdjacency(uint32_t solutions[][SOLUTION_SIZE], const uint32_t maximumNumberOfSolutions, CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &csrAdjacency, const uint32_t *searchingEdges, const uint32_t numberOfSearchingEdges, const bool filterCycles) noexcept {
+
+	// Set number of solutions to zero
+	uint32_t numberOfSolutions = 0;
+	
+	// Go through all searching edges
+	for(uint32_t i = 0; i < numberOfSearchingEdges; ++i) {
+	
+		// Check if adding edge closes a cycle that could be a solution
+		const uint32_t edge = searchingEdges[i];
+		if(addCuckatooCsrEdge(csrAdjacency, edge, filterCycles)) {
+		
+			// Reset visited nodes
+			cuckatooUVisitedNodePairs.clear();
+			cuckatooVVisitedNodePairs.clear();
+			
+			// Check if searching from the edge's node on the first partition made the solutions full
+			cuckatooRootNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 2];
+			if(searchCsrAdjacencyForCuckatooSolutions<SOLUTION_SIZE>(solutions, numberOfSolutions, maximumNumberOfSolutions, csrAdjacency, 1, cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 1] ^ 1, edge * 2 + 1)) {
+			
+				// Return number of solutions
+				return numberOfSolutions;
+			}
+		}
+	}
 	
-	// Return false
-	return false;
+	// Return number of solutions
+	return numberOfSolutions;
 }
 
-// Search node connections for cuckatoo solution second partition
-bool searchNodeConnectionsForCuckatooSolutionSecondPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept {
+// Search CSR adjacency for cuckatoo solutions (Visited node pairs are set to node connection link indices so that solutions are gotten the same way for both adjacencies)
+template<const uint_fast8_t solutionSize> bool searchCsrAdjacencyForCuckatooSolutions(uint32_t solutions[][SOLUTION_SIZE], uint32_t &numberOfSolutions, const uint32_t maximumNumberOfSolutions, const CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &csrAdjacency, uint_fast8_t cycleSize, const uint32_t node, const uint32_t edgeNodeConnection) noexcept {
+
+	// Check if node is on the first partition (Odd cycle sizes are on the first partition and even cycle sizes are on the second partition)
+	CuckatooSearchFrame frames[solutionSize];
+	CuckatooSearchFrame *frame = frames;
+	if(cycleSize & 1) {
 	
-	// Set that node pair has been visited
-	const uint32_t visitedNodePairIndex = cuckatooVVisitedNodePairs.setUniqueAndGetIndex(node >> 1, index);
+		// Set that node pair has been visited and start at the node's newest connection
+		*frame = {cuckatooUNewestNodeConnections.get(node), cuckatooUVisitedNodePairs.setUniqueAndGetIndex(node >> 1, edgeNodeConnection)};
+	}
 	
-	// Go through all of the node's connections
-	for(const CuckatooNodeConnectionsLink *nodeConnection = cuckatooVNewestNodeConnections.get(node); nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+	// Otherwise
+	else {
 	
-		// Check if the connected node has a pair
-		if(cuckatooUNewestNodeConnections.contains((nodeConnection - 1)->node ^ 1)) {
+		// Set that node pair has been visited and start at the node's newest connection
+		*frame = {cuckatooVNewestNodeConnections.get(node), cuckatooVVisitedNodePairs.setUniqueAndGetIndex(node >> 1, edgeNodeConnection)};
+	}
+	
+	// Loop forever
+	while(true) {
+	
+		// Check if all of the frame's connections were searched
+		if(!frame->nodeConnection) {
+		
+			// Check if node is on the first partition
+			if(cycleSize & 1) {
+			
+				// Set that node pair hasn't been visited
+				cuckatooUVisitedNodePairs.removeMostRecentSetUique(frame->visitedNodePairIndex);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Set that node pair hasn't been visited
+				cuckatooVVisitedNodePairs.removeMostRecentSetUique(frame->visitedNodePairIndex);
+			}
+			
+			// Check if frame is the first frame
+			if(frame == frames) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Go to previous frame and its next connection
+			--frame;
+			--cycleSize;
+			frame->nodeConnection = csrAdjacency.getPreviousConnection(frame->nodeConnection);
+			
+			// Continue
+			continue;
+		}
+		
+		// Get connection's edge
+		const uint32_t edge = csrAdjacency.getConnectionsEdge(frame->nodeConnection);
+		
+		// Check if node is on the first partition
+		if(cycleSize & 1) {
 		
 			// Check if the connected node's pair wasn't already visited
-			if(!cuckatooUVisitedNodePairs.contains((nodeConnection - 1)->node >> 1)) {
+			const uint32_t connectedNodeConnection = edge * 2 + 2;
+			const uint32_t connectedNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 2];
+			if(!cuckatooVVisitedNodePairs.contains(connectedNode >> 1)) {
 			
-				// Check if solution was found at the connected node's pair
-				if(searchNodeConnectionsForCuckatooSolutionFirstPartition(cycleSize + 1, (nodeConnection - 1)->node ^ 1, &(nodeConnection - 1)->edgeIndex)) {
+				// Check if cycle is complete
+				if((connectedNode ^ 1) == cuckatooRootNode) {
+				
+					// Check if cycle is a solution and adding it made the solutions full
+					if(cycleSize == solutionSize - 1 && addCuckatooSolutionFromVisitedNodePairs(solutions, numberOfSolutions, maximumNumberOfSolutions, connectedNode >> 1, connectedNodeConnection)) {
+					
+						// Return true
+						return true;
+					}
+				}
 				
-					// Return true
-					return true;
+				// Otherwise check if cycle could be as solution and the connected node has a pair
+				else if(cycleSize != solutionSize - 1 && cuckatooVNewestNodeConnections.contains(connectedNode ^ 1)) {
+				
+					// Go to next frame and set that the connected node's pair has been visited
+					*++frame = {cuckatooVNewestNodeConnections.get(connectedNode ^ 1), cuckatooVVisitedNodePairs.setUniqueAndGetIndex(connectedNode >> 1, connectedNodeConnection)};
+					++cycleSize;
+					
+					// Continue
+					continue;
 				}
 			}
 		}
+		
+		// Otherwise
+		else {
+		
+			// Check if the connected node has a pair and the connected node's pair wasn't already visited
+			const uint32_t connectedNodeConnection = edge * 2 + 1;
+			const uint32_t connectedNode = cuckatooEdges[edge * EDGE_NUMBER_OF_COMPONENTS + 1];
+			if(cuckatooUNewestNodeConnections.contains(connectedNode ^ 1) && !cuckatooUVisitedNodePairs.contains(connectedNode >> 1)) {
+			
+				// Go to next frame and set that the connected node's pair has been visited
+				*++frame = {cuckatooUNewestNodeConnections.get(connectedNode ^ 1), cuckatooUVisitedNodePairs.setUniqueAndGetIndex(connectedNode >> 1, connectedNodeConnection)};
+				++cycleSize;
+				
+				// Continue
+				continue;
+			}
+		}
+		
+		// Go to frame's next connection
+		frame->nodeConnection = csrAdjacency.getPreviousConnection(frame->nodeConnection);
 	}
-	
-	// Set that node pair hasn't been visited
-	cuckatooVVisitedNodePairs.removeMostRecentSetUique(visitedNodePairIndex);
-	
-	// Return false
-	return false;
 }
 
-
 #endif
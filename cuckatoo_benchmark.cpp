@@ -0,0 +1,308 @@
+// Constants
+
+// OpenCL target version (OpenCL v1.2)
+#define CL_TARGET_OPENCL_VERSION 120
+
+// Metal target version (Metal v3.0)
+#define METAL_TARGET_VERSION MTL::LanguageVersion3_0
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// System version
+	#define _WIN32_WINNT _WIN32_WINNT_VISTA
+	
+	// Use Unicode
+	#define UNICODE
+	#define _UNICODE
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Use Metal
+	#define MTL_PRIVATE_IMPLEMENTATION
+	
+	// Use NS
+	#define NS_PRIVATE_IMPLEMENTATION
+	
+	// Use bounds-checking interfaces
+	#define __STDC_WANT_LIB_EXT1__ 1
+#endif
+
+
+// Header files
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// Header files
+	#include <ws2tcpip.h>
+	#include <CL/cl.h>
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Header files
+	#include <TargetConditionals.h>
+	#include <arpa/inet.h>
+	#include <netdb.h>
+	#include <poll.h>
+	#include <sys/sysctl.h>
+	#include "./metal.h"
+	
+	// Check if using macOS
+	#if TARGET_OS_OSX == 1
+	
+		// Header files
+		#include <IOKit/pwr_mgt/IOPMLib.h>
+	#endif
+	
+	// Check if using OpenCL
+	#ifdef USE_OPENCL
+	
+		// Header files
+		#include <OpenCL/opencl.h>
+	#endif
+	
+// Otherwise
+#else
+
+	// Header files
+	#include <arpa/inet.h>
+	#include <CL/cl.h>
+	#include <CL/cl_ext.h>
+	#include <netdb.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+	
+	// Check if using FreeBSD
+	#ifdef __FreeBSD__
+	
+		// Header files
+		#include <pthread_np.h>
+	#endif
+	
+	// Check if not using Android
+	#ifndef __ANDROID__
+	
+		// Header files
+		#include <dbus/dbus.h>
+	#endif
+#endif
+
+// Header files
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cinttypes>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "./main.h"
+#include "./common.h"
+#include "./blake2b.h"
+#include "./hash_table.h"
+#include "./dense_table.h"
+#include "./disjoint_set.h"
+#include "./node_renamer.h"
+#include "./csr_adjacency.h"
+#include "./siphash.h"
+#include "./cuckatoo.h"
+#include "./test_graphs.h"
+
+using namespace std;
+
+
+// Configurable constants
+
+// Number of nonces (A graph is trimmed and searched for every nonce from zero to this)
+#define NUMBER_OF_NONCES 10
+
+// Max number of solutions per graph
+#define MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH 8
+
+
+// Constants
+
+// Check if using hash table searching
+#ifdef USE_HASH_TABLE_SEARCHING
+
+	// Searching tables name
+	#define SEARCHING_TABLES_NAME "hash tables"
+	
+// Otherwise
+#else
+
+	// Searching tables name
+	#define SEARCHING_TABLES_NAME "dense tables"
+#endif
+
+
+// Function prototypes
+
+// Search edges
+static inline bool searchEdges(const uint32_t *edges, const uint32_t *searchingEdges, const uint64_t numberOfEdges, CuckatooNodeConnectionsLink *nodeConnections, uint64_t &numberOfSolutions, double &searchingTime) noexcept;
+
+
+// Main function
+int main() {
+
+	// Check if creating the edges, trimming buffers, node connections, or node renamer failed
+	const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[NUMBER_OF_EDGES * EDGE_NUMBER_OF_COMPONENTS]);
+	const unique_ptr<uint32_t[]> trimmedEdges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
+	const unique_ptr<uint32_t[]> renamedEdges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
+	const unique_ptr<uint32_t[]> searchingEdges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING]);
+	const unique_ptr<uint32_t[]> nodesDegrees(new(nothrow) uint32_t[NUMBER_OF_EDGES]);
+	const unique_ptr<bool[]> edgesRemoved(new(nothrow) bool[NUMBER_OF_EDGES]);
+	const unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2 + 1]);
+	NodeRenamer<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> nodeRenamer(1);
+	if(!edges || !trimmedEdges || !renamedEdges || !searchingEdges || !nodesDegrees || !edgesRemoved || !nodeConnections || !nodeRenamer) {
+	
+		// Display message
+		cout << "Creating the benchmark's buffers failed" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Go through all searching edges
+	for(uint64_t i = 0; i < MAX_NUMBER_OF_EDGES_AFTER_TRIMMING; ++i) {
+	
+		// Set searching edge
+		searchingEdges[i] = i;
+	}
+	
+	// Set header's midstate from an empty header
+	Blake2bMidstate headerMidstate;
+	const uint8_t header[HEADER_SIZE] = {};
+	setBlake2bMidstate(headerMidstate, header);
+	
+	// Create threads barrier
+	barrier<> threadsBarrier(1);
+	
+	// Set number of graphs, edges, times, and solutions to zero
+	uint64_t numberOfGraphs = 0;
+	uint64_t totalNumberOfEdges = 0;
+	double renamingTime = 0;
+	double renamedNodesSearchingTime = 0;
+	uint64_t numberOfRenamedNodesSolutions = 0;
+	
+	// Check if there's no trimming rounds or using hash table searching
+	#if TRIMMING_ROUNDS == 0 || defined USE_HASH_TABLE_SEARCHING
+	
+		// Original nodes searching time
+		double originalNodesSearchingTime = 0;
+		
+		// Number of original nodes solutions
+		uint64_t numberOfOriginalNodesSolutions = 0;
+	#endif
+	
+	// Go through all nonces
+	for(uint64_t nonce = 0; nonce < NUMBER_OF_NONCES; ++nonce) {
+	
+		// Get graph's edges from the header and nonce
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+		blake2b(sipHashKeys, headerMidstate, nonce);
+		getTestGraphsEdges(edges.get(), sipHashKeys);
+		
+		// Check if trimming graph's edges left more edges than can be searched
+		const uint64_t numberOfEdges = trimTestGraphsEdges(trimmedEdges.get(), MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, edges.get(), TRIMMING_ROUNDS, nodesDegrees.get(), edgesRemoved.get());
+		if(numberOfEdges > MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
+		
+			// Continue
+			continue;
+		}
+		
+		// Increment number of graphs and add number of edges to the total number of edges
+		++numberOfGraphs;
+		totalNumberOfEdges += numberOfEdges;
+		
+		// Check if there's no trimming rounds or using hash table searching
+		#if TRIMMING_ROUNDS == 0 || defined USE_HASH_TABLE_SEARCHING
+		
+			// Check if searching the edges' original nodes failed (The searching tables accept any node when there's no trimming rounds or they're hash tables)
+			if(!searchEdges(trimmedEdges.get(), searchingEdges.get(), numberOfEdges, nodeConnections.get(), numberOfOriginalNodesSolutions, originalNodesSearchingTime)) {
+			
+				// Display message
+				cout << "Initializing cuckatoo thread local global variables failed" << endl;
+				
+				// Return failure
+				return EXIT_FAILURE;
+			}
+		#endif
+		
+		// Rename edges' nodes to dense identifiers
+		const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+		nodeRenamer.rename(renamedEdges.get(), trimmedEdges.get(), numberOfEdges, 0, threadsBarrier);
+		renamingTime += static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+		
+		// Check if searching the edges' renamed nodes failed
+		if(!searchEdges(renamedEdges.get(), searchingEdges.get(), numberOfEdges, nodeConnections.get(), numberOfRenamedNodesSolutions, renamedNodesSearchingTime)) {
+		
+			// Display message
+			cout << "Initializing cuckatoo thread local global variables failed" << endl;
+			
+			// Return failure
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// Check if no graphs could be searched
+	if(!numberOfGraphs) {
+	
+		// Display message
+		cout << "Trimming left more edges than can be searched for every graph" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Display message
+	cout << "Cuckatoo" << EDGE_BITS << " after " << TRIMMING_ROUNDS << " trimming rounds with " << SEARCHING_TABLES_NAME << ": " << numberOfGraphs << " graphs with " << totalNumberOfEdges / numberOfGraphs << " edges on average" << endl;
+	
+	// Check if there's no trimming rounds or using hash table searching
+	#if TRIMMING_ROUNDS == 0 || defined USE_HASH_TABLE_SEARCHING
+	
+		// Display message
+		cout << "\tSearching original nodes: " << originalNodesSearchingTime * MILLISECONDS_IN_A_SECOND / numberOfGraphs << " ms per graph (" << numberOfOriginalNodesSolutions << " solutions)" << endl;
+	#endif
+	
+	// Display message
+	cout << "\tRenaming nodes: " << renamingTime * MILLISECONDS_IN_A_SECOND / numberOfGraphs << " ms per graph" << endl;
+	cout << "\tSearching renamed nodes: " << renamedNodesSearchingTime * MILLISECONDS_IN_A_SECOND / numberOfGraphs << " ms per graph (" << numberOfRenamedNodesSolutions << " solutions)" << endl;
+	cout << "\tRenaming and searching renamed nodes: " << (renamingTime + renamedNodesSearchingTime) * MILLISECONDS_IN_A_SECOND / numberOfGraphs << " ms per graph" << endl;
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Search edges
+bool searchEdges(const uint32_t *edges, const uint32_t *searchingEdges, const uint64_t numberOfEdges, CuckatooNodeConnectionsLink *nodeConnections, uint64_t &numberOfSolutions, double &searchingTime) noexcept {
+
+	// Check if initializing cuckatoo thread local global variables failed
+	if(!initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get solutions from the edges (Cycles are only filtered when the edges were trimmed)
+	const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+	uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+	numberOfSolutions += getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, searchingEdges, numberOfEdges, TRIMMING_ROUNDS);
+	
+	// Reset node connections
+	cuckatooUNewestNodeConnections.clear();
+	cuckatooVNewestNodeConnections.clear();
+	searchingTime += static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+	
+	// Return true
+	return true;
+}
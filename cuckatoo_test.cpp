@@ -0,0 +1,705 @@
+// Constants
+
+// OpenCL target version (OpenCL v1.2)
+#define CL_TARGET_OPENCL_VERSION 120
+
+// Metal target version (Metal v3.0)
+#define METAL_TARGET_VERSION MTL::LanguageVersion3_0
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// System version
+	#define _WIN32_WINNT _WIN32_WINNT_VISTA
+	
+	// Use Unicode
+	#define UNICODE
+	#define _UNICODE
+
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Use Metal
+	#define MTL_PRIVATE_IMPLEMENTATION
+	
+	// Use NS
+	#define NS_PRIVATE_IMPLEMENTATION
+	
+	// Use bounds-checking interfaces
+	#define __STDC_WANT_LIB_EXT1__ 1
+#endif
+
+
+// Header files
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// Header files
+	#include <ws2tcpip.h>
+	#include <CL/cl.h>
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Header files
+	#include <TargetConditionals.h>
+	#include <arpa/inet.h>
+	#include <netdb.h>
+	#include <poll.h>
+	#include <sys/sysctl.h>
+	#include "./metal.h"
+	
+	// Check if using macOS
+	#if TARGET_OS_OSX == 1
+	
+		// Header files
+		#include <IOKit/pwr_mgt/IOPMLib.h>
+	#endif
+	
+	// Check if using OpenCL
+	#ifdef USE_OPENCL
+	
+		// Header files
+		#include <OpenCL/opencl.h>
+	#endif
+	
+// Otherwise
+#else
+
+	// Header files
+	#include <arpa/inet.h>
+	#include <CL/cl.h>
+	#include <CL/cl_ext.h>
+	#include <netdb.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+	
+	// Check if using FreeBSD
+	#ifdef __FreeBSD__
+	
+		// Header files
+		#include <pthread_np.h>
+	#endif
+	
+	// Check if not using Android
+	#ifndef __ANDROID__
+	
+		// Header files
+		#include <dbus/dbus.h>
+	#endif
+#endif
+
+// Header files
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cinttypes>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "./main.h"
+#include "./common.h"
+#include "./blake2b.h"
+#include "./hash_table.h"
+#include "./dense_table.h"
+#include "./disjoint_set.h"
+#include "./node_renamer.h"
+#include "./csr_adjacency.h"
+#include "./siphash.h"
+#include "./cuckatoo.h"
+#include "./test_graphs.h"
+
+using namespace std;
+
+
+// Configurable constants
+
+// Number of nonces (A graph is searched for every nonce from zero to this)
+#define NUMBER_OF_NONCES 200
+
+// Number of trimming rounds (Each graph is also searched after this many rounds of trimming it so that the renamed and filtered search is compared too)
+#define NUMBER_OF_TRIMMING_ROUNDS 20
+
+// Max number of solutions per graph
+#define MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH 8
+
+
+// Checks
+
+// Throw error if trimming rounds isn't zero (The graphs are trimmed by the test, so the searches must accept every edge)
+static_assert(TRIMMING_ROUNDS == 0, "Trimming rounds isn't zero");
+
+
+// Structures
+
+// Recursive cuckatoo node connections link structure (This is the recursive search that the iterative search replaced, and it's kept here as a reference to compare solutions with except that its visited node pairs store edge indices instead of pointers to them since hash tables store values)
+struct RecursiveCuckatooNodeConnectionsLink {
+
+	// Previous node connection link
+	const RecursiveCuckatooNodeConnectionsLink *previousNodeConnectionLink;
+	
+	// Node
+	uint32_t node;
+	
+	// Edge index
+	uint32_t edgeIndex;
+};
+
+
+// Global variables
+
+// Recursive cuckatoo newest node connections
+static HashTable<const RecursiveCuckatooNodeConnectionsLink *, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> recursiveCuckatooUNewestNodeConnections;
+static HashTable<const RecursiveCuckatooNodeConnectionsLink *, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> recursiveCuckatooVNewestNodeConnections;
+
+// Recursive cuckatoo visited pairs
+static HashTable<uint32_t, SOLUTION_SIZE / 2> recursiveCuckatooUVisitedNodePairs;
+static HashTable<uint32_t, SOLUTION_SIZE / 2> recursiveCuckatooVVisitedNodePairs;
+
+// Recursive cuckatoo root node
+static uint32_t recursiveCuckatooRootNode;
+
+
+// Function prototypes
+
+// Get recursive cuckatoo solution
+static inline bool getRecursiveCuckatooSolution(uint32_t solution[SOLUTION_SIZE], RecursiveCuckatooNodeConnectionsLink *__restrict__ nodeConnections, const uint32_t *__restrict__ edges, const uint64_t numberOfEdges) noexcept;
+
+// Search node connections for recursive cuckatoo solution first partition
+static inline bool searchNodeConnectionsForRecursiveCuckatooSolutionFirstPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept;
+
+// Search node connections for recursive cuckatoo solution second partition
+static inline bool searchNodeConnectionsForRecursiveCuckatooSolutionSecondPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept;
+
+// Is cuckatoo solution
+static inline bool isCuckatooSolution(const uint32_t solution[SOLUTION_SIZE], const uint32_t *edges) noexcept;
+
+// Compare solutions
+static inline bool compareSolutions(const char *search, const uint64_t nonce, const bool recursiveSolutionFound, const uint32_t recursiveSolution[SOLUTION_SIZE], uint32_t solutions[][SOLUTION_SIZE], const uint32_t numberOfSolutions, const uint32_t *edges) noexcept;
+
+
+// Main function
+int main() {
+
+	// Check if creating the edges, trimming buffers, node connections, tables, node renamer, or CSR adjacency failed
+	const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[NUMBER_OF_EDGES * EDGE_NUMBER_OF_COMPONENTS]);
+	const unique_ptr<uint32_t[]> trimmedEdges(new(nothrow) uint32_t[NUMBER_OF_EDGES * EDGE_NUMBER_OF_COMPONENTS]);
+	const unique_ptr<uint32_t[]> renamedEdges(new(nothrow) uint32_t[NUMBER_OF_EDGES * EDGE_NUMBER_OF_COMPONENTS]);
+	const unique_ptr<uint32_t[]> searchingEdges(new(nothrow) uint32_t[NUMBER_OF_EDGES]);
+	const unique_ptr<uint32_t[]> nodesDegrees(new(nothrow) uint32_t[NUMBER_OF_EDGES]);
+	const unique_ptr<bool[]> edgesRemoved(new(nothrow) bool[NUMBER_OF_EDGES]);
+	const unique_ptr<RecursiveCuckatooNodeConnectionsLink[]> recursiveNodeConnections(new(nothrow) RecursiveCuckatooNodeConnectionsLink[NUMBER_OF_EDGES * 2]);
+	const unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections(new(nothrow) CuckatooNodeConnectionsLink[NUMBER_OF_EDGES * 2 + 1]);
+	NodeRenamer<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> nodeRenamer(1);
+	const unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> csrAdjacency(new(nothrow) CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(1));
+	if(!edges || !trimmedEdges || !renamedEdges || !searchingEdges || !nodesDegrees || !edgesRemoved || !recursiveNodeConnections || !nodeConnections || !recursiveCuckatooUNewestNodeConnections || !recursiveCuckatooVNewestNodeConnections || !recursiveCuckatooUVisitedNodePairs || !recursiveCuckatooVVisitedNodePairs || !nodeRenamer || !csrAdjacency || !*csrAdjacency) {
+	
+		// Display message
+		cout << "Creating the test's buffers failed" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Go through all searching edges
+	for(uint64_t i = 0; i < NUMBER_OF_EDGES; ++i) {
+	
+		// Set searching edge
+		searchingEdges[i] = i;
+	}
+	
+	// Set header's midstate from an empty header
+	Blake2bMidstate headerMidstate;
+	const uint8_t header[HEADER_SIZE] = {};
+	setBlake2bMidstate(headerMidstate, header);
+	
+	// Go through all nonces
+	barrier<> threadsBarrier(1);
+	uint64_t numberOfRecursiveSolutions = 0;
+	bool solutionsMatch = true;
+	for(uint64_t nonce = 0; nonce < NUMBER_OF_NONCES; ++nonce) {
+	
+		// Get graph's edges from the header and nonce
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+		blake2b(sipHashKeys, headerMidstate, nonce);
+		getTestGraphsEdges(edges.get(), sipHashKeys);
+		
+		// Go through the graph untrimmed and trimmed
+		for(const unsigned int numberOfTrimmingRounds : {0, NUMBER_OF_TRIMMING_ROUNDS}) {
+		
+			// Trim graph's edges
+			const uint64_t numberOfEdges = trimTestGraphsEdges(trimmedEdges.get(), NUMBER_OF_EDGES, edges.get(), numberOfTrimmingRounds, nodesDegrees.get(), edgesRemoved.get());
+			
+			// Get solution from the recursive search
+			uint32_t recursiveSolution[SOLUTION_SIZE];
+			recursiveCuckatooRootNode = 0;
+			const bool recursiveSolutionFound = getRecursiveCuckatooSolution(recursiveSolution, recursiveNodeConnections.get(), trimmedEdges.get(), numberOfEdges);
+			
+			// Reset recursive node connections
+			recursiveCuckatooUNewestNodeConnections.clear();
+			recursiveCuckatooVNewestNodeConnections.clear();
+			
+			// Check if recursive solution was found
+			if(recursiveSolutionFound) {
+			
+				// Increment number of recursive solutions
+				++numberOfRecursiveSolutions;
+			}
+			
+			// Check if graph was trimmed
+			const uint32_t *searchedEdges = trimmedEdges.get();
+			if(numberOfTrimmingRounds) {
+			
+				// Rename edges' nodes to dense identifiers like the searching threads do when there's trimming rounds
+				nodeRenamer.rename(renamedEdges.get(), trimmedEdges.get(), numberOfEdges, 0, threadsBarrier);
+				searchedEdges = renamedEdges.get();
+			}
+			
+			// Check if initializing cuckatoo thread local global variables failed
+			if(!initializeCuckatooThreadLocalGlobalVariables(nodeConnections.get(), searchedEdges)) {
+			
+				// Display message
+				cout << "Initializing cuckatoo thread local global variables failed" << endl;
+				
+				// Return failure
+				return EXIT_FAILURE;
+			}
+			
+			// Get solutions from the iterative search (Cycles are only filtered when the edges were trimmed)
+			uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+			uint32_t numberOfSolutions = getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, searchingEdges.get(), numberOfEdges, numberOfTrimmingRounds);
+			
+			// Reset node connections
+			cuckatooUNewestNodeConnections.clear();
+			cuckatooVNewestNodeConnections.clear();
+			
+			// Check if solutions don't match the recursive search's
+			if(!compareSolutions(numberOfTrimmingRounds ? "Trimmed iterative" : "Untrimmed iterative", nonce, recursiveSolutionFound, recursiveSolution, solutions, numberOfSolutions, edges.get())) {
+			
+				// Set that solutions don't match
+				solutionsMatch = false;
+			}
+			
+			// Build CSR adjacency from the edges
+			csrAdjacency->build(searchedEdges, numberOfEdges, 0, threadsBarrier);
+			
+			// Get solutions from the iterative search using the CSR adjacency (Cycles are only filtered when the edges were trimmed)
+			numberOfSolutions = getCuckatooSolutionsFromCsrAdjacency(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, *csrAdjacency, searchingEdges.get(), numberOfEdges, numberOfTrimmingRounds);
+			
+			// Reset node connections
+			cuckatooUNewestNodeConnections.clear();
+			cuckatooVNewestNodeConnections.clear();
+			
+			// Check if solutions don't match the recursive search's
+			if(!compareSolutions(numberOfTrimmingRounds ? "Trimmed CSR" : "Untrimmed CSR", nonce, recursiveSolutionFound, recursiveSolution, solutions, numberOfSolutions, edges.get())) {
+			
+				// Set that solutions don't match
+				solutionsMatch = false;
+			}
+		}
+	}
+	
+	// Display message
+	cout << "Searched " << NUMBER_OF_NONCES << " graphs untrimmed and trimmed, and the recursive search found " << numberOfRecursiveSolutions << " solutions" << endl;
+	
+	// Check if solutions don't match or no solutions were found to compare
+	if(!solutionsMatch || !numberOfRecursiveSolutions) {
+	
+		// Display message
+		cout << (solutionsMatch ? "No solutions were found to compare" : "Solutions don't match") << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Display message
+	cout << "Solutions match" << endl;
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Get recursive cuckatoo solution
+bool getRecursiveCuckatooSolution(uint32_t solution[SOLUTION_SIZE], RecursiveCuckatooNodeConnectionsLink *__restrict__ nodeConnections, const uint32_t *__restrict__ edges, const uint64_t numberOfEdges) noexcept {
+
+	// Go through all edges
+	for(uint64_t nodeConnectionsIndex = 0, edgesIndex = 0; nodeConnectionsIndex < numberOfEdges * 2; nodeConnectionsIndex += 2, edgesIndex += EDGE_NUMBER_OF_COMPONENTS) {
+	
+		// Get edge's index and nodes
+		const uint32_t *index = &edges[edgesIndex];
+		uint32_t node = edges[edgesIndex + 1];
+		recursiveCuckatooRootNode = edges[edgesIndex + 2];
+		
+		// Replace newest node connection for the node on the first partition and add node connection to list
+		nodeConnections[nodeConnectionsIndex] = {recursiveCuckatooUNewestNodeConnections.replace(node, &nodeConnections[nodeConnectionsIndex]), node, edges[edgesIndex]};
+		
+		// Replace newest node connection for the node on the second partition and add node connection to list
+		nodeConnections[nodeConnectionsIndex + 1] = {recursiveCuckatooVNewestNodeConnections.replace(recursiveCuckatooRootNode, &nodeConnections[nodeConnectionsIndex + 1]), recursiveCuckatooRootNode, edges[edgesIndex]};
+		
+		// Check if both nodes have a pair
+		if(recursiveCuckatooUNewestNodeConnections.contains(node ^ 1) && recursiveCuckatooVNewestNodeConnections.contains(recursiveCuckatooRootNode ^ 1)) {
+		
+			// Reset visited nodes
+			recursiveCuckatooUVisitedNodePairs.clear();
+			recursiveCuckatooVVisitedNodePairs.clear();
+			
+			// Go through all nodes in the cycle
+			for(uint_fast8_t cycleSize = 1;; cycleSize += 2) {
+			
+				// Set that node pair has been visited
+				recursiveCuckatooUVisitedNodePairs.setUnique(node >> 1, *index);
+				
+				// Check if node's pair has more than one connection
+				const RecursiveCuckatooNodeConnectionsLink *nodeConnection = recursiveCuckatooUNewestNodeConnections.get(node ^ 1);
+				if(nodeConnection->previousNodeConnectionLink) {
+				
+					// Go through all of the node's pair's connections
+					for(; nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+					
+						// Check if the connected node's pair wasn't already visited
+						if(!recursiveCuckatooVVisitedNodePairs.contains((nodeConnection + 1)->node >> 1)) {
+						
+							// Check if cycle is complete
+							if(((nodeConnection + 1)->node ^ 1) == recursiveCuckatooRootNode) {
+							
+								// Check if cycle is a solution
+								if(cycleSize == SOLUTION_SIZE - 1) {
+								
+									// Get solution from visited nodes
+									recursiveCuckatooUVisitedNodePairs.getValues(solution);
+									recursiveCuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
+									solution[SOLUTION_SIZE - 1] = (nodeConnection + 1)->edgeIndex;
+									
+									// Sort solution in ascending order
+									sort(solution, solution + SOLUTION_SIZE);
+									
+									// Return true
+									return true;
+								}
+							}
+							
+							// Otherwise check if cycle could be as solution
+							else if(cycleSize != SOLUTION_SIZE - 1) {
+							
+								// Check if the connected node has a pair
+								if(recursiveCuckatooVNewestNodeConnections.contains((nodeConnection + 1)->node ^ 1)) {
+								
+									// Check if solution was found at the connected node's pair
+									if(searchNodeConnectionsForRecursiveCuckatooSolutionSecondPartition(cycleSize + 1, (nodeConnection + 1)->node ^ 1, &(nodeConnection + 1)->edgeIndex)) {
+									
+										// Get solution from visited nodes
+										recursiveCuckatooUVisitedNodePairs.getValues(solution);
+										recursiveCuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
+										
+										// Sort solution in ascending order
+										sort(solution, solution + SOLUTION_SIZE);
+										
+										// Return true
+										return true;
+									}
+								}
+							}
+						}
+					}
+					
+					// Break
+					break;
+				}
+				
+				// Go to node's pair opposite end and get its edge index
+				index = &(nodeConnection + 1)->edgeIndex;
+				node = (nodeConnection + 1)->node;
+				
+				// Check if node pair was already visited
+				if(recursiveCuckatooVVisitedNodePairs.contains(node >> 1)) {
+				
+					// Break
+					break;
+				}
+				
+				// Check if cycle is complete
+				if((node ^ 1) == recursiveCuckatooRootNode) {
+				
+					// Check if cycle is a solution
+					if(cycleSize == SOLUTION_SIZE - 1) {
+					
+						// Get solution from visited nodes
+						recursiveCuckatooUVisitedNodePairs.getValues(solution);
+						recursiveCuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
+						solution[SOLUTION_SIZE - 1] = *index;
+						
+						// Sort solution in ascending order
+						sort(solution, solution + SOLUTION_SIZE);
+						
+						// Return true
+						return true;
+					}
+					
+					// Break
+					break;
+				}
+				
+				// Check if cycle isn't a solution
+				if(cycleSize == SOLUTION_SIZE - 1) {
+				
+					// Break
+					break;
+				}
+				
+				// Check if node doesn't have a pair
+				if(!recursiveCuckatooVNewestNodeConnections.contains(node ^ 1)) {
+				
+					// break
+					break;
+				}
+				
+				// Set that node pair has been visited
+				recursiveCuckatooVVisitedNodePairs.setUnique(node >> 1, *index);
+				
+				// Check if node's pair has more than one connection
+				nodeConnection = recursiveCuckatooVNewestNodeConnections.get(node ^ 1);
+				if(nodeConnection->previousNodeConnectionLink) {
+				
+					// Go through all of the node's pair's connections
+					for(; nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+					
+						// Check if the connected node has a pair
+						if(recursiveCuckatooUNewestNodeConnections.contains((nodeConnection - 1)->node ^ 1)) {
+						
+							// Check if the connected node's pair wasn't already visited
+							if(!recursiveCuckatooUVisitedNodePairs.contains((nodeConnection - 1)->node >> 1)) {
+							
+								// Check if solution was found at the connected node's pair
+								if(searchNodeConnectionsForRecursiveCuckatooSolutionFirstPartition(cycleSize + 2, (nodeConnection - 1)->node ^ 1, &(nodeConnection - 1)->edgeIndex)) {
+								
+									// Get solution from visited nodes
+									recursiveCuckatooUVisitedNodePairs.getValues(solution);
+									recursiveCuckatooVVisitedNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
+									
+									// Sort solution in ascending order
+									sort(solution, solution + SOLUTION_SIZE);
+									
+									// Return true
+									return true;
+								}
+							}
+						}
+					}
+					
+					// Break
+					break;
+				}
+				
+				// Go to node's pair opposite end and get its edge index
+				index = &(nodeConnection - 1)->edgeIndex;
+				node = (nodeConnection - 1)->node;
+				
+				// Check if node pair was already visited
+				if(recursiveCuckatooUVisitedNodePairs.contains(node >> 1)) {
+				
+					// Break
+					break;
+				}
+				
+				// Check if node doesn't have a pair
+				if(!recursiveCuckatooUNewestNodeConnections.contains(node ^ 1)) {
+				
+					// break
+					break;
+				}
+			}
+		}
+	}
+	
+	// Return false
+	return false;
+}
+
+// Search node connections for recursive cuckatoo solution first partition
+bool searchNodeConnectionsForRecursiveCuckatooSolutionFirstPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept {
+
+	// Set that node pair has been visited
+	const uint32_t visitedNodePairIndex = recursiveCuckatooUVisitedNodePairs.setUniqueAndGetIndex(node >> 1, *index);
+	
+	// Go through all of the node's connections
+	for(const RecursiveCuckatooNodeConnectionsLink *nodeConnection = recursiveCuckatooUNewestNodeConnections.get(node); nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+	
+		// Check if the connected node's pair wasn't already visited
+		if(!recursiveCuckatooVVisitedNodePairs.contains((nodeConnection + 1)->node >> 1)) {
+		
+			// Check if cycle is complete
+			if(((nodeConnection + 1)->node ^ 1) == recursiveCuckatooRootNode) {
+			
+				// Check if cycle is a solution
+				if(cycleSize == SOLUTION_SIZE - 1) {
+				
+					// Set that the connected node's pair has been visited
+					recursiveCuckatooVVisitedNodePairs.setUnique((nodeConnection + 1)->node >> 1, (nodeConnection + 1)->edgeIndex);
+					
+					// Return true
+					return true;
+				}
+			}
+			
+			// Otherwise check if cycle could be as solution
+			else if(cycleSize != SOLUTION_SIZE - 1) {
+			
+				// Check if the connected node has a pair
+				if(recursiveCuckatooVNewestNodeConnections.contains((nodeConnection + 1)->node ^ 1)) {
+				
+					// Check if solution was found at the connected node's pair
+					if(searchNodeConnectionsForRecursiveCuckatooSolutionSecondPartition(cycleSize + 1, (nodeConnection + 1)->node ^ 1, &(nodeConnection + 1)->edgeIndex)) {
+					
+						// Return true
+						return true;
+					}
+				}
+			}
+		}
+	}
+	
+	// Set that node pair hasn't been visited
+	recursiveCuckatooUVisitedNodePairs.removeMostRecentSetUique(visitedNodePairIndex);
+	
+	// Return false
+	return false;
+}
+
+// Search node connections for recursive cuckatoo solution second partition
+bool searchNodeConnectionsForRecursiveCuckatooSolutionSecondPartition(const uint_fast8_t cycleSize, const uint32_t node, const uint32_t *index) noexcept {
+
+	// Set that node pair has been visited
+	const uint32_t visitedNodePairIndex = recursiveCuckatooVVisitedNodePairs.setUniqueAndGetIndex(node >> 1, *index);
+	
+	// Go through all of the node's connections
+	for(const RecursiveCuckatooNodeConnectionsLink *nodeConnection = recursiveCuckatooVNewestNodeConnections.get(node); nodeConnection; nodeConnection = nodeConnection->previousNodeConnectionLink) {
+	
+		// Check if the connected node has a pair
+		if(recursiveCuckatooUNewestNodeConnections.contains((nodeConnection - 1)->node ^ 1)) {
+		
+			// Check if the connected node's pair wasn't already visited
+			if(!recursiveCuckatooUVisitedNodePairs.contains((nodeConnection - 1)->node >> 1)) {
+			
+				// Check if solution was found at the connected node's pair
+				if(searchNodeConnectionsForRecursiveCuckatooSolutionFirstPartition(cycleSize + 1, (nodeConnection - 1)->node ^ 1, &(nodeConnection - 1)->edgeIndex)) {
+				
+					// Return true
+					return true;
+				}
+			}
+		}
+	}
+	
+	// Set that node pair hasn't been visited
+	recursiveCuckatooVVisitedNodePairs.removeMostRecentSetUique(visitedNodePairIndex);
+	
+	// Return false
+	return false;
+}
+
+// Is cuckatoo solution (This follows the cycle through the solution's edges the same way that a verifier does)
+bool isCuckatooSolution(const uint32_t solution[SOLUTION_SIZE], const uint32_t *edges) noexcept {
+
+	// Go through all of the solution's edges
+	uint32_t nodes[SOLUTION_SIZE * 2];
+	for(uint_fast8_t i = 0; i < SOLUTION_SIZE; ++i) {
+	
+		// Check if edge isn't in ascending order
+		if(i && solution[i] <= solution[i - 1]) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Get edge's nodes
+		nodes[i * 2] = edges[solution[i] * EDGE_NUMBER_OF_COMPONENTS + 1];
+		nodes[i * 2 + 1] = edges[solution[i] * EDGE_NUMBER_OF_COMPONENTS + 2];
+	}
+	
+	// Go through all nodes in the cycle
+	uint_fast8_t cycleSize = 0;
+	uint_fast8_t i = 0;
+	do {
+	
+		// Go through all other nodes on the same partition
+		uint_fast8_t next = i;
+		for(uint_fast8_t j = (i + 2) % (SOLUTION_SIZE * 2); j != i; j = (j + 2) % (SOLUTION_SIZE * 2)) {
+		
+			// Check if node is in the same node pair
+			if(nodes[j] >> 1 == nodes[i] >> 1) {
+			
+				// Check if the cycle branches
+				if(next != i) {
+				
+					// Return false
+					return false;
+				}
+				
+				// Set next node to the node
+				next = j;
+			}
+		}
+		
+		// Check if the cycle ends or doesn't go to the node's pair
+		if(next == i || nodes[next] == nodes[i]) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Go to the next node's edge's other node
+		i = next ^ 1;
+		++cycleSize;
+		
+	} while(i);
+	
+	// Return if the cycle goes through all of the solution's edges
+	return cycleSize == SOLUTION_SIZE;
+}
+
+// Compare solutions
+bool compareSolutions(const char *search, const uint64_t nonce, const bool recursiveSolutionFound, const uint32_t recursiveSolution[SOLUTION_SIZE], uint32_t solutions[][SOLUTION_SIZE], const uint32_t numberOfSolutions, const uint32_t *edges) noexcept {
+
+	// Go through all solutions
+	bool recursiveSolutionMatched = false;
+	for(uint32_t i = 0; i < numberOfSolutions; ++i) {
+	
+		// Check if solution isn't a cuckatoo solution or was already found
+		if(!isCuckatooSolution(solutions[i], edges) || any_of(solutions, solutions + i, [&solutions, i](const uint32_t *solution) noexcept { return equal(solution, solution + SOLUTION_SIZE, solutions[i]); })) {
+		
+			// Display message
+			cout << search << " search found an invalid or duplicate solution for nonce " << nonce << endl;
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if solution is the recursive search's solution
+		if(recursiveSolutionFound && equal(recursiveSolution, recursiveSolution + SOLUTION_SIZE, solutions[i])) {
+		
+			// Set that recursive solution matched
+			recursiveSolutionMatched = true;
+		}
+	}
+	
+	// Check if the recursive search's solution wasn't found or solutions were found that the recursive search didn't find
+	if(recursiveSolutionFound ? !recursiveSolutionMatched : numberOfSolutions) {
+	
+		// Display message
+		cout << search << " search's solutions don't match the recursive search's solution for nonce " << nonce << endl;
+		
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
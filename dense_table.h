@@ -0,0 +1,175 @@
+// Header guard
+#ifndef DENSE_TABLE_H
+#define DENSE_TABLE_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Dense table class (Keys must be less than the size, at most capacity keys can be set at the same time, and values can't be zero)
+template<typename ValueType, const uint32_t size, const uint32_t capacity> class DenseTable final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit DenseTable() noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Set unique
+		inline void setUnique(const uint32_t key, const ValueType value) noexcept;
+		
+		// Set unique and get index
+		inline uint32_t setUniqueAndGetIndex(const uint32_t key, const ValueType value) noexcept;
+		
+		// Replace
+		inline ValueType replace(const uint32_t key, const ValueType value) noexcept;
+		
+		// Remove most recent set unique
+		inline void removeMostRecentSetUique(const uint32_t index) noexcept;
+		
+		// Clear
+		inline void clear() noexcept;
+		
+		// Contains
+		inline bool contains(const uint32_t key) const noexcept;
+		
+		// Get
+		inline ValueType get(const uint32_t key) const noexcept;
+		
+		// Get values
+		inline void getValues(ValueType *__restrict__ values) const noexcept;
+		
+	// Private
+	private:
+	
+		// Entries (Each entry is the value at its key's index)
+		unique_ptr<ValueType[]> entries;
+		
+		// Keys (In the order that they were set)
+		unique_ptr<uint32_t[]> keys;
+		
+		// Number of keys
+		uint32_t numberOfKeys;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+template<typename ValueType, const uint32_t size, const uint32_t capacity> DenseTable<ValueType, size, capacity>::DenseTable() noexcept :
+
+	// Create entries
+	entries(new(nothrow) ValueType[size]()),
+	
+	// Create keys
+	keys(new(nothrow) uint32_t[capacity]),
+	
+	// Set number of keys to zero
+	numberOfKeys(0)
+{
+
+	// Throw error if size or capacity is invalid
+	static_assert(size && capacity && capacity <= size, "Dense table's size or capacity is invalid");
+}
+
+// Bool operator
+template<typename ValueType, const uint32_t size, const uint32_t capacity> DenseTable<ValueType, size, capacity>::operator bool() const noexcept {
+
+	// Return if creating entries and keys was successful
+	return entries && keys;
+}
+
+// Set unique
+template<typename ValueType, const uint32_t size, const uint32_t capacity> void DenseTable<ValueType, size, capacity>::setUnique(const uint32_t key, const ValueType value) noexcept {
+
+	// Set value at the key's index and append key to the keys
+	entries[key] = value;
+	keys[numberOfKeys++] = key;
+}
+
+// Set unique and get index
+template<typename ValueType, const uint32_t size, const uint32_t capacity> uint32_t DenseTable<ValueType, size, capacity>::setUniqueAndGetIndex(const uint32_t key, const ValueType value) noexcept {
+
+	// Set value at the key's index and append key to the keys
+	entries[key] = value;
+	keys[numberOfKeys] = key;
+	
+	// Return key's index in the keys
+	return numberOfKeys++;
+}
+
+// Replace
+template<typename ValueType, const uint32_t size, const uint32_t capacity> ValueType DenseTable<ValueType, size, capacity>::replace(const uint32_t key, const ValueType value) noexcept {
+
+	// Get current value
+	const ValueType currentValue = entries[key];
+	
+	// Check if key isn't set
+	if(!currentValue) {
+	
+		// Append key to the keys
+		keys[numberOfKeys++] = key;
+	}
+	
+	// Set value at the key's index
+	entries[key] = value;
+	
+	// Return current value
+	return currentValue;
+}
+
+// Remove most recent set unique
+template<typename ValueType, const uint32_t size, const uint32_t capacity> void DenseTable<ValueType, size, capacity>::removeMostRecentSetUique(const uint32_t index) noexcept {
+
+	// Clear value at the key's index and remove key from the keys
+	entries[keys[index]] = ValueType();
+	numberOfKeys = index;
+}
+
+// Clear
+template<typename ValueType, const uint32_t size, const uint32_t capacity> void DenseTable<ValueType, size, capacity>::clear() noexcept {
+
+	// Go through all keys
+	for(uint32_t index = 0; index < numberOfKeys; ++index) {
+	
+		// Clear value at the key's index
+		entries[keys[index]] = ValueType();
+	}
+	
+	// Set number of keys to zero
+	numberOfKeys = 0;
+}
+
+// Contains
+template<typename ValueType, const uint32_t size, const uint32_t capacity> bool DenseTable<ValueType, size, capacity>::contains(const uint32_t key) const noexcept {
+
+	// Return if value at the key's index exists
+	return entries[key];
+}
+
+// Get
+template<typename ValueType, const uint32_t size, const uint32_t capacity> ValueType DenseTable<ValueType, size, capacity>::get(const uint32_t key) const noexcept {
+
+	// Return value at the key's index
+	return entries[key];
+}
+
+// Get values
+template<typename ValueType, const uint32_t size, const uint32_t capacity> void DenseTable<ValueType, size, capacity>::getValues(ValueType *__restrict__ values) const noexcept {
+
+	// Go through all keys
+	for(uint32_t index = 0; index < numberOfKeys; ++index) {
+	
+		// Set value in values
+		values[index] = entries[keys[index]];
+	}
+}
+
+
+#endif
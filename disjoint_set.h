@@ -0,0 +1,135 @@
+// Header guard
+#ifndef DISJOINT_SET_H
+#define DISJOINT_SET_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Disjoint set class
+template<const uint32_t size> class DisjointSet final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit DisjointSet() noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Add
+		inline void add(const uint32_t element) noexcept;
+		
+		// Find
+		inline uint32_t find(uint32_t element) noexcept;
+		
+		// Join
+		inline uint32_t join(uint32_t firstRoot, uint32_t secondRoot) noexcept;
+		
+		// Get size
+		inline uint32_t getSize(const uint32_t root) const noexcept;
+		
+	// Private
+	private:
+	
+		// Root flag
+		static const uint32_t ROOT_FLAG;
+		
+		// Elements (Each element is either its parent or the root flag combined with its set's size)
+		unique_ptr<uint32_t[]> elements;
+};
+
+
+// Constants
+
+// Disjoint set root flag
+template<const uint32_t size> const uint32_t DisjointSet<size>::ROOT_FLAG = static_cast<uint32_t>(1) << 31;
+
+
+// Supporting function implementation
+
+// Constructor
+template<const uint32_t size> DisjointSet<size>::DisjointSet() noexcept :
+
+	// Create elements
+	elements(new(nothrow) uint32_t[size])
+{
+
+	// Throw error if size is invalid
+	static_assert(size && size <= ROOT_FLAG, "Disjoint set's size is invalid");
+}
+
+// Bool operator
+template<const uint32_t size> DisjointSet<size>::operator bool() const noexcept {
+
+	// Return if creating elements was successful
+	return elements.get();
+}
+
+// Add
+template<const uint32_t size> void DisjointSet<size>::add(const uint32_t element) noexcept {
+
+	// Set element to be the root of a set that only contains itself
+	elements[element] = ROOT_FLAG | 1;
+}
+
+// Find
+template<const uint32_t size> uint32_t DisjointSet<size>::find(uint32_t element) noexcept {
+
+	// Loop while element isn't a root
+	while(!(elements[element] & ROOT_FLAG)) {
+	
+		// Check if element's parent isn't a root
+		const uint32_t parent = elements[element];
+		if(!(elements[parent] & ROOT_FLAG)) {
+		
+			// Set element's parent to its grandparent
+			elements[element] = elements[parent];
+		}
+		
+		// Go to element's parent
+		element = elements[element];
+	}
+	
+	// Return element
+	return element;
+}
+
+// Join
+template<const uint32_t size> uint32_t DisjointSet<size>::join(uint32_t firstRoot, uint32_t secondRoot) noexcept {
+
+	// Check if roots are the same
+	if(firstRoot == secondRoot) {
+	
+		// Return first root
+		return firstRoot;
+	}
+	
+	// Check if first root's set is smaller than the second root's set
+	if(elements[firstRoot] < elements[secondRoot]) {
+	
+		// Swap roots
+		swap(firstRoot, secondRoot);
+	}
+	
+	// Add second root's set to the first root's set
+	elements[firstRoot] += elements[secondRoot] & ~ROOT_FLAG;
+	elements[secondRoot] = firstRoot;
+	
+	// Return first root
+	return firstRoot;
+}
+
+// Get size
+template<const uint32_t size> uint32_t DisjointSet<size>::getSize(const uint32_t root) const noexcept {
+
+	// Return root's set's size
+	return elements[root] & ~ROOT_FLAG;
+}
+
+
+#endif
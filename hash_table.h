@@ -9,7 +9,7 @@ using namespace std;
 
 // Classes
 
-// Hash table class
+// Hash table class (Getting or replacing a key that isn't set returns zero)
 template<typename ValueType, const uint32_t size> class HashTable final {
 
 	// Public
@@ -22,13 +22,13 @@ template<typename ValueType, const uint32_t size> class HashTable final {
 		inline explicit operator bool() const noexcept;
 		
 		// Set unique
-		inline void setUnique(const uint32_t key, const ValueType *__restrict__ value) noexcept;
+		inline void setUnique(const uint32_t key, const ValueType value) noexcept;
 		
 		// Set unique and get index
-		inline uint32_t setUniqueAndGetIndex(const uint32_t key, const ValueType *__restrict__ value) noexcept;
+		inline uint32_t setUniqueAndGetIndex(const uint32_t key, const ValueType value) noexcept;
 		
 		// Replace
-		inline const ValueType *replace(const uint32_t key, const ValueType *__restrict__ value) noexcept;
+		inline ValueType replace(const uint32_t key, const ValueType value) noexcept;
 		
 		// Remove most recent set unique
 		inline void removeMostRecentSetUique(const uint32_t index) noexcept;
@@ -40,7 +40,7 @@ template<typename ValueType, const uint32_t size> class HashTable final {
 		inline bool contains(const uint32_t key) const noexcept;
 		
 		// Get
-		inline const ValueType *get(const uint32_t key) const noexcept;
+		inline ValueType get(const uint32_t key) const noexcept;
 		
 		// Get values
 		inline void getValues(ValueType *__restrict__ values) const noexcept;
@@ -54,12 +54,18 @@ template<typename ValueType, const uint32_t size> class HashTable final {
 			// Key
 			uint32_t key;
 			
+			// Epoch
+			uint32_t epoch;
+			
 			// Value
-			const ValueType *value;
+			ValueType value;
 		};
 		
-		// Entries
+		// Entries (Entries are only set if their epoch is the current epoch)
 		unique_ptr<HashTableEntry[]> entries;
+		
+		// Epoch
+		uint32_t epoch;
 };
 
 
@@ -69,7 +75,10 @@ template<typename ValueType, const uint32_t size> class HashTable final {
 template<typename ValueType, const uint32_t size> HashTable<ValueType, size>::HashTable() noexcept :
 
 	// Create entries
-	entries(new(nothrow) HashTableEntry[bitCeilingConstantExpression(size + 1)])
+	entries(new(nothrow) HashTableEntry[bitCeilingConstantExpression(size + 1)]),
+	
+	// Set epoch to the first epoch
+	epoch(1)
 {
 
 	// Throw error if size is invalid
@@ -91,13 +100,13 @@ template<typename ValueType, const uint32_t size> HashTable<ValueType, size>::op
 }
 
 // Set unique
-template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::setUnique(const uint32_t key, const ValueType *__restrict__ value) noexcept {
+template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::setUnique(const uint32_t key, const ValueType value) noexcept {
 
 	// Get key's index
 	uint32_t index = key % bitCeilingConstantExpression(size + 1);
 	
 	// Loop while entry at index exists
-	while(entries[index].value) {
+	while(entries[index].epoch == epoch) {
 	
 		// Check if index isn't for the last entry
 		if(index != bitCeilingConstantExpression(size + 1) - 1) {
@@ -115,17 +124,17 @@ template<typename ValueType, const uint32_t size> void HashTable<ValueType, size
 	}
 	
 	// Set entry at index to the value
-	entries[index] = {key, value};
+	entries[index] = {key, epoch, value};
 }
 
 // Set unique and get index
-template<typename ValueType, const uint32_t size> uint32_t HashTable<ValueType, size>::setUniqueAndGetIndex(const uint32_t key, const ValueType *__restrict__ value) noexcept {
+template<typename ValueType, const uint32_t size> uint32_t HashTable<ValueType, size>::setUniqueAndGetIndex(const uint32_t key, const ValueType value) noexcept {
 
 	// Get key's index
 	uint32_t index = key % bitCeilingConstantExpression(size + 1);
 	
 	// Loop while entry at index exists
-	while(entries[index].value) {
+	while(entries[index].epoch == epoch) {
 	
 		// Check if index isn't for the last entry
 		if(index != bitCeilingConstantExpression(size + 1) - 1) {
@@ -143,26 +152,26 @@ template<typename ValueType, const uint32_t size> uint32_t HashTable<ValueType,
 	}
 	
 	// Set entry at index to the value
-	entries[index] = {key, value};
+	entries[index] = {key, epoch, value};
 	
 	// Return index
 	return index;
 }
 
 // Replace
-template<typename ValueType, const uint32_t size> const ValueType *HashTable<ValueType, size>::replace(const uint32_t key, const ValueType *__restrict__ value) noexcept {
+template<typename ValueType, const uint32_t size> ValueType HashTable<ValueType, size>::replace(const uint32_t key, const ValueType value) noexcept {
 
 	// Get key's index
 	uint32_t index = key % bitCeilingConstantExpression(size + 1);
 	
 	// Loop while entry at index exists
-	while(entries[index].value) {
+	while(entries[index].epoch == epoch) {
 	
 		// Check if entry has the same key
 		if(entries[index].key == key) {
 		
 			// Get current value
-			const ValueType *currentValue = entries[index].value;
+			const ValueType currentValue = entries[index].value;
 			
 			// Set entry at index to the value
 			entries[index].value = value;
@@ -187,31 +196,38 @@ template<typename ValueType, const uint32_t size> const ValueType *HashTable<Val
 	}
 	
 	// Set entry at index to the value
-	entries[index] = {key, value};
+	entries[index] = {key, epoch, value};
 	
-	// Return nothing
-	return nullptr;
+	// Return no value
+	return ValueType();
 }
 
 // Remove most recent set unique
 template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::removeMostRecentSetUique(const uint32_t index) noexcept {
 
 	// Clear entry at index
-	entries[index].value = nullptr;
+	entries[index].epoch = 0;
 }
 
 // Clear
 template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::clear() noexcept {
 
-	// Clear entries
-	memset(entries.get(), 0, sizeof(HashTableEntry) * bitCeilingConstantExpression(size + 1));
+	// Check if going to the next epoch wrapped around
+	if(!++epoch) {
+	
+		// Clear entries
+		memset(entries.get(), 0, sizeof(HashTableEntry) * bitCeilingConstantExpression(size + 1));
+		
+		// Set epoch to the first epoch
+		epoch = 1;
+	}
 }
 
 // Contains
 template<typename ValueType, const uint32_t size> bool HashTable<ValueType, size>::contains(const uint32_t key) const noexcept {
 
 	// Go through all existing entries starting at the key's index
-	for(uint32_t index = key % bitCeilingConstantExpression(size + 1); entries[index].value;) {
+	for(uint32_t index = key % bitCeilingConstantExpression(size + 1); entries[index].epoch == epoch;) {
 	
 		// Check if entry has the same key
 		if(entries[index].key == key) {
@@ -240,10 +256,10 @@ template<typename ValueType, const uint32_t size> bool HashTable<ValueType, size
 }
 
 // Get
-template<typename ValueType, const uint32_t size> const ValueType *HashTable<ValueType, size>::get(const uint32_t key) const noexcept {
+template<typename ValueType, const uint32_t size> ValueType HashTable<ValueType, size>::get(const uint32_t key) const noexcept {
 
 	// Go through all existing entries starting at the key's index
-	for(uint32_t index = key % bitCeilingConstantExpression(size + 1); entries[index].value;) {
+	for(uint32_t index = key % bitCeilingConstantExpression(size + 1); entries[index].epoch == epoch;) {
 	
 		// Check if entry has the same key
 		if(entries[index].key == key) {
@@ -267,8 +283,8 @@ template<typename ValueType, const uint32_t size> const ValueType *HashTable<Val
 		}
 	}
 	
-	// Return nothing
-	return nullptr;
+	// Return no value
+	return ValueType();
 }
 
 // Get values
@@ -278,10 +294,10 @@ template<typename ValueType, const uint32_t size> void HashTable<ValueType, size
 	for(uint32_t index = 0, valuesIndex = 0; index < bitCeilingConstantExpression(size + 1); ++index) {
 	
 		// Check if entry exists
-		if(entries[index].value) {
+		if(entries[index].epoch == epoch) {
 		
 			// Set value in values
-			values[valuesIndex++] = *entries[index].value;
+			values[valuesIndex++] = entries[index].value;
 		}
 	}
 }
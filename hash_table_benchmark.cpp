@@ -0,0 +1,336 @@
+// Constants
+
+// OpenCL target version (OpenCL v1.2)
+#define CL_TARGET_OPENCL_VERSION 120
+
+// Metal target version (Metal v3.0)
+#define METAL_TARGET_VERSION MTL::LanguageVersion3_0
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// System version
+	#define _WIN32_WINNT _WIN32_WINNT_VISTA
+	
+	// Use Unicode
+	#define UNICODE
+	#define _UNICODE
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Use Metal
+	#define MTL_PRIVATE_IMPLEMENTATION
+	
+	// Use NS
+	#define NS_PRIVATE_IMPLEMENTATION
+	
+	// Use bounds-checking interfaces
+	#define __STDC_WANT_LIB_EXT1__ 1
+#endif
+
+
+// Header files
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// Header files
+	#include <ws2tcpip.h>
+	#include <CL/cl.h>
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Header files
+	#include <TargetConditionals.h>
+	#include <arpa/inet.h>
+	#include <netdb.h>
+	#include <poll.h>
+	#include <sys/sysctl.h>
+	#include "./metal.h"
+	
+	// Check if using macOS
+	#if TARGET_OS_OSX == 1
+	
+		// Header files
+		#include <IOKit/pwr_mgt/IOPMLib.h>
+	#endif
+	
+	// Check if using OpenCL
+	#ifdef USE_OPENCL
+	
+		// Header files
+		#include <OpenCL/opencl.h>
+	#endif
+	
+// Otherwise
+#else
+
+	// Header files
+	#include <arpa/inet.h>
+	#include <CL/cl.h>
+	#include <CL/cl_ext.h>
+	#include <netdb.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+	
+	// Check if using FreeBSD
+	#ifdef __FreeBSD__
+	
+		// Header files
+		#include <pthread_np.h>
+	#endif
+	
+	// Check if not using Android
+	#ifndef __ANDROID__
+	
+		// Header files
+		#include <dbus/dbus.h>
+	#endif
+#endif
+
+// Header files
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cinttypes>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "./main.h"
+#include "./common.h"
+#include "./hash_table.h"
+
+using namespace std;
+
+
+// Configurable constants
+
+// Number of seconds per run (Graphs' node connections are set and cleared for this long for every edge bits and hash table)
+#define NUMBER_OF_SECONDS_PER_RUN 1
+
+// Min edge bits
+#define MIN_EDGE_BITS 16
+
+// Max edge bits
+#define MAX_EDGE_BITS 32
+
+
+// Checks
+
+// Throw error if trimming rounds is zero (Hash tables are sized for the max number of edges after trimming, which is too large to allocate for every edge bits without trimming)
+static_assert(TRIMMING_ROUNDS != 0, "Trimming rounds is zero");
+
+
+// Classes
+
+// Memset hash table class (This is the hash table that the epoch hash table replaced, which clears all of its entries with a memset and uses a value of zero to mean that an entry isn't set)
+template<typename ValueType, const uint32_t size> class MemsetHashTable final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit MemsetHashTable() noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Replace
+		inline ValueType replace(const uint32_t key, const ValueType value) noexcept;
+		
+		// Clear
+		inline void clear() noexcept;
+		
+	// Private
+	private:
+	
+		// Memset hash table entry structure
+		struct MemsetHashTableEntry {
+		
+			// Key
+			uint32_t key;
+			
+			// Value
+			ValueType value;
+		};
+		
+		// Entries
+		unique_ptr<MemsetHashTableEntry[]> entries;
+};
+
+
+// Function prototypes
+
+// Benchmark edge bits
+template<const unsigned int edgeBits> static inline void benchmarkEdgeBits() noexcept;
+
+// Get microseconds per graph
+template<typename HashTableType> static inline bool getMicrosecondsPerGraph(const unsigned int edgeBits, const uint32_t numberOfNodeConnections, double &microsecondsPerClear, double &microsecondsPerGraph) noexcept;
+
+
+// Main function
+int main() {
+
+	// Benchmark all edge bits
+	benchmarkEdgeBits<MIN_EDGE_BITS>();
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Constructor
+template<typename ValueType, const uint32_t size> MemsetHashTable<ValueType, size>::MemsetHashTable() noexcept :
+
+	// Create entries
+	entries(new(nothrow) MemsetHashTableEntry[bitCeilingConstantExpression(size + 1)])
+{
+
+	// Check if creating entries was successful
+	if(entries) {
+	
+		// Clear entries
+		memset(entries.get(), 0, sizeof(MemsetHashTableEntry) * bitCeilingConstantExpression(size + 1));
+	}
+}
+
+// Bool operator
+template<typename ValueType, const uint32_t size> MemsetHashTable<ValueType, size>::operator bool() const noexcept {
+
+	// Return if creating entries was successful
+	return entries.get();
+}
+
+// Replace
+template<typename ValueType, const uint32_t size> ValueType MemsetHashTable<ValueType, size>::replace(const uint32_t key, const ValueType value) noexcept {
+
+	// Get key's index
+	uint32_t index = key % bitCeilingConstantExpression(size + 1);
+	
+	// Loop while entry at index exists
+	while(entries[index].value) {
+	
+		// Check if entry has the same key
+		if(entries[index].key == key) {
+		
+			// Get current value
+			const ValueType currentValue = entries[index].value;
+			
+			// Set entry at index to the value
+			entries[index].value = value;
+			
+			// Return current value
+			return currentValue;
+		}
+		
+		// Check if index isn't for the last entry
+		if(index != bitCeilingConstantExpression(size + 1) - 1) {
+		
+			// Increment index
+			++index;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Set index to the first entry
+			index = 0;
+		}
+	}
+	
+	// Set entry at index to the value
+	entries[index] = {key, value};
+	
+	// Return no value
+	return ValueType();
+}
+
+// Clear
+template<typename ValueType, const uint32_t size> void MemsetHashTable<ValueType, size>::clear() noexcept {
+
+	// Clear entries
+	memset(entries.get(), 0, sizeof(MemsetHashTableEntry) * bitCeilingConstantExpression(size + 1));
+}
+
+// Benchmark edge bits (Hash tables are sized like the searching threads' newest node connections tables for the edge bits and trimming rounds)
+template<const unsigned int edgeBits> void benchmarkEdgeBits() noexcept {
+
+	// Get max number of edges after trimming
+	const uint32_t maxNumberOfEdgesAfterTrimming = ceilingConstantExpression(static_cast<double>(static_cast<uint64_t>(1) << edgeBits) / (((TRIMMING_ROUNDS + 1) / 2) * ((TRIMMING_ROUNDS + 1) / 2) + 2) - 1);
+	
+	// Check if getting microseconds per graph with each hash table was successful (Every node left after trimming has at least two edges, so a partition has at most half as many nodes as there are edges)
+	double memsetMicrosecondsPerClear;
+	double memsetMicrosecondsPerGraph;
+	double microsecondsPerClear;
+	double microsecondsPerGraph;
+	if(getMicrosecondsPerGraph<MemsetHashTable<uint32_t, maxNumberOfEdgesAfterTrimming>>(edgeBits, maxNumberOfEdgesAfterTrimming / 2, memsetMicrosecondsPerClear, memsetMicrosecondsPerGraph) && getMicrosecondsPerGraph<HashTable<uint32_t, maxNumberOfEdgesAfterTrimming>>(edgeBits, maxNumberOfEdgesAfterTrimming / 2, microsecondsPerClear, microsecondsPerGraph)) {
+	
+		// Display message
+		cout << "Cuckatoo" << edgeBits << " with " << TRIMMING_ROUNDS << " trimming rounds: memset clear " << memsetMicrosecondsPerClear << " us, epoch clear " << microsecondsPerClear << " us (" << memsetMicrosecondsPerClear / microsecondsPerClear << "x), setting " << maxNumberOfEdgesAfterTrimming / 2 << " node connections and clearing " << memsetMicrosecondsPerGraph << " us with the memset hash table and " << microsecondsPerGraph << " us with the hash table (" << memsetMicrosecondsPerGraph / microsecondsPerGraph << "x)" << endl;
+	}
+	
+	// Otherwise
+	else {
+	
+		// Display message
+		cout << "Creating the hash tables for cuckatoo" << edgeBits << " failed" << endl;
+	}
+	
+	// Check if not at the max edge bits
+	if constexpr(edgeBits < MAX_EDGE_BITS) {
+	
+		// Benchmark next edge bits
+		benchmarkEdgeBits<edgeBits + 1>();
+	}
+}
+
+// Get microseconds per graph (Each graph sets the newest node connection for the number of node connections nodes and then clears the hash table like the searching threads do)
+template<typename HashTableType> bool getMicrosecondsPerGraph(const unsigned int edgeBits, const uint32_t numberOfNodeConnections, double &microsecondsPerClear, double &microsecondsPerGraph) noexcept {
+
+	// Check if creating hash table failed
+	const unique_ptr<HashTableType> hashTable(new(nothrow) HashTableType());
+	if(!hashTable || !*hashTable) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all graphs until the run's time has passed
+	uint64_t numberOfGraphs = 0;
+	chrono::duration<double> clearingTime(0);
+	const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+	chrono::high_resolution_clock::time_point endTime;
+	do {
+	
+		// Go through all of the graph's node connections
+		for(uint32_t i = 0; i < numberOfNodeConnections; ++i) {
+		
+			// Set node's newest node connection (Nodes are spread across all of the edge bits' nodes and node connections are never zero)
+			hashTable->replace((static_cast<uint64_t>(i) * 0x9E3779B1 + numberOfGraphs * 0x85EBCA6B) & ((static_cast<uint64_t>(1) << edgeBits) - 1), i + 1);
+		}
+		
+		// Clear hash table
+		const chrono::high_resolution_clock::time_point clearingStartTime = chrono::high_resolution_clock::now();
+		hashTable->clear();
+		clearingTime += chrono::high_resolution_clock::now() - clearingStartTime;
+		
+		// Increment number of graphs
+		++numberOfGraphs;
+		
+	} while((endTime = chrono::high_resolution_clock::now()) - startTime < chrono::seconds(NUMBER_OF_SECONDS_PER_RUN));
+	
+	// Set microseconds per clear and per graph
+	microsecondsPerClear = clearingTime.count() * 1000000 / numberOfGraphs;
+	microsecondsPerGraph = static_cast<chrono::duration<double>>(endTime - startTime).count() * 1000000 / numberOfGraphs;
+	
+	// Return true
+	return true;
+}
@@ -0,0 +1,169 @@
+// Header guard
+#ifndef LEAF_PRUNER_H
+#define LEAF_PRUNER_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Leaf pruner class (Removes renamed edges that can't be part of a cycle because one of their nodes' pairs doesn't have any other edges, and partition is zero for the first partition and one for the second partition)
+template<const uint32_t maximumNumberOfEdges> class LeafPruner final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit LeafPruner(const unsigned int numberOfThreads) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Prune
+		inline void prune(const uint32_t *edges, const uint64_t numberOfEdges, const unsigned int maximumNumberOfRounds, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+		// Get edges removed
+		inline const bool *getEdgesRemoved() const noexcept;
+		
+	// Private
+	private:
+	
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Nodes' degrees (Each node's degree is at its node and partition combined)
+		unique_ptr<uint32_t[]> nodesDegrees;
+		
+		// Edges removed
+		unique_ptr<bool[]> edgesRemoved;
+		
+		// Rounds' number of edges removed (Each round's counter is reset during the round before it, so three counters are used to make sure that no thread is still reading the counter being reset)
+		uint64_t roundsNumberOfEdgesRemoved[3];
+};
+
+
+// Supporting function implementation
+
+// Constructor
+template<const uint32_t maximumNumberOfEdges> LeafPruner<maximumNumberOfEdges>::LeafPruner(const unsigned int numberOfThreads) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Create nodes' degrees (Edges' nodes are renamed to dense identifiers before pruning when there's trimming rounds and are already less than the number of edges otherwise, so nodes are less than twice the number of edges)
+	nodesDegrees(new(nothrow) uint32_t[static_cast<uint64_t>(maximumNumberOfEdges) * 4]),
+	
+	// Create edges removed
+	edgesRemoved(new(nothrow) bool[maximumNumberOfEdges])
+{
+
+	// Throw error if maximum number of edges is invalid
+	static_assert(maximumNumberOfEdges && maximumNumberOfEdges <= (static_cast<uint64_t>(UINT32_MAX) + 1) / 4, "Leaf pruner's maximum number of edges is invalid");
+}
+
+// Bool operator
+template<const uint32_t maximumNumberOfEdges> LeafPruner<maximumNumberOfEdges>::operator bool() const noexcept {
+
+	// Return if creating nodes' degrees and edges removed was successful
+	return nodesDegrees && edgesRemoved;
+}
+
+// Prune
+template<const uint32_t maximumNumberOfEdges> void LeafPruner<maximumNumberOfEdges>::prune(const uint32_t *edges, const uint64_t numberOfEdges, const unsigned int maximumNumberOfRounds, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Get thread's edges start and end
+	const uint64_t edgesStart = min((numberOfEdges + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges);
+	const uint64_t edgesEnd = min((numberOfEdges + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges);
+	
+	// Get thread's nodes' degrees start and end
+	const uint64_t nodesDegreesStart = min((numberOfEdges * 4 + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges * 4);
+	const uint64_t nodesDegreesEnd = min((numberOfEdges * 4 + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges * 4);
+	
+	// Clear thread's nodes' degrees
+	memset(&nodesDegrees[nodesDegreesStart], 0, sizeof(uint32_t) * (nodesDegreesEnd - nodesDegreesStart));
+	
+	// Clear thread's edges removed
+	memset(&edgesRemoved[edgesStart], false, sizeof(bool) * (edgesEnd - edgesStart));
+	
+	// Check if the first thread
+	if(!threadIndex) {
+	
+		// Set first round's number of edges removed to zero
+		roundsNumberOfEdgesRemoved[0] = 0;
+	}
+	
+	// Wait for all threads to finish clearing their nodes' degrees
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all of the thread's edges
+	for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+	
+		// Increment edge's nodes' degrees
+		__atomic_add_fetch(&nodesDegrees[edges[edge * EDGE_NUMBER_OF_COMPONENTS + 1] << 1], 1, __ATOMIC_RELAXED);
+		__atomic_add_fetch(&nodesDegrees[(edges[edge * EDGE_NUMBER_OF_COMPONENTS + 2] << 1) | 1], 1, __ATOMIC_RELAXED);
+	}
+	
+	// Wait for all threads to finish incrementing their edges' nodes' degrees
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all rounds
+	for(unsigned int round = 0; round < maximumNumberOfRounds; ++round) {
+	
+		// Go through all of the thread's edges
+		uint64_t numberOfEdgesRemoved = 0;
+		for(uint64_t edge = edgesStart; edge < edgesEnd; ++edge) {
+		
+			// Check if edge hasn't been removed
+			if(!edgesRemoved[edge]) {
+			
+				// Check if one of the edge's nodes' pairs doesn't have any edges (Degrees only decrease, so a degree of zero is final even if other threads are still removing edges)
+				const uint32_t uNode = edges[edge * EDGE_NUMBER_OF_COMPONENTS + 1];
+				const uint32_t vNode = edges[edge * EDGE_NUMBER_OF_COMPONENTS + 2];
+				if(!__atomic_load_n(&nodesDegrees[(uNode ^ 1) << 1], __ATOMIC_RELAXED) || !__atomic_load_n(&nodesDegrees[((vNode ^ 1) << 1) | 1], __ATOMIC_RELAXED)) {
+				
+					// Set that edge is removed
+					edgesRemoved[edge] = true;
+					
+					// Decrement edge's nodes' degrees
+					__atomic_sub_fetch(&nodesDegrees[uNode << 1], 1, __ATOMIC_RELAXED);
+					__atomic_sub_fetch(&nodesDegrees[(vNode << 1) | 1], 1, __ATOMIC_RELAXED);
+					
+					// Increment number of edges removed
+					++numberOfEdgesRemoved;
+				}
+			}
+		}
+		
+		// Check if the first thread
+		if(!threadIndex) {
+		
+			// Set next round's number of edges removed to zero
+			roundsNumberOfEdgesRemoved[(round + 1) % size(roundsNumberOfEdgesRemoved)] = 0;
+		}
+		
+		// Add number of edges removed to the round's number of edges removed
+		__atomic_add_fetch(&roundsNumberOfEdgesRemoved[round % size(roundsNumberOfEdgesRemoved)], numberOfEdgesRemoved, __ATOMIC_RELAXED);
+		
+		// Wait for all threads to finish removing their edges
+		threadsBarrier.arrive_and_wait();
+		
+		// Check if no edges were removed during the round
+		if(!__atomic_load_n(&roundsNumberOfEdgesRemoved[round % size(roundsNumberOfEdgesRemoved)], __ATOMIC_RELAXED)) {
+		
+			// Break
+			break;
+		}
+	}
+}
+
+// Get edges removed
+template<const uint32_t maximumNumberOfEdges> const bool *LeafPruner<maximumNumberOfEdges>::getEdgesRemoved() const noexcept {
+
+	// Return edges removed
+	return edgesRemoved.get();
+}
+
+
+#endif
@@ -16,7 +16,7 @@ using namespace std;
 // Constants
 
 // Lean trimming required RAM bytes
-#define LEAN_TRIMMING_REQUIRED_RAM_BYTES (NUMBER_OF_EDGES / BITS_IN_A_BYTE * 3)
+#define LEAN_TRIMMING_REQUIRED_RAM_BYTES (NUMBER_OF_EDGES / BITS_IN_A_BYTE * 3 + (sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t)) * REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS)
 
 
 // Function prototypes
@@ -34,7 +34,7 @@ using namespace std;
 #else
 
 	// Create lean trimming context
-	static inline cl_context createLeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const unsigned int deviceIndex) noexcept;
+	static inline cl_context createLeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const cl_device_type deviceTypes, const unsigned int deviceIndex) noexcept;
 	
 	// Perform lean trimming loop
 	static inline bool performLeanTrimmingLoop(const cl_context context) noexcept;
@@ -134,7 +134,7 @@ using namespace std;
 #else
 
 	// Create lean trimming context
-	cl_context createLeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const unsigned int deviceIndex) noexcept {
+	cl_context createLeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const cl_device_type deviceTypes, const unsigned int deviceIndex) noexcept {
 	
 		// Set index to zero
 		unsigned int index = 0;
@@ -144,11 +144,11 @@ using namespace std;
 			
 			// Check if getting platform's number of devices was successful and devices exist
 			cl_uint numberOfDevices;
-			if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
+			if(clGetDeviceIDs(platforms[i], deviceTypes, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
 			
 				// Check if getting platform's devices was successful
 				cl_device_id devices[numberOfDevices];
-				if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
+				if(clGetDeviceIDs(platforms[i], deviceTypes, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
 				
 					// Go through all of the platform's devices
 					for(cl_uint j = 0; j < numberOfDevices; ++j) {
@@ -229,6 +229,9 @@ using namespace std;
 			// Edge bits value
 			MTLSTR(TO_STRING(EDGE_BITS)),
 			
+			// Edge number of components value
+			MTLSTR(TO_STRING(EDGE_NUMBER_OF_COMPONENTS)),
+			
 			// Number of edges per step one work item value
 			unique_ptr<NS::Number, void(*)(NS::Number *)>(NS::Number::alloc()->init(LEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM), [](NS::Number *numberOfEdgesPerStepOneWorkItemValue) noexcept {
 			
@@ -236,16 +239,30 @@ using namespace std;
 				numberOfEdgesPerStepOneWorkItemValue->release();
 				
 			}).get(),
+			
+			// Max number of edges after trimming value
+			unique_ptr<NS::Number, void(*)(NS::Number *)>(NS::Number::alloc()->init(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING), [](NS::Number *maxNumberOfEdgesAfterTrimmingValue) noexcept {
+			
+				// Free max number of edges after trimming value
+				maxNumberOfEdgesAfterTrimmingValue->release();
+				
+			}).get()
 		
 		}, (const NS::Object *[]){
 		
 			// Edge bits key
 			MTLSTR("EDGE_BITS"),
 			
+			// Edge number of components key
+			MTLSTR("EDGE_NUMBER_OF_COMPONENTS"),
+			
 			// Number of edges per step one work item key
-			MTLSTR("NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM")
+			MTLSTR("NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM"),
+			
+			// Max number of edges after trimming key
+			MTLSTR("MAX_NUMBER_OF_EDGES_AFTER_TRIMMING")
 		
-		}, 2), [](NS::Dictionary *preprocessorMacros) noexcept {
+		}, 4), [](NS::Dictionary *preprocessorMacros) noexcept {
 		
 			// Free preprocessor macros
 			preprocessorMacros->release();
@@ -335,12 +352,17 @@ using namespace std;
 			// Free step four kernel
 			stepFourKernel->release();
 		});
+		const unique_ptr<MTL::Function, void(*)(MTL::Function *)> stepFiveKernel(library->newFunction(MTLSTR("trimEdgesStepFive")), [](MTL::Function *stepFiveKernel) noexcept {
+		
+			// Free step five kernel
+			stepFiveKernel->release();
+		});
 		const unique_ptr<MTL::Function, void(*)(MTL::Function *)> clearNodesBitmapKernel(library->newFunction(MTLSTR("clearNodesBitmap")), [](MTL::Function *clearNodesBitmapKernel) noexcept {
 		
 			// Free clear nodes bitmap kernel
 			clearNodesBitmapKernel->release();
 		});
-		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !clearNodesBitmapKernel) {
+		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !clearNodesBitmapKernel) {
 		
 			// Display message
 			cout << "Getting kernels from the library failed." << endl;
@@ -374,13 +396,19 @@ using namespace std;
 			// Free step four pipeline
 			stepFourPipeline->release();
 		});
+		NS::Error *createPipelineFiveError;
+		unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)> stepFivePipeline(device->newComputePipelineState(stepFiveKernel.get(), &createPipelineFiveError), [](MTL::ComputePipelineState *stepFivePipeline) noexcept {
+		
+			// Free step five pipeline
+			stepFivePipeline->release();
+		});
 		NS::Error *createPipelineClearNodesBitmapError;
 		unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)> clearNodesBitmapPipeline(device->newComputePipelineState(clearNodesBitmapKernel.get(), &createPipelineClearNodesBitmapError), [](MTL::ComputePipelineState *clearNodesBitmapPipeline) noexcept {
 		
 			// Free clear nodes bitmap pipeline
 			clearNodesBitmapPipeline->release();
 		});
-		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !clearNodesBitmapPipeline) {
+		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !stepFivePipeline || !clearNodesBitmapPipeline) {
 		
 			// Display message
 			cout << "Creating pipelines for the GPU failed." << endl;
@@ -453,6 +481,23 @@ using namespace std;
 				}
 			}
 			
+			// Check if creating pipeline five failed and an error exists
+			if(!stepFivePipeline && createPipelineFiveError) {
+			
+				// Check if error's localized description exists
+				const NS::String *localizedDescription = createPipelineFiveError->localizedDescription();
+				if(localizedDescription) {
+				
+					// Check if localized description's UTF-8 string exists
+					const char *utf8String = localizedDescription->utf8String();
+					if(utf8String) {
+					
+						// Display message
+						cout << utf8String << endl;
+					}
+				}
+			}
+			
 			// Check if creating pipeline clear nodes bitmap failed and an error exists
 			if(!clearNodesBitmapPipeline && createPipelineClearNodesBitmapError) {
 			
@@ -489,6 +534,9 @@ using namespace std;
 			// Trim edges step four kernel
 			{NUMBER_OF_EDGES / (sizeof(uint64_t) * BITS_IN_A_BYTE), 1, 1},
 			
+			// Trim edges step five kernel
+			{NUMBER_OF_EDGES / (sizeof(uint64_t) * BITS_IN_A_BYTE), 1, 1},
+			
 			// Clear nodes bitmap kernel
 			{(NUMBER_OF_EDGES / BITS_IN_A_BYTE) / sizeof(uint64_t), 1, 1}
 		};
@@ -508,8 +556,11 @@ using namespace std;
 			// Trim edges step four kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[3].width), 1, 1},
 			
+			// Trim edges step five kernel
+			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[4].width), 1, 1},
+			
 			// Clear nodes bitmap kernel
-			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[4].width), 1, 1}
+			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[5].width), 1, 1}
 		};
 		
 		// Check if creating pipeline descriptors failed
@@ -533,12 +584,17 @@ using namespace std;
 			// Free step four pipeline descriptor
 			stepFourPipelineDescriptor->release();
 		});
+		const unique_ptr<MTL::ComputePipelineDescriptor, void(*)(MTL::ComputePipelineDescriptor *)> stepFivePipelineDescriptor(MTL::ComputePipelineDescriptor::alloc()->init(), [](MTL::ComputePipelineDescriptor *stepFivePipelineDescriptor) noexcept {
+		
+			// Free step five pipeline descriptor
+			stepFivePipelineDescriptor->release();
+		});
 		const unique_ptr<MTL::ComputePipelineDescriptor, void(*)(MTL::ComputePipelineDescriptor *)> clearNodesBitmapPipelineDescriptor(MTL::ComputePipelineDescriptor::alloc()->init(), [](MTL::ComputePipelineDescriptor *clearNodesBitmapPipelineDescriptor) noexcept {
 		
 			// Free clear nodes bitmap pipeline descriptor
 			clearNodesBitmapPipelineDescriptor->release();
 		});
-		if(!stepOnePipelineDescriptor || !stepTwoPipelineDescriptor || !stepThreePipelineDescriptor || !stepFourPipelineDescriptor || !clearNodesBitmapPipelineDescriptor) {
+		if(!stepOnePipelineDescriptor || !stepTwoPipelineDescriptor || !stepThreePipelineDescriptor || !stepFourPipelineDescriptor || !stepFivePipelineDescriptor || !clearNodesBitmapPipelineDescriptor) {
 		
 			// Display message
 			cout << "Creating pipeline descriptors failed." << endl;
@@ -564,9 +620,13 @@ using namespace std;
 		stepFourPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[3].width);
 		stepFourPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[3].width % stepFourPipeline->threadExecutionWidth() == 0);
 		
+		stepFivePipelineDescriptor->setComputeFunction(stepFiveKernel.get());
+		stepFivePipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[4].width);
+		stepFivePipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[4].width % stepFivePipeline->threadExecutionWidth() == 0);
+		
 		clearNodesBitmapPipelineDescriptor->setComputeFunction(clearNodesBitmapKernel.get());
-		clearNodesBitmapPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[4].width);
-		clearNodesBitmapPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[4].width % clearNodesBitmapPipeline->threadExecutionWidth() == 0);
+		clearNodesBitmapPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[5].width);
+		clearNodesBitmapPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[5].width % clearNodesBitmapPipeline->threadExecutionWidth() == 0);
 		
 		// Check if recreating pipelines for the device with hardcoded work items per work group failed
 		stepOnePipeline = unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)>(device->newComputePipelineState(stepOnePipelineDescriptor.get(), MTL::PipelineOptionNone, nullptr, &createPipelineOneError), [](MTL::ComputePipelineState *stepOnePipeline) noexcept {
@@ -589,12 +649,17 @@ using namespace std;
 			// Free step four pipeline
 			stepFourPipeline->release();
 		});
+		stepFivePipeline = unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)>(device->newComputePipelineState(stepFivePipelineDescriptor.get(), MTL::PipelineOptionNone, nullptr, &createPipelineFiveError), [](MTL::ComputePipelineState *stepFivePipeline) noexcept {
+		
+			// Free step five pipeline
+			stepFivePipeline->release();
+		});
 		clearNodesBitmapPipeline = unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)>(device->newComputePipelineState(clearNodesBitmapPipelineDescriptor.get(), MTL::PipelineOptionNone, nullptr, &createPipelineClearNodesBitmapError), [](MTL::ComputePipelineState *clearNodesBitmapPipeline) noexcept {
 		
 			// Free clear nodes bitmap pipeline
 			clearNodesBitmapPipeline->release();
 		});
-		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !clearNodesBitmapPipeline) {
+		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !stepFivePipeline || !clearNodesBitmapPipeline) {
 		
 			// Display message
 			cout << "Creating pipelines for the GPU failed." << endl;
@@ -667,6 +732,23 @@ using namespace std;
 				}
 			}
 			
+			// Check if recreating pipeline five failed and an error exists
+			if(!stepFivePipeline && createPipelineFiveError) {
+			
+				// Check if error's localized description exists
+				const NS::String *localizedDescription = createPipelineFiveError->localizedDescription();
+				if(localizedDescription) {
+				
+					// Check if localized description's UTF-8 string exists
+					const char *utf8String = localizedDescription->utf8String();
+					if(utf8String) {
+					
+						// Display message
+						cout << utf8String << endl;
+					}
+				}
+			}
+			
 			// Check if recreating pipeline clear nodes bitmap failed and an error exists
 			if(!clearNodesBitmapPipeline && createPipelineClearNodesBitmapError) {
 			
@@ -689,12 +771,12 @@ using namespace std;
 		}
 		
 		// Check if allocating memory on the device failed
-		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapOne(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapOne) noexcept {
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapOne(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModePrivate | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapOne) noexcept {
 		
 			// Free edges bitmap one
 			edgesBitmapOne->release();
 		});
-		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapTwo(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapTwo) noexcept {
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapTwo(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModePrivate | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapTwo) noexcept {
 		
 			// Free edges bitmap two
 			edgesBitmapTwo->release();
@@ -704,6 +786,16 @@ using namespace std;
 			// Free nodes bitmap
 			nodesBitmap->release();
 		});
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> remainingEdgesOne(device->newBuffer(sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t), MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *remainingEdgesOne) noexcept {
+		
+			// Free remaining edges one
+			remainingEdgesOne->release();
+		});
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> remainingEdgesTwo(device->newBuffer(sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t), MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *remainingEdgesTwo) noexcept {
+		
+			// Free remaining edges two
+			remainingEdgesTwo->release();
+		});
 		if(!edgesBitmapOne || !edgesBitmapTwo || !nodesBitmap) {
 		
 			// Display message
@@ -789,16 +881,20 @@ using namespace std;
 		uint64_t heightOne = jobHeight;
 		uint64_t idOne = jobId;
 		uint64_t nonceOne = jobNonce++;
-		blake2b(sipHashKeysOne, jobHeader, nonceOne);
+		blake2b(sipHashKeysOne, jobHeaderMidstate, nonceOne);
 		
-		// Set compute pass's nodes bitmap, SipHash keys, and edges bitmap arguments
+		// Clear the beginning of remaining edges one
+		reinterpret_cast<uint32_t *>(remainingEdgesOne->contents())[0] = 0;
+		
+		// Set compute pass's nodes bitmap, SipHash keys, edges bitmap, and remaining edges arguments
 		computePassEncoder->setBuffer(nodesBitmap.get(), 0, 0);
 		computePassEncoder->setBytes(&sipHashKeysOne, sizeof(sipHashKeysOne), 1);
 		computePassEncoder->setBuffer(edgesBitmapOne.get(), 0, 2);
+		computePassEncoder->setBuffer(remainingEdgesOne.get(), 0, 4);
 		
 		// Add clearing nodes bitmap to the compute pass
 		computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 		
 		// Add running step one to the compute pass
 		computePassEncoder->setComputePipelineState(stepOnePipeline.get());
@@ -809,11 +905,11 @@ using namespace std;
 		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[1], workItemsPerWorkGroup[1]);
 		
 		// Go through all remaining trimming rounds
-		for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+		for(unsigned int i = 1; i < TRIMMING_ROUNDS + extraTrimmingRounds; ++i) {
 		
 			// Add clearing nodes bitmap to the compute pass
 			computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 			
 			// Set compute pass's nodes in second partition argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 3);
@@ -827,6 +923,10 @@ using namespace std;
 			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[3], workItemsPerWorkGroup[3]);
 		}
 		
+		// Add running step five to the compute pass
+		computePassEncoder->setComputePipelineState(stepFivePipeline.get());
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+		
 		// Finish adding commands to the compute pass
 		computePassEncoder->endEncoding();
 		
@@ -907,16 +1007,20 @@ using namespace std;
 		uint64_t heightTwo = jobHeight;
 		uint64_t idTwo = jobId;
 		uint64_t nonceTwo = jobNonce++;
-		blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
+		blake2b(sipHashKeysTwo, jobHeaderMidstate, nonceTwo);
+		
+		// Clear the beginning of remaining edges two
+		reinterpret_cast<uint32_t *>(remainingEdgesTwo->contents())[0] = 0;
 		
-		// Set compute pass's nodes bitmap, SipHash keys, and edges bitmap arguments
+		// Set compute pass's nodes bitmap, SipHash keys, edges bitmap, and remaining edges arguments
 		computePassEncoder->setBuffer(nodesBitmap.get(), 0, 0);
 		computePassEncoder->setBytes(&sipHashKeysTwo, sizeof(sipHashKeysTwo), 1);
 		computePassEncoder->setBuffer(edgesBitmapTwo.get(), 0, 2);
+		computePassEncoder->setBuffer(remainingEdgesTwo.get(), 0, 4);
 		
 		// Add clearing nodes bitmap to the compute pass
 		computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 		
 		// Add running step one to the compute pass
 		computePassEncoder->setComputePipelineState(stepOnePipeline.get());
@@ -927,11 +1031,11 @@ using namespace std;
 		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[1], workItemsPerWorkGroup[1]);
 		
 		// Go through all remaining trimming rounds
-		for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+		for(unsigned int i = 1; i < TRIMMING_ROUNDS + extraTrimmingRounds; ++i) {
 		
 			// Add clearing nodes bitmap to the compute pass
 			computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 			
 			// Set compute pass's nodes in second partition argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 3);
@@ -945,6 +1049,10 @@ using namespace std;
 			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[3], workItemsPerWorkGroup[3]);
 		}
 		
+		// Add running step five to the compute pass
+		computePassEncoder->setComputePipelineState(stepFivePipeline.get());
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+		
 		// Finish adding commands to the compute pass
 		computePassEncoder->endEncoding();
 		
@@ -955,7 +1063,7 @@ using namespace std;
 		commandBuffer->commit();
 		
 		// Trimming finished
-		trimmingFinished(edgesBitmapOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
+		trimmingFinished(remainingEdgesOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
 		
 		// Wait until the compute pass has finished
 		commandBuffer->waitUntilCompleted();
@@ -1023,16 +1131,20 @@ using namespace std;
 			heightOne = jobHeight;
 			idOne = jobId;
 			nonceOne = jobNonce++;
-			blake2b(sipHashKeysOne, jobHeader, nonceOne);
+			blake2b(sipHashKeysOne, jobHeaderMidstate, nonceOne);
 			
-			// Set compute pass's nodes bitmap, SipHash keys, and edges bitmap arguments
+			// Clear the beginning of remaining edges one
+			reinterpret_cast<uint32_t *>(remainingEdgesOne->contents())[0] = 0;
+			
+			// Set compute pass's nodes bitmap, SipHash keys, edges bitmap, and remaining edges arguments
 			computePassEncoder->setBuffer(nodesBitmap.get(), 0, 0);
 			computePassEncoder->setBytes(&sipHashKeysOne, sizeof(sipHashKeysOne), 1);
 			computePassEncoder->setBuffer(edgesBitmapOne.get(), 0, 2);
+			computePassEncoder->setBuffer(remainingEdgesOne.get(), 0, 4);
 			
 			// Add clearing nodes bitmap to the compute pass
 			computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 			
 			// Add running step one to the compute pass
 			computePassEncoder->setComputePipelineState(stepOnePipeline.get());
@@ -1043,11 +1155,11 @@ using namespace std;
 			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[1], workItemsPerWorkGroup[1]);
 			
 			// Go through all remaining trimming rounds
-			for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+			for(unsigned int i = 1; i < TRIMMING_ROUNDS + extraTrimmingRounds; ++i) {
 			
 				// Add clearing nodes bitmap to the compute pass
 				computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 				
 				// Set compute pass's nodes in second partition argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 3);
@@ -1061,6 +1173,10 @@ using namespace std;
 				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[3], workItemsPerWorkGroup[3]);
 			}
 			
+			// Add running step five to the compute pass
+			computePassEncoder->setComputePipelineState(stepFivePipeline.get());
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+			
 			// Finish adding commands to the compute pass
 			computePassEncoder->endEncoding();
 			
@@ -1071,7 +1187,7 @@ using namespace std;
 			commandBuffer->commit();
 			
 			// Trimming finished
-			trimmingFinished(edgesBitmapTwo->contents(), sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
+			trimmingFinished(remainingEdgesTwo->contents(), sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
 			
 			// Wait until the compute pass has finished
 			commandBuffer->waitUntilCompleted();
@@ -1143,16 +1259,20 @@ using namespace std;
 			heightTwo = jobHeight;
 			idTwo = jobId;
 			nonceTwo = jobNonce++;
-			blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
+			blake2b(sipHashKeysTwo, jobHeaderMidstate, nonceTwo);
 			
-			// Set compute pass's nodes bitmap, SipHash keys, and edges bitmap arguments
+			// Clear the beginning of remaining edges two
+			reinterpret_cast<uint32_t *>(remainingEdgesTwo->contents())[0] = 0;
+			
+			// Set compute pass's nodes bitmap, SipHash keys, edges bitmap, and remaining edges arguments
 			computePassEncoder->setBuffer(nodesBitmap.get(), 0, 0);
 			computePassEncoder->setBytes(&sipHashKeysTwo, sizeof(sipHashKeysTwo), 1);
 			computePassEncoder->setBuffer(edgesBitmapTwo.get(), 0, 2);
+			computePassEncoder->setBuffer(remainingEdgesTwo.get(), 0, 4);
 			
 			// Add clearing nodes bitmap to the compute pass
 			computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 			
 			// Add running step one to the compute pass
 			computePassEncoder->setComputePipelineState(stepOnePipeline.get());
@@ -1163,11 +1283,11 @@ using namespace std;
 			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[1], workItemsPerWorkGroup[1]);
 			
 			// Go through all remaining trimming rounds
-			for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+			for(unsigned int i = 1; i < TRIMMING_ROUNDS + extraTrimmingRounds; ++i) {
 			
 				// Add clearing nodes bitmap to the compute pass
 				computePassEncoder->setComputePipelineState(clearNodesBitmapPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[5], workItemsPerWorkGroup[5]);
 				
 				// Set compute pass's nodes in second partition argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 3);
@@ -1181,6 +1301,10 @@ using namespace std;
 				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[3], workItemsPerWorkGroup[3]);
 			}
 			
+			// Add running step five to the compute pass
+			computePassEncoder->setComputePipelineState(stepFivePipeline.get());
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[4], workItemsPerWorkGroup[4]);
+			
 			// Finish adding commands to the compute pass
 			computePassEncoder->endEncoding();
 			
@@ -1191,7 +1315,7 @@ using namespace std;
 			commandBuffer->commit();
 			
 			// Trimming finished
-			trimmingFinished(edgesBitmapOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
+			trimmingFinished(remainingEdgesOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
 			
 			// Wait until the compute pass has finished
 			commandBuffer->waitUntilCompleted();
@@ -1218,9 +1342,9 @@ using namespace std;
 			return false;
 		}
 		
-		// Check if getting device's max work group size failed or its max work group size don't exists
+		// Check if getting device's max work group size failed
 		size_t maxWorkGroupSize;
-		if(clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(maxWorkGroupSize), &maxWorkGroupSize, nullptr) != CL_SUCCESS || !maxWorkGroupSize) {
+		if(!getOpenClDeviceMaxWorkGroupSize(device, maxWorkGroupSize)) {
 		
 			// Display message
 			cout << "Getting GPU's info failed." << endl;
@@ -1245,7 +1369,7 @@ using namespace std;
 		}
 		
 		// Check if building program for the device failed
-		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(LEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM)).c_str(), nullptr, nullptr) != CL_SUCCESS) {
+		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DEDGE_NUMBER_OF_COMPONENTS=" TO_STRING(EDGE_NUMBER_OF_COMPONENTS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(LEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DMAX_NUMBER_OF_EDGES_AFTER_TRIMMING=" + to_string(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING)).c_str(), nullptr, nullptr) != CL_SUCCESS) {
 		
 			// Display message
 			cout << "Building program for the GPU failed." << endl;
@@ -1272,7 +1396,8 @@ using namespace std;
 		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepTwoKernel(clCreateKernel(program.get(), "trimEdgesStepTwo", nullptr), clReleaseKernel);
 		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepThreeKernel(clCreateKernel(program.get(), "trimEdgesStepThree", nullptr), clReleaseKernel);
 		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepFourKernel(clCreateKernel(program.get(), "trimEdgesStepFour", nullptr), clReleaseKernel);
-		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel) {
+		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepFiveKernel(clCreateKernel(program.get(), "trimEdgesStepFive", nullptr), clReleaseKernel);
+		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel) {
 		
 			// Display message
 			cout << "Creating kernels for the GPU failed." << endl;
@@ -1294,6 +1419,9 @@ using namespace std;
 			NUMBER_OF_EDGES / (sizeof(cl_ulong) * BITS_IN_A_BYTE),
 			
 			// Trim edges step four kernel
+			NUMBER_OF_EDGES / (sizeof(cl_ulong) * BITS_IN_A_BYTE),
+			
+			// Trim edges step five kernel
 			NUMBER_OF_EDGES / (sizeof(cl_ulong) * BITS_IN_A_BYTE)
 		};
 		
@@ -1310,7 +1438,10 @@ using namespace std;
 			min(bit_floor(maxWorkGroupSize), totalNumberOfWorkItems[2]),
 			
 			// Trim edges step four kernel
-			min(bit_floor(maxWorkGroupSize), totalNumberOfWorkItems[3])
+			min(bit_floor(maxWorkGroupSize), totalNumberOfWorkItems[3]),
+			
+			// Trim edges step five kernel
+			min(bit_floor(maxWorkGroupSize), totalNumberOfWorkItems[4])
 		};
 		
 		// Free kernels
@@ -1318,6 +1449,7 @@ using namespace std;
 		stepTwoKernel.reset();
 		stepThreeKernel.reset();
 		stepFourKernel.reset();
+		stepFiveKernel.reset();
 		
 		// Check if recreating program for the device failed
 		program = unique_ptr<remove_pointer<cl_program>::type, decltype(&clReleaseProgram)>(clCreateProgramWithSource(context, 1, &source, &sourceSize, nullptr), clReleaseProgram);
@@ -1331,7 +1463,7 @@ using namespace std;
 		}
 		
 		// Check if rebuilding program for the device with hardcoded work items per work groups failed
-		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(LEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DTRIM_EDGES_STEP_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[0]) + " -DTRIM_EDGES_STEP_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[1]) + " -DTRIM_EDGES_STEP_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[2]) + " -DTRIM_EDGES_STEP_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[3])).c_str(), nullptr, nullptr) != CL_SUCCESS) {
+		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DEDGE_NUMBER_OF_COMPONENTS=" TO_STRING(EDGE_NUMBER_OF_COMPONENTS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(LEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DMAX_NUMBER_OF_EDGES_AFTER_TRIMMING=" + to_string(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) + " -DTRIM_EDGES_STEP_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[0]) + " -DTRIM_EDGES_STEP_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[1]) + " -DTRIM_EDGES_STEP_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[2]) + " -DTRIM_EDGES_STEP_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[3]) + " -DTRIM_EDGES_STEP_FIVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[4])).c_str(), nullptr, nullptr) != CL_SUCCESS) {
 		
 			// Display message
 			cout << "Building program for the GPU failed." << endl;
@@ -1358,7 +1490,8 @@ using namespace std;
 		stepTwoKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepTwo", nullptr), clReleaseKernel);
 		stepThreeKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepThree", nullptr), clReleaseKernel);
 		stepFourKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepFour", nullptr), clReleaseKernel);
-		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel) {
+		stepFiveKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepFive", nullptr), clReleaseKernel);
+		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel) {
 		
 			// Display message
 			cout << "Creating kernels for the GPU failed." << endl;
@@ -1368,68 +1501,35 @@ using namespace std;
 		}
 		
 		// Check if allocating memory on the device failed
-		static unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapOne(nullptr, clReleaseMemObject);
-		edgesBitmapOne = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
-		static unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapTwo(nullptr, clReleaseMemObject);
-		edgesBitmapTwo = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
+		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapOne(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
+		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapTwo(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> nodesBitmap(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
 		if(!edgesBitmapOne || !edgesBitmapTwo || !nodesBitmap) {
 		
 			// Display message
 			cout << "Allocating memory on the GPU failed." << endl;
 			
-			// Free edges bitmap one and two
-			edgesBitmapOne.reset();
-			edgesBitmapTwo.reset();
-			
 			// Return false
 			return false;
 		}
 		
 		// Check if creating command queue for the device failed
-		static uint64_t *resultOne = nullptr;
-		static uint64_t *resultTwo = nullptr;
-		const unique_ptr<remove_pointer<cl_command_queue>::type, void(*)(cl_command_queue)> commandQueue(clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, nullptr), [](cl_command_queue commandQueue) noexcept {
-		
-			// Wait for all commands in the queue to finish
-			clFinish(commandQueue);
-			
-			// Check if result one exists
-			if(resultOne) {
-			
-				// Queue unmapping result one
-				clEnqueueUnmapMemObject(commandQueue, edgesBitmapOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr);
-			}
-			
-			// Check if result two exists
-			if(resultTwo) {
-			
-				// Queue unmapping result two
-				clEnqueueUnmapMemObject(commandQueue, edgesBitmapTwo.get(), reinterpret_cast<void *>(resultTwo), 0, nullptr, nullptr);
-			}
-			
-			// Wait for all commands in the queue to finish
-			clFinish(commandQueue);
-			
-			// Free command queue
-			clReleaseCommandQueue(commandQueue);
-			
-			// Reset result one and two
-			resultOne = nullptr;
-			resultTwo = nullptr;
-			
-			// Free edges bitmap one and two
-			edgesBitmapOne.reset();
-			edgesBitmapTwo.reset();
-		});
+		const unique_ptr<remove_pointer<cl_command_queue>::type, decltype(&clReleaseCommandQueue)> commandQueue(clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, nullptr), clReleaseCommandQueue);
 		if(!commandQueue) {
 		
 			// Display message
 			cout << "Creating command queue for the GPU failed." << endl;
 			
-			// Free edges bitmap one and two
-			edgesBitmapOne.reset();
-			edgesBitmapTwo.reset();
+			// Return false
+			return false;
+		}
+		
+		// Check if allocating memory for the remaining edges ring buffer on the device failed
+		RemainingEdgesRingBuffer remainingEdgesRingBuffer(context, commandQueue.get());
+		if(!remainingEdgesRingBuffer) {
+		
+			// Display message
+			cout << "Allocating memory on the GPU failed." << endl;
 			
 			// Return false
 			return false;
@@ -1461,79 +1561,11 @@ using namespace std;
 		// Set previous graph processed time to now
 		previousGraphProcessedTime = chrono::high_resolution_clock::now();
 		
-		// Check if queuing clearing nodes bitmap on the device failed
-		Event firstCommandEvent;
-		if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Get SipHash keys from job's header and nonce
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeysOne;
-		uint64_t heightOne = jobHeight;
-		uint64_t idOne = jobId;
-		uint64_t nonceOne = jobNonce++;
-		blake2b(sipHashKeysOne, jobHeader, nonceOne);
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepOneKernel.get(), 1, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step one on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's edges bitmap or SipHash keys arguments failed
-		if(clSetKernelArg(stepTwoKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step Two on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's edges bitmap or SipHash keys arguments failed
-		if(clSetKernelArg(stepThreeKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Go through all remaining trimming rounds
-		for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+		// Perform trimming with the remaining edges ring buffer
+		return remainingEdgesRingBuffer.perform([&](const cl_mem remainingEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, cl_event *firstCommandEvent) noexcept -> bool {
 		
 			// Check if queuing clearing nodes bitmap on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, nullptr) != CL_SUCCESS) {
+			if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, firstCommandEvent) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Preparing program's arguments on the GPU failed." << endl;
@@ -1542,8 +1574,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if setting program's nodes in second partition argument failed
-			if(clSetKernelArg(stepThreeKernel.get(), 2, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
+			// Check if setting program's SipHash keys argument failed
+			if(clSetKernelArg(stepOneKernel.get(), 1, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -1552,8 +1584,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if queuing running step three on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
+			// Check if queuing running step one on the device failed
+			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Running program on the GPU failed." << endl;
@@ -1562,8 +1594,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if setting program's nodes in second partition argument failed
-			if(clSetKernelArg(stepFourKernel.get(), 2, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
+			// Check if setting program's edges bitmap or SipHash keys arguments failed
+			if(clSetKernelArg(stepTwoKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -1572,8 +1604,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if queuing running step four on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
+			// Check if queuing running step Two on the device failed
+			if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Running program on the GPU failed." << endl;
@@ -1581,300 +1613,19 @@ using namespace std;
 				// Return false
 				return false;
 			}
-		}
-		
-		// Check if queuing map result failed
-		Event mapEvent;
-		resultOne = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapOne.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-		if(!resultOne) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if closing
-		if(closing) {
-			
-			// Return true
-			return true;
-		}
-		
-		// Check if waiting for map event to finish failed
-		if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if getting trimming time failed
-		cl_ulong startTime;
-		cl_ulong endTime;
-		if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting GPU trimming time failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Display message
-		cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-		
-		// Check if queuing clearing nodes bitmap on the device failed
-		firstCommandEvent.free();
-		if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Get SipHash keys from job's header and nonce
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeysTwo;
-		uint64_t heightTwo = jobHeight;
-		uint64_t idTwo = jobId;
-		uint64_t nonceTwo = jobNonce++;
-		blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepOneKernel.get(), 1, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step one on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's edges bitmap or SipHash keys arguments failed
-		if(clSetKernelArg(stepTwoKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step two on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's edges bitmap or SipHash keys arguments failed
-		if(clSetKernelArg(stepThreeKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
 		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Go through all remaining trimming rounds
-		for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+			// Check if setting program's edges bitmap or SipHash keys arguments failed
+			if(clSetKernelArg(stepThreeKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 		
-			// Check if queuing clearing nodes bitmap on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's nodes in second partition argument failed
-			if(clSetKernelArg(stepThreeKernel.get(), 2, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step three on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
 			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
 				// Return false
 				return false;
 			}
-			
-			// Check if setting program's nodes in second partition argument failed
-			if(clSetKernelArg(stepFourKernel.get(), 2, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step four on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Check if queuing map result failed
-		mapEvent.free();
-		resultTwo = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapTwo.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-		if(!resultTwo) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Perform commands in queue
-		clFlush(commandQueue.get());
-		
-		// Trimming finished
-		trimmingFinished(resultOne, sipHashKeysOne, heightOne, idOne, nonceOne);
-		
-		// Check if queuing unmap result failed
-		if(clEnqueueUnmapMemObject(commandQueue.get(), edgesBitmapOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Set that result one doesn't exist
-		resultOne = nullptr;
-		
-		// While not closing
-		while(!closing) {
-		
-			// Check if waiting for map event to finish failed
-			if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if getting trimming time failed
-			if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting GPU trimming time failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Display message
-			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-			
-			// Check if queuing clearing nodes bitmap on the device failed
-			firstCommandEvent.free();
-			if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Get SipHash keys from job's header and nonce
-			heightOne = jobHeight;
-			idOne = jobId;
-			nonceOne = jobNonce++;
-			blake2b(sipHashKeysOne, jobHeader, nonceOne);
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 1, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's edges bitmap or SipHash keys arguments failed
-			if(clSetKernelArg(stepTwoKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step two on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's edges bitmap or SipHash keys arguments failed
-			if(clSetKernelArg(stepThreeKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Go through all remaining trimming rounds
-			for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
+		
+			// Go through all remaining trimming rounds
+			for(unsigned int i = 1; i < TRIMMING_ROUNDS + extraTrimmingRounds; ++i) {
 			
 				// Check if queuing clearing nodes bitmap on the device failed
 				if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, nullptr) != CL_SUCCESS) {
@@ -1927,70 +1678,8 @@ using namespace std;
 				}
 			}
 			
-			// Check if queuing map result failed
-			mapEvent.free();
-			resultOne = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapOne.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-			if(!resultOne) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Perform commands in queue
-			clFlush(commandQueue.get());
-			
-			// Trimming finished
-			trimmingFinished(resultTwo, sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
-			
-			// Check if queuing unmap result failed
-			if(clEnqueueUnmapMemObject(commandQueue.get(), edgesBitmapTwo.get(), reinterpret_cast<void *>(resultTwo), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Set that result two doesn't exist
-			resultTwo = nullptr;
-			
-			// Check if closing
-			if(closing) {
-			
-				// Return true
-				return true;
-			}
-			
-			// Check if waiting for map event to finish failed
-			if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if getting trimming time failed
-			if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting GPU trimming time failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Display message
-			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-			
-			// Check if queuing clearing nodes bitmap on the device failed
-			firstCommandEvent.free();
-			if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
+			// Check if queuing clearing the beginning of remaining edges on the device failed
+			if(clEnqueueFillBuffer(commandQueue.get(), remainingEdges, (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Preparing program's arguments on the GPU failed." << endl;
@@ -1999,14 +1688,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Get SipHash keys from job's header and nonce
-			heightTwo = jobHeight;
-			idTwo = jobId;
-			nonceTwo = jobNonce++;
-			blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 1, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+			// Check if setting program's edges bitmap, remaining edges, or SipHash keys arguments failed
+			if(clSetKernelArg(stepFiveKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 1, sizeof(remainingEdges), &remainingEdges) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 2, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -2015,8 +1698,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
+			// Check if queuing running step five on the device failed
+			if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Running program on the GPU failed." << endl;
@@ -2025,124 +1708,10 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if setting program's edges bitmap or SipHash keys arguments failed
-			if(clSetKernelArg(stepTwoKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
 			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step two on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's edges bitmap or SipHash keys arguments failed
-			if(clSetKernelArg(stepThreeKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Go through all remaining trimming rounds
-			for(unsigned int i = 1; i < TRIMMING_ROUNDS; ++i) {
-			
-				// Check if queuing clearing nodes bitmap on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), nodesBitmap.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's nodes in second partition argument failed
-				if(clSetKernelArg(stepThreeKernel.get(), 2, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step three on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's nodes in second partition argument failed
-				if(clSetKernelArg(stepFourKernel.get(), 2, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step four on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Check if queuing map result failed
-			mapEvent.free();
-			resultTwo = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapTwo.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-			if(!resultTwo) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Perform commands in queue
-			clFlush(commandQueue.get());
-			
-			// Trimming finished
-			trimmingFinished(resultOne, sipHashKeysOne, heightOne, idOne, nonceOne);
-			
-			// Check if queuing unmap result failed
-			if(clEnqueueUnmapMemObject(commandQueue.get(), edgesBitmapOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Set that result one doesn't exist
-			resultOne = nullptr;
-		}
-		
-		// Return true
-		return true;
+			// Return true
+			return true;
+		});
 	}
 #endif
 
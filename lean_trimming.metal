@@ -7,8 +7,8 @@ Trimming round 2: clear nodes bitmap, step three, step four
 Trimming round 3: clear nodes bitmap, step three, step four
 ...
 Trimming round n - 1: clear nodes bitmap, step three, step four
-Trimming round n: clear nodes bitmap, step three, step four
-Get result from edges bitmap
+Trimming round n: clear nodes bitmap, step three, step four, clear first remaining edge, step five
+Get result from remaining edges
 */
 
 
@@ -47,6 +47,9 @@ using namespace metal;
 // Trim edges step four
 [[kernel]] void trimEdgesStepFour(device ulong *__restrict edgesBitmap, device const uint *__restrict nodesBitmap, constant const uchar &__restrict nodesInSecondPartition, constant const ulong4 &__restrict sipHashKeys, const uint globalId);
 
+// Trim edges step five
+[[kernel]] void trimEdgesStepFive(device const ulong *__restrict edgesBitmap, device atomic_uint *__restrict remainingEdges, constant const ulong4 &__restrict sipHashKeys, const uint globalId, const ushort localId);
+
 // Clear nodes bitmap
 [[kernel]] void clearNodesBitmap(device ulong *nodesBitmap, const uint globalId);
 
@@ -169,6 +172,78 @@ static inline bool isBitSetInBitmap(device const uint *bitmap, const uint index)
 	edgesBitmap[globalId] = edges;
 }
 
+// Trim edges step five
+[[kernel]] void trimEdgesStepFive(device const ulong *__restrict edgesBitmap [[buffer(2)]], device atomic_uint *__restrict remainingEdges [[buffer(4)]], constant const ulong4 &__restrict sipHashKeys [[buffer(1)]], const uint globalId [[thread_position_in_grid]], const ushort localId [[thread_position_in_threadgroup]]) {
+
+	// Declare number of edges and index
+	threadgroup atomic_uint numberOfEdges;
+	threadgroup uint index;
+	
+	// Check if this work item is the first in the work group
+	if(localId == 0) {
+	
+		// Set number of edges to zero
+		atomic_store_explicit(&numberOfEdges, 0, memory_order_relaxed);
+	}
+	
+	// Synchronize work group
+	threadgroup_barrier(mem_flags::mem_threadgroup);
+	
+	// Get work item's edge indices
+	const uint indices = globalId * static_cast<char>(sizeof(ulong) * BITS_IN_A_BYTE);
+	
+	// Get this work item's edges
+	ulong edges = edgesBitmap[globalId];
+	
+	// Check if this work item has edges
+	uint offset = 0;
+	if(edges) {
+	
+		// Add this work item's number of edges to the work group's number of edges
+		offset = atomic_fetch_add_explicit(&numberOfEdges, static_cast<uint>(popcount(edges)), memory_order_relaxed);
+	}
+	
+	// Synchronize work group
+	threadgroup_barrier(mem_flags::mem_threadgroup);
+	
+	// Check if this work item is the first in the work group
+	if(localId == 0) {
+	
+		// Add work group's number of edges to the number of remaining edges
+		index = atomic_fetch_add_explicit(remainingEdges, atomic_load_explicit(&numberOfEdges, memory_order_relaxed), memory_order_relaxed);
+	}
+	
+	// Synchronize work group
+	threadgroup_barrier(mem_flags::mem_threadgroup);
+	
+	// Go through all of this work item's enabled edges
+	for(uint i = index + offset; edges; ++i) {
+	
+		// Get edge's bit index
+		const char bitIndex = static_cast<char>(sizeof(ulong) * BITS_IN_A_BYTE) - 1 - clz(edges);
+		
+		// Disable edge
+		edges ^= static_cast<ulong>(1) << bitIndex;
+		
+		// Get edge's index
+		const uint edgeIndex = indices + bitIndex;
+		
+		// Get edge's node
+		const uint node = sipHash24(sipHashKeys, static_cast<ulong>(edgeIndex) * 2);
+		
+		// Get edge's other node
+		const uint otherNode = sipHash24(sipHashKeys, (static_cast<ulong>(edgeIndex) * 2) | 1);
+		
+		// Get next remaining edge
+		device atomic_uint *nextRemainingEdge = &remainingEdges[min(i, static_cast<uint>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING - 1)) * EDGE_NUMBER_OF_COMPONENTS + 1];
+		
+		// Set next remaining edge to the edge and its nodes
+		atomic_store_explicit(&nextRemainingEdge[0], edgeIndex, memory_order_relaxed);
+		atomic_store_explicit(&nextRemainingEdge[1], node, memory_order_relaxed);
+		atomic_store_explicit(&nextRemainingEdge[2], otherNode, memory_order_relaxed);
+	}
+}
+
 // Clear nodes bitmap
 [[kernel]] void clearNodesBitmap(device ulong *nodesBitmap [[buffer(0)]], const uint globalId [[thread_position_in_grid]]) {
 
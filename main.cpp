@@ -70,6 +70,7 @@
 	// Header files
 	#include <arpa/inet.h>
 	#include <CL/cl.h>
+	#include <CL/cl_ext.h>
 	#include <netdb.h>
 	#include <netinet/in.h>
 	#include <poll.h>
@@ -93,8 +94,10 @@
 
 // Header files
 #include <algorithm>
+#include <atomic>
 #include <barrier>
 #include <cinttypes>
+#include <cmath>
 #include <condition_variable>
 #include <csignal>
 #include <cstring>
@@ -104,8 +107,18 @@
 #include <thread>
 #include "./main.h"
 #include "./common.h"
+#include "./cpu_topology.h"
 #include "./blake2b.h"
 #include "./hash_table.h"
+#include "./dense_table.h"
+#include "./disjoint_set.h"
+#include "./node_renamer.h"
+#include "./component_partitioner.h"
+#include "./csr_adjacency.h"
+#include "./leaf_pruner.h"
+#include "./searching_threads_handoff.h"
+#include "./bounded_queue.h"
+#include "./work_stealing_scheduler.h"
 #include "./siphash.h"
 #include "./cuckatoo.h"
 
@@ -117,21 +130,17 @@ using namespace std;
 // Max number of searching threads
 #define MAX_NUMBER_OF_SEARCHING_THREADS 8
 
-// Max number of searching threads searching edges
-#define MAX_NUMBER_OF_SEARCHING_THREADS_SEARCHING_EDGES 4
+// Max number of solutions per graph
+#define MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH 8
 
-// Check if edge bits is 32
-#if EDGE_BITS == 32
+// Searching threads number of edges per SipHash (Edges' nodes are computed this many edges at a time so that SipHash-2-4 can use wide vectors)
+#define SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH 16
 
-	// First searching thread search edges percent
-	#define FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT 0.86
-	
-// Otherwise
-#else
+// Max searching threads bitmap chunk size (Searching threads take and steal the edges bitmap's units this many at a time when getting the edges from it)
+#define MAX_SEARCHING_THREADS_BITMAP_CHUNK_SIZE 512
 
-	// First searching thread search edges percent
-	#define FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT 0.85
-#endif
+// Number of nonces per BLAKE2b (SipHash keys are derived for this many consecutive nonces at a time when there's no trimming rounds so that BLAKE2b can use wide vectors)
+#define NUMBER_OF_NONCES_PER_BLAKE2B 8
 
 // Default stratum server address
 #define DEFAULT_STRATUM_SERVER_ADDRESS "localhost"
@@ -166,6 +175,21 @@ using namespace std;
 // Default instance index
 #define DEFAULT_INSTANCE_INDEX 1
 
+// Default CPU trimming rounds
+#define DEFAULT_CPU_TRIMMING_ROUNDS 0
+
+// Max CPU trimming rounds
+#define MAX_CPU_TRIMMING_ROUNDS 1000
+
+// Default number of parallel graphs
+#define DEFAULT_NUMBER_OF_PARALLEL_GRAPHS 1
+
+// Searching threads bitmap chunk size (Chunks are made smaller for small graphs so that each searching thread still gets several of them)
+#define SEARCHING_THREADS_BITMAP_CHUNK_SIZE static_cast<uint32_t>(min(static_cast<uint64_t>(MAX_SEARCHING_THREADS_BITMAP_CHUNK_SIZE), max(static_cast<uint64_t>(EDGES_BITMAP_SIZE) / (MAX_NUMBER_OF_SEARCHING_THREADS * 8), static_cast<uint64_t>(1))))
+
+// Searching threads number of bitmap chunks
+#define SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS static_cast<uint32_t>((EDGES_BITMAP_SIZE + SEARCHING_THREADS_BITMAP_CHUNK_SIZE - 1) / SEARCHING_THREADS_BITMAP_CHUNK_SIZE)
+
 // Trimming type
 enum TrimmingType {
 
@@ -179,10 +203,67 @@ enum TrimmingType {
 	SLEAN_TRIMMING_TYPE = 1 << 1,
 	
 	// Lean trimming type
-	LEAN_TRIMMING_TYPE = 1 << 2
+	LEAN_TRIMMING_TYPE = 1 << 2,
+	
+	// CPU lean trimming type
+	CPU_LEAN_TRIMMING_TYPE = 1 << 3,
+	
+	// CPU mean trimming type
+	CPU_MEAN_TRIMMING_TYPE = 1 << 4
+};
+
+// Searching phase (Searching threads stop searching a graph for a previous block after one of these phases)
+enum SearchingPhase : uint8_t {
+
+	// Starting searching phase
+	STARTING_SEARCHING_PHASE = 1,
+	
+	// Renaming searching phase
+	RENAMING_SEARCHING_PHASE,
+	
+	// Partitioning searching phase
+	PARTITIONING_SEARCHING_PHASE
 };
 
 
+// Structures
+
+// Check if there's no trimming rounds
+#if TRIMMING_ROUNDS == 0
+
+	// Parallel graph structure (A graph that's given to a group of searching threads and then given back with its solutions when searching multiple graphs in parallel)
+	struct ParallelGraph {
+	
+		// SipHash keys
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+		
+		// Height
+		uint64_t height;
+		
+		// ID
+		uint64_t id;
+		
+		// Nonce
+		uint64_t nonce;
+		
+		// Close (The group of searching threads that gets this closes instead of searching it)
+		bool close;
+		
+		// Stale phase (The group's first searching thread sets this to the phase after which the group stops searching the graph because it's for a previous block)
+		uint8_t stalePhase;
+		
+		// Searching time
+		double searchingTime;
+		
+		// Number of solutions
+		uint32_t numberOfSolutions;
+		
+		// Solutions
+		uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+	};
+#endif
+
+
 // Global variables
 
 // Closing
@@ -191,11 +272,14 @@ static volatile sig_atomic_t closing;
 // Previous graph processed time
 static chrono::high_resolution_clock::time_point previousGraphProcessedTime;
 
-// Searching threads mutex
-static mutex searchingThreadsMutex;
+// Searching threads handoff
+static SearchingThreadsHandoff *searchingThreadsHandoff;
+
+// Searching threads scheduler (This is only set when the searching threads' idle times are displayed)
+static WorkStealingScheduler *searchingThreadsScheduler;
 
-// Searching threads lock
-static unique_lock searchingThreadsLock(searchingThreadsMutex);
+// Searching threads solutions mutex
+static mutex searchingThreadsSolutionsMutex;
 
 // Searching threads data
 static const void *searchingThreadsData;
@@ -203,20 +287,20 @@ static const void *searchingThreadsData;
 // Searching threads SipHash keys
 static const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) *searchingThreadsSipHashKeys;
 
-// Searching threads solution
-static uint32_t searchingThreadsSolution[SOLUTION_SIZE];
+// Searching threads CPU trimming rounds
+static unsigned int searchingThreadsCpuTrimmingRounds;
 
-// Searching threads finished
-static bool searchingThreadsFinished;
+// Searching threads height
+static uint64_t searchingThreadsHeight;
 
-// Start searching threads trigger toggle
-static bool startSearchingThreadsTriggerToggle;
+// Searching threads stale phase (The first searching thread sets this to the phase after which the searching threads stop searching the graph because it's for a previous block)
+static uint8_t searchingThreadsStalePhase;
 
-// Start searching threads conditional variable
-static condition_variable *startSearchingThreadsConditionalVariable;
+// Searching threads solutions
+static uint32_t searchingThreadsSolutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
 
-// Searching threads finished conditional variable
-static condition_variable *searchingThreadsFinishedConditionalVariable;
+// Searching threads number of solutions
+static uint32_t searchingThreadsNumberOfSolutions;
 
 // Graphs processed
 static uint64_t graphsProcessed;
@@ -267,8 +351,8 @@ static uint64_t jobHeight;
 // Job ID
 static uint64_t jobId;
 
-// Job header
-static uint8_t jobHeader[HEADER_SIZE] = {};
+// Job header midstate
+static Blake2bMidstate jobHeaderMidstate;
 
 // Check if not tuning
 #ifndef TUNING
@@ -280,12 +364,53 @@ static uint8_t jobHeader[HEADER_SIZE] = {};
 // Job nonce
 static uint64_t jobNonce = 0;
 
+// Newest job height (This can be newer than the job's height since the stratum server watcher sets it as soon as a job for a new block arrives, and graphs with a different height are abandoned)
+static atomic<uint64_t> newestJobHeight;
+
+// Check if not tuning
+#ifndef TUNING
+
+	// Stale graphs
+	static uint64_t staleGraphs;
+	
+	// Stale time saved
+	static double staleTimeSaved;
+#endif
+
 
 // Function prototypes
 
 // Trimming finished
 static inline void trimmingFinished(const void *__restrict__ data, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce) noexcept;
 
+// Search trimmed graph
+static inline double searchTrimmedGraph(const void *__restrict__ data, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce) noexcept;
+
+// Searching finished
+static inline void searchingFinished(const uint64_t height, const uint64_t id, const uint64_t nonce, const chrono::high_resolution_clock::time_point &endTime, const double searchingTime) noexcept;
+
+// Add searching threads solutions
+static inline void addSearchingThreadsSolutions(const uint32_t solutions[][SOLUTION_SIZE], const uint32_t numberOfSolutions) noexcept;
+
+// Set searching threads edges' nodes
+static inline CPU_FEATURE_DISPATCH_VARIANTS void setSearchingThreadsEdgesNodes(uint32_t *edges, const uint_fast8_t numberOfEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys) noexcept;
+
+// Is stale graph
+static inline bool isStaleGraph(const uint64_t height) noexcept;
+
+// Mark stale searching phase
+static inline void markStaleSearchingPhase(uint8_t &stalePhase, const SearchingPhase phase, const uint64_t height, const unsigned int searchingThreadIndex) noexcept;
+
+// Is stale searching phase
+static inline bool isStaleSearchingPhase(const uint8_t &stalePhase, const SearchingPhase phase) noexcept;
+
+// Check if using CPU feature dispatch
+#ifdef USE_CPU_FEATURE_DISPATCH
+
+	// Get CPU feature dispatch variant
+	static inline const char *getCpuFeatureDispatchVariant() noexcept;
+#endif
+
 // Check if not tuning
 #ifndef TUNING
 
@@ -304,9 +429,21 @@ static inline void trimmingFinished(const void *__restrict__ data, const uint64_
 
 
 // Header files
+#include "./remaining_edges_ring_buffer.h"
+#include "./pipeline_balancer.h"
 #include "./lean_trimming.h"
 #include "./mean_trimming.h"
 #include "./slean_trimming.h"
+#include "./cpu_lean_trimming.h"
+#include "./cpu_mean_trimming.h"
+#include "./cpu_trimming_device.h"
+
+// Check if not tuning
+#ifndef TUNING
+
+	// Header files
+	#include "./stratum_server_watcher.h"
+#endif
 
 
 // Check if not using other main function
@@ -371,12 +508,17 @@ void prepareMiner() noexcept {
 // Start miner
 bool startMiner(const int argc, char *argv[]) noexcept {
 
-	// Set start searching threads trigger toggle to false
-	startSearchingThreadsTriggerToggle = false;
-	
 	// Set graphs processed to zero
 	graphsProcessed = 0;
 	
+	// Check if tuning
+	#ifdef TUNING
+	
+		// Set job's header midstate to an empty header's midstate
+		const uint8_t emptyHeader[HEADER_SIZE] = {};
+		setBlake2bMidstate(jobHeaderMidstate, emptyHeader);
+	#endif
+	
 	// Check if not tuning
 	#ifndef TUNING
 	
@@ -391,6 +533,12 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 		
 		// Set stratum server password to nothing
 		stratumServerPassword = nullptr;
+		
+		// Set stale graphs to zero
+		staleGraphs = 0;
+		
+		// Set stale time saved to zero
+		staleTimeSaved = 0;
 	#endif
 	
 	// Display message
@@ -416,6 +564,13 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 		#endif
 	#endif
 	
+	// Check if using CPU feature dispatch
+	#ifdef USE_CPU_FEATURE_DISPATCH
+	
+		// Display message
+		cout << ", " << getCpuFeatureDispatchVariant() << " CPU variant";
+	#endif
+	
 	// Check if tuning
 	#ifdef TUNING
 	
@@ -533,13 +688,13 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 				// Display message
 				cout << "No OpenCL platforms found." << endl;
 				
-				// Return false
-				return false;
+				// Set number of platforms to zero (CPU lean trimming doesn't use a GPU, so this isn't an error)
+				numberOfPlatforms = 0;
 			}
 			
-			// Check if getting platforms failed
+			// Check if platforms exist and getting platforms failed
 			cl_platform_id platforms[numberOfPlatforms];
-			if(clGetPlatformIDs(numberOfPlatforms, platforms, nullptr) != CL_SUCCESS) {
+			if(numberOfPlatforms && clGetPlatformIDs(numberOfPlatforms, platforms, nullptr) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Getting OpenCL platforms failed." << endl;
@@ -583,6 +738,39 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 		// Lean trimming
 		{"lean_trimming", no_argument, nullptr, 'l'},
 		
+		// CPU lean trimming
+		{"cpu_lean_trimming", no_argument, nullptr, 'e'},
+		
+		// CPU mean trimming
+		{"cpu_mean_trimming", no_argument, nullptr, 'b'},
+		
+		// Check if not using an Apple device or using OpenCL
+		#if !defined __APPLE__ || defined USE_OPENCL
+		
+			// OpenCL CPU devices
+			{"opencl_cpu_devices", no_argument, nullptr, 'o'},
+		#endif
+		
+		// CSR searching
+		{"csr_searching", no_argument, nullptr, 'c'},
+		
+		// CPU trimming rounds
+		{"cpu_trimming_rounds", required_argument, nullptr, 'n'},
+		
+		// Check if there's trimming rounds
+		#if TRIMMING_ROUNDS != 0
+		
+			// Balance pipeline stages
+			{"balance_pipeline_stages", no_argument, nullptr, 'k'},
+		#endif
+		
+		// Check if there's no trimming rounds
+		#if TRIMMING_ROUNDS == 0
+		
+			// Parallel graphs
+			{"parallel_graphs", required_argument, nullptr, 'x'},
+		#endif
+		
 		// Total number of instances
 		{"total_number_of_instances", required_argument, nullptr, 't'},
 		
@@ -619,6 +807,32 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 		
 		// Set trimming types to all trimming types
 		underlying_type_t<TrimmingType> trimmingTypes = ALL_TRIMMING_TYPES;
+		
+		// Check if not using an Apple device or using OpenCL
+		#if !defined __APPLE__ || defined USE_OPENCL
+		
+			// Set OpenCL device types to GPUs
+			cl_device_type openClDeviceTypes = CL_DEVICE_TYPE_GPU;
+		#endif
+	#endif
+	
+	// Set CSR searching to false
+	bool csrSearching = false;
+	
+	// Set CPU trimming rounds to its default value
+	unsigned int cpuTrimmingRounds = DEFAULT_CPU_TRIMMING_ROUNDS;
+	
+	// Check if there's no trimming rounds
+	#if TRIMMING_ROUNDS == 0
+	
+		// Set number of parallel graphs to its default value
+		unsigned int numberOfParallelGraphs = DEFAULT_NUMBER_OF_PARALLEL_GRAPHS;
+		
+	// Otherwise
+	#else
+	
+		// Set balance pipeline stages to false
+		bool balancePipelineStages = false;
 	#endif
 	
 	// Set total number of instances to its default value
@@ -636,10 +850,63 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 	// Set exit after options to true if options are provided
 	bool exitAfterOptions = argc > 1;
 	
+	// Set short options
+	string shortOptions = "va:p:u:w:dg:meslbcn:t:i:h";
+	
+	// Check if not using an Apple device or using OpenCL
+	#if !defined __APPLE__ || defined USE_OPENCL
+	
+		// Add OpenCL CPU devices to short options
+		shortOptions += 'o';
+	#endif
+	
+	// Check if there's no trimming rounds
+	#if TRIMMING_ROUNDS == 0
+	
+		// Add parallel graphs to short options
+		shortOptions += "x:";
+		
+	// Otherwise
+	#else
+	
+		// Add balance pipeline stages to short options
+		shortOptions += 'k';
+	#endif
+	
+	// Check if the GPU's memory is adjustable
+	if(currentAdjustableGpuMemoryAmount) {
+	
+		// Add GPU RAM to short options
+		shortOptions += "r:";
+	}
+	
+	// Check if there's trimming rounds
+	#if TRIMMING_ROUNDS != 0
+	
+		// Check if not using an Apple device or using OpenCL
+		#if !defined __APPLE__ || defined USE_OPENCL
+		
+			// Go through all options silently before processing them so that displaying GPUs includes all of the accepted OpenCL device types regardless of the options' order
+			int silentOption;
+			opterr = 0;
+			optind = 0;
+			while((silentOption = getopt_long(argc, argv, shortOptions.c_str(), options, nullptr)) != -1) {
+			
+				// Check if option is OpenCL CPU devices
+				if(silentOption == 'o') {
+				
+					// Add CPU and accelerator devices to the OpenCL device types
+					openClDeviceTypes |= CL_DEVICE_TYPE_CPU | CL_DEVICE_TYPE_ACCELERATOR;
+				}
+			}
+			opterr = 1;
+		#endif
+	#endif
+	
 	// Go through all options while not displaying help
 	int option;
 	optind = 0;
-	while((option = getopt_long(argc, argv, (static_cast<string>("va:p:u:w:dg:meslt:i:h") + (currentAdjustableGpuMemoryAmount ? "r:" : "")).c_str(), options, nullptr)) != -1 && !displayHelp) {
+	while((option = getopt_long(argc, argv, shortOptions.c_str(), options, nullptr)) != -1 && !displayHelp) {
 	
 		// Check option
 		switch(option) {
@@ -954,11 +1221,11 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 							
 							// Check if getting platform's number of devices was successful and devices exist
 							cl_uint numberOfDevices;
-							if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
+							if(clGetDeviceIDs(platforms[i], openClDeviceTypes, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
 							
 								// Check if getting platform's devices was successful
 								cl_device_id devices[numberOfDevices];
-								if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
+								if(clGetDeviceIDs(platforms[i], openClDeviceTypes, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
 								
 									// Go through all of the platform's devices
 									for(cl_uint j = 0; j < numberOfDevices; ++j) {
@@ -1177,6 +1444,134 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					// Enable lean trimming type
 					trimmingTypes |= LEAN_TRIMMING_TYPE;
 					
+					// Break
+					break;
+					
+				// CPU lean trimming
+				case 'e':
+				
+					// Set exit after options to false
+					exitAfterOptions = false;
+					
+					// Enable CPU lean trimming type
+					trimmingTypes |= CPU_LEAN_TRIMMING_TYPE;
+					
+					// Break
+					break;
+					
+				// CPU mean trimming
+				case 'b':
+				
+					// Set exit after options to false
+					exitAfterOptions = false;
+					
+					// Enable CPU mean trimming type
+					trimmingTypes |= CPU_MEAN_TRIMMING_TYPE;
+					
+					// Break
+					break;
+					
+				// Check if not using an Apple device or using OpenCL
+				#if !defined __APPLE__ || defined USE_OPENCL
+				
+					// OpenCL CPU devices
+					case 'o':
+					
+						// Set exit after options to false
+						exitAfterOptions = false;
+						
+						// Break (OpenCL device types were already set before processing the options)
+						break;
+				#endif
+			#endif
+			
+			// CSR searching
+			case 'c':
+			
+				// Set exit after options to false
+				exitAfterOptions = false;
+				
+				// Set CSR searching to true
+				csrSearching = true;
+				
+				// Break
+				break;
+			
+			// CPU trimming rounds
+			case 'n': {
+			
+				// Set exit after options to false
+				exitAfterOptions = false;
+				
+				// Check if option is invalid
+				char *end;
+				errno = 0;
+				const unsigned long optionAsNumber = optarg ? strtoul(optarg, &end, DECIMAL_NUMBER_BASE) : 0;
+				if(!optarg || end == optarg || *end || !isdigit(optarg[0]) || (optarg[0] == '0' && isdigit(optarg[1])) || errno || optionAsNumber > MAX_CPU_TRIMMING_ROUNDS) {
+				
+					// Display message
+					cout << argv[0] << ": invalid CPU trimming rounds -- '" << (optarg ? optarg : "") << '\'' << endl;
+					
+					// Set display help to true
+					displayHelp = true;
+				}
+				
+				// Otherwise
+				else {
+				
+					// Set CPU trimming rounds to the option
+					cpuTrimmingRounds = optionAsNumber;
+				}
+				
+				// Break
+				break;
+			}
+			
+			// Check if there's no trimming rounds
+			#if TRIMMING_ROUNDS == 0
+			
+				// Parallel graphs
+				case 'x': {
+				
+					// Set exit after options to false
+					exitAfterOptions = false;
+					
+					// Check if option is invalid
+					char *end;
+					errno = 0;
+					const unsigned long optionAsNumber = optarg ? strtoul(optarg, &end, DECIMAL_NUMBER_BASE) : 0;
+					if(!optarg || end == optarg || *end || !isdigit(optarg[0]) || (optarg[0] == '0' && isdigit(optarg[1])) || errno || !optionAsNumber || optionAsNumber > MAX_NUMBER_OF_SEARCHING_THREADS) {
+					
+						// Display message
+						cout << argv[0] << ": invalid parallel graphs -- '" << (optarg ? optarg : "") << '\'' << endl;
+						
+						// Set display help to true
+						displayHelp = true;
+					}
+					
+					// Otherwise
+					else {
+					
+						// Set number of parallel graphs to the option
+						numberOfParallelGraphs = optionAsNumber;
+					}
+					
+					// Break
+					break;
+				}
+				
+			// Otherwise
+			#else
+			
+				// Balance pipeline stages
+				case 'k':
+				
+					// Set exit after options to false
+					exitAfterOptions = false;
+					
+					// Set balance pipeline stages to true
+					balancePipelineStages = true;
+					
 					// Break
 					break;
 			#endif
@@ -1338,9 +1733,33 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			cout << "\t-m, --mean_trimming\t\tUse only mean trimming" << endl;
 			cout << "\t-s, --slean_trimming\t\tUse only slean trimming" << endl;
 			cout << "\t-l, --lean_trimming\t\tUse only lean trimming" << endl;
+			cout << "\t-e, --cpu_lean_trimming\t\tUse only lean trimming performed on the CPU" << endl;
+			cout << "\t-b, --cpu_mean_trimming\t\tUse only mean trimming performed on the CPU" << endl;
+			
+			// Check if not using an Apple device or using OpenCL
+			#if !defined __APPLE__ || defined USE_OPENCL
+			
+				// Display message
+				cout << "\t-o, --opencl_cpu_devices\tAlso use OpenCL CPU and accelerator devices as GPUs with work group sizes tuned for them" << endl;
+			#endif
 		#endif
 		
 		// Display message
+		cout << "\t-c, --csr_searching\t\tSearch using a compressed sparse row adjacency instead of linked lists" << endl;
+		cout << "\t-n, --cpu_trimming_rounds\tThe maximum number of trimming rounds the searching threads perform on the remaining edges before searching them. They stop early once a round doesn't remove any edges (default: " TO_STRING(DEFAULT_CPU_TRIMMING_ROUNDS) ")" << endl;
+		
+		// Check if there's no trimming rounds
+		#if TRIMMING_ROUNDS == 0
+		
+			// Display message
+			cout << "\t-x, --parallel_graphs\t\tThe number of graphs to search at once by splitting the searching threads into that many groups. Each group uses its own memory for its graph (default: " TO_STRING(DEFAULT_NUMBER_OF_PARALLEL_GRAPHS) ")" << endl;
+			
+		// Otherwise
+		#else
+		
+			// Display message
+			cout << "\t-k, --balance_pipeline_stages\tAdjust the number of lean trimming rounds and CPU trimming rounds while mining to make graphs take the least time. Lean trimming never performs fewer than " TO_STRING(TRIMMING_ROUNDS) " trimming rounds" << endl;
+		#endif
 		cout << "\t-t, --total_number_of_instances\tThe total number of instances of this program that will be running (default: " TO_STRING(DEFAULT_TOTAL_NUMBER_OF_INSTANCES) ")" << endl;
 		cout << "\t-i, --instance\t\t\tThe index of this instance (default: " TO_STRING(DEFAULT_INSTANCE_INDEX) ")" << endl;
 		cout << "\t-h, --help\t\t\tDisplay help information" << endl;
@@ -1352,6 +1771,9 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 	// Get number of applicable CPU cores
 	const unsigned int numberOfApplicableCpuCores = getNumberOfHighPerformanceCpuCores();
 	
+	// Create CPU topology
+	createCpuTopology(numberOfApplicableCpuCores);
+	
 	// Get CPU cores name offset
 	const unsigned int cpuCoresNameOffset = getNumberOfCpuCores() - numberOfApplicableCpuCores;
 	
@@ -1361,8 +1783,15 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 	// Get this instance's first thread index
 	const unsigned int firstThreadIndex = (instanceIndex - 1) * max(numberOfApplicableCpuCores / totalNumberOfInstances, static_cast<unsigned int>(1)) % numberOfApplicableCpuCores;
 	
+	// Check if using a CPU topology
+	if(cpuTopology) {
+	
+		// Set CPU topology's instance
+		cpuTopology->setInstance(firstThreadIndex, numberOfThreads);
+	}
+	
 	// Check if setting thread's priority and affinity failed
-	if(!setThreadPriorityAndAffinity((firstThreadIndex + numberOfThreads - 1) % numberOfApplicableCpuCores)) {
+	if(!setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + numberOfThreads - 1) % numberOfApplicableCpuCores))) {
 	
 		// Display message
 		cout << "Setting thread's priority and affinity failed." << endl;
@@ -1446,6 +1875,13 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 	// Display message
 	cout << "This is instance " << instanceIndex << " out of " << totalNumberOfInstances << ((totalNumberOfInstances == DEFAULT_TOTAL_NUMBER_OF_INSTANCES) ? ". You should change this if you're planning on running multiple instances of this program at once" : "") << '.' << endl;
 	
+	// Check if using a CPU topology
+	if(cpuTopology) {
+	
+		// Display CPU topology
+		cpuTopology->display(firstThreadIndex, numberOfThreads);
+	}
+	
 	// Display message
 	cout << "Using the cuckatoo" TO_STRING(EDGE_BITS) " (C" TO_STRING(EDGE_BITS) ") mining algorithm. You should verify that this is the correct algorithm for the cryptocurrency that you're trying to mine." << endl;
 	
@@ -1480,16 +1916,18 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			// Return false
 			return false;
 		}
+		
+		// Create stratum server watcher
+		createStratumServerWatcher();
+		
+		// Automatically free stratum server watcher when done
+		const unique_ptr<unique_ptr<StratumServerWatcher>, void(*)(unique_ptr<StratumServerWatcher> *)> stratumServerWatcherUniquePointer(&stratumServerWatcher, [](unique_ptr<StratumServerWatcher> *stratumServerWatcher) noexcept {
+		
+			// Free stratum server watcher
+			stratumServerWatcher->reset();
+		});
 	#endif
 	
-	// Create start searching threads conditional variable
-	condition_variable startSearchingThreadsConditionalVariableAutomaticDuration;
-	startSearchingThreadsConditionalVariable = &startSearchingThreadsConditionalVariableAutomaticDuration;
-	
-	// Create searching threads finished conditional variable
-	condition_variable searchingThreadsFinishedConditionalVariableAutomaticDuration;
-	searchingThreadsFinishedConditionalVariable = &searchingThreadsFinishedConditionalVariableAutomaticDuration;
-	
 	// Check if there's no trimming rounds
 	#if TRIMMING_ROUNDS == 0
 	
@@ -1506,91 +1944,483 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			#ifdef _WIN32
 			
 				// Display message
-				cout << (i ? ", " : "") << "CPU " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + cpuCoresNameOffset);
+				cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
 				
 			// Otherwise check if using an Apple device
 			#elif defined __APPLE__
 			
 				// Display message
-				cout << (i ? ", " : "") << "Core " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+				cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 				
 			// Otherwise
 			#else
 			
 				// Display message
-				cout << (i ? ", " : "") << "CPU" << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+				cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 			#endif
 		}
 		
 		// Display new line
 		cout << endl;
 		
-		// Get number of searching threads searching edges
-		const unsigned int numberOfSearchingThreadsSearchingEdges = min(min(numberOfSearchingThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS_SEARCHING_EDGES)), static_cast<unsigned int>(1 + ceil(log2((1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) * MAX_NUMBER_OF_EDGES_AFTER_TRIMMING))));
-		
-		// Go through all searching threads
-		thread searchingThreads[numberOfSearchingThreads];
-		barrier searchingThreadsBarrier(numberOfSearchingThreads);
-		const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
-		unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreadsSearchingEdges];
-		unsigned int numberOfSearchingThreadsFinished = 0;
-		bool closeSearchingThreads = false;
-		bool searchingThreadsInitializedSuccessfully = true;
-		
-		for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
+		// Check if searching multiple graphs in parallel
+		numberOfParallelGraphs = min(numberOfParallelGraphs, numberOfSearchingThreads);
+		if(numberOfParallelGraphs > 1) {
 		
-			// Check if searching thread is searching edges
-			if(i < numberOfSearchingThreadsSearchingEdges) {
+			// Display message
+			cout << "Searching " << numberOfParallelGraphs << " graphs in parallel." << endl;
+			
+			// Go through all groups of searching threads
+			thread searchingThreads[numberOfSearchingThreads];
+			unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreads];
+			unique_ptr<barrier<>> searchingGroupsBarrier[MAX_NUMBER_OF_SEARCHING_THREADS];
+			unique_ptr<uint32_t[]> searchingGroupsEdges[MAX_NUMBER_OF_SEARCHING_THREADS];
+			unique_ptr<ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE>> searchingGroupsComponentPartitioner[MAX_NUMBER_OF_SEARCHING_THREADS];
+			unique_ptr<LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> searchingGroupsLeafPruner[MAX_NUMBER_OF_SEARCHING_THREADS];
+			unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> searchingGroupsCsrAdjacency[MAX_NUMBER_OF_SEARCHING_THREADS];
+			unique_ptr<WorkStealingScheduler> searchingGroupsWorkStealingScheduler[MAX_NUMBER_OF_SEARCHING_THREADS];
+			ParallelGraph searchingGroupsGraph[MAX_NUMBER_OF_SEARCHING_THREADS];
+			BoundedQueue<ParallelGraph> graphsToSearch(numberOfParallelGraphs * 3);
+			BoundedQueue<ParallelGraph> searchedGraphs(numberOfParallelGraphs * 2);
+			SearchingThreadsHandoff searchingThreadsHandoffAutomaticDuration(numberOfSearchingThreads);
+			searchingThreadsHandoff = &searchingThreadsHandoffAutomaticDuration;
+			bool closeSearchingThreads = false;
+			atomic<bool> searchingThreadsInitializedSuccessfully(true);
+			
+			for(unsigned int i = 0, groupsFirstSearchingThreadIndex = 0; i < numberOfParallelGraphs; ++i) {
+			
+				// Get number of searching threads in the group
+				const unsigned int numberOfGroupsSearchingThreads = numberOfSearchingThreads * (i + 1) / numberOfParallelGraphs - numberOfSearchingThreads * i / numberOfParallelGraphs;
+				
+				// Create group's barrier, edges, component partitioner, leaf pruner, CSR adjacency, and work stealing scheduler
+				searchingGroupsBarrier[i] = unique_ptr<barrier<>>(new(nothrow) barrier<>(numberOfGroupsSearchingThreads));
+				searchingGroupsEdges[i] = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
+				searchingGroupsComponentPartitioner[i] = unique_ptr<ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE>>(new(nothrow) ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE>(numberOfGroupsSearchingThreads));
+				searchingGroupsLeafPruner[i] = unique_ptr<LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>>(cpuTrimmingRounds ? new(nothrow) LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfGroupsSearchingThreads) : nullptr);
+				searchingGroupsCsrAdjacency[i] = unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>>(csrSearching ? new(nothrow) CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfGroupsSearchingThreads) : nullptr);
+				searchingGroupsWorkStealingScheduler[i] = unique_ptr<WorkStealingScheduler>(new(nothrow) WorkStealingScheduler(numberOfGroupsSearchingThreads, SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS));
+				
+				// Go through all of the group's searching threads
+				for(unsigned int j = 0; j < numberOfGroupsSearchingThreads; ++j) {
+				
+					// Create searching thread's node connections
+					nodeConnections[groupsFirstSearchingThreadIndex + j] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2 + 1]);
+					
+					// Create searching thread
+					searchingThreads[groupsFirstSearchingThreadIndex + j] = thread([numberOfApplicableCpuCores, firstThreadIndex, groupsBarrier = searchingGroupsBarrier[i].get(), edges = searchingGroupsEdges[i].get(), componentPartitioner = searchingGroupsComponentPartitioner[i].get(), cpuTrimmingRounds, leafPruner = searchingGroupsLeafPruner[i].get(), csrSearching, csrAdjacency = searchingGroupsCsrAdjacency[i].get(), nodeConnections = nodeConnections[groupsFirstSearchingThreadIndex + j].get(), workStealingScheduler = searchingGroupsWorkStealingScheduler[i].get(), &graph = searchingGroupsGraph[i], &graphsToSearch, &searchedGraphs, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = groupsFirstSearchingThreadIndex + j, groupsSearchingThreadIndex = j]() noexcept {
+					
+						// Check if using an Apple device and not using macOS or using Android
+						#if (defined __APPLE__ && TARGET_OS_OSX == 0) || defined __ANDROID__
+						
+							// Set thread's priority and affinity
+							setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores));
+							
+							// Set initialized failed to if creating the group's barrier failed, creating edges failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, creating graph queues failed, creating work stealing scheduler failed, or initializing thread local global variables failed
+							const bool initializingFailed = !groupsBarrier || !edges || !componentPartitioner || !*componentPartitioner || (cpuTrimmingRounds && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !graphsToSearch || !searchedGraphs || !workStealingScheduler || !*workStealingScheduler || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
+							
+						// Otherwise
+						#else
+						
+							// Set initialized failed to if setting searching thread's priority and affinity failed, creating the group's barrier failed, creating edges failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, creating graph queues failed, creating work stealing scheduler failed, or initializing thread local global variables failed
+							const bool initializingFailed = !setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores)) || !groupsBarrier || !edges || !componentPartitioner || !*componentPartitioner || (cpuTrimmingRounds && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !graphsToSearch || !searchedGraphs || !workStealingScheduler || !*workStealingScheduler || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
+						#endif
+						
+						// Check if initializing failed
+						if(initializingFailed) {
+						
+							// Set searching threads initialized successfully to false
+							searchingThreadsInitializedSuccessfully.store(false, memory_order_relaxed);
+						}
+						
+						// Notify that the searching thread has initialized
+						searchingThreadsHandoff->finished();
+						
+						// Wait until starting searching threads (A group's searching threads wait for each other at the group's barrier, so none of them can close on their own if any searching thread failed to initialize)
+						searchingThreadsHandoff->waitUntilStarted(0);
+						
+						// Get if closing thread
+						const bool closeThread = closeSearchingThreads;
+						
+						// Check if closing thread
+						if(closeThread) {
+						
+							// Return
+							return;
+						}
+						
+						// Give the searching thread its share of the edges bitmap's chunks
+						workStealingScheduler->distribute(groupsSearchingThreadIndex);
+						
+						// Loop forever
+						while(true) {
+						
+							// Check if searching thread is the group's first searching thread
+							chrono::high_resolution_clock::time_point startTime;
+							if(!groupsSearchingThreadIndex) {
+							
+								// Get the group's next graph to search
+								graphsToSearch.pop(graph);
+								
+								// Record start time
+								startTime = chrono::high_resolution_clock::now();
+								
+								// Check if not closing
+								if(!graph.close) {
+								
+									// Mark starting as stale if the graph is stale
+									markStaleSearchingPhase(graph.stalePhase, STARTING_SEARCHING_PHASE, graph.height, groupsSearchingThreadIndex);
+								}
+							}
+							
+							// Wait for the group's first searching thread to get the graph
+							groupsBarrier->arrive_and_wait();
+							
+							// Check if closing thread
+							if(graph.close) {
+							
+								// Return
+								return;
+							}
+							
+							// Check if starting is stale
+							if(isStaleSearchingPhase(graph.stalePhase, STARTING_SEARCHING_PHASE)) {
+							
+								// Wait for all of the group's searching threads to get that the graph is stale (The group's first searching thread gets the next graph into the same place when it gives back this one)
+								groupsBarrier->arrive_and_wait();
+								
+								// Give the searching thread its share of the edges bitmap's chunks for the next graph
+								workStealingScheduler->distribute(groupsSearchingThreadIndex);
+								
+								// Check if searching thread is the group's first searching thread
+								if(!groupsSearchingThreadIndex) {
+								
+									// Set graph's searching time
+									graph.searchingTime = static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+									
+									// Give back the stale graph
+									searchedGraphs.push(graph);
+								}
+								
+								// Continue
+								continue;
+							}
+							
+							// Mark getting the edges as stale if the graph is stale
+							markStaleSearchingPhase(graph.stalePhase, RENAMING_SEARCHING_PHASE, graph.height, groupsSearchingThreadIndex);
+							
+							// Go through all chunks of the edges bitmap that the searching thread gets or steals
+							workStealingScheduler->perform(groupsSearchingThreadIndex, [edges, &graph](const uint32_t chunk) noexcept {
+							
+								// Go through all units in the chunk
+								uint64_t edgeIndex = static_cast<uint64_t>(chunk) * SEARCHING_THREADS_BITMAP_CHUNK_SIZE * BITMAP_UNIT_WIDTH * EDGE_NUMBER_OF_COMPONENTS;
+								for(uint_fast32_t bitmapIndex = chunk * SEARCHING_THREADS_BITMAP_CHUNK_SIZE; bitmapIndex < min((chunk + 1) * SEARCHING_THREADS_BITMAP_CHUNK_SIZE, static_cast<uint32_t>(EDGES_BITMAP_SIZE)); ++bitmapIndex) {
+								
+									// Go through all bits in the unit
+									for(uint_fast8_t i = 0; i < BITMAP_UNIT_WIDTH; ++i) {
+									
+										// Set edge's index
+										edges[edgeIndex] = bitmapIndex * BITMAP_UNIT_WIDTH + i;
+										
+										// Go to next edge
+										edgeIndex += EDGE_NUMBER_OF_COMPONENTS;
+										
+										// Check if enough edges don't have their nodes set
+										if((i + 1) % SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH == 0) {
+										
+											// Set edges' nodes
+											setSearchingThreadsEdgesNodes(&edges[edgeIndex - SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH * EDGE_NUMBER_OF_COMPONENTS], SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH, graph.sipHashKeys);
+										}
+									}
+								}
+							});
+							
+							// Wait for all of the group's searching threads to finish getting the edges in the chunks
+							workStealingScheduler->arriveAndWait(groupsSearchingThreadIndex, *groupsBarrier);
+							
+							// Check if getting the edges is stale (Edges' nodes are already less than twice the number of edges, so they don't need to be renamed)
+							if(isStaleSearchingPhase(graph.stalePhase, RENAMING_SEARCHING_PHASE)) {
+							
+								// Wait for all of the group's searching threads to get that the graph is stale
+								groupsBarrier->arrive_and_wait();
+								
+								// Give the searching thread its share of the edges bitmap's chunks for the next graph
+								workStealingScheduler->distribute(groupsSearchingThreadIndex);
+								
+								// Check if searching thread is the group's first searching thread
+								if(!groupsSearchingThreadIndex) {
+								
+									// Set graph's searching time
+									graph.searchingTime = static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+									
+									// Give back the stale graph
+									searchedGraphs.push(graph);
+								}
+								
+								// Continue
+								continue;
+							}
+							
+							// Mark partitioning as stale if the graph is stale
+							markStaleSearchingPhase(graph.stalePhase, PARTITIONING_SEARCHING_PHASE, graph.height, groupsSearchingThreadIndex);
+							
+							// Check if CPU trimming
+							if(cpuTrimmingRounds) {
+							
+								// Remove edges that can't be part of a cycle
+								leafPruner->prune(edges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, cpuTrimmingRounds, groupsSearchingThreadIndex, *groupsBarrier);
+							}
+							
+							// Partition edges' components
+							componentPartitioner->partition(edges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, cpuTrimmingRounds ? leafPruner->getEdgesRemoved() : nullptr, groupsSearchingThreadIndex, *groupsBarrier);
+							
+							// Check if partitioning is stale
+							if(isStaleSearchingPhase(graph.stalePhase, PARTITIONING_SEARCHING_PHASE)) {
+							
+								// Wait for all of the group's searching threads to get that the graph is stale
+								groupsBarrier->arrive_and_wait();
+								
+								// Give the searching thread its share of the edges bitmap's chunks for the next graph
+								workStealingScheduler->distribute(groupsSearchingThreadIndex);
+								
+								// Check if searching thread is the group's first searching thread
+								if(!groupsSearchingThreadIndex) {
+								
+									// Set graph's searching time
+									graph.searchingTime = static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+									
+									// Give back the stale graph
+									searchedGraphs.push(graph);
+								}
+								
+								// Continue
+								continue;
+							}
+							
+							// Check if CSR searching
+							uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+							uint32_t numberOfSolutions;
+							if(csrSearching) {
+							
+								// Build CSR adjacency from the edges
+								csrAdjacency->build(edges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, groupsSearchingThreadIndex, *groupsBarrier);
+								
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner->getThreadsNumberOfPrecedingEdges(groupsSearchingThreadIndex); ++i) {
+								
+									// Add edge to the CSR adjacency without searching it
+									addCuckatooCsrEdge(*csrAdjacency, componentPartitioner->getThreadsPrecedingEdges(groupsSearchingThreadIndex)[i], cpuTrimmingRounds);
+								}
+								
+								// Get solutions from the searching thread's edges using the CSR adjacency (Cycles are only filtered when the edges were trimmed)
+								numberOfSolutions = getCuckatooSolutionsFromCsrAdjacency(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, *csrAdjacency, componentPartitioner->getThreadsEdges(groupsSearchingThreadIndex), componentPartitioner->getThreadsNumberOfEdges(groupsSearchingThreadIndex), cpuTrimmingRounds);
+							}
+							
+							// Otherwise
+							else {
+							
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner->getThreadsNumberOfPrecedingEdges(groupsSearchingThreadIndex); ++i) {
+								
+									// Add edge without searching it
+									addCuckatooEdge(componentPartitioner->getThreadsPrecedingEdges(groupsSearchingThreadIndex)[i], cpuTrimmingRounds);
+								}
+								
+								// Get solutions from the searching thread's edges (Cycles are only filtered when the edges were trimmed)
+								numberOfSolutions = getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, componentPartitioner->getThreadsEdges(groupsSearchingThreadIndex), componentPartitioner->getThreadsNumberOfEdges(groupsSearchingThreadIndex), cpuTrimmingRounds);
+							}
+							
+							// Check if solutions were found
+							if(numberOfSolutions) {
+							
+								// Reserve space for the solutions in the graph's solutions (The searched graph's solutions are checked for duplicates when they're submitted)
+								const uint32_t firstSolutionIndex = atomic_ref<uint32_t>(graph.numberOfSolutions).fetch_add(numberOfSolutions, memory_order_relaxed);
+								
+								// Go through all of the solutions that fit in the graph's solutions
+								for(uint32_t i = firstSolutionIndex; i < min(firstSolutionIndex + numberOfSolutions, static_cast<uint32_t>(MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH)); ++i) {
+								
+									// Append solution to the graph's solutions
+									memcpy(graph.solutions[i], solutions[i - firstSolutionIndex], sizeof(graph.solutions[i]));
+								}
+							}
+							
+							// Reset node connections
+							cuckatooUNewestNodeConnections.clear();
+							cuckatooVNewestNodeConnections.clear();
+							
+							// Wait for all of the group's searching threads to finish searching the graph
+							groupsBarrier->arrive_and_wait();
+							
+							// Give the searching thread its share of the edges bitmap's chunks for the next graph
+							workStealingScheduler->distribute(groupsSearchingThreadIndex);
+							
+							// Check if searching thread is the group's first searching thread
+							if(!groupsSearchingThreadIndex) {
+							
+								// Set graph's searching time
+								graph.searchingTime = static_cast<chrono::duration<double>>(chrono::high_resolution_clock::now() - startTime).count();
+								
+								// Give back the searched graph
+								searchedGraphs.push(graph);
+							}
+						}
+					});
+				}
+				
+				// Update group's first searching thread index
+				groupsFirstSearchingThreadIndex += numberOfGroupsSearchingThreads;
+			}
+			
+			// Wait until searching threads have initialized
+			searchingThreadsHandoff->waitUntilFinished();
+			
+			// Check if searching threads didn't initialized successfully
+			if(!searchingThreadsInitializedSuccessfully) {
+			
+				// Display message
+				cout << "Allocating memory failed." << endl;
+				
+				// Close searching threads
+				closeSearchingThreads = true;
+				searchingThreadsHandoff->start();
+			}
+			
+			// Otherwise
+			else {
+			
+				// Start searching threads
+				searchingThreadsHandoff->start();
+				
+				// Display message
+				cout << "Mining started." << endl;
+				
+				// Set previous graph processed time to now
+				previousGraphProcessedTime = chrono::high_resolution_clock::now();
+				
+				// Create give graph to search function
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys[NUMBER_OF_NONCES_PER_BLAKE2B];
+				uint64_t sipHashKeysHeight = jobHeight;
+				uint64_t sipHashKeysId = jobId;
+				uint64_t sipHashKeysFirstNonce = jobNonce;
+				uint_fast8_t sipHashKeysIndex = NUMBER_OF_NONCES_PER_BLAKE2B;
+				const auto giveGraphToSearch = [&graphsToSearch, &sipHashKeys, &sipHashKeysHeight, &sipHashKeysId, &sipHashKeysFirstNonce, &sipHashKeysIndex]() noexcept {
+				
+					// Check if all SipHash keys were used or the job changed since they were derived
+					if(sipHashKeysIndex == NUMBER_OF_NONCES_PER_BLAKE2B || jobHeight != sipHashKeysHeight || jobId != sipHashKeysId || jobNonce != sipHashKeysFirstNonce + sipHashKeysIndex) {
+					
+						// Get SipHash keys from job's header and next nonces
+						blake2b<NUMBER_OF_NONCES_PER_BLAKE2B>(sipHashKeys, jobHeaderMidstate, jobNonce);
+						sipHashKeysHeight = jobHeight;
+						sipHashKeysId = jobId;
+						sipHashKeysFirstNonce = jobNonce;
+						sipHashKeysIndex = 0;
+					}
+					
+					// Give graph to search to the groups of searching threads
+					ParallelGraph graphToSearch;
+					graphToSearch.sipHashKeys = sipHashKeys[sipHashKeysIndex++];
+					graphToSearch.height = jobHeight;
+					graphToSearch.id = jobId;
+					graphToSearch.nonce = jobNonce++;
+					graphToSearch.close = false;
+					graphToSearch.stalePhase = 0;
+					graphToSearch.numberOfSolutions = 0;
+					graphsToSearch.push(graphToSearch);
+				};
+				
+				// Go through two graphs per group of searching threads (This lets each group start its next graph without waiting for the searched graph to be submitted)
+				for(unsigned int i = 0; i < numberOfParallelGraphs * 2; ++i) {
+				
+					// Give graph to search
+					giveGraphToSearch();
+				}
+				
+				// While not closing
+				while(!closing) {
+				
+					// Get searched graph
+					ParallelGraph searchedGraph;
+					searchedGraphs.pop(searchedGraph);
+					
+					// Set searching threads solutions to the searched graph's solutions
+					searchingThreadsNumberOfSolutions = 0;
+					addSearchingThreadsSolutions(searchedGraph.solutions, min(searchedGraph.numberOfSolutions, static_cast<uint32_t>(MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH)));
+					
+					// Searching finished
+					searchingFinished(searchedGraph.height, searchedGraph.id, searchedGraph.nonce, chrono::high_resolution_clock::now(), searchedGraph.searchingTime);
+					
+					// Give graph to search
+					giveGraphToSearch();
+				}
+				
+				// Go through all groups of searching threads
+				for(unsigned int i = 0; i < numberOfParallelGraphs; ++i) {
+				
+					// Close group of searching threads
+					ParallelGraph closeGraph;
+					closeGraph.close = true;
+					graphsToSearch.push(closeGraph);
+				}
+			}
+			
+			// Go through all searching threads
+			for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
 			
-				// Create searching thread's node connections
-				nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2]);
+				// Join searching thread
+				searchingThreads[i].join();
 			}
 			
+			// Return if searching threads initialized successfully
+			return searchingThreadsInitializedSuccessfully;
+		}
+		
+		// Go through all searching threads
+		thread searchingThreads[numberOfSearchingThreads];
+		barrier searchingThreadsBarrier(numberOfSearchingThreads);
+		const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
+		ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE> componentPartitioner(numberOfSearchingThreads);
+		const unique_ptr<LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> leafPruner(cpuTrimmingRounds ? new(nothrow) LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+		const unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> csrAdjacency(csrSearching ? new(nothrow) CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+		unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreads];
+		WorkStealingScheduler workStealingScheduler(numberOfSearchingThreads, SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS);
+		searchingThreadsScheduler = &workStealingScheduler;
+		SearchingThreadsHandoff searchingThreadsHandoffAutomaticDuration(numberOfSearchingThreads);
+		searchingThreadsHandoff = &searchingThreadsHandoffAutomaticDuration;
+		bool closeSearchingThreads = false;
+		atomic<bool> searchingThreadsInitializedSuccessfully(true);
+		
+		for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
+		
+			// Create searching thread's node connections
+			nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2 + 1]);
+			
 			// Create searching thread
-			searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, numberOfSearchingThreads, numberOfSearchingThreadsSearchingEdges, &searchingThreadsBarrier, edges = edges.get(), nodeConnections = nodeConnections[min(i, numberOfSearchingThreadsSearchingEdges - 1)].get(), &numberOfSearchingThreadsFinished, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
+			searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, &searchingThreadsBarrier, edges = edges.get(), &componentPartitioner, cpuTrimmingRounds, leafPruner = leafPruner.get(), csrSearching, csrAdjacency = csrAdjacency.get(), nodeConnections = nodeConnections[i].get(), &workStealingScheduler, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
 			
 				// Check if using an Apple device and not using macOS or using Android
-				unique_lock lock(searchingThreadsMutex);
 				#if (defined __APPLE__ && TARGET_OS_OSX == 0) || defined __ANDROID__
 				
 					// Set thread's priority and affinity
-					setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores);
+					setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores));
 					
-					// Set initialized failed to if creating edges failed, creating node connections failed, or initializing thread local global variables failed
-					const bool initializingFailed = !edges || !nodeConnections || (searchingThreadIndex < numberOfSearchingThreadsSearchingEdges && !initializeCuckatooThreadLocalGlobalVariables());
+					// Set initialized failed to if creating edges failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, creating work stealing scheduler failed, or initializing thread local global variables failed
+					const bool initializingFailed = !edges || !componentPartitioner || (cpuTrimmingRounds && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !workStealingScheduler || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 					
 				// Otherwise
 				#else
 				
-					// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating node connections failed, or initializing thread local global variables failed
-					const bool initializingFailed = !setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores) || !edges || !nodeConnections || (searchingThreadIndex < numberOfSearchingThreadsSearchingEdges && !initializeCuckatooThreadLocalGlobalVariables());
+					// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, creating work stealing scheduler failed, or initializing thread local global variables failed
+					const bool initializingFailed = !setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores)) || !edges || !componentPartitioner || (cpuTrimmingRounds && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !workStealingScheduler || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 				#endif
 				
 				// Check if initializing failed
 				if(initializingFailed) {
 				
 					// Set searching threads initialized successfully to false
-					searchingThreadsInitializedSuccessfully = false;
-				}
-				
-				// Check if all searching threads have initialized
-				if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
-				
-					// Reset number of searching threads finished
-					numberOfSearchingThreadsFinished = 0;
-					
-					// Notify that searching threads have initialized
-					searchingThreadsFinished = true;
-					lock.unlock();
-					searchingThreadsFinishedConditionalVariable->notify_one();
+					searchingThreadsInitializedSuccessfully.store(false, memory_order_relaxed);
 				}
 				
-				// Otherwise
-				else {
-				
-					// Unlock
-					lock.unlock();
-				}
+				// Notify that the searching thread has initialized
+				searchingThreadsHandoff->finished();
 				
 				// Check if initializing failed
 				if(initializingFailed) {
@@ -1599,24 +2429,17 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					return;
 				}
 				
-				// Set searching thread's bitmap start and end
-				const uint_fast32_t bitmapStart = (EDGES_BITMAP_SIZE + numberOfSearchingThreads - 1) / numberOfSearchingThreads * searchingThreadIndex;
-				const uint_fast32_t bitmapEnd = min((EDGES_BITMAP_SIZE + numberOfSearchingThreads - 1) / numberOfSearchingThreads * (searchingThreadIndex + 1), EDGES_BITMAP_SIZE);
+				// Give the searching thread its share of the edges bitmap's chunks
+				workStealingScheduler.distribute(searchingThreadIndex);
 				
 				// Loop forever
-				for(bool startTriggerTrue = true;; startTriggerTrue = !startTriggerTrue) {
+				for(uint32_t sequence = 0;;) {
 				
 					// Wait until starting searching threads
-					lock.lock();
-					startSearchingThreadsConditionalVariable->wait(lock, [startTriggerTrue]() noexcept -> bool {
-					
-						// Return if starting searching threads
-						return startSearchingThreadsTriggerToggle == startTriggerTrue;
-					});
+					sequence = searchingThreadsHandoff->waitUntilStarted(sequence);
 					
 					// Get if closing thread
 					const bool closeThread = closeSearchingThreads;
-					lock.unlock();
 					
 					// Check if closing thread
 					if(closeThread) {
@@ -1625,118 +2448,138 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 						return;
 					}
 					
-					// Go through all of the searching thread's units in the edges bitmap
-					uint64_t edgeIndex = static_cast<uint64_t>(bitmapStart) * BITMAP_UNIT_WIDTH * EDGE_NUMBER_OF_COMPONENTS;
-					for(uint_fast32_t bitmapIndex = bitmapStart; bitmapIndex < bitmapEnd; ++bitmapIndex) {
-					
-						// Go through all bits in the unit
-						for(uint_fast8_t i = 0; i < BITMAP_UNIT_WIDTH; ++i) {
-						
-							// Set edge's index
-							edges[edgeIndex] = bitmapIndex * BITMAP_UNIT_WIDTH + i;
-							
-							// Set edge's nodes
-							const uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nonces = {static_cast<uint64_t>(edges[edgeIndex]) * 2, (static_cast<uint64_t>(edges[edgeIndex]) * 2) | 1};
-							uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nodes;
-							sipHash24<2>(&nodes, *searchingThreadsSipHashKeys, &nonces);
-							edges[edgeIndex + 1] = nodes[0];
-							edges[edgeIndex + 2] = nodes[1];
-							
-							// Go to next edge
-							edgeIndex += EDGE_NUMBER_OF_COMPONENTS;
-						}
-					}
-					
-					// Wait for all searching threads to finish getting the edges in their units
-					searchingThreadsBarrier.arrive_and_wait();
+					// Mark getting the edges as stale if the graph is stale
+					markStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
 					
-					// Check if searching thread is searching edges
-					if(searchingThreadIndex < numberOfSearchingThreadsSearchingEdges) {
+					// Go through all chunks of the edges bitmap that the searching thread gets or steals
+					workStealingScheduler.perform(searchingThreadIndex, [edges](const uint32_t chunk) noexcept {
 					
-						// Check if not the first searching thread
-						if(searchingThreadIndex) {
+						// Go through all units in the chunk
+						uint64_t edgeIndex = static_cast<uint64_t>(chunk) * SEARCHING_THREADS_BITMAP_CHUNK_SIZE * BITMAP_UNIT_WIDTH * EDGE_NUMBER_OF_COMPONENTS;
+						for(uint_fast32_t bitmapIndex = chunk * SEARCHING_THREADS_BITMAP_CHUNK_SIZE; bitmapIndex < min((chunk + 1) * SEARCHING_THREADS_BITMAP_CHUNK_SIZE, static_cast<uint32_t>(EDGES_BITMAP_SIZE)); ++bitmapIndex) {
 						
-							// Set first searching edges
-							const uint64_t firstSearchingEdge = (1 - 1 / pow(2, searchingThreadIndex - 1)) * NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(NUMBER_OF_EDGES * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT));
+							// Go through all bits in the unit
+							for(uint_fast8_t i = 0; i < BITMAP_UNIT_WIDTH; ++i) {
 							
-							// Go through all previous edges
-							for(uint64_t nodeConnectionsIndex = 0, edgesIndex = 0; nodeConnectionsIndex < firstSearchingEdge * 2; nodeConnectionsIndex += 2, edgesIndex += EDGE_NUMBER_OF_COMPONENTS) {
-							
-								// Replace newest node connection for the node on the first partition and add node connection to list
-								nodeConnections[nodeConnectionsIndex] = {cuckatooUNewestNodeConnections.replace(edges[edgesIndex + 1], &nodeConnections[nodeConnectionsIndex]), edges[edgesIndex + 1], edges[edgesIndex]};
+								// Set edge's index
+								edges[edgeIndex] = bitmapIndex * BITMAP_UNIT_WIDTH + i;
 								
-								// Replace newest node connection for the node on the second partition and add node connection to list
-								nodeConnections[nodeConnectionsIndex + 1] = {cuckatooVNewestNodeConnections.replace(edges[edgesIndex + 2], &nodeConnections[nodeConnectionsIndex + 1]), edges[edgesIndex + 2], edges[edgesIndex]};
-							}
-							
-							// Check if getting solution was successful
-							uint32_t solution[SOLUTION_SIZE];
-							if(getCuckatooSolution(solution, &nodeConnections[firstSearchingEdge * 2], &edges[firstSearchingEdge * EDGE_NUMBER_OF_COMPONENTS], static_cast<uint64_t>((1 - 1 / pow(2, searchingThreadIndex)) * NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(NUMBER_OF_EDGES * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT))) - firstSearchingEdge)) {
-							
-								// Lock
-								lock.lock();
+								// Go to next edge
+								edgeIndex += EDGE_NUMBER_OF_COMPONENTS;
 								
-								// Set searching threads solution to the solution
-								memcpy(searchingThreadsSolution, solution, sizeof(solution));
+								// Check if enough edges don't have their nodes set
+								if((i + 1) % SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH == 0) {
 								
-								// Unlock
-								lock.unlock();
+									// Set edges' nodes
+									setSearchingThreadsEdgesNodes(&edges[edgeIndex - SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH * EDGE_NUMBER_OF_COMPONENTS], SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH, *searchingThreadsSipHashKeys);
+								}
 							}
 						}
+					});
+					
+					// Wait for all searching threads to finish getting the edges in the chunks
+					workStealingScheduler.arriveAndWait(searchingThreadIndex, searchingThreadsBarrier);
+					
+					// Check if getting the edges is stale (Edges' nodes are already less than twice the number of edges, so they don't need to be renamed)
+					if(isStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE)) {
+					
+						// Give the searching thread its share of the edges bitmap's chunks for the next graph
+						workStealingScheduler.distribute(searchingThreadIndex);
 						
-						// Otherwise
-						else {
+						// Notify that the searching thread has finished
+						searchingThreadsHandoff->finished();
 						
-							// Check if getting solution was successful
-							uint32_t solution[SOLUTION_SIZE];
-							if(getCuckatooSolution(solution, nodeConnections, edges, ceil(NUMBER_OF_EDGES * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * NUMBER_OF_EDGES * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT)))) {
-							
-								// Lock
-								lock.lock();
-								
-								// Set searching threads solution to the solution
-								memcpy(searchingThreadsSolution, solution, sizeof(solution));
-								
-								// Unlock
-								lock.unlock();
-							}
-						}
+						// Continue
+						continue;
+					}
+					
+					// Mark partitioning as stale if the graph is stale
+					markStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
+					
+					// Check if CPU trimming
+					if(cpuTrimmingRounds) {
+					
+						// Remove edges that can't be part of a cycle
+						leafPruner->prune(edges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, cpuTrimmingRounds, searchingThreadIndex, searchingThreadsBarrier);
+					}
+					
+					// Partition edges' components
+					componentPartitioner.partition(edges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, cpuTrimmingRounds ? leafPruner->getEdgesRemoved() : nullptr, searchingThreadIndex, searchingThreadsBarrier);
+					
+					// Check if partitioning is stale
+					if(isStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE)) {
+					
+						// Give the searching thread its share of the edges bitmap's chunks for the next graph
+						workStealingScheduler.distribute(searchingThreadIndex);
 						
-						// Reset node connections
-						cuckatooUNewestNodeConnections.clear();
-						cuckatooVNewestNodeConnections.clear();
+						// Notify that the searching thread has finished
+						searchingThreadsHandoff->finished();
+						
+						// Continue
+						continue;
 					}
 					
-					// Check if all searching threads have finished
-					lock.lock();
-					if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
+					// Check if CSR searching
+					uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+					uint32_t numberOfSolutions;
+					if(csrSearching) {
 					
-						// Reset number of searching threads finished
-						numberOfSearchingThreadsFinished = 0;
+						// Build CSR adjacency from the edges
+						csrAdjacency->build(edges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, searchingThreadIndex, searchingThreadsBarrier);
+						
+						// Go through all of the searching thread's preceding edges
+						for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
 						
-						// Notify that searching threads have finished
-						searchingThreadsFinished = true;
-						lock.unlock();
-						searchingThreadsFinishedConditionalVariable->notify_one();
+							// Add edge to the CSR adjacency without searching it
+							addCuckatooCsrEdge(*csrAdjacency, componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], cpuTrimmingRounds);
+						}
+						
+						// Get solutions from the searching thread's edges using the CSR adjacency (Cycles are only filtered when the edges were trimmed)
+						numberOfSolutions = getCuckatooSolutionsFromCsrAdjacency(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, *csrAdjacency, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), cpuTrimmingRounds);
 					}
 					
 					// Otherwise
 					else {
 					
-						// Unlock
-						lock.unlock();
+						// Go through all of the searching thread's preceding edges
+						for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
+						
+							// Add edge without searching it
+							addCuckatooEdge(componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], cpuTrimmingRounds);
+						}
+						
+						// Get solutions from the searching thread's edges (Cycles are only filtered when the edges were trimmed)
+						numberOfSolutions = getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), cpuTrimmingRounds);
+					}
+					
+					// Check if solutions were found
+					if(numberOfSolutions) {
+					
+						// Lock searching threads solutions mutex
+						searchingThreadsSolutionsMutex.lock();
+						
+						// Add solutions to the searching threads solutions
+						addSearchingThreadsSolutions(solutions, numberOfSolutions);
+						
+						// Unlock searching threads solutions mutex
+						searchingThreadsSolutionsMutex.unlock();
 					}
+					
+					// Reset node connections
+					cuckatooUNewestNodeConnections.clear();
+					cuckatooVNewestNodeConnections.clear();
+					
+					// Give the searching thread its share of the edges bitmap's chunks for the next graph (Every searching thread has passed the barrier after getting the edges, so none of them are still stealing from its deque)
+					workStealingScheduler.distribute(searchingThreadIndex);
+					
+					// Notify that the searching thread has finished
+					searchingThreadsHandoff->finished();
 				}
 			});
 		}
 		
 		// Wait until searching threads have initialized
-		searchingThreadsFinished = false;
-		searchingThreadsFinishedConditionalVariable->wait(searchingThreadsLock, []() noexcept -> bool {
-		
-			// Return if searching threads have initialized
-			return searchingThreadsFinished;
-		});
+		searchingThreadsHandoff->waitUntilFinished();
 		
 		// Check if searching threads didn't initialized successfully
 		if(!searchingThreadsInitializedSuccessfully) {
@@ -1755,22 +2598,32 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			previousGraphProcessedTime = chrono::high_resolution_clock::now();
 			
 			// While not closing
+			uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys[NUMBER_OF_NONCES_PER_BLAKE2B];
+			uint64_t sipHashKeysHeight = jobHeight;
+			uint64_t sipHashKeysId = jobId;
+			uint64_t sipHashKeysFirstNonce = jobNonce;
+			uint_fast8_t sipHashKeysIndex = NUMBER_OF_NONCES_PER_BLAKE2B;
 			while(!closing) {
 			
-				// Get SipHash keys from job's header and nonce
-				uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
-				blake2b(sipHashKeys, jobHeader, jobNonce);
+				// Check if all SipHash keys were used or the job changed since they were derived
+				if(sipHashKeysIndex == NUMBER_OF_NONCES_PER_BLAKE2B || jobHeight != sipHashKeysHeight || jobId != sipHashKeysId || jobNonce != sipHashKeysFirstNonce + sipHashKeysIndex) {
+				
+					// Get SipHash keys from job's header and next nonces
+					blake2b<NUMBER_OF_NONCES_PER_BLAKE2B>(sipHashKeys, jobHeaderMidstate, jobNonce);
+					sipHashKeysHeight = jobHeight;
+					sipHashKeysId = jobId;
+					sipHashKeysFirstNonce = jobNonce;
+					sipHashKeysIndex = 0;
+				}
 				
 				// Trimming finished
-				trimmingFinished(nullptr, sipHashKeys, jobHeight, jobId, jobNonce++);
+				trimmingFinished(nullptr, sipHashKeys[sipHashKeysIndex++], jobHeight, jobId, jobNonce++);
 			}
 		}
 		
 		// Close searching threads
 		closeSearchingThreads = true;
-		startSearchingThreadsTriggerToggle = !startSearchingThreadsTriggerToggle;
-		searchingThreadsLock.unlock();
-		startSearchingThreadsConditionalVariable->notify_all();
+		searchingThreadsHandoff->start();
 		
 		// Go through all searching threads
 		for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
@@ -1779,15 +2632,18 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			searchingThreads[i].join();
 		}
 		
-		// Lock searching threads lock
-		searchingThreadsLock.lock();
-		
 		// Return if searching threads initialized successfully
 		return searchingThreadsInitializedSuccessfully;
 		
 	// Otherwise
 	#else
 	
+		// Set searching threads CPU trimming rounds to the CPU trimming rounds
+		searchingThreadsCpuTrimmingRounds = cpuTrimmingRounds;
+		
+		// Get if using leaf pruner (The pipeline balancer can make the searching threads start CPU trimming while mining)
+		const bool usingLeafPruner = cpuTrimmingRounds || balancePipelineStages;
+		
 		// Check if device index isn't specified
 		if(deviceIndex == ALL_DEVICES) {
 		
@@ -1868,11 +2724,11 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					
 					// Check if getting platform's number of devices was successful and devices exist
 					cl_uint numberOfDevices;
-					if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
+					if(clGetDeviceIDs(platforms[i], openClDeviceTypes, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
 					
 						// Check if getting platform's devices was successful
 						cl_device_id devices[numberOfDevices];
-						if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
+						if(clGetDeviceIDs(platforms[i], openClDeviceTypes, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
 						
 							// Go through all of the platform's devices
 							for(cl_uint j = 0; j < numberOfDevices; ++j) {
@@ -1943,6 +2799,16 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			trimmingTypeDisplay = true;
 		}
 		
+		// Check if CPU mean trimming is enabled (It's not used when using all trimming types since it requires much more RAM than the other trimming types)
+		if(trimmingTypes & CPU_MEAN_TRIMMING_TYPE) {
+		
+			// Display message
+			cout << (trimmingTypeDisplay ? "," : "") << " CPU mean";
+			
+			// Set trimming type displayed to true
+			trimmingTypeDisplay = true;
+		}
+		
 		// Check if using all trimming types or slean trimming is enabled
 		if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & SLEAN_TRIMMING_TYPE) {
 		
@@ -1958,6 +2824,16 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 		
 			// Display message
 			cout << (trimmingTypeDisplay ? "," : "") << " lean";
+			
+			// Set trimming type displayed to true
+			trimmingTypeDisplay = true;
+		}
+		
+		// Check if using all trimming types or CPU lean trimming is enabled
+		if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & CPU_LEAN_TRIMMING_TYPE) {
+		
+			// Display message
+			cout << (trimmingTypeDisplay ? "," : "") << " CPU lean";
 		}
 		
 		// Display new line
@@ -1978,31 +2854,91 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)> context(nullptr, clReleaseContext);
 		#endif
 		
-		// Check if using all trimming types or mean trimming is enabled
-		if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & MEAN_TRIMMING_TYPE) {
+		// Check if using all trimming types, mean trimming is enabled, or CPU mean trimming is enabled
+		if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & (MEAN_TRIMMING_TYPE | CPU_MEAN_TRIMMING_TYPE)) {
 		
-			// Check if using an Apple device and not using OpenCL
-			#if defined __APPLE__ && !defined USE_OPENCL
+			// Check if using all trimming types or mean trimming is enabled
+			if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & MEAN_TRIMMING_TYPE) {
 			
-				// Create mean trimming context
-				context = unique_ptr<MTL::Device, void(*)(MTL::Device *)>(createMeanTrimmingContext(deviceIndex), [](MTL::Device *context) noexcept {
+				// Check if using an Apple device and not using OpenCL
+				#if defined __APPLE__ && !defined USE_OPENCL
 				
-					// Free context
-					context->release();
-				});
+					// Create mean trimming context
+					context = unique_ptr<MTL::Device, void(*)(MTL::Device *)>(createMeanTrimmingContext(deviceIndex), [](MTL::Device *context) noexcept {
+					
+						// Free context
+						context->release();
+					});
+					
+				// Otherwise
+				#else
 				
-			// Otherwise
-			#else
+					// Create mean trimming context
+					context = unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)>(createMeanTrimmingContext(platforms, numberOfPlatforms, openClDeviceTypes, deviceIndex), clReleaseContext);
+					
+					// Check if using Linux
+					#ifdef __linux__
+					
+						// Check if creating mean trimming context was successful
+						if(context) {
+						
+							// Place threads near the GPU
+							placeThreadsNearOpenClContext(context.get(), firstThreadIndex, numberOfThreads, numberOfApplicableCpuCores);
+						}
+					#endif
+				#endif
 				
-				// Create mean trimming context
-				context = unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)>(createMeanTrimmingContext(platforms, numberOfPlatforms, deviceIndex), clReleaseContext);
-			#endif
+				// Check if creating mean trimming context failed
+				if(!context) {
+				
+					// Display message
+					cout << ((deviceIndex == ALL_DEVICES) ? "No applicable GPU found for mean trimming" : "GPU isn't applicable for mean trimming") << ". Mean trimming requires ";
+					
+					// Check if RAM requirement can be expressed in bytes
+					if(MEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE / 2) {
+					
+						// Display message
+						cout << MEAN_TRIMMING_REQUIRED_RAM_BYTES << " bytes";
+					}
+					
+					// Otherwise check if RAM requirement can be expressed in kilobytes
+					else if(MEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE / 2) {
+					
+						// Display message
+						cout << (ceil(static_cast<double>(MEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE * 100) / 100) << " KB";
+					}
+					
+					// Otherwise check if RAM requirement can be expressed in megabytes
+					else if(MEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE * MEGABYTES_IN_A_GIGABYTE / 2) {
+					
+						// Display message
+						cout << (ceil(static_cast<double>(MEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE * 100) / 100) << " MB";
+					}
+					
+					// Otherwise
+					else {
+					
+						// Display message
+						cout << (ceil(static_cast<double>(MEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE / MEGABYTES_IN_A_GIGABYTE * 100) / 100) << " GB";
+					}
+					
+					// Display message
+					cout << " of RAM and " << (MEAN_TRIMMING_REQUIRED_WORK_GROUP_RAM_BYTES / BYTES_IN_A_KILOBYTE) << " KB of local memory." << endl;
+					
+					// Check if local RAM kilobytes is greater than its min value
+					if(LOCAL_RAM_KILOBYTES > MIN_LOCAL_RAM_KILOBYTES) {
+					
+						// Display message
+						cout << "Build this program with LOCAL_RAM_KILOBYTES=" << (LOCAL_RAM_KILOBYTES / 2) << " to reduce mean trimming's GPU local memory requirement by half." << endl;
+					}
+				}
+			}
 			
-			// Check if creating mean trimming context was successful
-			if(context) {
+			// Check if creating mean trimming context was successful or CPU mean trimming is enabled
+			if(context || trimmingTypes & CPU_MEAN_TRIMMING_TYPE) {
 				
 				// Get number of searching threads
-				const unsigned int numberOfSearchingThreads = min(min(numberOfThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS_SEARCHING_EDGES)), static_cast<unsigned int>(1 + ceil(log2((1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) * MAX_NUMBER_OF_EDGES_AFTER_TRIMMING))));
+				const unsigned int numberOfSearchingThreads = min(numberOfThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS));
 				
 				// Display message
 				cout << "Using " << numberOfSearchingThreads << " CPU core(s) for searching: ";
@@ -2014,19 +2950,19 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					#ifdef _WIN32
 					
 						// Display message
-						cout << (i ? ", " : "") << "CPU " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
 						
 					// Otherwise check if using an Apple device
 					#elif defined __APPLE__
 					
 						// Display message
-						cout << (i ? ", " : "") << "Core " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 						
 					// Otherwise
 					#else
 					
 						// Display message
-						cout << (i ? ", " : "") << "CPU" << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 					#endif
 				}
 				
@@ -2035,61 +2971,51 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 				
 				// Go through all searching threads
 				thread searchingThreads[numberOfSearchingThreads];
+				barrier searchingThreadsBarrier(numberOfSearchingThreads);
+				const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
+				NodeRenamer<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> nodeRenamer(numberOfSearchingThreads);
+				ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE> componentPartitioner(numberOfSearchingThreads);
+				const unique_ptr<LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> leafPruner(usingLeafPruner ? new(nothrow) LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+				const unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> csrAdjacency(csrSearching ? new(nothrow) CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
 				unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreads];
-				unsigned int numberOfSearchingThreadsFinished = 0;
+				SearchingThreadsHandoff searchingThreadsHandoffAutomaticDuration(numberOfSearchingThreads);
+				searchingThreadsHandoff = &searchingThreadsHandoffAutomaticDuration;
 				bool closeSearchingThreads = false;
-				bool searchingThreadsInitializedSuccessfully = true;
+				atomic<bool> searchingThreadsInitializedSuccessfully(true);
 				
 				for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
 				
 					// Create searching thread's node connections
-					nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2]);
+					nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2 + 1]);
 					
 					// Create searching thread
-					searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, numberOfSearchingThreads, nodeConnections = nodeConnections[i].get(), &numberOfSearchingThreadsFinished, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
+					searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, &searchingThreadsBarrier, edges = edges.get(), &nodeRenamer, &componentPartitioner, usingLeafPruner, leafPruner = leafPruner.get(), csrSearching, csrAdjacency = csrAdjacency.get(), nodeConnections = nodeConnections[i].get(), &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
 					
 						// Check if using an Apple device and not using macOS or using Android
-						unique_lock lock(searchingThreadsMutex);
 						#if (defined __APPLE__ && TARGET_OS_OSX == 0) || defined __ANDROID__
 						
 							// Set thread's priority and affinity
-							setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores);
+							setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores));
 							
-							// Set initialized failed to if creating edges failed, creating node connections failed, or initializing thread local global variables failed
-							const bool initializingFailed = !nodeConnections || !initializeCuckatooThreadLocalGlobalVariables();
+							// Set initialized failed to if creating edges failed, creating node renamer failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, or initializing thread local global variables failed
+							const bool initializingFailed = !edges || !nodeRenamer || !componentPartitioner || (usingLeafPruner && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 							
 						// Otherwise
 						#else
 						
-							// Set initialized failed to if setting searching thread's priority and affinity failed, creating node connections failed, or initializing thread local global variables failed
-							const bool initializingFailed = !setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores) || !nodeConnections || !initializeCuckatooThreadLocalGlobalVariables();
+							// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating node renamer failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, or initializing thread local global variables failed
+							const bool initializingFailed = !setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores)) || !edges || !nodeRenamer || !componentPartitioner || (usingLeafPruner && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 						#endif
 						
 						// Check if initializing failed
 						if(initializingFailed) {
 						
 							// Set searching threads initialized successfully to false
-							searchingThreadsInitializedSuccessfully = false;
-						}
-						
-						// Check if all searching threads have initialized
-						if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
-						
-							// Reset number of searching threads finished
-							numberOfSearchingThreadsFinished = 0;
-							
-							// Notify that searching threads have initialized
-							searchingThreadsFinished = true;
-							lock.unlock();
-							searchingThreadsFinishedConditionalVariable->notify_one();
+							searchingThreadsInitializedSuccessfully.store(false, memory_order_relaxed);
 						}
 						
-						// Otherwise
-						else {
-						
-							// Unlock
-							lock.unlock();
-						}
+						// Notify that the searching thread has initialized
+						searchingThreadsHandoff->finished();
 						
 						// Check if initializing failed
 						if(initializingFailed) {
@@ -2099,19 +3025,13 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 						}
 						
 						// Loop forever
-						for(bool startTriggerTrue = true;; startTriggerTrue = !startTriggerTrue) {
+						for(uint32_t sequence = 0;;) {
 						
 							// Wait until starting searching threads
-							lock.lock();
-							startSearchingThreadsConditionalVariable->wait(lock, [startTriggerTrue]() noexcept -> bool {
-							
-								// Return if starting searching threads
-								return startSearchingThreadsTriggerToggle == startTriggerTrue;
-							});
+							sequence = searchingThreadsHandoff->waitUntilStarted(sequence);
 							
 							// Get if closing thread
 							const bool closeThread = closeSearchingThreads;
-							lock.unlock();
 							
 							// Check if closing thread
 							if(closeThread) {
@@ -2120,48 +3040,23 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 								return;
 							}
 							
+							// Get CPU trimming rounds (The pipeline balancer can change this between graphs)
+							const unsigned int cpuTrimmingRounds = searchingThreadsCpuTrimmingRounds;
+							
 							// Get number of edges
 							const uint32_t &numberOfEdges = reinterpret_cast<const uint32_t *>(searchingThreadsData)[0];
 							
 							// Get total number of edges
 							const uint32_t totalNumberOfEdges = min(numberOfEdges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING);
 							
-							// Get edges
-							const uint32_t *edges = &reinterpret_cast<const uint32_t *>(searchingThreadsData)[1];
+							// Mark renaming as stale if the graph is stale
+							markStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
 							
-							// Check if not the first searching thread
-							if(searchingThreadIndex) {
-							
-								// Set first searching edges
-								const uint64_t firstSearchingEdge = (1 - 1 / pow(2, searchingThreadIndex - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreads - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT));
-								
-								// Go through all previous edges
-								for(uint64_t nodeConnectionsIndex = 0, edgesIndex = 0; nodeConnectionsIndex < firstSearchingEdge * 2; nodeConnectionsIndex += 2, edgesIndex += EDGE_NUMBER_OF_COMPONENTS) {
-								
-									// Replace newest node connection for the node on the first partition and add node connection to list
-									nodeConnections[nodeConnectionsIndex] = {cuckatooUNewestNodeConnections.replace(edges[edgesIndex + 1], &nodeConnections[nodeConnectionsIndex]), edges[edgesIndex + 1], edges[edgesIndex]};
-									
-									// Replace newest node connection for the node on the second partition and add node connection to list
-									nodeConnections[nodeConnectionsIndex + 1] = {cuckatooVNewestNodeConnections.replace(edges[edgesIndex + 2], &nodeConnections[nodeConnectionsIndex + 1]), edges[edgesIndex + 2], edges[edgesIndex]};
-								}
-								
-								// Check if getting solution was successful
-								uint32_t solution[SOLUTION_SIZE];
-								if(getCuckatooSolution(solution, &nodeConnections[firstSearchingEdge * 2], &edges[firstSearchingEdge * EDGE_NUMBER_OF_COMPONENTS], static_cast<uint64_t>((1 - 1 / pow(2, searchingThreadIndex)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreads - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT))) - firstSearchingEdge)) {
-								
-									// Lock
-									lock.lock();
-									
-									// Set searching threads solution to the solution
-									memcpy(searchingThreadsSolution, solution, sizeof(solution));
-									
-									// Unlock
-									lock.unlock();
-								}
-							}
+							// Rename edges' nodes
+							nodeRenamer.rename(edges, &reinterpret_cast<const uint32_t *>(searchingThreadsData)[1], totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
 							
-							// Otherwise
-							else {
+							// Check if the first searching thread
+							if(!searchingThreadIndex) {
 							
 								// Check if too may edges exist
 								if(numberOfEdges > MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
@@ -2180,56 +3075,99 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 										cout << "Too many edges exist after trimming, so some edges weren't searched. Increase the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS + 1) << " if this happens frequently." << endl;
 									}
 								}
+							}
+							
+							// Check if renaming is stale
+							if(isStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE)) {
+							
+								// Notify that the searching thread has finished
+								searchingThreadsHandoff->finished();
 								
-								// Check if getting solution was successful
-								uint32_t solution[SOLUTION_SIZE];
-								if(getCuckatooSolution(solution, nodeConnections, edges, ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreads - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT)))) {
-								
-									// Lock
-									lock.lock();
-									
-									// Set searching threads solution to the solution
-									memcpy(searchingThreadsSolution, solution, sizeof(solution));
-									
-									// Unlock
-									lock.unlock();
-								}
+								// Continue
+								continue;
 							}
 							
-							// Reset node connections
-							cuckatooUNewestNodeConnections.clear();
-							cuckatooVNewestNodeConnections.clear();
+							// Mark partitioning as stale if the graph is stale
+							markStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
+							
+							// Check if CPU trimming
+							if(cpuTrimmingRounds) {
+							
+								// Remove edges that can't be part of a cycle
+								leafPruner->prune(edges, totalNumberOfEdges, cpuTrimmingRounds, searchingThreadIndex, searchingThreadsBarrier);
+							}
+							
+							// Partition edges' components
+							componentPartitioner.partition(edges, totalNumberOfEdges, cpuTrimmingRounds ? leafPruner->getEdgesRemoved() : nullptr, searchingThreadIndex, searchingThreadsBarrier);
+							
+							// Check if partitioning is stale
+							if(isStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE)) {
 							
-							// Check if all searching threads have finished
-							lock.lock();
-							if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
+								// Notify that the searching thread has finished
+								searchingThreadsHandoff->finished();
+								
+								// Continue
+								continue;
+							}
 							
-								// Reset number of searching threads finished
-								numberOfSearchingThreadsFinished = 0;
+							// Check if CSR searching
+							uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+							uint32_t numberOfSolutions;
+							if(csrSearching) {
+							
+								// Build CSR adjacency from the edges
+								csrAdjacency->build(edges, totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
+								
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
 								
-								// Notify that searching threads have finished
-								searchingThreadsFinished = true;
-								lock.unlock();
-								searchingThreadsFinishedConditionalVariable->notify_one();
+									// Add edge to the CSR adjacency without searching it
+									addCuckatooCsrEdge(*csrAdjacency, componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], true);
+								}
+								
+								// Get solutions from the searching thread's edges using the CSR adjacency
+								numberOfSolutions = getCuckatooSolutionsFromCsrAdjacency(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, *csrAdjacency, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), true);
 							}
 							
 							// Otherwise
 							else {
 							
-								// Unlock
-								lock.unlock();
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
+								
+									// Add edge without searching it
+									addCuckatooEdge(componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], true);
+								}
+								
+								// Get solutions from the searching thread's edges
+								numberOfSolutions = getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), true);
+							}
+							
+							// Check if solutions were found
+							if(numberOfSolutions) {
+							
+								// Lock searching threads solutions mutex
+								searchingThreadsSolutionsMutex.lock();
+								
+								// Add solutions to the searching threads solutions
+								addSearchingThreadsSolutions(solutions, numberOfSolutions);
+								
+								// Unlock searching threads solutions mutex
+								searchingThreadsSolutionsMutex.unlock();
 							}
+							
+							// Reset node connections
+							cuckatooUNewestNodeConnections.clear();
+							cuckatooVNewestNodeConnections.clear();
+							
+							// Notify that the searching thread has finished
+							searchingThreadsHandoff->finished();
 						}	
 					});
 				}
 				
 				// Wait until searching threads have initialized
-				searchingThreadsFinished = false;
-				searchingThreadsFinishedConditionalVariable->wait(searchingThreadsLock, []() noexcept -> bool {
-				
-					// Return if searching threads have initialized
-					return searchingThreadsFinished;
-				});
+				searchingThreadsHandoff->waitUntilFinished();
 				
 				// Check if searching threads didn't initialized successfully
 				bool performingTrimmingLoopResult = false;
@@ -2242,15 +3180,33 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 				// Otherwise
 				else {
 				
-					// Perform mean trimming loop
-					performingTrimmingLoopResult = performMeanTrimmingLoop(context.get());
+					// Check if creating mean trimming context was successful
+					if(context) {
+					
+						// Create CPU trimming device from the CPU cores that aren't searching
+						createCpuTrimmingDevice(numberOfThreads, numberOfSearchingThreads, firstThreadIndex, numberOfApplicableCpuCores, cpuCoresNameOffset, true);
+					}
+					
+					// Check if balancing pipeline stages
+					if(balancePipelineStages) {
+					
+						// Create pipeline balancer without extra trimming rounds since mean trimming's number of trimming rounds is built into its programs and CPU mean trimming alternates with searching
+						createPipelineBalancer(0, static_cast<bool>(context));
+					}
+					
+					// Perform mean trimming loop if creating mean trimming context was successful otherwise perform CPU mean trimming loop
+					performingTrimmingLoopResult = context ? performMeanTrimmingLoop(context.get()) : performCpuMeanTrimmingLoop(numberOfThreads, firstThreadIndex, numberOfApplicableCpuCores, cpuCoresNameOffset);
+					
+					// Free pipeline balancer
+					pipelineBalancer.reset();
+					
+					// Free CPU trimming device
+					cpuTrimmingDevice.reset();
 				}
 				
 				// Close searching threads
 				closeSearchingThreads = true;
-				startSearchingThreadsTriggerToggle = !startSearchingThreadsTriggerToggle;
-				searchingThreadsLock.unlock();
-				startSearchingThreadsConditionalVariable->notify_all();
+				searchingThreadsHandoff->start();
 				
 				// Go through all searching threads
 				for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
@@ -2259,57 +3215,9 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					searchingThreads[i].join();
 				}
 				
-				// Lock searching threads lock
-				searchingThreadsLock.lock();
-				
 				// Return if searching threads initialized successfully and performing trimming loop was successful
 				return searchingThreadsInitializedSuccessfully && performingTrimmingLoopResult;
 			}
-			
-			// Otherwise
-			else {
-			
-				// Display message
-				cout << ((deviceIndex == ALL_DEVICES) ? "No applicable GPU found for mean trimming" : "GPU isn't applicable for mean trimming") << ". Mean trimming requires ";
-				
-				// Check if RAM requirement can be expressed in bytes
-				if(MEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE / 2) {
-				
-					// Display message
-					cout << MEAN_TRIMMING_REQUIRED_RAM_BYTES << " bytes";
-				}
-				
-				// Otherwise check if RAM requirement can be expressed in kilobytes
-				else if(MEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE / 2) {
-				
-					// Display message
-					cout << (ceil(static_cast<double>(MEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE * 100) / 100) << " KB";
-				}
-				
-				// Otherwise check if RAM requirement can be expressed in megabytes
-				else if(MEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE * MEGABYTES_IN_A_GIGABYTE / 2) {
-				
-					// Display message
-					cout << (ceil(static_cast<double>(MEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE * 100) / 100) << " MB";
-				}
-				
-				// Otherwise
-				else {
-				
-					// Display message
-					cout << (ceil(static_cast<double>(MEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE / MEGABYTES_IN_A_GIGABYTE * 100) / 100) << " GB";
-				}
-				
-				// Display message
-				cout << " of RAM and " << (MEAN_TRIMMING_REQUIRED_WORK_GROUP_RAM_BYTES / BYTES_IN_A_KILOBYTE) << " KB of local memory." << endl;
-				
-				// Check if local RAM kilobytes is greater than its min value
-				if(LOCAL_RAM_KILOBYTES > MIN_LOCAL_RAM_KILOBYTES) {
-				
-					// Display message
-					cout << "Build this program with LOCAL_RAM_KILOBYTES=" << (LOCAL_RAM_KILOBYTES / 2) << " to reduce mean trimming's GPU local memory requirement by half." << endl;
-				}
-			}
 		}
 		
 		// Check if using all trimming types or slean trimming is enabled
@@ -2329,14 +3237,25 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			#else
 			
 				// Create slean trimming context
-				context = unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)>(createSleanTrimmingContext(platforms, numberOfPlatforms, deviceIndex), clReleaseContext);
+				context = unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)>(createSleanTrimmingContext(platforms, numberOfPlatforms, openClDeviceTypes, deviceIndex), clReleaseContext);
+				
+				// Check if using Linux
+				#ifdef __linux__
+				
+					// Check if creating slean trimming context was successful
+					if(context) {
+					
+						// Place threads near the GPU
+						placeThreadsNearOpenClContext(context.get(), firstThreadIndex, numberOfThreads, numberOfApplicableCpuCores);
+					}
+				#endif
 			#endif
 			
 			// Check if creating slean trimming context was successful
 			if(context) {
 			
 				// Get number of searching threads
-				const unsigned int numberOfSearchingThreads = min(min(numberOfThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS)), static_cast<unsigned int>(EDGES_BITMAP_SIZE));
+				const unsigned int numberOfSearchingThreads = min(numberOfThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS));
 				
 				// Display message
 				cout << "Using " << numberOfSearchingThreads << " CPU core(s) for searching: ";
@@ -2348,92 +3267,72 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					#ifdef _WIN32
 					
 						// Display message
-						cout << (i ? ", " : "") << "CPU " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
 						
 					// Otherwise check if using an Apple device
 					#elif defined __APPLE__
 					
 						// Display message
-						cout << (i ? ", " : "") << "Core " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 						
 					// Otherwise
 					#else
 					
 						// Display message
-						cout << (i ? ", " : "") << "CPU" << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 					#endif
 				}
 				
 				// Display new line
 				cout << endl;
 				
-				// Get number of searching threads searching edges
-				const unsigned int numberOfSearchingThreadsSearchingEdges = min(min(numberOfSearchingThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS_SEARCHING_EDGES)), static_cast<unsigned int>(1 + ceil(log2((1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) * MAX_NUMBER_OF_EDGES_AFTER_TRIMMING))));
-				
 				// Go through all searching threads
 				thread searchingThreads[numberOfSearchingThreads];
-				uint32_t numberOfEdges[numberOfSearchingThreads];
 				barrier searchingThreadsBarrier(numberOfSearchingThreads);
 				const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
-				unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreadsSearchingEdges];
-				unsigned int numberOfSearchingThreadsFinished = 0;
+				NodeRenamer<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> nodeRenamer(numberOfSearchingThreads);
+				ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE> componentPartitioner(numberOfSearchingThreads);
+				const unique_ptr<LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> leafPruner(usingLeafPruner ? new(nothrow) LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+				const unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> csrAdjacency(csrSearching ? new(nothrow) CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+				unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreads];
+				SearchingThreadsHandoff searchingThreadsHandoffAutomaticDuration(numberOfSearchingThreads);
+				searchingThreadsHandoff = &searchingThreadsHandoffAutomaticDuration;
 				bool closeSearchingThreads = false;
-				bool searchingThreadsInitializedSuccessfully = true;
+				atomic<bool> searchingThreadsInitializedSuccessfully(true);
 				
 				for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
 				
-					// Check if searching thread is searching edges
-					if(i < numberOfSearchingThreadsSearchingEdges) {
-					
-						// Create searching thread's node connections
-						nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2]);
-					}
+					// Create searching thread's node connections
+					nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2 + 1]);
 					
 					// Create searching thread
-					searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, numberOfSearchingThreads, numberOfSearchingThreadsSearchingEdges, &numberOfEdges, &searchingThreadsBarrier, edges = edges.get(), nodeConnections = nodeConnections[min(i, numberOfSearchingThreadsSearchingEdges - 1)].get(), &numberOfSearchingThreadsFinished, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
+					searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, &searchingThreadsBarrier, edges = edges.get(), &nodeRenamer, &componentPartitioner, usingLeafPruner, leafPruner = leafPruner.get(), csrSearching, csrAdjacency = csrAdjacency.get(), nodeConnections = nodeConnections[i].get(), &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
 					
 						// Check if using an Apple device and not using macOS or using Android
-						unique_lock lock(searchingThreadsMutex);
 						#if (defined __APPLE__ && TARGET_OS_OSX == 0) || defined __ANDROID__
 						
 							// Set thread's priority and affinity
-							setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores);
+							setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores));
 							
-							// Set initialized failed to if creating edges failed, creating node connections failed, or initializing thread local global variables failed
-							const bool initializingFailed = !edges || !nodeConnections || (searchingThreadIndex < numberOfSearchingThreadsSearchingEdges && !initializeCuckatooThreadLocalGlobalVariables());
+							// Set initialized failed to if creating edges failed, creating node renamer failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, or initializing thread local global variables failed
+							const bool initializingFailed = !edges || !nodeRenamer || !componentPartitioner || (usingLeafPruner && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 							
 						// Otherwise
 						#else
 						
-							// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating node connections failed, or initializing thread local global variables failed
-							const bool initializingFailed = !setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores) || !edges || !nodeConnections || (searchingThreadIndex < numberOfSearchingThreadsSearchingEdges && !initializeCuckatooThreadLocalGlobalVariables());
+							// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating node renamer failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, or initializing thread local global variables failed
+							const bool initializingFailed = !setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores)) || !edges || !nodeRenamer || !componentPartitioner || (usingLeafPruner && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 						#endif
 						
 						// Check if initializing failed
 						if(initializingFailed) {
 						
 							// Set searching threads initialized successfully to false
-							searchingThreadsInitializedSuccessfully = false;
+							searchingThreadsInitializedSuccessfully.store(false, memory_order_relaxed);
 						}
 						
-						// Check if all searching threads have initialized
-						if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
-						
-							// Reset number of searching threads finished
-							numberOfSearchingThreadsFinished = 0;
-							
-							// Notify that searching threads have initialized
-							searchingThreadsFinished = true;
-							lock.unlock();
-							searchingThreadsFinishedConditionalVariable->notify_one();
-						}
-						
-						// Otherwise
-						else {
-						
-							// Unlock
-							lock.unlock();
-						}
+						// Notify that the searching thread has initialized
+						searchingThreadsHandoff->finished();
 						
 						// Check if initializing failed
 						if(initializingFailed) {
@@ -2442,24 +3341,14 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 							return;
 						}
 						
-						// Set searching thread's bitmap start and end
-						const uint_fast32_t bitmapStart = (EDGES_BITMAP_SIZE + numberOfSearchingThreads - 1) / numberOfSearchingThreads * searchingThreadIndex;
-						const uint_fast32_t bitmapEnd = min((EDGES_BITMAP_SIZE + numberOfSearchingThreads - 1) / numberOfSearchingThreads * (searchingThreadIndex + 1), EDGES_BITMAP_SIZE);
-						
 						// Loop forever
-						for(bool startTriggerTrue = true;; startTriggerTrue = !startTriggerTrue) {
+						for(uint32_t sequence = 0;;) {
 						
 							// Wait until starting searching threads
-							lock.lock();
-							startSearchingThreadsConditionalVariable->wait(lock, [startTriggerTrue]() noexcept -> bool {
-							
-								// Return if starting searching threads
-								return startSearchingThreadsTriggerToggle == startTriggerTrue;
-							});
+							sequence = searchingThreadsHandoff->waitUntilStarted(sequence);
 							
 							// Get if closing thread
 							const bool closeThread = closeSearchingThreads;
-							lock.unlock();
 							
 							// Check if closing thread
 							if(closeThread) {
@@ -2468,106 +3357,26 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 								return;
 							}
 							
-							// Go through all of the searching thread's units in the edges bitmap
-							numberOfEdges[searchingThreadIndex] = 0;
-							for(uint_fast32_t bitmapIndex = bitmapStart; bitmapIndex < bitmapEnd; ++bitmapIndex) {
+							// Get CPU trimming rounds (The pipeline balancer can change this between graphs)
+							const unsigned int cpuTrimmingRounds = searchingThreadsCpuTrimmingRounds;
 							
-								// Add number of set bits in the unit to the searching thread's number of edges
-								numberOfEdges[searchingThreadIndex] += __builtin_popcountll(reinterpret_cast<const uint64_t *>(searchingThreadsData)[bitmapIndex]);
-							}
+							// Get number of edges
+							const uint32_t &numberOfEdges = reinterpret_cast<const uint32_t *>(searchingThreadsData)[0];
 							
-							// Wait for all searching threads to finish counting the number of edges in their units
-							searchingThreadsBarrier.arrive_and_wait();
+							// Get total number of edges
+							const uint32_t totalNumberOfEdges = min(numberOfEdges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING);
 							
-							// Check if not the first searching thread
-							uint32_t firstEdge = 0;
-							if(searchingThreadIndex) {
+							// Mark renaming as stale if the graph is stale
+							markStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
 							
-								// Go through all previous searching threads
-								for(unsigned int previousSearchingThreadIndex = searchingThreadIndex; previousSearchingThreadIndex; --previousSearchingThreadIndex) {
-								
-									// Add previous searching thread's number of edges to first edge
-									firstEdge += numberOfEdges[previousSearchingThreadIndex - 1];
-								}
-							}
+							// Rename edges' nodes
+							nodeRenamer.rename(edges, &reinterpret_cast<const uint32_t *>(searchingThreadsData)[1], totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
 							
-							// Check if not too many edges exist for the searching thread
-							uint32_t totalNumberOfEdges;
-							if(firstEdge + numberOfEdges[searchingThreadIndex] <= MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
+							// Check if the first searching thread
+							if(!searchingThreadIndex) {
 							
-								// Go through all of the searching thread's units in the edges bitmap
-								uint64_t edgeIndex = static_cast<uint64_t>(firstEdge) * EDGE_NUMBER_OF_COMPONENTS;
-								for(uint_fast32_t bitmapIndex = bitmapStart; bitmapIndex < bitmapEnd; ++bitmapIndex) {
-								
-									// Go through all set bits in the unit
-									uint64_t unit = reinterpret_cast<const uint64_t *>(searchingThreadsData)[bitmapIndex];
-									for(uint_fast8_t unitCurrentBitIndex = __builtin_ffsll(unit), unitPreviousBitIndex = 0; unitCurrentBitIndex; unit >>= unitCurrentBitIndex, unitPreviousBitIndex += unitCurrentBitIndex, unitCurrentBitIndex = __builtin_ffsll(unit)) {
-									
-										// Set edge's index
-										edges[edgeIndex] = bitmapIndex * BITMAP_UNIT_WIDTH + (unitCurrentBitIndex - 1) + unitPreviousBitIndex;
-										
-										// Set edge's nodes
-										const uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nonces = {static_cast<uint64_t>(edges[edgeIndex]) * 2, (static_cast<uint64_t>(edges[edgeIndex]) * 2) | 1};
-										uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nodes;
-										sipHash24<2>(&nodes, *searchingThreadsSipHashKeys, &nonces);
-										edges[edgeIndex + 1] = nodes[0];
-										edges[edgeIndex + 2] = nodes[1];
-										
-										// Go to next edge
-										edgeIndex += EDGE_NUMBER_OF_COMPONENTS;
-										
-										// Check if shifting by the entire unit
-										if(unitCurrentBitIndex == BITMAP_UNIT_WIDTH) {
-										
-											// Break
-											break;
-										}
-									}
-								}
-								
-								// Go through all next searching threads
-								totalNumberOfEdges = firstEdge + numberOfEdges[searchingThreadIndex];
-								for(unsigned int nextSearchingThreadIndex = searchingThreadIndex + 1; nextSearchingThreadIndex < numberOfSearchingThreads; ++nextSearchingThreadIndex) {
-								
-									// Check if not too many edges exist for the next searching thread
-									if(totalNumberOfEdges + numberOfEdges[nextSearchingThreadIndex] <= MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
-									
-										// Add next searching thread's number of edges to total number of edges
-										totalNumberOfEdges += numberOfEdges[nextSearchingThreadIndex];
-									}
-									
-									// Otherwise
-									else {
-									
-										// Check if first searching thread
-										if(!searchingThreadIndex) {
-										
-											// Check if there's too many trimming rounds
-											if(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING <= TOO_MANY_TRIMMING_ROUNDS_MAX_REMAINING_NUMBER_OF_EDGES) {
-											
-												// Display message
-												cout << "Too many edges exist after trimming, so some edges weren't searched. Decrease the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS - 1) << " if this happens frequently." << endl;
-											}
-											
-											// Otherwise
-											else {
-											
-												// Display message
-												cout << "Too many edges exist after trimming, so some edges weren't searched. Increase the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS + 1) << " if this happens frequently." << endl;
-											}
-										}
-										
-										// Break
-										break;
-									}
-								}
-							}
-							
-							// Otherwise
-							else {
-							
-								// Check if first searching thread
-								if(!searchingThreadIndex) {
+								// Check if too may edges exist
+								if(numberOfEdges > MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
 								
 									// Check if there's too many trimming rounds
 									if(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING <= TOO_MANY_TRIMMING_ROUNDS_MAX_REMAINING_NUMBER_OF_EDGES) {
@@ -2583,117 +3392,100 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 										cout << "Too many edges exist after trimming, so some edges weren't searched. Increase the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS + 1) << " if this happens frequently." << endl;
 									}
 								}
+							}
+							
+							
+							// Check if renaming is stale
+							if(isStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE)) {
+							
+								// Notify that the searching thread has finished
+								searchingThreadsHandoff->finished();
 								
-								// Go through all searching threads
-								totalNumberOfEdges = 0;
-								for(unsigned int nextSearchingThreadIndex = 0; nextSearchingThreadIndex < numberOfSearchingThreads; ++nextSearchingThreadIndex) {
-								
-									// Check if not too many edges exist for the next searching thread
-									if(totalNumberOfEdges + numberOfEdges[nextSearchingThreadIndex] <= MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
-									
-										// Add next searching thread's number of edges to total number of edges
-										totalNumberOfEdges += numberOfEdges[nextSearchingThreadIndex];
-									}
-									
-									// Otherwise
-									else {
-									
-										// Break
-										break;
-									}
-								}
+								// Continue
+								continue;
+							}
+							
+							// Mark partitioning as stale if the graph is stale
+							markStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
+							
+							// Check if CPU trimming
+							if(cpuTrimmingRounds) {
+							
+								// Remove edges that can't be part of a cycle
+								leafPruner->prune(edges, totalNumberOfEdges, cpuTrimmingRounds, searchingThreadIndex, searchingThreadsBarrier);
 							}
 							
-							// Wait for all searching threads to finish getting the edges in their units
-							searchingThreadsBarrier.arrive_and_wait();
+							// Partition edges' components
+							componentPartitioner.partition(edges, totalNumberOfEdges, cpuTrimmingRounds ? leafPruner->getEdgesRemoved() : nullptr, searchingThreadIndex, searchingThreadsBarrier);
 							
-							// Check if searching thread is searching edges
-							if(searchingThreadIndex < numberOfSearchingThreadsSearchingEdges) {
+							// Check if partitioning is stale
+							if(isStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE)) {
 							
-								// Check if not the first searching thread
-								if(searchingThreadIndex) {
+								// Notify that the searching thread has finished
+								searchingThreadsHandoff->finished();
 								
-									// Set first searching edges
-									const uint64_t firstSearchingEdge = (1 - 1 / pow(2, searchingThreadIndex - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT));
-									
-									// Go through all previous edges
-									for(uint64_t nodeConnectionsIndex = 0, edgesIndex = 0; nodeConnectionsIndex < firstSearchingEdge * 2; nodeConnectionsIndex += 2, edgesIndex += EDGE_NUMBER_OF_COMPONENTS) {
-									
-										// Replace newest node connection for the node on the first partition and add node connection to list
-										nodeConnections[nodeConnectionsIndex] = {cuckatooUNewestNodeConnections.replace(edges[edgesIndex + 1], &nodeConnections[nodeConnectionsIndex]), edges[edgesIndex + 1], edges[edgesIndex]};
-										
-										// Replace newest node connection for the node on the second partition and add node connection to list
-										nodeConnections[nodeConnectionsIndex + 1] = {cuckatooVNewestNodeConnections.replace(edges[edgesIndex + 2], &nodeConnections[nodeConnectionsIndex + 1]), edges[edgesIndex + 2], edges[edgesIndex]};
-									}
-									
-									// Check if getting solution was successful
-									uint32_t solution[SOLUTION_SIZE];
-									if(getCuckatooSolution(solution, &nodeConnections[firstSearchingEdge * 2], &edges[firstSearchingEdge * EDGE_NUMBER_OF_COMPONENTS], static_cast<uint64_t>((1 - 1 / pow(2, searchingThreadIndex)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT))) - firstSearchingEdge)) {
-									
-										// Lock
-										lock.lock();
-										
-										// Set searching threads solution to the solution
-										memcpy(searchingThreadsSolution, solution, sizeof(solution));
-										
-										// Unlock
-										lock.unlock();
-									}
-								}
+								// Continue
+								continue;
+							}
+							
+							// Check if CSR searching
+							uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+							uint32_t numberOfSolutions;
+							if(csrSearching) {
+							
+								// Build CSR adjacency from the edges
+								csrAdjacency->build(edges, totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
 								
-								// Otherwise
-								else {
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
 								
-									// Check if getting solution was successful
-									uint32_t solution[SOLUTION_SIZE];
-									if(getCuckatooSolution(solution, nodeConnections, edges, ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT)))) {
-									
-										// Lock
-										lock.lock();
-										
-										// Set searching threads solution to the solution
-										memcpy(searchingThreadsSolution, solution, sizeof(solution));
-										
-										// Unlock
-										lock.unlock();
-									}
+									// Add edge to the CSR adjacency without searching it
+									addCuckatooCsrEdge(*csrAdjacency, componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], true);
 								}
 								
-								// Reset node connections
-								cuckatooUNewestNodeConnections.clear();
-								cuckatooVNewestNodeConnections.clear();
+								// Get solutions from the searching thread's edges using the CSR adjacency
+								numberOfSolutions = getCuckatooSolutionsFromCsrAdjacency(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, *csrAdjacency, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), true);
 							}
 							
-							// Check if all searching threads have finished
-							lock.lock();
-							if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
+							// Otherwise
+							else {
 							
-								// Reset number of searching threads finished
-								numberOfSearchingThreadsFinished = 0;
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
+								
+									// Add edge without searching it
+									addCuckatooEdge(componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], true);
+								}
 								
-								// Notify that searching threads have finished
-								searchingThreadsFinished = true;
-								lock.unlock();
-								searchingThreadsFinishedConditionalVariable->notify_one();
+								// Get solutions from the searching thread's edges
+								numberOfSolutions = getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), true);
 							}
 							
-							// Otherwise
-							else {
+							// Check if solutions were found
+							if(numberOfSolutions) {
 							
-								// Unlock
-								lock.unlock();
+								// Lock searching threads solutions mutex
+								searchingThreadsSolutionsMutex.lock();
+								
+								// Add solutions to the searching threads solutions
+								addSearchingThreadsSolutions(solutions, numberOfSolutions);
+								
+								// Unlock searching threads solutions mutex
+								searchingThreadsSolutionsMutex.unlock();
 							}
+							
+							// Reset node connections
+							cuckatooUNewestNodeConnections.clear();
+							cuckatooVNewestNodeConnections.clear();
+							
+							// Notify that the searching thread has finished
+							searchingThreadsHandoff->finished();
 						}	
 					});
 				}
 				
 				// Wait until searching threads have initialized
-				searchingThreadsFinished = false;
-				searchingThreadsFinishedConditionalVariable->wait(searchingThreadsLock, []() noexcept -> bool {
-				
-					// Return if searching threads have initialized
-					return searchingThreadsFinished;
-				});
+				searchingThreadsHandoff->waitUntilFinished();
 				
 				// Check if searching threads didn't initialized successfully
 				bool performingTrimmingLoopResult = false;
@@ -2706,15 +3498,29 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 				// Otherwise
 				else {
 				
+					// Create CPU trimming device from the CPU cores that aren't searching
+					createCpuTrimmingDevice(numberOfThreads, numberOfSearchingThreads, firstThreadIndex, numberOfApplicableCpuCores, cpuCoresNameOffset, true);
+					
+					// Check if balancing pipeline stages
+					if(balancePipelineStages) {
+					
+						// Create pipeline balancer without extra trimming rounds since slean trimming's number of trimming rounds is built into its programs
+						createPipelineBalancer(0, true);
+					}
+					
 					// Perform slean trimming loop
 					performingTrimmingLoopResult = performSleanTrimmingLoop(context.get());
+					
+					// Free pipeline balancer
+					pipelineBalancer.reset();
+					
+					// Free CPU trimming device
+					cpuTrimmingDevice.reset();
 				}
 				
 				// Close searching threads
 				closeSearchingThreads = true;
-				startSearchingThreadsTriggerToggle = !startSearchingThreadsTriggerToggle;
-				searchingThreadsLock.unlock();
-				startSearchingThreadsConditionalVariable->notify_all();
+				searchingThreadsHandoff->start();
 				
 				// Go through all searching threads
 				for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
@@ -2723,9 +3529,6 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					searchingThreads[i].join();
 				}
 				
-				// Lock searching threads lock
-				searchingThreadsLock.lock();
-				
 				// Return if searching threads initialized successfully and performing trimming loop was successful
 				return searchingThreadsInitializedSuccessfully && performingTrimmingLoopResult;
 			}
@@ -2783,28 +3586,81 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 			}
 		}
 		
-		// Check if using all trimming types or lean trimming is enabled
-		if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & LEAN_TRIMMING_TYPE) {
+		// Check if using all trimming types, lean trimming is enabled, or CPU lean trimming is enabled
+		if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & (LEAN_TRIMMING_TYPE | CPU_LEAN_TRIMMING_TYPE)) {
 		
-			// Check if using an Apple device and not using OpenCL
-			#if defined __APPLE__ && !defined USE_OPENCL
+			// Check if using all trimming types or lean trimming is enabled
+			if(trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & LEAN_TRIMMING_TYPE) {
 			
-				// Create lean trimming context
-				context = unique_ptr<MTL::Device, void(*)(MTL::Device *)>(createLeanTrimmingContext(deviceIndex), [](MTL::Device *context) noexcept {
+				// Check if using an Apple device and not using OpenCL
+				#if defined __APPLE__ && !defined USE_OPENCL
 				
-					// Free context
-					context->release();
-				});
+					// Create lean trimming context
+					context = unique_ptr<MTL::Device, void(*)(MTL::Device *)>(createLeanTrimmingContext(deviceIndex), [](MTL::Device *context) noexcept {
+					
+						// Free context
+						context->release();
+					});
+					
+				// Otherwise
+				#else
 				
-			// Otherwise
-			#else
-			
-				// Create lean trimming context
-				context = unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)>(createLeanTrimmingContext(platforms, numberOfPlatforms, deviceIndex), clReleaseContext);
-			#endif
+					// Create lean trimming context
+					context = unique_ptr<remove_pointer<cl_context>::type, decltype(&clReleaseContext)>(createLeanTrimmingContext(platforms, numberOfPlatforms, openClDeviceTypes, deviceIndex), clReleaseContext);
+					
+					// Check if using Linux
+					#ifdef __linux__
+					
+						// Check if creating lean trimming context was successful
+						if(context) {
+						
+							// Place threads near the GPU
+							placeThreadsNearOpenClContext(context.get(), firstThreadIndex, numberOfThreads, numberOfApplicableCpuCores);
+						}
+					#endif
+				#endif
+				
+				// Check if creating lean trimming context failed
+				if(!context) {
+				
+					// Display message
+					cout << ((deviceIndex == ALL_DEVICES) ? "No applicable GPU found for lean trimming" : "GPU isn't applicable for lean trimming") << ". Lean trimming requires ";
+					
+					// Check if RAM requirement can be expressed in bytes
+					if(LEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE / 2) {
+					
+						// Display message
+						cout << LEAN_TRIMMING_REQUIRED_RAM_BYTES << " bytes";
+					}
+					
+					// Otherwise check if RAM requirement can be expressed in kilobytes
+					else if(LEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE / 2) {
+					
+						// Display message
+						cout << (ceil(static_cast<double>(LEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE * 100) / 100) << " KB";
+					}
+					
+					// Otherwise check if RAM requirement can be expressed in megabytes
+					else if(LEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE * MEGABYTES_IN_A_GIGABYTE / 2) {
+					
+						// Display message
+						cout << (ceil(static_cast<double>(LEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE * 100) / 100) << " MB";
+					}
+					
+					// Otherwise
+					else {
+					
+						// Display message
+						cout << (ceil(static_cast<double>(LEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE / MEGABYTES_IN_A_GIGABYTE * 100) / 100) << " GB";
+					}
+					
+					// Display message
+					cout << " of RAM." << endl;
+				}
+			}
 			
-			// Check if creating lean trimming context was successful
-			if(context) {
+			// Check if creating lean trimming context was successful or CPU lean trimming can be used
+			if(context || trimmingTypes == ALL_TRIMMING_TYPES || trimmingTypes & CPU_LEAN_TRIMMING_TYPE) {
 				
 				// Get number of searching threads
 				const unsigned int numberOfSearchingThreads = min(min(numberOfThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS)), static_cast<unsigned int>(EDGES_BITMAP_SIZE));
@@ -2819,92 +3675,76 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					#ifdef _WIN32
 					
 						// Display message
-						cout << (i ? ", " : "") << "CPU " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "CPU " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + cpuCoresNameOffset);
 						
 					// Otherwise check if using an Apple device
 					#elif defined __APPLE__
 					
 						// Display message
-						cout << (i ? ", " : "") << "Core " << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "Core " << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 						
 					// Otherwise
 					#else
 					
 						// Display message
-						cout << (i ? ", " : "") << "CPU" << ((firstThreadIndex + i) % numberOfApplicableCpuCores + 1 + cpuCoresNameOffset);
+						cout << (i ? ", " : "") << "CPU" << (getCpuCore((firstThreadIndex + i) % numberOfApplicableCpuCores) + 1 + cpuCoresNameOffset);
 					#endif
 				}
 				
 				// Display new line
 				cout << endl;
 				
-				// Get number of searching threads searching edges
-				const unsigned int numberOfSearchingThreadsSearchingEdges = min(min(numberOfSearchingThreads, static_cast<unsigned int>(MAX_NUMBER_OF_SEARCHING_THREADS_SEARCHING_EDGES)), static_cast<unsigned int>(1 + ceil(log2((1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) * MAX_NUMBER_OF_EDGES_AFTER_TRIMMING))));
-				
 				// Go through all searching threads
 				thread searchingThreads[numberOfSearchingThreads];
-				uint32_t numberOfEdges[numberOfSearchingThreads];
+				const unique_ptr<uint32_t[]> chunksFirstEdge(new(nothrow) uint32_t[SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS + 1]);
+				uint32_t numberOfChunksSearched;
 				barrier searchingThreadsBarrier(numberOfSearchingThreads);
 				const unique_ptr<uint32_t[]> edges(new(nothrow) uint32_t[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * EDGE_NUMBER_OF_COMPONENTS]);
-				unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreadsSearchingEdges];
-				unsigned int numberOfSearchingThreadsFinished = 0;
+				NodeRenamer<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> nodeRenamer(numberOfSearchingThreads);
+				ComponentPartitioner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING, SOLUTION_SIZE> componentPartitioner(numberOfSearchingThreads);
+				const unique_ptr<LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> leafPruner(usingLeafPruner ? new(nothrow) LeafPruner<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+				const unique_ptr<CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>> csrAdjacency(csrSearching ? new(nothrow) CsrAdjacency<MAX_NUMBER_OF_EDGES_AFTER_TRIMMING>(numberOfSearchingThreads) : nullptr);
+				unique_ptr<CuckatooNodeConnectionsLink[]> nodeConnections[numberOfSearchingThreads];
+				WorkStealingScheduler workStealingScheduler(numberOfSearchingThreads, SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS);
+				searchingThreadsScheduler = context ? nullptr : &workStealingScheduler;
+				SearchingThreadsHandoff searchingThreadsHandoffAutomaticDuration(numberOfSearchingThreads);
+				searchingThreadsHandoff = &searchingThreadsHandoffAutomaticDuration;
 				bool closeSearchingThreads = false;
-				bool searchingThreadsInitializedSuccessfully = true;
+				atomic<bool> searchingThreadsInitializedSuccessfully(true);
 				
 				for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
 				
-					// Check if searching thread is searching edges
-					if(i < numberOfSearchingThreadsSearchingEdges) {
-					
-						// Create searching thread's node connections
-						nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2]);
-					}
+					// Create searching thread's node connections
+					nodeConnections[i] = unique_ptr<CuckatooNodeConnectionsLink[]>(new(nothrow) CuckatooNodeConnectionsLink[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2 + 1]);
 					
 					// Create searching thread
-					searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, numberOfSearchingThreads, numberOfSearchingThreadsSearchingEdges, &numberOfEdges, &searchingThreadsBarrier, edges = edges.get(), nodeConnections = nodeConnections[min(i, numberOfSearchingThreadsSearchingEdges - 1)].get(), &numberOfSearchingThreadsFinished, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
+					searchingThreads[i] = thread([numberOfApplicableCpuCores, firstThreadIndex, trimmingResultIsRemainingEdges = static_cast<bool>(context), chunksFirstEdge = chunksFirstEdge.get(), &numberOfChunksSearched, &searchingThreadsBarrier, edges = edges.get(), &nodeRenamer, &componentPartitioner, usingLeafPruner, leafPruner = leafPruner.get(), csrSearching, csrAdjacency = csrAdjacency.get(), nodeConnections = nodeConnections[i].get(), &workStealingScheduler, &closeSearchingThreads, &searchingThreadsInitializedSuccessfully, searchingThreadIndex = i]() noexcept {
 					
 						// Check if using an Apple device and not using macOS or using Android
-						unique_lock lock(searchingThreadsMutex);
 						#if (defined __APPLE__ && TARGET_OS_OSX == 0) || defined __ANDROID__
 						
 							// Set thread's priority and affinity
-							setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores);
+							setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores));
 							
-							// Set initialized failed to if creating edges failed, creating node connections failed, or initializing thread local global variables failed
-							const bool initializingFailed = !edges || !nodeConnections || (searchingThreadIndex < numberOfSearchingThreadsSearchingEdges && !initializeCuckatooThreadLocalGlobalVariables());
+							// Set initialized failed to if creating edges failed, creating node renamer failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, creating chunks' first edges failed, creating work stealing scheduler failed, or initializing thread local global variables failed
+							const bool initializingFailed = !edges || !nodeRenamer || !componentPartitioner || (usingLeafPruner && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !chunksFirstEdge || !workStealingScheduler || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 							
 						// Otherwise
 						#else
 						
-							// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating node connections failed, or initializing thread local global variables failed
-							const bool initializingFailed = !setThreadPriorityAndAffinity((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores) || !edges || !nodeConnections || (searchingThreadIndex < numberOfSearchingThreadsSearchingEdges && !initializeCuckatooThreadLocalGlobalVariables());
+							// Set initialized failed to if setting searching thread's priority and affinity failed, creating edges failed, creating node renamer failed, creating component partitioner failed, creating leaf pruner failed, creating CSR adjacency failed, creating node connections failed, creating chunks' first edges failed, creating work stealing scheduler failed, or initializing thread local global variables failed
+							const bool initializingFailed = !setThreadPriorityAndAffinity(getCpuCore((firstThreadIndex + searchingThreadIndex) % numberOfApplicableCpuCores)) || !edges || !nodeRenamer || !componentPartitioner || (usingLeafPruner && (!leafPruner || !*leafPruner)) || (csrSearching && (!csrAdjacency || !*csrAdjacency)) || !nodeConnections || !chunksFirstEdge || !workStealingScheduler || !initializeCuckatooThreadLocalGlobalVariables(nodeConnections, edges);
 						#endif
 						
 						// Check if initializing failed
 						if(initializingFailed) {
 						
 							// Set searching threads initialized successfully to false
-							searchingThreadsInitializedSuccessfully = false;
-						}
-						
-						// Check if all searching threads have initialized
-						if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
-						
-							// Reset number of searching threads finished
-							numberOfSearchingThreadsFinished = 0;
-							
-							// Notify that searching threads have initialized
-							searchingThreadsFinished = true;
-							lock.unlock();
-							searchingThreadsFinishedConditionalVariable->notify_one();
+							searchingThreadsInitializedSuccessfully.store(false, memory_order_relaxed);
 						}
 						
-						// Otherwise
-						else {
-						
-							// Unlock
-							lock.unlock();
-						}
+						// Notify that the searching thread has initialized
+						searchingThreadsHandoff->finished();
 						
 						// Check if initializing failed
 						if(initializingFailed) {
@@ -2913,24 +3753,17 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 							return;
 						}
 						
-						// Set searching thread's bitmap start and end
-						const uint_fast32_t bitmapStart = (EDGES_BITMAP_SIZE + numberOfSearchingThreads - 1) / numberOfSearchingThreads * searchingThreadIndex;
-						const uint_fast32_t bitmapEnd = min((EDGES_BITMAP_SIZE + numberOfSearchingThreads - 1) / numberOfSearchingThreads * (searchingThreadIndex + 1), EDGES_BITMAP_SIZE);
+						// Give the searching thread its share of the edges bitmap's chunks
+						workStealingScheduler.distribute(searchingThreadIndex);
 						
 						// Loop forever
-						for(bool startTriggerTrue = true;; startTriggerTrue = !startTriggerTrue) {
+						for(uint32_t sequence = 0;;) {
 						
 							// Wait until starting searching threads
-							lock.lock();
-							startSearchingThreadsConditionalVariable->wait(lock, [startTriggerTrue]() noexcept -> bool {
-							
-								// Return if starting searching threads
-								return startSearchingThreadsTriggerToggle == startTriggerTrue;
-							});
+							sequence = searchingThreadsHandoff->waitUntilStarted(sequence);
 							
 							// Get if closing thread
 							const bool closeThread = closeSearchingThreads;
-							lock.unlock();
 							
 							// Check if closing thread
 							if(closeThread) {
@@ -2939,80 +3772,83 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 								return;
 							}
 							
-							// Go through all of the searching thread's units in the edges bitmap
-							numberOfEdges[searchingThreadIndex] = 0;
-							for(uint_fast32_t bitmapIndex = bitmapStart; bitmapIndex < bitmapEnd; ++bitmapIndex) {
-							
-								// Add number of set bits in the unit to the searching thread's number of edges
-								numberOfEdges[searchingThreadIndex] += __builtin_popcountll(reinterpret_cast<const uint64_t *>(searchingThreadsData)[bitmapIndex]);
-							}
-							
-							// Wait for all searching threads to finish counting the number of edges in their units
-							searchingThreadsBarrier.arrive_and_wait();
+							// Get CPU trimming rounds (The pipeline balancer can change this between graphs)
+							const unsigned int cpuTrimmingRounds = searchingThreadsCpuTrimmingRounds;
 							
-							// Check if not the first searching thread
-							uint32_t firstEdge = 0;
-							if(searchingThreadIndex) {
-							
-								// Go through all previous searching threads
-								for(unsigned int previousSearchingThreadIndex = searchingThreadIndex; previousSearchingThreadIndex; --previousSearchingThreadIndex) {
-								
-									// Add previous searching thread's number of edges to first edge
-									firstEdge += numberOfEdges[previousSearchingThreadIndex - 1];
-								}
-							}
+							// Mark renaming as stale if the graph is stale
+							markStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
 							
-							// Check if not too many edges exist for the searching thread
+							// Check if trimming result is remaining edges
 							uint32_t totalNumberOfEdges;
-							if(firstEdge + numberOfEdges[searchingThreadIndex] <= MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
+							if(trimmingResultIsRemainingEdges) {
 							
-								// Go through all of the searching thread's units in the edges bitmap
-								uint64_t edgeIndex = static_cast<uint64_t>(firstEdge) * EDGE_NUMBER_OF_COMPONENTS;
-								for(uint_fast32_t bitmapIndex = bitmapStart; bitmapIndex < bitmapEnd; ++bitmapIndex) {
+								// Get number of edges
+								const uint32_t &numberOfRemainingEdges = reinterpret_cast<const uint32_t *>(searchingThreadsData)[0];
+								
+								// Get total number of edges
+								totalNumberOfEdges = min(numberOfRemainingEdges, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING);
 								
-									// Go through all set bits in the unit
-									uint64_t unit = reinterpret_cast<const uint64_t *>(searchingThreadsData)[bitmapIndex];
-									for(uint_fast8_t unitCurrentBitIndex = __builtin_ffsll(unit), unitPreviousBitIndex = 0; unitCurrentBitIndex; unit >>= unitCurrentBitIndex, unitPreviousBitIndex += unitCurrentBitIndex, unitCurrentBitIndex = __builtin_ffsll(unit)) {
+								// Rename edges' nodes
+								nodeRenamer.rename(edges, &reinterpret_cast<const uint32_t *>(searchingThreadsData)[1], totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
+								
+								// Check if the first searching thread
+								if(!searchingThreadIndex) {
+								
+									// Check if too may edges exist
+									if(numberOfRemainingEdges > MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
 									
-										// Set edge's index
-										edges[edgeIndex] = bitmapIndex * BITMAP_UNIT_WIDTH + (unitCurrentBitIndex - 1) + unitPreviousBitIndex;
-										
-										// Set edge's nodes
-										const uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nonces = {static_cast<uint64_t>(edges[edgeIndex]) * 2, (static_cast<uint64_t>(edges[edgeIndex]) * 2) | 1};
-										uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nodes;
-										sipHash24<2>(&nodes, *searchingThreadsSipHashKeys, &nonces);
-										edges[edgeIndex + 1] = nodes[0];
-										edges[edgeIndex + 2] = nodes[1];
+										// Check if there's too many trimming rounds
+										if(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING <= TOO_MANY_TRIMMING_ROUNDS_MAX_REMAINING_NUMBER_OF_EDGES) {
 										
-										// Go to next edge
-										edgeIndex += EDGE_NUMBER_OF_COMPONENTS;
+											// Display message
+											cout << "Too many edges exist after trimming, so some edges weren't searched. Decrease the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS - 1) << " if this happens frequently." << endl;
+										}
 										
-										// Check if shifting by the entire unit
-										if(unitCurrentBitIndex == BITMAP_UNIT_WIDTH) {
+										// Otherwise
+										else {
 										
-											// Break
-											break;
+											// Display message
+											cout << "Too many edges exist after trimming, so some edges weren't searched. Increase the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS + 1) << " if this happens frequently." << endl;
 										}
 									}
 								}
+							}
+							
+							// Otherwise
+							else {
+							
+								// Go through all chunks of the edges bitmap that the searching thread gets or steals
+								workStealingScheduler.perform(searchingThreadIndex, [chunksFirstEdge](const uint32_t chunk) noexcept {
 								
-								// Go through all next searching threads
-								totalNumberOfEdges = firstEdge + numberOfEdges[searchingThreadIndex];
-								for(unsigned int nextSearchingThreadIndex = searchingThreadIndex + 1; nextSearchingThreadIndex < numberOfSearchingThreads; ++nextSearchingThreadIndex) {
-								
-									// Check if not too many edges exist for the next searching thread
-									if(totalNumberOfEdges + numberOfEdges[nextSearchingThreadIndex] <= MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
+									// Go through all units in the chunk
+									uint32_t numberOfEdgesInChunk = 0;
+									for(uint_fast32_t bitmapIndex = chunk * SEARCHING_THREADS_BITMAP_CHUNK_SIZE; bitmapIndex < min((chunk + 1) * SEARCHING_THREADS_BITMAP_CHUNK_SIZE, static_cast<uint32_t>(EDGES_BITMAP_SIZE)); ++bitmapIndex) {
 									
-										// Add next searching thread's number of edges to total number of edges
-										totalNumberOfEdges += numberOfEdges[nextSearchingThreadIndex];
+										// Add number of set bits in the unit to the chunk's number of edges
+										numberOfEdgesInChunk += __builtin_popcountll(reinterpret_cast<const uint64_t *>(searchingThreadsData)[bitmapIndex]);
 									}
 									
-									// Otherwise
-									else {
+									// Set chunk's number of edges (This is where the next chunk's first edge goes so that the first searching thread can turn the numbers of edges into first edges in place)
+									chunksFirstEdge[chunk + 1] = numberOfEdgesInChunk;
+								});
+								
+								// Wait for all searching threads to finish counting the number of edges in the chunks
+								workStealingScheduler.arriveAndWait(searchingThreadIndex, searchingThreadsBarrier);
+								
+								// Check if the first searching thread
+								if(!searchingThreadIndex) {
+								
+									// Go through all chunks
+									chunksFirstEdge[0] = 0;
+									numberOfChunksSearched = SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS;
+									for(uint32_t chunk = 0; chunk < SEARCHING_THREADS_NUMBER_OF_BITMAP_CHUNKS; ++chunk) {
 									
-										// Check if first searching thread
-										if(!searchingThreadIndex) {
+										// Check if too many edges exist for the chunk
+										if(chunksFirstEdge[chunk] + chunksFirstEdge[chunk + 1] > MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
 										
+											// Set number of chunks searched to not include the chunk or any after it
+											numberOfChunksSearched = chunk;
+											
 											// Check if there's too many trimming rounds
 											if(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING <= TOO_MANY_TRIMMING_ROUNDS_MAX_REMAINING_NUMBER_OF_EDGES) {
 											
@@ -3026,145 +3862,179 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 												// Display message
 												cout << "Too many edges exist after trimming, so some edges weren't searched. Increase the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS + 1) << " if this happens frequently." << endl;
 											}
+											
+											// Break
+											break;
 										}
 										
-										// Break
-										break;
+										// Set next chunk's first edge
+										chunksFirstEdge[chunk + 1] += chunksFirstEdge[chunk];
 									}
 								}
-							}
-							
-							// Otherwise
-							else {
-							
-								// Check if first searching thread
-								if(!searchingThreadIndex) {
 								
-									// Check if there's too many trimming rounds
-									if(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING <= TOO_MANY_TRIMMING_ROUNDS_MAX_REMAINING_NUMBER_OF_EDGES) {
-									
-										// Display message
-										cout << "Too many edges exist after trimming, so some edges weren't searched. Decrease the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS - 1) << " if this happens frequently." << endl;
-									}
-									
-									// Otherwise
-									else {
+								// Give the searching thread its share of the edges bitmap's chunks again
+								workStealingScheduler.distribute(searchingThreadIndex);
+								
+								// Wait for the first searching thread to finish getting the chunks' first edges
+								searchingThreadsBarrier.arrive_and_wait();
+								
+								// Go through all chunks of the edges bitmap that the searching thread gets or steals
+								totalNumberOfEdges = chunksFirstEdge[numberOfChunksSearched];
+								workStealingScheduler.perform(searchingThreadIndex, [edges, chunksFirstEdge, &numberOfChunksSearched](const uint32_t chunk) noexcept {
+								
+									// Check if the chunk's edges are searched
+									if(chunk < numberOfChunksSearched) {
 									
-										// Display message
-										cout << "Too many edges exist after trimming, so some edges weren't searched. Increase the number of trimming rounds by building this program with TRIMMING_ROUNDS=" << (TRIMMING_ROUNDS + 1) << " if this happens frequently." << endl;
+										// Go through all units in the chunk
+										uint64_t edgeIndex = static_cast<uint64_t>(chunksFirstEdge[chunk]) * EDGE_NUMBER_OF_COMPONENTS;
+										uint_fast8_t numberOfEdgesWithoutNodes = 0;
+										for(uint_fast32_t bitmapIndex = chunk * SEARCHING_THREADS_BITMAP_CHUNK_SIZE; bitmapIndex < min((chunk + 1) * SEARCHING_THREADS_BITMAP_CHUNK_SIZE, static_cast<uint32_t>(EDGES_BITMAP_SIZE)); ++bitmapIndex) {
+										
+											// Go through all set bits in the unit
+											uint64_t unit = reinterpret_cast<const uint64_t *>(searchingThreadsData)[bitmapIndex];
+											for(uint_fast8_t unitCurrentBitIndex = __builtin_ffsll(unit), unitPreviousBitIndex = 0; unitCurrentBitIndex; unit >>= unitCurrentBitIndex, unitPreviousBitIndex += unitCurrentBitIndex, unitCurrentBitIndex = __builtin_ffsll(unit)) {
+											
+												// Set edge's index
+												edges[edgeIndex] = bitmapIndex * BITMAP_UNIT_WIDTH + (unitCurrentBitIndex - 1) + unitPreviousBitIndex;
+												
+												// Go to next edge
+												edgeIndex += EDGE_NUMBER_OF_COMPONENTS;
+												
+												// Check if enough edges don't have their nodes set
+												if(++numberOfEdgesWithoutNodes == SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH) {
+												
+													// Set edges' nodes
+													setSearchingThreadsEdgesNodes(&edges[edgeIndex - SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH * EDGE_NUMBER_OF_COMPONENTS], SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH, *searchingThreadsSipHashKeys);
+													
+													// Set number of edges without nodes to zero
+													numberOfEdgesWithoutNodes = 0;
+												}
+												
+												// Check if shifting by the entire unit
+												if(unitCurrentBitIndex == BITMAP_UNIT_WIDTH) {
+												
+													// Break
+													break;
+												}
+											}
+										}
+										
+										// Check if edges don't have their nodes set
+										if(numberOfEdgesWithoutNodes) {
+										
+											// Set edges' nodes
+											setSearchingThreadsEdgesNodes(&edges[edgeIndex - numberOfEdgesWithoutNodes * EDGE_NUMBER_OF_COMPONENTS], numberOfEdgesWithoutNodes, *searchingThreadsSipHashKeys);
+										}
 									}
-								}
+								});
+								
+								// Wait for all searching threads to finish getting the edges in the chunks
+								workStealingScheduler.arriveAndWait(searchingThreadIndex, searchingThreadsBarrier);
+								
+								// Rename edges' nodes
+								nodeRenamer.rename(edges, edges, totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
+							}
+							
+							// Check if renaming is stale
+							if(isStaleSearchingPhase(searchingThreadsStalePhase, RENAMING_SEARCHING_PHASE)) {
+							
+								// Give the searching thread its share of the edges bitmap's chunks for the next graph
+								workStealingScheduler.distribute(searchingThreadIndex);
 								
-								// Go through all searching threads
-								totalNumberOfEdges = 0;
-								for(unsigned int nextSearchingThreadIndex = 0; nextSearchingThreadIndex < numberOfSearchingThreads; ++nextSearchingThreadIndex) {
+								// Notify that the searching thread has finished
+								searchingThreadsHandoff->finished();
 								
-									// Check if not too many edges exist for the next searching thread
-									if(totalNumberOfEdges + numberOfEdges[nextSearchingThreadIndex] <= MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
-									
-										// Add next searching thread's number of edges to total number of edges
-										totalNumberOfEdges += numberOfEdges[nextSearchingThreadIndex];
-									}
-									
-									// Otherwise
-									else {
-									
-										// Break
-										break;
-									}
-								}
+								// Continue
+								continue;
+							}
+							
+							// Mark partitioning as stale if the graph is stale
+							markStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE, searchingThreadsHeight, searchingThreadIndex);
+							
+							// Check if CPU trimming
+							if(cpuTrimmingRounds) {
+							
+								// Remove edges that can't be part of a cycle
+								leafPruner->prune(edges, totalNumberOfEdges, cpuTrimmingRounds, searchingThreadIndex, searchingThreadsBarrier);
 							}
 							
-							// Wait for all searching threads to finish getting the edges in their units
-							searchingThreadsBarrier.arrive_and_wait();
+							// Partition edges' components
+							componentPartitioner.partition(edges, totalNumberOfEdges, cpuTrimmingRounds ? leafPruner->getEdgesRemoved() : nullptr, searchingThreadIndex, searchingThreadsBarrier);
 							
-							// Check if searching thread is searching edges
-							if(searchingThreadIndex < numberOfSearchingThreadsSearchingEdges) {
+							// Check if partitioning is stale
+							if(isStaleSearchingPhase(searchingThreadsStalePhase, PARTITIONING_SEARCHING_PHASE)) {
 							
-								// Check if not the first searching thread
-								if(searchingThreadIndex) {
+								// Give the searching thread its share of the edges bitmap's chunks for the next graph
+								workStealingScheduler.distribute(searchingThreadIndex);
 								
-									// Set first searching edges
-									const uint64_t firstSearchingEdge = (1 - 1 / pow(2, searchingThreadIndex - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT));
-									
-									// Go through all previous edges
-									for(uint64_t nodeConnectionsIndex = 0, edgesIndex = 0; nodeConnectionsIndex < firstSearchingEdge * 2; nodeConnectionsIndex += 2, edgesIndex += EDGE_NUMBER_OF_COMPONENTS) {
-									
-										// Replace newest node connection for the node on the first partition and add node connection to list
-										nodeConnections[nodeConnectionsIndex] = {cuckatooUNewestNodeConnections.replace(edges[edgesIndex + 1], &nodeConnections[nodeConnectionsIndex]), edges[edgesIndex + 1], edges[edgesIndex]};
-										
-										// Replace newest node connection for the node on the second partition and add node connection to list
-										nodeConnections[nodeConnectionsIndex + 1] = {cuckatooVNewestNodeConnections.replace(edges[edgesIndex + 2], &nodeConnections[nodeConnectionsIndex + 1]), edges[edgesIndex + 2], edges[edgesIndex]};
-									}
-									
-									// Check if getting solution was successful
-									uint32_t solution[SOLUTION_SIZE];
-									if(getCuckatooSolution(solution, &nodeConnections[firstSearchingEdge * 2], &edges[firstSearchingEdge * EDGE_NUMBER_OF_COMPONENTS], static_cast<uint64_t>((1 - 1 / pow(2, searchingThreadIndex)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) + ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT))) - firstSearchingEdge)) {
-									
-										// Lock
-										lock.lock();
-										
-										// Set searching threads solution to the solution
-										memcpy(searchingThreadsSolution, solution, sizeof(solution));
-										
-										// Unlock
-										lock.unlock();
-									}
-								}
+								// Notify that the searching thread has finished
+								searchingThreadsHandoff->finished();
 								
-								// Otherwise
-								else {
+								// Continue
+								continue;
+							}
+							
+							// Check if CSR searching
+							uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH][SOLUTION_SIZE];
+							uint32_t numberOfSolutions;
+							if(csrSearching) {
+							
+								// Build CSR adjacency from the edges
+								csrAdjacency->build(edges, totalNumberOfEdges, searchingThreadIndex, searchingThreadsBarrier);
 								
-									// Check if getting solution was successful
-									uint32_t solution[SOLUTION_SIZE];
-									if(getCuckatooSolution(solution, nodeConnections, edges, ceil(totalNumberOfEdges * FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT + totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT) - (1 - 1 / pow(2, numberOfSearchingThreadsSearchingEdges - 1)) * totalNumberOfEdges * (1 - FIRST_SEARCHING_THREAD_SEARCH_EDGES_PERCENT)))) {
-									
-										// Lock
-										lock.lock();
-										
-										// Set searching threads solution to the solution
-										memcpy(searchingThreadsSolution, solution, sizeof(solution));
-										
-										// Unlock
-										lock.unlock();
-									}
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
+								
+									// Add edge to the CSR adjacency without searching it
+									addCuckatooCsrEdge(*csrAdjacency, componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], true);
 								}
 								
-								// Reset node connections
-								cuckatooUNewestNodeConnections.clear();
-								cuckatooVNewestNodeConnections.clear();
+								// Get solutions from the searching thread's edges using the CSR adjacency
+								numberOfSolutions = getCuckatooSolutionsFromCsrAdjacency(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, *csrAdjacency, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), true);
 							}
 							
-							// Check if all searching threads have finished
-							lock.lock();
-							if(++numberOfSearchingThreadsFinished == numberOfSearchingThreads) {
+							// Otherwise
+							else {
 							
-								// Reset number of searching threads finished
-								numberOfSearchingThreadsFinished = 0;
+								// Go through all of the searching thread's preceding edges
+								for(uint32_t i = 0; i < componentPartitioner.getThreadsNumberOfPrecedingEdges(searchingThreadIndex); ++i) {
+								
+									// Add edge without searching it
+									addCuckatooEdge(componentPartitioner.getThreadsPrecedingEdges(searchingThreadIndex)[i], true);
+								}
 								
-								// Notify that searching threads have finished
-								searchingThreadsFinished = true;
-								lock.unlock();
-								searchingThreadsFinishedConditionalVariable->notify_one();
+								// Get solutions from the searching thread's edges
+								numberOfSolutions = getCuckatooSolutions(solutions, MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH, componentPartitioner.getThreadsEdges(searchingThreadIndex), componentPartitioner.getThreadsNumberOfEdges(searchingThreadIndex), true);
 							}
 							
-							// Otherwise
-							else {
+							// Check if solutions were found
+							if(numberOfSolutions) {
 							
-								// Unlock
-								lock.unlock();
+								// Lock searching threads solutions mutex
+								searchingThreadsSolutionsMutex.lock();
+								
+								// Add solutions to the searching threads solutions
+								addSearchingThreadsSolutions(solutions, numberOfSolutions);
+								
+								// Unlock searching threads solutions mutex
+								searchingThreadsSolutionsMutex.unlock();
 							}
+							
+							// Reset node connections
+							cuckatooUNewestNodeConnections.clear();
+							cuckatooVNewestNodeConnections.clear();
+							
+							// Give the searching thread its share of the edges bitmap's chunks for the next graph (Every searching thread has passed the barrier after getting the edges, so none of them are still stealing from its deque)
+							workStealingScheduler.distribute(searchingThreadIndex);
+							
+							// Notify that the searching thread has finished
+							searchingThreadsHandoff->finished();
 						}	
 					});
 				}
 				
 				// Wait until searching threads have initialized
-				searchingThreadsFinished = false;
-				searchingThreadsFinishedConditionalVariable->wait(searchingThreadsLock, []() noexcept -> bool {
-				
-					// Return if searching threads have initialized
-					return searchingThreadsFinished;
-				});
+				searchingThreadsHandoff->waitUntilFinished();
 				
 				// Check if searching threads didn't initialized successfully
 				bool performingTrimmingLoopResult = false;
@@ -3177,15 +4047,33 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 				// Otherwise
 				else {
 				
-					// Perform lean trimming loop
-					performingTrimmingLoopResult = performLeanTrimmingLoop(context.get());
+					// Check if creating lean trimming context was successful
+					if(context) {
+					
+						// Create CPU trimming device from the CPU cores that aren't searching
+						createCpuTrimmingDevice(numberOfThreads, numberOfSearchingThreads, firstThreadIndex, numberOfApplicableCpuCores, cpuCoresNameOffset, true);
+					}
+					
+					// Check if balancing pipeline stages
+					if(balancePipelineStages) {
+					
+						// Create pipeline balancer (CPU lean trimming alternates with searching on the same CPU cores, so its stages don't overlap)
+						createPipelineBalancer(PIPELINE_BALANCER_MAX_EXTRA_TRIMMING_ROUNDS, static_cast<bool>(context));
+					}
+					
+					// Perform lean trimming loop if creating lean trimming context was successful otherwise perform CPU lean trimming loop
+					performingTrimmingLoopResult = context ? performLeanTrimmingLoop(context.get()) : performCpuLeanTrimmingLoop(numberOfThreads, firstThreadIndex, numberOfApplicableCpuCores, cpuCoresNameOffset);
+					
+					// Free pipeline balancer
+					pipelineBalancer.reset();
+					
+					// Free CPU trimming device
+					cpuTrimmingDevice.reset();
 				}
 				
 				// Close searching threads
 				closeSearchingThreads = true;
-				startSearchingThreadsTriggerToggle = !startSearchingThreadsTriggerToggle;
-				searchingThreadsLock.unlock();
-				startSearchingThreadsConditionalVariable->notify_all();
+				searchingThreadsHandoff->start();
 				
 				// Go through all searching threads
 				for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
@@ -3194,50 +4082,9 @@ bool startMiner(const int argc, char *argv[]) noexcept {
 					searchingThreads[i].join();
 				}
 				
-				// Lock searching threads lock
-				searchingThreadsLock.lock();
-				
 				// Return if searching threads initialized successfully and performing trimming loop was successful
 				return searchingThreadsInitializedSuccessfully && performingTrimmingLoopResult;
 			}
-			
-			// Otherwise
-			else {
-			
-				// Display message
-				cout << ((deviceIndex == ALL_DEVICES) ? "No applicable GPU found for lean trimming" : "GPU isn't applicable for lean trimming") << ". Lean trimming requires ";
-				
-				// Check if RAM requirement can be expressed in bytes
-				if(LEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE / 2) {
-				
-					// Display message
-					cout << LEAN_TRIMMING_REQUIRED_RAM_BYTES << " bytes";
-				}
-				
-				// Otherwise check if RAM requirement can be expressed in kilobytes
-				else if(LEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE / 2) {
-				
-					// Display message
-					cout << (ceil(static_cast<double>(LEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE * 100) / 100) << " KB";
-				}
-				
-				// Otherwise check if RAM requirement can be expressed in megabytes
-				else if(LEAN_TRIMMING_REQUIRED_RAM_BYTES < BYTES_IN_A_KILOBYTE * KILOBYTES_IN_A_MEGABYTE * MEGABYTES_IN_A_GIGABYTE / 2) {
-				
-					// Display message
-					cout << (ceil(static_cast<double>(LEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE * 100) / 100) << " MB";
-				}
-				
-				// Otherwise
-				else {
-				
-					// Display message
-					cout << (ceil(static_cast<double>(LEAN_TRIMMING_REQUIRED_RAM_BYTES) / BYTES_IN_A_KILOBYTE / KILOBYTES_IN_A_MEGABYTE / MEGABYTES_IN_A_GIGABYTE * 100) / 100) << " GB";
-				}
-				
-				// Display message
-				cout << " of RAM." << endl;
-			}
 		}
 		
 		// Return true
@@ -3367,47 +4214,152 @@ void stopMiner() noexcept {
 	}
 #endif
 
-// Check if not tuning
-#ifndef TUNING
+// Trimming finished
+void trimmingFinished(const void *__restrict__ data, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce) noexcept {
 
-	// Trimming finished
-	void trimmingFinished(const void *__restrict__ data, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce) noexcept {
+	// Check if there's no trimming rounds
+	#if TRIMMING_ROUNDS == 0
 	
-// Otherwise
-#else
+		// Search trimmed graph
+		searchTrimmedGraph(data, sipHashKeys, height, id, nonce);
+		
+	// Otherwise
+	#else
+	
+		// Search trimmed graph
+		const double searchingTime = searchTrimmedGraph(data, sipHashKeys, height, id, nonce);
+		
+		// Check if balancing pipeline stages and graph isn't stale (Stale graphs' times don't show how long graphs take)
+		if(pipelineBalancer && !isStaleGraph(height)) {
+		
+			// Add graph to the pipeline balancer
+			pipelineBalancer->addGraph(searchingTime);
+		}
+		
+		// Check if using a CPU trimming device
+		if(cpuTrimmingDevice) {
+		
+			// Check if graph isn't stale
+			if(!isStaleGraph(height)) {
+			
+				// Add GPU graph to the CPU trimming device
+				cpuTrimmingDevice->addGpuGraph(searchingTime);
+			}
+			
+			// Check if CPU trimming device finished trimming a graph
+			if(cpuTrimmingDevice->isFinished()) {
+			
+				// Search CPU trimming device's trimmed graph
+				const double cpuSearchingTime = searchTrimmedGraph(cpuTrimmingDevice->getResult(), cpuTrimmingDevice->getSipHashKeys(), cpuTrimmingDevice->getHeight(), cpuTrimmingDevice->getId(), cpuTrimmingDevice->getNonce());
+				
+				// Display message
+				cout << "\tCPU trimming time:\t " << cpuTrimmingDevice->getTrimmingTime() << " second(s) using " << cpuTrimmingDevice->getNumberOfActiveThreads() << " CPU core(s)" << endl;
+				
+				// Check if CPU trimming device's graph isn't stale
+				if(!isStaleGraph(cpuTrimmingDevice->getHeight())) {
+				
+					// Add CPU graph to the CPU trimming device
+					cpuTrimmingDevice->addCpuGraph(cpuSearchingTime);
+					
+					// Check if balancing pipeline stages
+					if(pipelineBalancer) {
+					
+						// Add CPU graph to the pipeline balancer
+						pipelineBalancer->addGraph(cpuSearchingTime);
+					}
+				}
+				
+				// Set that CPU trimming device's trimmed graph was searched
+				cpuTrimmingDevice->searched();
+			}
+			
+			// Check if not closing, CPU trimming device isn't trimming, searching threads have time to search its graphs, and the job isn't stale (The CPU trimming device would abandon the graph right away if the job for a new block hasn't been received yet)
+			const unsigned int numberOfCpuTrimmingDeviceThreads = cpuTrimmingDevice->getNumberOfThreadsToUse();
+			if(!closing && !cpuTrimmingDevice->isTrimming() && numberOfCpuTrimmingDeviceThreads && !isStaleGraph(jobHeight)) {
+			
+				// Get SipHash keys from job's header and nonce
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) cpuTrimmingDeviceSipHashKeys;
+				const uint64_t cpuTrimmingDeviceNonce = jobNonce++;
+				blake2b(cpuTrimmingDeviceSipHashKeys, jobHeaderMidstate, cpuTrimmingDeviceNonce);
+				
+				// Start CPU trimming device trimming the graph
+				cpuTrimmingDevice->start(cpuTrimmingDeviceSipHashKeys, jobHeight, jobId, cpuTrimmingDeviceNonce, numberOfCpuTrimmingDeviceThreads);
+			}
+			
+			// Set that searching threads are idle
+			cpuTrimmingDevice->searchingThreadsIdle();
+		}
+	#endif
+}
 
-	// Trimming finished
-	void trimmingFinished(const void *__restrict__ data, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, __attribute__((unused)) const uint64_t height, __attribute__((unused)) const uint64_t id, __attribute__((unused)) const uint64_t nonce) noexcept {
-#endif
+// Search trimmed graph
+double searchTrimmedGraph(const void *__restrict__ data, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &__restrict__ sipHashKeys, const uint64_t height, const uint64_t id, const uint64_t nonce) noexcept {
 
 	// Record start time
 	const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
 	
-	// Start searching threads
-	searchingThreadsData = data;
-	searchingThreadsSipHashKeys = &sipHashKeys;
-	searchingThreadsSolution[1] = 0;
-	searchingThreadsFinished = false;
-	startSearchingThreadsTriggerToggle = !startSearchingThreadsTriggerToggle;
-	searchingThreadsLock.unlock();
-	startSearchingThreadsConditionalVariable->notify_all();
-	
-	// Wait until searching threads have finished
-	searchingThreadsLock.lock();
-	searchingThreadsFinishedConditionalVariable->wait(searchingThreadsLock, []() noexcept -> bool {
-	
-		// Return if searching threads have finished
-		return searchingThreadsFinished;
-	});
+	// Set that searching threads didn't find any solutions
+	searchingThreadsNumberOfSolutions = 0;
+	
+	// Check if graph isn't stale (Graphs for a previous block that were trimmed before a new block's job arrived aren't searched)
+	if(!isStaleGraph(height)) {
+	
+		// Start searching threads
+		searchingThreadsData = data;
+		searchingThreadsSipHashKeys = &sipHashKeys;
+		searchingThreadsHeight = height;
+		searchingThreadsStalePhase = 0;
+		searchingThreadsHandoff->start();
+		
+		// Wait until searching threads have finished
+		searchingThreadsHandoff->waitUntilFinished();
+	}
 	
 	// Record end time
 	const chrono::high_resolution_clock::time_point endTime = chrono::high_resolution_clock::now();
 	
+	// Searching finished
+	const double searchingTime = static_cast<chrono::duration<double>>(endTime - startTime).count();
+	searchingFinished(height, id, nonce, endTime, searchingTime);
+	
+	// Return searching time
+	return searchingTime;
+}
+
+// Check if not tuning
+#ifndef TUNING
+
+	// Searching finished
+	void searchingFinished(const uint64_t height, const uint64_t id, const uint64_t nonce, const chrono::high_resolution_clock::time_point &endTime, const double searchingTime) noexcept {
+	
+// Otherwise
+#else
+
+	// Searching finished
+	void searchingFinished(__attribute__((unused)) const uint64_t height, __attribute__((unused)) const uint64_t id, __attribute__((unused)) const uint64_t nonce, const chrono::high_resolution_clock::time_point &endTime, const double searchingTime) noexcept {
+#endif
+
 	// Display message
 	cout << endl << "Mining info:" << endl;
 	
-	// Get if is first graph
-	const bool isFirstGraph = !graphsProcessed;
+	// Check if not tuning
+	#ifndef TUNING
+	
+		// Get if graph is stale
+		const bool graphIsStale = isStaleGraph(height);
+		
+		// Get if is first graph (Stale graphs aren't counted as processed, but they still finish the first graph)
+		const bool isFirstGraph = !graphsProcessed && !staleGraphs;
+		
+	// Otherwise
+	#else
+	
+		// Set graph isn't stale
+		const bool graphIsStale = false;
+		
+		// Get if is first graph
+		const bool isFirstGraph = !graphsProcessed;
+	#endif
 	
 	// Check if is first graph
 	static bool previouslyDisconnectedFromServer;
@@ -3421,20 +4373,27 @@ void stopMiner() noexcept {
 		previouslyWaitedForApplicableJobFromServer = false;
 	}
 	
-	// Check if there's no trimming rounds
-	#if TRIMMING_ROUNDS == 0
+	// Check if graph isn't stale (Stale graphs weren't searched, so they're only displayed in the stale graphs instead of being counted as checked or in the mining rate)
+	if(!graphIsStale) {
 	
-		// Display message
-		cout << "\tMining rate:\t " << (1 / static_cast<chrono::duration<double>>(endTime - previousGraphProcessedTime).count()) << " graph(s)/second" << (previouslyDisconnectedFromServer ? ". This is lower for this graph since it includes the time taken to reconnect to the stratum server" : (previouslyWaitedForApplicableJobFromServer ? ". This is lower for this graph since it includes the time taken to receive an applicable job from the stratum server" : "")) << endl;
+		// Check if there's no trimming rounds
+		#if TRIMMING_ROUNDS == 0
+		
+			// Display message
+			cout << "\tMining rate:\t " << (1 / static_cast<chrono::duration<double>>(endTime - previousGraphProcessedTime).count()) << " graph(s)/second" << (previouslyDisconnectedFromServer ? ". This is lower for this graph since it includes the time taken to reconnect to the stratum server" : (previouslyWaitedForApplicableJobFromServer ? ". This is lower for this graph since it includes the time taken to receive an applicable job from the stratum server" : "")) << endl;
+			
+		// Otherwise
+		#else
+		
+			// Display message
+			cout << "\tMining rate:\t " << (1 / static_cast<chrono::duration<double>>(endTime - previousGraphProcessedTime).count()) << " graph(s)/second" << (!isFirstGraph ? (previouslyDisconnectedFromServer ? ". This is lower for this graph since it includes the time taken to reconnect to the stratum server" : (previouslyWaitedForApplicableJobFromServer ? ". This is lower for this graph since it includes the time taken to receive an applicable job from the stratum server" : "")) : ". This is lower for the first graph since it includes the time taken to prime the pipeline") << endl;
+		#endif
 		
-	// Otherwise
-	#else
-	
 		// Display message
-		cout << "\tMining rate:\t " << (1 / static_cast<chrono::duration<double>>(endTime - previousGraphProcessedTime).count()) << " graph(s)/second" << (graphsProcessed ? (previouslyDisconnectedFromServer ? ". This is lower for this graph since it includes the time taken to reconnect to the stratum server" : (previouslyWaitedForApplicableJobFromServer ? ". This is lower for this graph since it includes the time taken to receive an applicable job from the stratum server" : "")) : ". This is lower for the first graph since it includes the time taken to prime the pipeline") << endl;
-	#endif
+		cout << "\tGraphs checked:\t " << ++graphsProcessed << endl;
+	}
 	
-	// Update previous graph processed time
+	// Update previous graph processed time (The next graph's mining rate doesn't include the time spent on a stale graph)
 	previousGraphProcessedTime = endTime;
 	
 	// Set previously disconnected from server to false
@@ -3443,9 +4402,6 @@ void stopMiner() noexcept {
 	// Set previously waited for applicable job from server to false
 	previouslyWaitedForApplicableJobFromServer = false;
 	
-	// Display message
-	cout << "\tGraphs checked:\t " << ++graphsProcessed << endl;
-	
 	// Check if not tuning
 	#ifndef TUNING
 	
@@ -3461,12 +4417,36 @@ void stopMiner() noexcept {
 			lastKeepAliveTime = endTime;
 		}
 		
+		// Check if graph is stale
+		static double previousSearchingTime;
+		if(graphIsStale) {
+		
+			// Increment stale graphs
+			++staleGraphs;
+			
+			// Add the searching time that wasn't spent on the graph to the stale time saved
+			staleTimeSaved += max(previousSearchingTime - searchingTime, 0.0);
+			
+			// Set that searching threads didn't find any solutions (Solutions for a previous block would be rejected by the stratum server)
+			searchingThreadsNumberOfSolutions = 0;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Update previous searching time
+			previousSearchingTime = searchingTime;
+		}
+		
 		// Set reconnect to server to false
 		bool reconnectToServer = false;
 		
-		// Check if searching threads found a solution
-		if(searchingThreadsSolution[1]) {
+		// Go through all solutions found by the searching threads while not reconnecting to the server
+		for(uint32_t i = 0; i < searchingThreadsNumberOfSolutions && !reconnectToServer; ++i) {
 		
+			// Get solution
+			const uint32_t *solution = searchingThreadsSolutions[i];
+			
 			// Increment solutions found
 			++solutionsFound;
 			
@@ -3475,14 +4455,14 @@ void stopMiner() noexcept {
 			
 				// Create submit request failed
 				char submitRequest[sizeof("{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"job_id\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"nonce\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"pow\":[") - sizeof('\0') + (sizeof("4294967295,") - sizeof('\0')) * SOLUTION_SIZE - sizeof(',') + sizeof("]}}\n")];
-				const int requestSize = snprintf(submitRequest, sizeof(submitRequest), "{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":%" PRIu64 ",\"job_id\":%" PRIu64 ",\"nonce\":%" PRIu64 ",\"pow\":[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "]}}\n", height, id, nonce, searchingThreadsSolution[0], searchingThreadsSolution[1], searchingThreadsSolution[2], searchingThreadsSolution[3], searchingThreadsSolution[4], searchingThreadsSolution[5], searchingThreadsSolution[6], searchingThreadsSolution[7], searchingThreadsSolution[8], searchingThreadsSolution[9], searchingThreadsSolution[10], searchingThreadsSolution[11], searchingThreadsSolution[12], searchingThreadsSolution[13], searchingThreadsSolution[14], searchingThreadsSolution[15], searchingThreadsSolution[16], searchingThreadsSolution[17], searchingThreadsSolution[18], searchingThreadsSolution[19], searchingThreadsSolution[20], searchingThreadsSolution[21], searchingThreadsSolution[22], searchingThreadsSolution[23], searchingThreadsSolution[24], searchingThreadsSolution[25], searchingThreadsSolution[26], searchingThreadsSolution[27], searchingThreadsSolution[28], searchingThreadsSolution[29], searchingThreadsSolution[30], searchingThreadsSolution[31], searchingThreadsSolution[32], searchingThreadsSolution[33], searchingThreadsSolution[34], searchingThreadsSolution[35], searchingThreadsSolution[36], searchingThreadsSolution[37], searchingThreadsSolution[38], searchingThreadsSolution[39], searchingThreadsSolution[40], searchingThreadsSolution[41]);
+				const int requestSize = snprintf(submitRequest, sizeof(submitRequest), "{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":%" PRIu64 ",\"job_id\":%" PRIu64 ",\"nonce\":%" PRIu64 ",\"pow\":[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "]}}\n", height, id, nonce, solution[0], solution[1], solution[2], solution[3], solution[4], solution[5], solution[6], solution[7], solution[8], solution[9], solution[10], solution[11], solution[12], solution[13], solution[14], solution[15], solution[16], solution[17], solution[18], solution[19], solution[20], solution[21], solution[22], solution[23], solution[24], solution[25], solution[26], solution[27], solution[28], solution[29], solution[30], solution[31], solution[32], solution[33], solution[34], solution[35], solution[36], solution[37], solution[38], solution[39], solution[40], solution[41]);
 				
 			// Otherwise
 			#else
 			
 				// Create submit request failed
 				char submitRequest[sizeof("{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"height\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"job_id\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"nonce\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"pow\":{\"" TO_STRING(STRATUM_SERVER_MINING_ALGORITHM_NAME) "\":[" TO_STRING(EDGE_BITS) ",[") - sizeof('\0') + (sizeof("4294967295,") - sizeof('\0')) * SOLUTION_SIZE - sizeof(',') + sizeof("]]}}}\n")];
-				const int requestSize = snprintf(submitRequest, sizeof(submitRequest), "{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"height\":%" PRIu64 ",\"job_id\":%" PRIu64 ",\"nonce\":%" PRIu64 ",\"pow\":{\"" TO_STRING(STRATUM_SERVER_MINING_ALGORITHM_NAME) "\":[" TO_STRING(EDGE_BITS) ",[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "]]}}}\n", height, id, nonce, searchingThreadsSolution[0], searchingThreadsSolution[1], searchingThreadsSolution[2], searchingThreadsSolution[3], searchingThreadsSolution[4], searchingThreadsSolution[5], searchingThreadsSolution[6], searchingThreadsSolution[7], searchingThreadsSolution[8], searchingThreadsSolution[9], searchingThreadsSolution[10], searchingThreadsSolution[11], searchingThreadsSolution[12], searchingThreadsSolution[13], searchingThreadsSolution[14], searchingThreadsSolution[15], searchingThreadsSolution[16], searchingThreadsSolution[17], searchingThreadsSolution[18], searchingThreadsSolution[19], searchingThreadsSolution[20], searchingThreadsSolution[21], searchingThreadsSolution[22], searchingThreadsSolution[23], searchingThreadsSolution[24], searchingThreadsSolution[25], searchingThreadsSolution[26], searchingThreadsSolution[27], searchingThreadsSolution[28], searchingThreadsSolution[29], searchingThreadsSolution[30], searchingThreadsSolution[31], searchingThreadsSolution[32], searchingThreadsSolution[33], searchingThreadsSolution[34], searchingThreadsSolution[35], searchingThreadsSolution[36], searchingThreadsSolution[37], searchingThreadsSolution[38], searchingThreadsSolution[39], searchingThreadsSolution[40], searchingThreadsSolution[41]);
+				const int requestSize = snprintf(submitRequest, sizeof(submitRequest), "{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"height\":%" PRIu64 ",\"job_id\":%" PRIu64 ",\"nonce\":%" PRIu64 ",\"pow\":{\"" TO_STRING(STRATUM_SERVER_MINING_ALGORITHM_NAME) "\":[" TO_STRING(EDGE_BITS) ",[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "]]}}}\n", height, id, nonce, solution[0], solution[1], solution[2], solution[3], solution[4], solution[5], solution[6], solution[7], solution[8], solution[9], solution[10], solution[11], solution[12], solution[13], solution[14], solution[15], solution[16], solution[17], solution[18], solution[19], solution[20], solution[21], solution[22], solution[23], solution[24], solution[25], solution[26], solution[27], solution[28], solution[29], solution[30], solution[31], solution[32], solution[33], solution[34], solution[35], solution[36], solution[37], solution[38], solution[39], solution[40], solution[41]);
 			#endif
 			
 			// Check if creating submit request failed
@@ -3513,6 +4493,13 @@ void stopMiner() noexcept {
 		// Display message
 		cout << "\tSolutions found: " << solutionsFound << endl;
 		
+		// Check if stale graphs exist
+		if(staleGraphs) {
+		
+			// Display message
+			cout << "\tStale graphs:\t " << staleGraphs << " abandoned for new blocks, saving " << staleTimeSaved << " second(s)" << endl;
+		}
+		
 		// Check if not reconnecting to the server and it's time to send a keep alive request to the stratum server
 		if(!reconnectToServer && endTime - lastKeepAliveTime >= SEND_KEEP_ALIVE_REQUEST_INTERVAL) {
 		
@@ -3689,6 +4676,13 @@ void stopMiner() noexcept {
 			// Display message
 			cout << "Disconnected from the stratum server." << endl;
 			
+			// Check if the stratum server watcher exists
+			if(stratumServerWatcher) {
+			
+				// Pause stratum server watcher
+				stratumServerWatcher->pause();
+			}
+			
 			// Loop while not closing, not connecting to server, and not closing
 			while(!closing && !connectToServer() && !closing) {
 			
@@ -3709,6 +4703,13 @@ void stopMiner() noexcept {
 				#endif
 			}
 			
+			// Check if the stratum server watcher exists
+			if(stratumServerWatcher) {
+			
+				// Resume stratum server watcher
+				stratumServerWatcher->resume();
+			}
+			
 			// Set previously disconnected from server to true
 			previouslyDisconnectedFromServer = true;
 			
@@ -3718,12 +4719,151 @@ void stopMiner() noexcept {
 			// Update last keep alive time
 			lastKeepAliveTime = chrono::high_resolution_clock::now();
 		}
+		
+		// Set newest job height to the job's height (All responses from the stratum server that the stratum server watcher looked at have been received)
+		newestJobHeight.store(jobHeight, memory_order_relaxed);
+		
+		// Check if the stratum server watcher exists
+		if(stratumServerWatcher) {
+		
+			// Set that the stratum server watcher's responses were received
+			stratumServerWatcher->responsesReceived();
+		}
 	#endif
 	
 	// Display message
-	cout << "Pipeline stages:" << endl << "\tSearching time:\t " << static_cast<chrono::duration<double>>(endTime - startTime).count() << " second(s)" << endl;
+	cout << "Pipeline stages:" << endl << "\tSearching time:\t " << searchingTime << " second(s)" << endl;
+	
+	// Check if searching threads scheduler exists
+	if(searchingThreadsScheduler) {
+	
+		// Display message
+		cout << "\tIdle time:\t ";
+		
+		// Go through all searching threads
+		for(unsigned int i = 0; i < searchingThreadsScheduler->getNumberOfThreads(); ++i) {
+		
+			// Display message
+			cout << (i ? ", " : "") << searchingThreadsScheduler->getIdleTime(i);
+		}
+		
+		// Display message
+		cout << " second(s)" << endl;
+		
+		// Reset searching threads' idle times
+		searchingThreadsScheduler->resetIdleTimes();
+	}
+}
+
+// Add searching threads solutions
+void addSearchingThreadsSolutions(const uint32_t solutions[][SOLUTION_SIZE], const uint32_t numberOfSolutions) noexcept {
+
+	// Go through all solutions while the searching threads solutions aren't full
+	for(uint32_t i = 0; i < numberOfSolutions && searchingThreadsNumberOfSolutions != MAX_NUMBER_OF_SOLUTIONS_PER_GRAPH; ++i) {
+	
+		// Go through all searching threads solutions while the solution isn't found in them
+		bool solutionIsDuplicate = false;
+		for(uint32_t j = 0; j < searchingThreadsNumberOfSolutions && !solutionIsDuplicate; ++j) {
+		
+			// Set solution is duplicate to if the solution is the searching threads solution
+			solutionIsDuplicate = !memcmp(solutions[i], searchingThreadsSolutions[j], sizeof(searchingThreadsSolutions[j]));
+		}
+		
+		// Check if solution isn't a duplicate
+		if(!solutionIsDuplicate) {
+		
+			// Append solution to the searching threads solutions
+			memcpy(searchingThreadsSolutions[searchingThreadsNumberOfSolutions++], solutions[i], sizeof(searchingThreadsSolutions[0]));
+		}
+	}
+}
+
+// Set searching threads edges' nodes
+void setSearchingThreadsEdgesNodes(uint32_t *edges, const uint_fast8_t numberOfEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys) noexcept {
+
+	// Throw error if searching threads number of edges per SipHash is invalid
+	static_assert(SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH && BITMAP_UNIT_WIDTH % SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH == 0, "Searching threads number of edges per SipHash is invalid");
+	
+	// Go through all edges
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH * 2))) nonces = {};
+	for(uint_fast8_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Set edge's nonces from its index
+		nonces[i * 2] = static_cast<uint64_t>(edges[i * EDGE_NUMBER_OF_COMPONENTS]) * 2;
+		nonces[i * 2 + 1] = (static_cast<uint64_t>(edges[i * EDGE_NUMBER_OF_COMPONENTS]) * 2) | 1;
+	}
+	
+	// Get nodes from the nonces
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH * 2))) nodes;
+	sipHash24<SEARCHING_THREADS_NUMBER_OF_EDGES_PER_SIPHASH * 2>(&nodes, sipHashKeys, &nonces);
+	
+	// Go through all edges
+	for(uint_fast8_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Set edge's nodes
+		edges[i * EDGE_NUMBER_OF_COMPONENTS + 1] = nodes[i * 2];
+		edges[i * EDGE_NUMBER_OF_COMPONENTS + 2] = nodes[i * 2 + 1];
+	}
+}
+
+// Is stale graph
+bool isStaleGraph(const uint64_t height) noexcept {
+
+	// Return if a job for a different block than the graph's was received
+	return newestJobHeight.load(memory_order_relaxed) != height;
+}
+
+// Mark stale searching phase
+void markStaleSearchingPhase(uint8_t &stalePhase, const SearchingPhase phase, const uint64_t height, const unsigned int searchingThreadIndex) noexcept {
+
+	// Check if the first searching thread, no phase is stale, and the graph is stale
+	if(!searchingThreadIndex && !atomic_ref<uint8_t>(stalePhase).load(memory_order_relaxed) && isStaleGraph(height)) {
+	
+		// Set stale phase to the phase (The searching threads only check this after all of them have crossed one of the phase's barriers, so they all stop after the same phase)
+		atomic_ref<uint8_t>(stalePhase).store(phase, memory_order_relaxed);
+	}
+}
+
+// Is stale searching phase
+bool isStaleSearchingPhase(const uint8_t &stalePhase, const SearchingPhase phase) noexcept {
+
+	// Return if the phase or a previous phase is stale
+	const uint8_t currentStalePhase = atomic_ref<const uint8_t>(stalePhase).load(memory_order_relaxed);
+	return currentStalePhase && currentStalePhase <= phase;
 }
 
+// Check if using CPU feature dispatch
+#ifdef USE_CPU_FEATURE_DISPATCH
+
+	// Get CPU feature dispatch variant
+	const char *getCpuFeatureDispatchVariant() noexcept {
+	
+		// Check if CPU supports x86-64-v4
+		if(__builtin_cpu_supports("x86-64-v4")) {
+		
+			// Return x86-64-v4
+			return "x86-64-v4";
+		}
+		
+		// Check if CPU supports x86-64-v3
+		if(__builtin_cpu_supports("x86-64-v3")) {
+		
+			// Return x86-64-v3
+			return "x86-64-v3";
+		}
+		
+		// Check if CPU supports x86-64-v2
+		if(__builtin_cpu_supports("x86-64-v2")) {
+		
+			// Return x86-64-v2
+			return "x86-64-v2";
+		}
+		
+		// Return x86-64
+		return "x86-64";
+	}
+#endif
+
 // Check if not tuning
 #ifndef TUNING
 
@@ -4444,11 +5584,14 @@ void stopMiner() noexcept {
 			// Set job's height to new job's height
 			jobHeight = newJobHeight;
 			
+			// Set newest job height to the job's height
+			newestJobHeight.store(jobHeight, memory_order_relaxed);
+			
 			// Set job's ID to new job's ID
 			jobId = newJobId;
 			
-			// Set job's header to new job's header
-			memcpy(jobHeader, newJobHeader, sizeof(newJobHeader));
+			// Set job's header midstate to new job's header's midstate
+			setBlake2bMidstate(jobHeaderMidstate, newJobHeader);
 			
 			// Check if stratum server uses more than one mining algorithm
 			#if STRATUM_SERVER_NUMBER_OF_MINING_ALGORITHMS != 1
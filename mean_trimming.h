@@ -40,13 +40,13 @@ using namespace std;
 #if defined __APPLE__ && !defined USE_OPENCL
 
 	// Mean trimming required RAM bytes
-	#define MEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + static_cast<uint64_t>(MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) * 2 + (sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t)) * 2)
+	#define MEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + static_cast<uint64_t>(MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) * 2 + (sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t)) * REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS)
 	
 // Otherwise
 #else
 
 	// Mean trimming required RAM bytes
-	#define MEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + static_cast<uint64_t>(MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) * 2 + (sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint)) * 2)
+	#define MEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(MEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + static_cast<uint64_t>(MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) * 2 + (sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint)) * REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS)
 #endif
 
 // Mean trimming required work group RAM bytes
@@ -71,7 +71,7 @@ using namespace std;
 #else
 
 	// Create mean trimming context
-	static inline cl_context createMeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const unsigned int deviceIndex) noexcept;
+	static inline cl_context createMeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const cl_device_type deviceTypes, const unsigned int deviceIndex) noexcept;
 	
 	// Perform mean trimming loop
 	static inline bool performMeanTrimmingLoop(const cl_context context) noexcept;
@@ -171,7 +171,7 @@ using namespace std;
 #else
 
 	// Create mean trimming context
-	cl_context createMeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const unsigned int deviceIndex) noexcept {
+	cl_context createMeanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const cl_device_type deviceTypes, const unsigned int deviceIndex) noexcept {
 	
 		// Set index to zero
 		unsigned int index = 0;
@@ -181,11 +181,11 @@ using namespace std;
 			
 			// Check if getting platform's number of devices was successful and devices exist
 			cl_uint numberOfDevices;
-			if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
+			if(clGetDeviceIDs(platforms[i], deviceTypes, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
 			
 				// Check if getting platform's devices was successful
 				cl_device_id devices[numberOfDevices];
-				if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
+				if(clGetDeviceIDs(platforms[i], deviceTypes, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
 				
 					// Go through all of the platform's devices
 					for(cl_uint j = 0; j < numberOfDevices; ++j) {
@@ -1016,7 +1016,7 @@ using namespace std;
 			// Free remaining edges two
 			remainingEdgesTwo->release();
 		});
-		if(!bucketsOne || (bucketsOneNumberOfBuckets != MEAN_TRIMMING_NUMBER_OF_BUCKETS && !bucketsOneSecondPart) || !bucketsTwo || !numberOfEdgesPerBucketOne || !numberOfEdgesPerBucketTwo || !remainingEdgesOne || !remainingEdgesTwo) {
+		if(!bucketsOne || (bucketsOneNumberOfBuckets != MEAN_TRIMMING_NUMBER_OF_BUCKETS && !bucketsOneSecondPart) || !bucketsTwo || !numberOfEdgesPerBucketOne || !numberOfEdgesPerBucketTwo) {
 		
 			// Display message
 			cout << "Allocating memory on the GPU failed." << endl;
@@ -1101,7 +1101,7 @@ using namespace std;
 		uint64_t heightOne = jobHeight;
 		uint64_t idOne = jobId;
 		uint64_t nonceOne = jobNonce++;
-		blake2b(sipHashKeysOne, jobHeader, nonceOne);
+		blake2b(sipHashKeysOne, jobHeaderMidstate, nonceOne);
 		
 		// Clear the beginning of remaining edges one
 		reinterpret_cast<uint32_t *>(remainingEdgesOne->contents())[0] = 0;
@@ -1282,7 +1282,7 @@ using namespace std;
 		uint64_t heightTwo = jobHeight;
 		uint64_t idTwo = jobId;
 		uint64_t nonceTwo = jobNonce++;
-		blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
+		blake2b(sipHashKeysTwo, jobHeaderMidstate, nonceTwo);
 		
 		// Clear the beginning of remaining edges two
 		reinterpret_cast<uint32_t *>(remainingEdgesTwo->contents())[0] = 0;
@@ -1461,7 +1461,7 @@ using namespace std;
 			heightOne = jobHeight;
 			idOne = jobId;
 			nonceOne = jobNonce++;
-			blake2b(sipHashKeysOne, jobHeader, nonceOne);
+			blake2b(sipHashKeysOne, jobHeaderMidstate, nonceOne);
 			
 			// Clear the beginning of remaining edges one
 			reinterpret_cast<uint32_t *>(remainingEdgesOne->contents())[0] = 0;
@@ -1644,7 +1644,7 @@ using namespace std;
 			heightTwo = jobHeight;
 			idTwo = jobId;
 			nonceTwo = jobNonce++;
-			blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
+			blake2b(sipHashKeysTwo, jobHeaderMidstate, nonceTwo);
 			
 			// Clear the beginning of remaining edges two
 			reinterpret_cast<uint32_t *>(remainingEdgesTwo->contents())[0] = 0;
@@ -1782,11 +1782,11 @@ using namespace std;
 			return false;
 		}
 		
-		// Check if getting device's max work group size, max memory allocation size, or work group memory size failed, or its max work group size don't exists
+		// Check if getting device's max work group size, max memory allocation size, or work group memory size failed
 		size_t maxWorkGroupSize;
 		cl_ulong maxMemoryAllocationSize;
 		cl_ulong workGroupMemorySize;
-		if(clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(maxWorkGroupSize), &maxWorkGroupSize, nullptr) != CL_SUCCESS || clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxMemoryAllocationSize), &maxMemoryAllocationSize, nullptr) != CL_SUCCESS || clGetDeviceInfo(device, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(workGroupMemorySize), &workGroupMemorySize, nullptr) != CL_SUCCESS || !maxWorkGroupSize) {
+		if(!getOpenClDeviceMaxWorkGroupSize(device, maxWorkGroupSize) || clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxMemoryAllocationSize), &maxMemoryAllocationSize, nullptr) != CL_SUCCESS || !getOpenClDeviceWorkGroupMemorySize(device, workGroupMemorySize)) {
 		
 			// Display message
 			cout << "Getting GPU's info failed." << endl;
@@ -1978,822 +1978,52 @@ using namespace std;
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> bucketsTwo(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, static_cast<uint64_t>(MEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) * MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> numberOfEdgesPerBucketOne(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> numberOfEdgesPerBucketTwo(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
-		static unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> remainingEdgesOne(nullptr, clReleaseMemObject);
-		remainingEdgesOne = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
-		static unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> remainingEdgesTwo(nullptr, clReleaseMemObject);
-		remainingEdgesTwo = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
-		if(!bucketsOne || (bucketsOneNumberOfBuckets != MEAN_TRIMMING_NUMBER_OF_BUCKETS && !bucketsOneSecondPart) || !bucketsTwo || !numberOfEdgesPerBucketOne || !numberOfEdgesPerBucketTwo || !remainingEdgesOne || !remainingEdgesTwo) {
+		if(!bucketsOne || (bucketsOneNumberOfBuckets != MEAN_TRIMMING_NUMBER_OF_BUCKETS && !bucketsOneSecondPart) || !bucketsTwo || !numberOfEdgesPerBucketOne || !numberOfEdgesPerBucketTwo) {
 		
 			// Display message
 			cout << "Allocating memory on the GPU failed." << endl;
 			
-			// Free remaining edges one and two
-			remainingEdgesOne.reset();
-			remainingEdgesTwo.reset();
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if creating command queue for the device failed
-		static uint32_t *resultOne = nullptr;
-		static uint32_t *resultTwo = nullptr;
-		const unique_ptr<remove_pointer<cl_command_queue>::type, void(*)(cl_command_queue)> commandQueue(clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, nullptr), [](cl_command_queue commandQueue) noexcept {
-		
-			// Wait for all commands in the queue to finish
-			clFinish(commandQueue);
-			
-			// Check if result one exists
-			if(resultOne) {
-			
-				// Queue unmapping result one
-				clEnqueueUnmapMemObject(commandQueue, remainingEdgesOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr);
-			}
-			
-			// Check if result two exists
-			if(resultTwo) {
-			
-				// Queue unmapping result two
-				clEnqueueUnmapMemObject(commandQueue, remainingEdgesTwo.get(), reinterpret_cast<void *>(resultTwo), 0, nullptr, nullptr);
-			}
-			
-			// Wait for all commands in the queue to finish
-			clFinish(commandQueue);
-			
-			// Free command queue
-			clReleaseCommandQueue(commandQueue);
-			
-			// Reset result one and two
-			resultOne = nullptr;
-			resultTwo = nullptr;
-			
-			// Free remaining edges one and two
-			remainingEdgesOne.reset();
-			remainingEdgesTwo.reset();
-		});
-		if(!commandQueue) {
-		
-			// Display message
-			cout << "Creating command queue for the GPU failed." << endl;
-			
-			// Free remaining edges one and two
-			remainingEdgesOne.reset();
-			remainingEdgesTwo.reset();
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's unchanging arguments failed
-		if(clSetKernelArg(stepOneKernel.get(), 0, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 1, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 0, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 1, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(bucketsTwo.get()), &unmove(bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 3, sizeof(numberOfEdgesPerBucketTwo.get()), &unmove(numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 0, sizeof(bucketsTwo.get()), &unmove(bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 1, sizeof(numberOfEdgesPerBucketTwo.get()), &unmove(numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 2, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 1, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 2, sizeof(bucketsTwo.get()), &unmove(bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(numberOfEdgesPerBucketTwo.get()), &unmove(numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS || clSetKernelArg(stepSixKernel.get(), 0, (TRIMMING_ROUNDS % 2) ? sizeof(bucketsTwo.get()) : sizeof(bucketsOne.get()), &unmove((TRIMMING_ROUNDS % 2) ? bucketsTwo.get() : bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepSixKernel.get(), 1, (TRIMMING_ROUNDS % 2) ? sizeof(numberOfEdgesPerBucketTwo.get()) : sizeof(numberOfEdgesPerBucketOne.get()), &unmove((TRIMMING_ROUNDS % 2) ? numberOfEdgesPerBucketTwo.get() : numberOfEdgesPerBucketOne.get())) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if using buckets one second part
-		if(bucketsOneNumberOfBuckets != MEAN_TRIMMING_NUMBER_OF_BUCKETS) {
-		
-			// Check if setting program's unchanging arguments failed
-			if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(bucketsOneSecondPart.get()), &unmove(bucketsOneSecondPart.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 5, sizeof(bucketsOneSecondPart.get()), &unmove(bucketsOneSecondPart.get())) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Display message
-		cout << "Mining started" << endl << endl << "Mining info:" << endl << "\tMining rate:\t 0 graph(s)/second" << endl << "\tGraphs checked:\t 0" << endl;
-		
-		// Check if not tuning
-		#ifndef TUNING
-		
-			// Display message
-			cout << "\tSolutions found: 0" << endl;
-		#endif
-		
-		// Display message
-		cout << "Pipeline stages:" << endl;
-		
-		// Set previous graph processed time to now
-		previousGraphProcessedTime = chrono::high_resolution_clock::now();
-		
-		// Check if queuing clearing number of edges per bucket one on the device failed
-		Event firstCommandEvent;
-		if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Get SipHash keys from job's header and nonce
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeysOne;
-		uint64_t heightOne = jobHeight;
-		uint64_t idOne = jobId;
-		uint64_t nonceOne = jobNonce++;
-		blake2b(sipHashKeysOne, jobHeader, nonceOne);
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step one on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing clearing number of edges per bucket two on the device failed
-		if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepTwoKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step two on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if trimming more than one round
-		if(TRIMMING_ROUNDS > 1) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepThreeKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step three on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if trimming more than two rounds
-			if(TRIMMING_ROUNDS > 2) {
-			
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepFourKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step four on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Go through all remaining trimming rounds
-				for(unsigned int i = 3; i < TRIMMING_ROUNDS; ++i) {
-				
-					// Check if queuing clearing number of edges per bucket on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), (i % 2) ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's source buckets, number of edges per source bucket, destination buckets, or number of edges per destination bucket arguments failed
-					if(clSetKernelArg(stepFiveKernel.get(), 0, (i % 2) ? sizeof(bucketsTwo.get()) : sizeof(bucketsOne.get()), &unmove((i % 2) ? bucketsTwo.get() : bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 1, (i % 2) ? sizeof(numberOfEdgesPerBucketTwo.get()) : sizeof(numberOfEdgesPerBucketOne.get()), &unmove((i % 2) ? numberOfEdgesPerBucketTwo.get() : numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 2, (i % 2) ? sizeof(bucketsOne.get()) : sizeof(bucketsTwo.get()), &unmove((i % 2) ? bucketsOne.get() : bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, (i % 2) ? sizeof(numberOfEdgesPerBucketOne.get()) : sizeof(numberOfEdgesPerBucketTwo.get()), &unmove((i % 2) ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step five on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-			}
-		}
-		
-		// Check if queuing clearing the beginning of remaining edges one on the device failed
-		if(clEnqueueFillBuffer(commandQueue.get(), remainingEdgesOne.get(), (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's remaining edges argument failed
-		if(clSetKernelArg(stepSixKernel.get(), 2, sizeof(remainingEdgesOne.get()), &unmove(remainingEdgesOne.get())) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if trimming rounds is less than three
-		if(TRIMMING_ROUNDS < 3) {
-		
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Check if queuing running step six on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[5], &workItemsPerWorkGroup[5], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing map result failed
-		Event mapEvent;
-		resultOne = reinterpret_cast<uint32_t *>(clEnqueueMapBuffer(commandQueue.get(), remainingEdgesOne.get(), CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), 0, nullptr, mapEvent.getAddress(), nullptr));
-		if(!resultOne) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if closing
-		if(closing) {
-			
-			// Return true
-			return true;
-		}
-		
-		// Check if waiting for map event to finish failed
-		if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if getting trimming time failed
-		cl_ulong startTime;
-		cl_ulong endTime;
-		if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting GPU trimming time failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Display message
-		cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-		
-		// Check if queuing clearing number of edges per bucket one on the device failed
-		firstCommandEvent.free();
-		if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Get SipHash keys from job's header and nonce
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeysTwo;
-		uint64_t heightTwo = jobHeight;
-		uint64_t idTwo = jobId;
-		uint64_t nonceTwo = jobNonce++;
-		blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step one on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing clearing number of edges per bucket two on the device failed
-		if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepTwoKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step two on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if trimming more than one round
-		if(TRIMMING_ROUNDS > 1) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepThreeKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step three on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if trimming more than two rounds
-			if(TRIMMING_ROUNDS > 2) {
-			
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepFourKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step four on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Go through all remaining trimming rounds
-				for(unsigned int i = 3; i < TRIMMING_ROUNDS; ++i) {
-				
-					// Check if queuing clearing number of edges per bucket on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), (i % 2) ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's source buckets, number of edges per source bucket, destination buckets, or number of edges per destination bucket arguments failed
-					if(clSetKernelArg(stepFiveKernel.get(), 0, (i % 2) ? sizeof(bucketsTwo.get()) : sizeof(bucketsOne.get()), &unmove((i % 2) ? bucketsTwo.get() : bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 1, (i % 2) ? sizeof(numberOfEdgesPerBucketTwo.get()) : sizeof(numberOfEdgesPerBucketOne.get()), &unmove((i % 2) ? numberOfEdgesPerBucketTwo.get() : numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 2, (i % 2) ? sizeof(bucketsOne.get()) : sizeof(bucketsTwo.get()), &unmove((i % 2) ? bucketsOne.get() : bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, (i % 2) ? sizeof(numberOfEdgesPerBucketOne.get()) : sizeof(numberOfEdgesPerBucketTwo.get()), &unmove((i % 2) ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step five on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-			}
-		}
-		
-		// Check if queuing clearing the beginning of remaining edges two on the device failed
-		if(clEnqueueFillBuffer(commandQueue.get(), remainingEdgesTwo.get(), (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's remaining edge argument failed
-		if(clSetKernelArg(stepSixKernel.get(), 2, sizeof(remainingEdgesTwo.get()), &unmove(remainingEdgesTwo.get())) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if trimming rounds is less than three
-		if(TRIMMING_ROUNDS < 3) {
-		
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Check if queuing running step six on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[5], &workItemsPerWorkGroup[5], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing map result failed
-		mapEvent.free();
-		resultTwo = reinterpret_cast<uint32_t *>(clEnqueueMapBuffer(commandQueue.get(), remainingEdgesTwo.get(), CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), 0, nullptr, mapEvent.getAddress(), nullptr));
-		if(!resultTwo) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Perform commands in queue
-		clFlush(commandQueue.get());
-		
-		// Trimming finished
-		trimmingFinished(resultOne, sipHashKeysOne, heightOne, idOne, nonceOne);
-		
-		// Check if queuing unmap result failed
-		if(clEnqueueUnmapMemObject(commandQueue.get(), remainingEdgesOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Set that result one doesn't exist
-		resultOne = nullptr;
-		
-		// While not closing
-		while(!closing) {
-		
-			// Check if waiting for map event to finish failed
-			if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if getting trimming time failed
-			if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting GPU trimming time failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Display message
-			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-			
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			firstCommandEvent.free();
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Get SipHash keys from job's header and nonce
-			heightOne = jobHeight;
-			idOne = jobId;
-			nonceOne = jobNonce++;
-			blake2b(sipHashKeysOne, jobHeader, nonceOne);
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing clearing number of edges per bucket two on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepTwoKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step two on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if trimming more than one round
-			if(TRIMMING_ROUNDS > 1) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepThreeKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step three on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if trimming more than two rounds
-				if(TRIMMING_ROUNDS > 2) {
-				
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFourKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step four on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Go through all remaining trimming rounds
-					for(unsigned int i = 3; i < TRIMMING_ROUNDS; ++i) {
-					
-						// Check if queuing clearing number of edges per bucket on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), (i % 2) ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's source buckets, number of edges per source bucket, destination buckets, or number of edges per destination bucket arguments failed
-						if(clSetKernelArg(stepFiveKernel.get(), 0, (i % 2) ? sizeof(bucketsTwo.get()) : sizeof(bucketsOne.get()), &unmove((i % 2) ? bucketsTwo.get() : bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 1, (i % 2) ? sizeof(numberOfEdgesPerBucketTwo.get()) : sizeof(numberOfEdgesPerBucketOne.get()), &unmove((i % 2) ? numberOfEdgesPerBucketTwo.get() : numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 2, (i % 2) ? sizeof(bucketsOne.get()) : sizeof(bucketsTwo.get()), &unmove((i % 2) ? bucketsOne.get() : bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, (i % 2) ? sizeof(numberOfEdgesPerBucketOne.get()) : sizeof(numberOfEdgesPerBucketTwo.get()), &unmove((i % 2) ? numberOfEdgesPerBucketOne.get() : numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step five on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-				}
-			}
+			// Return false
+			return false;
+		}
+		
+		// Check if creating command queue for the device failed
+		const unique_ptr<remove_pointer<cl_command_queue>::type, decltype(&clReleaseCommandQueue)> commandQueue(clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, nullptr), clReleaseCommandQueue);
+		if(!commandQueue) {
+		
+			// Display message
+			cout << "Creating command queue for the GPU failed." << endl;
 			
-			// Check if queuing clearing the beginning of remaining edges one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), remainingEdgesOne.get(), (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
+			// Return false
+			return false;
+		}
+		
+		// Check if allocating memory for the remaining edges ring buffer on the device failed
+		RemainingEdgesRingBuffer remainingEdgesRingBuffer(context, commandQueue.get());
+		if(!remainingEdgesRingBuffer) {
+		
+			// Display message
+			cout << "Allocating memory on the GPU failed." << endl;
 			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
+			// Return false
+			return false;
+		}
+		
+		// Check if setting program's unchanging arguments failed
+		if(clSetKernelArg(stepOneKernel.get(), 0, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 1, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 0, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 1, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 2, sizeof(bucketsTwo.get()), &unmove(bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 3, sizeof(numberOfEdgesPerBucketTwo.get()), &unmove(numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 0, sizeof(bucketsTwo.get()), &unmove(bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 1, sizeof(numberOfEdgesPerBucketTwo.get()), &unmove(numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 2, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepThreeKernel.get(), 3, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 0, sizeof(bucketsOne.get()), &unmove(bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 1, sizeof(numberOfEdgesPerBucketOne.get()), &unmove(numberOfEdgesPerBucketOne.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 2, sizeof(bucketsTwo.get()), &unmove(bucketsTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFourKernel.get(), 3, sizeof(numberOfEdgesPerBucketTwo.get()), &unmove(numberOfEdgesPerBucketTwo.get())) != CL_SUCCESS || clSetKernelArg(stepSixKernel.get(), 0, (TRIMMING_ROUNDS % 2) ? sizeof(bucketsTwo.get()) : sizeof(bucketsOne.get()), &unmove((TRIMMING_ROUNDS % 2) ? bucketsTwo.get() : bucketsOne.get())) != CL_SUCCESS || clSetKernelArg(stepSixKernel.get(), 1, (TRIMMING_ROUNDS % 2) ? sizeof(numberOfEdgesPerBucketTwo.get()) : sizeof(numberOfEdgesPerBucketOne.get()), &unmove((TRIMMING_ROUNDS % 2) ? numberOfEdgesPerBucketTwo.get() : numberOfEdgesPerBucketOne.get())) != CL_SUCCESS) {
+		
+			// Display message
+			cout << "Setting program's arguments on the GPU failed." << endl;
 			
-			// Check if setting program's remaining edge argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 2, sizeof(remainingEdgesOne.get()), &unmove(remainingEdgesOne.get())) != CL_SUCCESS) {
+			// Return false
+			return false;
+		}
+		
+		// Check if using buckets one second part
+		if(bucketsOneNumberOfBuckets != MEAN_TRIMMING_NUMBER_OF_BUCKETS) {
+		
+			// Check if setting program's unchanging arguments failed
+			if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(bucketsOneSecondPart.get()), &unmove(bucketsOneSecondPart.get())) != CL_SUCCESS || clSetKernelArg(stepTwoKernel.get(), 5, sizeof(bucketsOneSecondPart.get()), &unmove(bucketsOneSecondPart.get())) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -2801,95 +2031,29 @@ using namespace std;
 				// Return false
 				return false;
 			}
-			
-			// Check if trimming rounds is less than three
-			if(TRIMMING_ROUNDS < 3) {
-			
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepSixKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Check if queuing running step six on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[5], &workItemsPerWorkGroup[5], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing map result failed
-			mapEvent.free();
-			resultOne = reinterpret_cast<uint32_t *>(clEnqueueMapBuffer(commandQueue.get(), remainingEdgesOne.get(), CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), 0, nullptr, mapEvent.getAddress(), nullptr));
-			if(!resultOne) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Perform commands in queue
-			clFlush(commandQueue.get());
-			
-			// Trimming finished
-			trimmingFinished(resultTwo, sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
-			
-			// Check if queuing unmap result failed
-			if(clEnqueueUnmapMemObject(commandQueue.get(), remainingEdgesTwo.get(), reinterpret_cast<void *>(resultTwo), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Set that result two doesn't exist
-			resultTwo = nullptr;
-			
-			// Check if closing
-			if(closing) {
-			
-				// Return true
-				return true;
-			}
-			
-			// Check if waiting for map event to finish failed
-			if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if getting trimming time failed
-			if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting GPU trimming time failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
+		}
+		
+		// Display message
+		cout << "Mining started" << endl << endl << "Mining info:" << endl << "\tMining rate:\t 0 graph(s)/second" << endl << "\tGraphs checked:\t 0" << endl;
+		
+		// Check if not tuning
+		#ifndef TUNING
+		
 			// Display message
-			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-			
+			cout << "\tSolutions found: 0" << endl;
+		#endif
+		
+		// Display message
+		cout << "Pipeline stages:" << endl;
+		
+		// Set previous graph processed time to now
+		previousGraphProcessedTime = chrono::high_resolution_clock::now();
+		
+		// Perform trimming with the remaining edges ring buffer
+		return remainingEdgesRingBuffer.perform([&](const cl_mem remainingEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, cl_event *firstCommandEvent) noexcept -> bool {
+		
 			// Check if queuing clearing number of edges per bucket one on the device failed
-			firstCommandEvent.free();
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
+			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Preparing program's arguments on the GPU failed." << endl;
@@ -2898,14 +2062,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Get SipHash keys from job's header and nonce
-			heightTwo = jobHeight;
-			idTwo = jobId;
-			nonceTwo = jobNonce++;
-			blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
-			
 			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+			if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -2929,17 +2087,17 @@ using namespace std;
 			
 				// Display message
 				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
+			
 				// Return false
 				return false;
 			}
 			
 			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepTwoKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+			if(clSetKernelArg(stepTwoKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
-				
+			
 				// Return false
 				return false;
 			}
@@ -2968,7 +2126,7 @@ using namespace std;
 				}
 				
 				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepThreeKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+				if(clSetKernelArg(stepThreeKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 				
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
@@ -2992,7 +2150,7 @@ using namespace std;
 				
 					// Check if queuing clearing number of edges per bucket two on the device failed
 					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (MEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, MEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
+				
 						// Display message
 						cout << "Preparing program's arguments on the GPU failed." << endl;
 						
@@ -3001,7 +2159,7 @@ using namespace std;
 					}
 					
 					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFourKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+					if(clSetKernelArg(stepFourKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 					
 						// Display message
 						cout << "Setting program's arguments on the GPU failed." << endl;
@@ -3019,7 +2177,7 @@ using namespace std;
 						// Return false
 						return false;
 					}
-					
+				
 					// Go through all remaining trimming rounds
 					for(unsigned int i = 3; i < TRIMMING_ROUNDS; ++i) {
 					
@@ -3056,8 +2214,8 @@ using namespace std;
 				}
 			}
 			
-			// Check if queuing clearing the beginning of remaining edges two on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), remainingEdgesTwo.get(), (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
+			// Check if queuing clearing the beginning of remaining edges on the device failed
+			if(clEnqueueFillBuffer(commandQueue.get(), remainingEdges, (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Preparing program's arguments on the GPU failed." << endl;
@@ -3066,8 +2224,8 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if setting program's remaining edge argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 2, sizeof(remainingEdgesTwo.get()), &unmove(remainingEdgesTwo.get())) != CL_SUCCESS) {
+			// Check if setting program's remaining edges argument failed
+			if(clSetKernelArg(stepSixKernel.get(), 2, sizeof(remainingEdges), &remainingEdges) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -3080,8 +2238,8 @@ using namespace std;
 			if(TRIMMING_ROUNDS < 3) {
 			
 				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepSixKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-				
+				if(clSetKernelArg(stepSixKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
+			
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
 					
@@ -3100,40 +2258,10 @@ using namespace std;
 				return false;
 			}
 			
-			// Check if queuing map result failed
-			mapEvent.free();
-			resultTwo = reinterpret_cast<uint32_t *>(clEnqueueMapBuffer(commandQueue.get(), remainingEdgesTwo.get(), CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), 0, nullptr, mapEvent.getAddress(), nullptr));
-			if(!resultTwo) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Perform commands in queue
-			clFlush(commandQueue.get());
 			
-			// Trimming finished
-			trimmingFinished(resultOne, sipHashKeysOne, heightOne, idOne, nonceOne);
-			
-			// Check if queuing unmap result failed
-			if(clEnqueueUnmapMemObject(commandQueue.get(), remainingEdgesOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Set that result one doesn't exist
-			resultOne = nullptr;
-		}
-		
-		// Return true
-		return true;
+			// Return true
+			return true;
+		});
 	}
 #endif
 
@@ -0,0 +1,214 @@
+// Header guard
+#ifndef NODE_RENAMER_H
+#define NODE_RENAMER_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Node renamer class (Renames each partition's nodes to dense identifiers while keeping nodes that are pairs as pairs)
+template<const uint32_t maximumNumberOfEdges> class NodeRenamer final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit NodeRenamer(const unsigned int numberOfThreads) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Rename
+		inline void rename(uint32_t *renamedEdges, const uint32_t *edges, const uint64_t numberOfEdges, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+	// Private
+	private:
+	
+		// Digit number of bits
+		static const uint_fast8_t DIGIT_NUMBER_OF_BITS;
+		
+		// Number of digits
+		static const uint32_t NUMBER_OF_DIGITS;
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Nodes (Each node is its partition and pair in the upper 32 bits and its position in the edges in the lower 32 bits)
+		unique_ptr<uint64_t[]> nodes;
+		
+		// Sorted nodes
+		unique_ptr<uint64_t[]> sortedNodes;
+		
+		// Threads' digit counts
+		unique_ptr<uint32_t[]> threadsDigitCounts;
+		
+		// Threads' number of pairs in each partition
+		unique_ptr<uint32_t[]> threadsNumberOfPairs;
+};
+
+
+// Constants
+
+// Node renamer digit number of bits
+template<const uint32_t maximumNumberOfEdges> const uint_fast8_t NodeRenamer<maximumNumberOfEdges>::DIGIT_NUMBER_OF_BITS = 8;
+
+// Node renamer number of digits
+template<const uint32_t maximumNumberOfEdges> const uint32_t NodeRenamer<maximumNumberOfEdges>::NUMBER_OF_DIGITS = 1 << DIGIT_NUMBER_OF_BITS;
+
+
+// Supporting function implementation
+
+// Constructor
+template<const uint32_t maximumNumberOfEdges> NodeRenamer<maximumNumberOfEdges>::NodeRenamer(const unsigned int numberOfThreads) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Create nodes
+	nodes(new(nothrow) uint64_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2]),
+	
+	// Create sorted nodes
+	sortedNodes(new(nothrow) uint64_t[static_cast<uint64_t>(maximumNumberOfEdges) * 2]),
+	
+	// Create threads' digit counts
+	threadsDigitCounts(new(nothrow) uint32_t[numberOfThreads * NUMBER_OF_DIGITS]),
+	
+	// Create threads' number of pairs
+	threadsNumberOfPairs(new(nothrow) uint32_t[numberOfThreads * 2])
+{
+
+	// Throw error if maximum number of edges is invalid
+	static_assert(maximumNumberOfEdges && maximumNumberOfEdges <= UINT32_MAX / 2, "Node renamer's maximum number of edges is invalid");
+}
+
+// Bool operator
+template<const uint32_t maximumNumberOfEdges> NodeRenamer<maximumNumberOfEdges>::operator bool() const noexcept {
+
+	// Return if creating nodes, sorted nodes, threads' digit counts, and threads' number of pairs was successful
+	return nodes && sortedNodes && threadsDigitCounts && threadsNumberOfPairs;
+}
+
+// Rename
+template<const uint32_t maximumNumberOfEdges> void NodeRenamer<maximumNumberOfEdges>::rename(uint32_t *renamedEdges, const uint32_t *edges, const uint64_t numberOfEdges, const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Get thread's nodes start and end
+	const uint64_t nodesStart = min((numberOfEdges * 2 + numberOfThreads - 1) / numberOfThreads * threadIndex, numberOfEdges * 2);
+	const uint64_t nodesEnd = min((numberOfEdges * 2 + numberOfThreads - 1) / numberOfThreads * (threadIndex + 1), numberOfEdges * 2);
+	
+	// Go through all of the thread's nodes
+	for(uint64_t nodesIndex = nodesStart; nodesIndex < nodesEnd; ++nodesIndex) {
+	
+		// Check if node is on the first partition
+		if(!(nodesIndex & 1)) {
+		
+			// Set renamed edge's index
+			renamedEdges[nodesIndex / 2 * EDGE_NUMBER_OF_COMPONENTS] = edges[nodesIndex / 2 * EDGE_NUMBER_OF_COMPONENTS];
+		}
+		
+		// Set node to its partition and pair combined with its position
+		nodes[nodesIndex] = (((nodesIndex & 1) << (EDGE_BITS - 1)) | (edges[nodesIndex / 2 * EDGE_NUMBER_OF_COMPONENTS + 1 + (nodesIndex & 1)] >> 1)) << 32 | nodesIndex;
+	}
+	
+	// Go through all digits in the nodes' partitions and pairs
+	uint64_t *source = nodes.get();
+	uint64_t *destination = sortedNodes.get();
+	for(uint_fast8_t shift = 32; shift < 32 + EDGE_BITS; shift += DIGIT_NUMBER_OF_BITS) {
+	
+		// Go through all of the thread's nodes
+		uint32_t *digitCounts = &threadsDigitCounts[threadIndex * NUMBER_OF_DIGITS];
+		memset(digitCounts, 0, sizeof(uint32_t) * NUMBER_OF_DIGITS);
+		for(uint64_t nodesIndex = nodesStart; nodesIndex < nodesEnd; ++nodesIndex) {
+		
+			// Increment node's digit's count
+			++digitCounts[(source[nodesIndex] >> shift) & (NUMBER_OF_DIGITS - 1)];
+		}
+		
+		// Wait for all threads to finish counting their nodes' digits
+		threadsBarrier.arrive_and_wait();
+		
+		// Go through all digits
+		uint32_t digitOffsets[NUMBER_OF_DIGITS];
+		for(uint32_t digit = 0, offset = 0; digit < NUMBER_OF_DIGITS; ++digit) {
+		
+			// Go through all threads
+			for(unsigned int currentThreadIndex = 0; currentThreadIndex < numberOfThreads; ++currentThreadIndex) {
+			
+				// Check if thread is this thread
+				if(currentThreadIndex == threadIndex) {
+				
+					// Set digit's offset to the offset
+					digitOffsets[digit] = offset;
+				}
+				
+				// Add thread's digit's count to the offset
+				offset += threadsDigitCounts[currentThreadIndex * NUMBER_OF_DIGITS + digit];
+			}
+		}
+		
+		// Go through all of the thread's nodes
+		for(uint64_t nodesIndex = nodesStart; nodesIndex < nodesEnd; ++nodesIndex) {
+		
+			// Move node to its digit's next offset
+			destination[digitOffsets[(source[nodesIndex] >> shift) & (NUMBER_OF_DIGITS - 1)]++] = source[nodesIndex];
+		}
+		
+		// Wait for all threads to finish moving their nodes
+		threadsBarrier.arrive_and_wait();
+		
+		// Swap source and destination
+		swap(source, destination);
+	}
+	
+	// Go through all of the thread's sorted nodes
+	uint32_t *numberOfPairs = &threadsNumberOfPairs[threadIndex * 2];
+	numberOfPairs[0] = numberOfPairs[1] = 0;
+	for(uint64_t nodesIndex = nodesStart; nodesIndex < nodesEnd; ++nodesIndex) {
+	
+		// Check if node's pair is different than the previous node's pair
+		if(!nodesIndex || (source[nodesIndex] >> 32) != (source[nodesIndex - 1] >> 32)) {
+		
+			// Increment number of pairs in the node's partition
+			++numberOfPairs[source[nodesIndex] >> (32 + EDGE_BITS - 1)];
+		}
+	}
+	
+	// Wait for all threads to finish counting their pairs
+	threadsBarrier.arrive_and_wait();
+	
+	// Go through all previous threads
+	uint32_t nextPairs[2] = {};
+	for(unsigned int previousThreadIndex = 0; previousThreadIndex < threadIndex; ++previousThreadIndex) {
+	
+		// Add previous thread's number of pairs in each partition to the next pairs
+		nextPairs[0] += threadsNumberOfPairs[previousThreadIndex * 2];
+		nextPairs[1] += threadsNumberOfPairs[previousThreadIndex * 2 + 1];
+	}
+	
+	// Go through all of the thread's sorted nodes
+	for(uint64_t nodesIndex = nodesStart; nodesIndex < nodesEnd; ++nodesIndex) {
+	
+		// Get node's partition and position
+		const uint_fast8_t partition = source[nodesIndex] >> (32 + EDGE_BITS - 1);
+		const uint64_t position = source[nodesIndex] & UINT32_MAX;
+		
+		// Check if node's pair is different than the previous node's pair
+		if(!nodesIndex || (source[nodesIndex] >> 32) != (source[nodesIndex - 1] >> 32)) {
+		
+			// Go to the partition's next pair
+			++nextPairs[partition];
+		}
+		
+		// Set renamed edge's node to the pair's identifier combined with the node's side of the pair
+		const uint64_t edgesIndex = position / 2 * EDGE_NUMBER_OF_COMPONENTS + 1 + partition;
+		renamedEdges[edgesIndex] = ((nextPairs[partition] - 1) << 1) | (edges[edgesIndex] & 1);
+	}
+	
+	// Wait for all threads to finish renaming their nodes
+	threadsBarrier.arrive_and_wait();
+}
+
+
+#endif
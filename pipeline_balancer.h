@@ -0,0 +1,451 @@
+// Header guard
+#ifndef PIPELINE_BALANCER_H
+#define PIPELINE_BALANCER_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// Pipeline balancer number of settling graphs (Graphs searched right after a setting is changed aren't measured since they could have been trimmed before the change)
+#define PIPELINE_BALANCER_NUMBER_OF_SETTLING_GRAPHS 4
+
+// Pipeline balancer number of measured graphs (Stage times are measured over this many graphs before each decision)
+#define PIPELINE_BALANCER_NUMBER_OF_MEASURED_GRAPHS 16
+
+// Pipeline balancer min searching fraction (Searching threads that search less than this fraction of the time are waiting for the trimming stage, so trimming is the slowest stage)
+#define PIPELINE_BALANCER_MIN_SEARCHING_FRACTION 0.8
+
+// Pipeline balancer max searching fraction (Searching threads that search more than this fraction of the time are the slowest stage)
+#define PIPELINE_BALANCER_MAX_SEARCHING_FRACTION 0.95
+
+// Pipeline balancer min improvement (A changed setting is only kept if it decreases the time per graph by at least this fraction)
+#define PIPELINE_BALANCER_MIN_IMPROVEMENT 0.02
+
+// Pipeline balancer max backoff (A changed setting that wasn't kept isn't tried again for a number of decisions that doubles each time up to this many)
+#define PIPELINE_BALANCER_MAX_BACKOFF 64
+
+// Pipeline balancer max extra trimming rounds
+#define PIPELINE_BALANCER_MAX_EXTRA_TRIMMING_ROUNDS 32
+
+
+// Classes
+
+// Pipeline balancer class (Measures how long each graph takes and how much of that time the searching threads spend searching, and changes the number of trimming rounds that lean trimming and the searching threads perform one at a time, keeping each change only if it makes graphs take less time)
+class PipelineBalancer final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit PipelineBalancer(const unsigned int maxExtraTrimmingRounds, const bool stagesOverlap) noexcept;
+		
+		// Add graph
+		inline void addGraph(const double searchingTime) noexcept;
+		
+	// Private
+	private:
+	
+		// Setting
+		enum class Setting : uint8_t {
+		
+			// More trimming rounds setting
+			MORE_TRIMMING_ROUNDS,
+			
+			// Fewer trimming rounds setting
+			FEWER_TRIMMING_ROUNDS,
+			
+			// More CPU trimming rounds setting
+			MORE_CPU_TRIMMING_ROUNDS,
+			
+			// Fewer CPU trimming rounds setting
+			FEWER_CPU_TRIMMING_ROUNDS,
+			
+			// None setting
+			NONE
+		};
+		
+		// Change
+		inline bool change(const Setting setting) noexcept;
+		
+		// Display settings
+		inline void displaySettings() const noexcept;
+		
+		// Max extra trimming rounds
+		const unsigned int maxExtraTrimmingRounds;
+		
+		// Stages overlap
+		const bool stagesOverlap;
+		
+		// Number of graphs
+		unsigned int numberOfGraphs;
+		
+		// Measuring start time
+		chrono::high_resolution_clock::time_point measuringStartTime;
+		
+		// Measured searching time
+		double measuredSearchingTime;
+		
+		// Previous graph time
+		double previousGraphTime;
+		
+		// Trying setting
+		Setting tryingSetting;
+		
+		// Previous extra trimming rounds
+		unsigned int previousExtraTrimmingRounds;
+		
+		// Previous CPU trimming rounds
+		unsigned int previousCpuTrimmingRounds;
+		
+		// Next setting
+		underlying_type_t<Setting> nextSetting;
+		
+		// Settings' backoffs
+		unsigned int settingsBackoffs[static_cast<underlying_type_t<Setting>>(Setting::NONE)];
+		
+		// Settings' remaining backoffs
+		unsigned int settingsRemainingBackoffs[static_cast<underlying_type_t<Setting>>(Setting::NONE)];
+};
+
+
+// Global variables
+
+// Extra trimming rounds (Lean trimming performs this many trimming rounds more than TRIMMING_ROUNDS, which only decreases the number of edges that remain)
+static unsigned int extraTrimmingRounds = 0;
+
+// Pipeline balancer
+static unique_ptr<PipelineBalancer> pipelineBalancer;
+
+
+// Function prototypes
+
+// Create pipeline balancer
+static inline void createPipelineBalancer(const unsigned int maxExtraTrimmingRounds, const bool stagesOverlap) noexcept;
+
+
+// Supporting function implementation
+
+// Constructor
+PipelineBalancer::PipelineBalancer(const unsigned int maxExtraTrimmingRounds, const bool stagesOverlap) noexcept :
+
+	// Set max extra trimming rounds
+	maxExtraTrimmingRounds(maxExtraTrimmingRounds),
+	
+	// Set stages overlap
+	stagesOverlap(stagesOverlap),
+	
+	// Set number of graphs to zero
+	numberOfGraphs(0),
+	
+	// Set measured searching time to zero
+	measuredSearchingTime(0),
+	
+	// Set previous graph time to zero
+	previousGraphTime(0),
+	
+	// Set trying setting to none
+	tryingSetting(Setting::NONE),
+	
+	// Set previous extra trimming rounds to zero
+	previousExtraTrimmingRounds(0),
+	
+	// Set previous CPU trimming rounds to zero
+	previousCpuTrimmingRounds(0),
+	
+	// Set next setting to the first setting
+	nextSetting(0),
+	
+	// Set settings' backoffs to zero
+	settingsBackoffs{},
+	
+	// Set settings' remaining backoffs to zero
+	settingsRemainingBackoffs{}
+{
+
+	// Set extra trimming rounds to zero
+	extraTrimmingRounds = 0;
+}
+
+// Add graph
+void PipelineBalancer::addGraph(const double searchingTime) noexcept {
+
+	// Check if graph is settling
+	const chrono::high_resolution_clock::time_point currentTime = chrono::high_resolution_clock::now();
+	if(++numberOfGraphs <= PIPELINE_BALANCER_NUMBER_OF_SETTLING_GRAPHS) {
+	
+		// Check if the last settling graph
+		if(numberOfGraphs == PIPELINE_BALANCER_NUMBER_OF_SETTLING_GRAPHS) {
+		
+			// Start measuring
+			measuringStartTime = currentTime;
+			measuredSearchingTime = 0;
+		}
+		
+		// Return
+		return;
+	}
+	
+	// Add graph's searching time to the measured searching time
+	measuredSearchingTime += searchingTime;
+	
+	// Check if not all graphs have been measured
+	if(numberOfGraphs < PIPELINE_BALANCER_NUMBER_OF_SETTLING_GRAPHS + PIPELINE_BALANCER_NUMBER_OF_MEASURED_GRAPHS) {
+	
+		// Return
+		return;
+	}
+	
+	// Get graph time and searching fraction
+	const double measuredTime = static_cast<chrono::duration<double>>(currentTime - measuringStartTime).count();
+	const double graphTime = measuredTime / PIPELINE_BALANCER_NUMBER_OF_MEASURED_GRAPHS;
+	const double searchingFraction = measuredSearchingTime / measuredTime;
+	
+	// Restart measuring
+	numberOfGraphs = PIPELINE_BALANCER_NUMBER_OF_SETTLING_GRAPHS;
+	measuringStartTime = currentTime;
+	measuredSearchingTime = 0;
+	
+	// Go through all settings
+	for(underlying_type_t<Setting> i = 0; i < static_cast<underlying_type_t<Setting>>(Setting::NONE); ++i) {
+	
+		// Decrement setting's remaining backoff
+		settingsRemainingBackoffs[i] -= settingsRemainingBackoffs[i] ? 1 : 0;
+	}
+	
+	// Check if trying a setting
+	if(tryingSetting != Setting::NONE) {
+	
+		// Check if setting decreased the graph time
+		const underlying_type_t<Setting> triedSetting = static_cast<underlying_type_t<Setting>>(tryingSetting);
+		tryingSetting = Setting::NONE;
+		if(graphTime < previousGraphTime * (1 - PIPELINE_BALANCER_MIN_IMPROVEMENT)) {
+		
+			// Display message
+			cout << "\tBalancer:\t kept ";
+			displaySettings();
+			cout << " since graph time decreased from " << previousGraphTime << " to " << graphTime << " second(s)" << endl;
+			
+			// Reset setting's backoff
+			settingsBackoffs[triedSetting] = 0;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Restore previous settings
+			extraTrimmingRounds = previousExtraTrimmingRounds;
+			searchingThreadsCpuTrimmingRounds = previousCpuTrimmingRounds;
+			
+			// Display message
+			cout << "\tBalancer:\t reverted to ";
+			displaySettings();
+			cout << " since graph time went from " << previousGraphTime << " to " << graphTime << " second(s)" << endl;
+			
+			// Don't try the setting again for longer than the previous time
+			settingsBackoffs[triedSetting] = min(max(settingsBackoffs[triedSetting] * 2, static_cast<unsigned int>(1)), static_cast<unsigned int>(PIPELINE_BALANCER_MAX_BACKOFF));
+			settingsRemainingBackoffs[triedSetting] = settingsBackoffs[triedSetting];
+			
+			// Restart settling since graphs were trimmed or searched with the tried setting
+			numberOfGraphs = 0;
+			
+			// Return
+			return;
+		}
+	}
+	
+	// Check if stages overlap
+	bool settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::NONE)];
+	const char *reason;
+	if(stagesOverlap) {
+	
+		// Check if searching is the slowest stage
+		if(searchingFraction > PIPELINE_BALANCER_MAX_SEARCHING_FRACTION) {
+		
+			// Try decreasing the searching time with more trimming rounds or with a different number of CPU trimming rounds
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::MORE_TRIMMING_ROUNDS)] = true;
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::FEWER_TRIMMING_ROUNDS)] = false;
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::MORE_CPU_TRIMMING_ROUNDS)] = true;
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::FEWER_CPU_TRIMMING_ROUNDS)] = true;
+			reason = "searching is the slowest stage";
+		}
+		
+		// Otherwise check if trimming is the slowest stage
+		else if(searchingFraction < PIPELINE_BALANCER_MIN_SEARCHING_FRACTION) {
+		
+			// Try decreasing the trimming time with fewer trimming rounds
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::MORE_TRIMMING_ROUNDS)] = false;
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::FEWER_TRIMMING_ROUNDS)] = true;
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::MORE_CPU_TRIMMING_ROUNDS)] = false;
+			settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::FEWER_CPU_TRIMMING_ROUNDS)] = false;
+			reason = "trimming is the slowest stage";
+		}
+		
+		// Otherwise
+		else {
+		
+			// Update previous graph time
+			previousGraphTime = graphTime;
+			
+			// Return
+			return;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Try all settings since the stages take turns using the same CPU cores
+		settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::MORE_TRIMMING_ROUNDS)] = true;
+		settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::FEWER_TRIMMING_ROUNDS)] = true;
+		settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::MORE_CPU_TRIMMING_ROUNDS)] = true;
+		settingsToTry[static_cast<underlying_type_t<Setting>>(Setting::FEWER_CPU_TRIMMING_ROUNDS)] = true;
+		reason = "trimming and searching take turns";
+	}
+	
+	// Go through all settings starting at the next setting so that settings take turns being tried
+	previousGraphTime = graphTime;
+	for(underlying_type_t<Setting> i = 0; i < static_cast<underlying_type_t<Setting>>(Setting::NONE); ++i) {
+	
+		// Check if trying the setting and it isn't backing off
+		const underlying_type_t<Setting> setting = (nextSetting + i) % static_cast<underlying_type_t<Setting>>(Setting::NONE);
+		if(settingsToTry[setting] && !settingsRemainingBackoffs[setting]) {
+		
+			// Save current settings
+			previousExtraTrimmingRounds = extraTrimmingRounds;
+			previousCpuTrimmingRounds = searchingThreadsCpuTrimmingRounds;
+			
+			// Check if changing the setting was successful
+			if(change(static_cast<Setting>(setting))) {
+			
+				// Display message
+				cout << "\tBalancer:\t " << reason << " (searching " << (searchingFraction * 100) << "% of " << graphTime << " second(s) per graph), so trying ";
+				displaySettings();
+				cout << endl;
+				
+				// Set trying setting to the setting
+				tryingSetting = static_cast<Setting>(setting);
+				
+				// Set next setting to the setting after it
+				nextSetting = (setting + 1) % static_cast<underlying_type_t<Setting>>(Setting::NONE);
+				
+				// Restart settling since graphs are trimmed or searched with the changed setting
+				numberOfGraphs = 0;
+				
+				// Break
+				break;
+			}
+		}
+	}
+}
+
+// Change
+bool PipelineBalancer::change(const Setting setting) noexcept {
+
+	// Check setting
+	switch(setting) {
+	
+		// More trimming rounds
+		case Setting::MORE_TRIMMING_ROUNDS:
+		
+			// Check if extra trimming rounds is at its max value
+			if(extraTrimmingRounds == maxExtraTrimmingRounds) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Increment extra trimming rounds
+			++extraTrimmingRounds;
+			
+			// Break
+			break;
+			
+		// Fewer trimming rounds
+		case Setting::FEWER_TRIMMING_ROUNDS:
+		
+			// Check if there's no extra trimming rounds
+			if(!extraTrimmingRounds) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Decrement extra trimming rounds
+			--extraTrimmingRounds;
+			
+			// Break
+			break;
+			
+		// More CPU trimming rounds
+		case Setting::MORE_CPU_TRIMMING_ROUNDS:
+		
+			// Check if CPU trimming rounds is at its max value
+			if(searchingThreadsCpuTrimmingRounds == MAX_CPU_TRIMMING_ROUNDS) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Double CPU trimming rounds (The searching threads stop trimming once a round doesn't remove any edges, so the number of rounds that matters can be far from the current number)
+			searchingThreadsCpuTrimmingRounds = searchingThreadsCpuTrimmingRounds ? min(searchingThreadsCpuTrimmingRounds * 2, static_cast<unsigned int>(MAX_CPU_TRIMMING_ROUNDS)) : 1;
+			
+			// Break
+			break;
+			
+		// Fewer CPU trimming rounds
+		case Setting::FEWER_CPU_TRIMMING_ROUNDS:
+		
+			// Check if there's no CPU trimming rounds
+			if(!searchingThreadsCpuTrimmingRounds) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Halve CPU trimming rounds
+			searchingThreadsCpuTrimmingRounds /= 2;
+			
+			// Break
+			break;
+			
+		// Default
+		default:
+		
+			// Return false
+			return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Display settings
+void PipelineBalancer::displaySettings() const noexcept {
+
+	// Display message
+	cout << (TRIMMING_ROUNDS + extraTrimmingRounds) << " trimming round(s) and " << searchingThreadsCpuTrimmingRounds << " CPU trimming round(s)";
+}
+
+// Create pipeline balancer
+void createPipelineBalancer(const unsigned int maxExtraTrimmingRounds, const bool stagesOverlap) noexcept {
+
+	// Check if creating pipeline balancer failed
+	pipelineBalancer = unique_ptr<PipelineBalancer>(new(nothrow) PipelineBalancer(maxExtraTrimmingRounds, stagesOverlap));
+	if(!pipelineBalancer) {
+	
+		// Display message
+		cout << "Allocating memory for balancing the pipeline stages failed. Mining without it." << endl;
+		
+		// Return
+		return;
+	}
+	
+	// Display message
+	cout << "Balancing the pipeline stages with " << TRIMMING_ROUNDS << " to " << (TRIMMING_ROUNDS + maxExtraTrimmingRounds) << " trimming round(s) and 0 to " << MAX_CPU_TRIMMING_ROUNDS << " CPU trimming round(s)" << endl;
+}
+
+
+#endif
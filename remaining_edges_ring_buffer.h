@@ -0,0 +1,272 @@
+// Header guard
+#ifndef REMAINING_EDGES_RING_BUFFER_H
+#define REMAINING_EDGES_RING_BUFFER_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// Remaining edges ring buffer depth (Number of graphs that can be trimmed or waiting to be searched at the same time, so the GPU can keep trimming through a graph that takes longer than usual to search instead of stalling after one graph, this default comes from a simulation of the trimming and searching times and hasn't been measured on an OpenCL or Metal device so it may need to be tuned for one)
+#define REMAINING_EDGES_RING_BUFFER_DEPTH 3
+
+
+// Constants
+
+// Check if using an Apple device and not using OpenCL
+#if defined __APPLE__ && !defined USE_OPENCL
+
+	// Remaining edges ring buffer number of slots (Metal trimming alternates between two remaining edges buffers)
+	#define REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS 2
+	
+// Otherwise
+#else
+
+	// Remaining edges ring buffer number of slots
+	#define REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS REMAINING_EDGES_RING_BUFFER_DEPTH
+#endif
+
+
+// Check if not using an Apple device or using OpenCL
+#if !defined __APPLE__ || defined USE_OPENCL
+
+	// Checks
+	
+	// Throw error if remaining edges ring buffer depth is invalid
+	static_assert(REMAINING_EDGES_RING_BUFFER_DEPTH >= 2, "Remaining edges ring buffer depth is less than two");
+	
+	
+	// Classes
+	
+	// Remaining edges ring buffer class (Each slot has its own remaining edges buffer and the graph that's being trimmed into it, and the oldest slot is searched while the newer slots are trimmed by the device's in-order command queue)
+	class RemainingEdgesRingBuffer final {
+	
+		// Public
+		public:
+		
+			// Constructor
+			inline explicit RemainingEdgesRingBuffer(const cl_context context, const cl_command_queue commandQueue) noexcept;
+			
+			// Destructor
+			inline ~RemainingEdgesRingBuffer() noexcept;
+			
+			// Bool operator
+			inline explicit operator bool() const noexcept;
+			
+			// Perform
+			template<typename EnqueueTrimming> inline bool perform(const EnqueueTrimming &enqueueTrimming) noexcept;
+			
+		// Private
+		private:
+		
+			// Slot
+			struct Slot {
+			
+				// Remaining edges
+				unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> remainingEdges = {nullptr, clReleaseMemObject};
+				
+				// Result
+				uint32_t *result = nullptr;
+				
+				// First command event
+				Event firstCommandEvent;
+				
+				// Map event
+				Event mapEvent;
+				
+				// SipHash keys
+				uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+				
+				// Height
+				uint64_t height;
+				
+				// ID
+				uint64_t id;
+				
+				// Nonce
+				uint64_t nonce;
+			};
+			
+			// Enqueue graph
+			template<typename EnqueueTrimming> inline bool enqueueGraph(Slot &slot, const EnqueueTrimming &enqueueTrimming) noexcept;
+			
+			// Command queue
+			const cl_command_queue commandQueue;
+			
+			// Slots
+			Slot slots[REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS];
+	};
+	
+	
+	// Supporting function implementation
+	
+	// Constructor
+	RemainingEdgesRingBuffer::RemainingEdgesRingBuffer(const cl_context context, const cl_command_queue commandQueue) noexcept :
+	
+		// Set command queue to command queue
+		commandQueue(commandQueue)
+	{
+	
+		// Go through all slots
+		for(Slot &slot : slots) {
+		
+			// Allocate memory for the slot's remaining edges on the device
+			slot.remainingEdges = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
+		}
+	}
+	
+	// Destructor
+	RemainingEdgesRingBuffer::~RemainingEdgesRingBuffer() noexcept {
+	
+		// Wait for all commands in the queue to finish
+		clFinish(commandQueue);
+		
+		// Go through all slots
+		for(Slot &slot : slots) {
+		
+			// Check if slot's result exists
+			if(slot.result) {
+			
+				// Queue unmapping slot's result
+				clEnqueueUnmapMemObject(commandQueue, slot.remainingEdges.get(), reinterpret_cast<void *>(slot.result), 0, nullptr, nullptr);
+			}
+		}
+		
+		// Wait for all commands in the queue to finish
+		clFinish(commandQueue);
+	}
+	
+	// Bool operator
+	RemainingEdgesRingBuffer::operator bool() const noexcept {
+	
+		// Go through all slots
+		for(const Slot &slot : slots) {
+		
+			// Check if allocating memory for the slot's remaining edges failed
+			if(!slot.remainingEdges) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Perform
+	template<typename EnqueueTrimming> bool RemainingEdgesRingBuffer::perform(const EnqueueTrimming &enqueueTrimming) noexcept {
+	
+		// Go through all slots except the newest
+		for(unsigned int i = 0; i < REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS - 1; ++i) {
+		
+			// Check if queuing trimming the slot's graph failed
+			if(!enqueueGraph(slots[i], enqueueTrimming)) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Go through all oldest slots while not closing
+		cl_ulong previousEndTime = 0;
+		for(unsigned int oldestSlotIndex = 0; !closing; oldestSlotIndex = (oldestSlotIndex + 1) % REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS) {
+		
+			// Check if waiting for oldest slot's map event to finish failed
+			Slot &oldestSlot = slots[oldestSlotIndex];
+			if(clWaitForEvents(1, oldestSlot.mapEvent.getAddress()) != CL_SUCCESS) {
+			
+				// Display message
+				cout << "Getting result from the GPU failed." << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Check if getting trimming time failed
+			cl_ulong startTime;
+			cl_ulong endTime;
+			if(clGetEventProfilingInfo(oldestSlot.firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(oldestSlot.mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
+			
+				// Display message
+				cout << "Getting GPU trimming time failed." << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Display message (The graph can be queued while the previous graph is still being trimmed, so its trimming starts when either it's queued or the previous graph's trimming ends)
+			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - max(startTime, previousEndTime))).count() << " second(s)" << endl;
+			
+			// Set previous end time to the end time
+			previousEndTime = endTime;
+			
+			// Check if queuing trimming the newest slot's graph failed
+			if(!enqueueGraph(slots[(oldestSlotIndex + REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS - 1) % REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS], enqueueTrimming)) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Perform commands in queue
+			clFlush(commandQueue);
+			
+			// Trimming finished
+			trimmingFinished(oldestSlot.result, oldestSlot.sipHashKeys, oldestSlot.height, oldestSlot.id, oldestSlot.nonce);
+			
+			// Check if queuing unmap oldest slot's result failed
+			if(clEnqueueUnmapMemObject(commandQueue, oldestSlot.remainingEdges.get(), reinterpret_cast<void *>(oldestSlot.result), 0, nullptr, nullptr) != CL_SUCCESS) {
+			
+				// Display message
+				cout << "Getting result from the GPU failed." << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Set that oldest slot's result doesn't exist
+			oldestSlot.result = nullptr;
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Enqueue graph
+	template<typename EnqueueTrimming> bool RemainingEdgesRingBuffer::enqueueGraph(Slot &slot, const EnqueueTrimming &enqueueTrimming) noexcept {
+	
+		// Get SipHash keys from job's header and nonce
+		slot.height = jobHeight;
+		slot.id = jobId;
+		slot.nonce = jobNonce++;
+		blake2b(slot.sipHashKeys, jobHeaderMidstate, slot.nonce);
+		
+		// Check if queuing trimming the graph into the slot's remaining edges failed
+		slot.firstCommandEvent.free();
+		if(!enqueueTrimming(slot.remainingEdges.get(), slot.sipHashKeys, slot.firstCommandEvent.getAddress())) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if queuing map result failed
+		slot.mapEvent.free();
+		slot.result = reinterpret_cast<uint32_t *>(clEnqueueMapBuffer(commandQueue, slot.remainingEdges.get(), CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint), 0, nullptr, slot.mapEvent.getAddress(), nullptr));
+		if(!slot.result) {
+		
+			// Display message
+			cout << "Getting result from the GPU failed." << endl;
+			
+			// Return false
+			return false;
+		}
+		
+		// Return true
+		return true;
+	}
+#endif
+
+
+#endif
@@ -0,0 +1,161 @@
+// Header guard
+#ifndef SEARCHING_THREADS_HANDOFF_H
+#define SEARCHING_THREADS_HANDOFF_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// Searching threads handoff number of spins (Threads check for the handoff this many times before sleeping until it happens, which avoids context switches when graphs are handed off faster than a thread can be woken up)
+#define SEARCHING_THREADS_HANDOFF_NUMBER_OF_SPINS 256
+
+
+// Classes
+
+// Searching threads handoff class (Hands graphs from the trimming thread to the searching threads by incrementing a sequence number and hands them back by counting down the searching threads that haven't finished, so neither direction needs a mutex)
+class SearchingThreadsHandoff final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit SearchingThreadsHandoff(const unsigned int numberOfSearchingThreads) noexcept;
+		
+		// Start
+		inline void start() noexcept;
+		
+		// Wait until started
+		inline uint32_t waitUntilStarted(const uint32_t previousSequence) const noexcept;
+		
+		// Finished
+		inline void finished() noexcept;
+		
+		// Wait until finished
+		inline void waitUntilFinished() const noexcept;
+		
+	// Private
+	private:
+	
+		// Spin
+		static inline void spin() noexcept;
+		
+		// Number of searching threads
+		const unsigned int numberOfSearchingThreads;
+		
+		// Number of spins (Spinning only slows down the thread being waited on when there's one CPU core)
+		const unsigned int numberOfSpins;
+		
+		// Sequence (This is on a different cache line than the number of searching threads remaining since that's written by every searching thread while this is only written once per graph)
+		alignas(64) atomic<uint32_t> sequence;
+		
+		// Number of searching threads remaining
+		alignas(64) atomic<uint32_t> numberOfSearchingThreadsRemaining;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+SearchingThreadsHandoff::SearchingThreadsHandoff(const unsigned int numberOfSearchingThreads) noexcept :
+
+	// Set number of searching threads
+	numberOfSearchingThreads(numberOfSearchingThreads),
+	
+	// Set number of spins based on if there's more than one CPU core
+	numberOfSpins((getNumberOfCpuCores() > 1) ? SEARCHING_THREADS_HANDOFF_NUMBER_OF_SPINS : 0),
+	
+	// Set sequence to zero
+	sequence(0),
+	
+	// Set number of searching threads remaining to the number of searching threads so that waiting until finished waits for them to initialize
+	numberOfSearchingThreadsRemaining(numberOfSearchingThreads)
+{
+}
+
+// Start
+void SearchingThreadsHandoff::start() noexcept {
+
+	// Set number of searching threads remaining to the number of searching threads
+	numberOfSearchingThreadsRemaining.store(numberOfSearchingThreads, memory_order_relaxed);
+	
+	// Increment sequence (This releases the graph's data and the number of searching threads remaining to the searching threads)
+	sequence.fetch_add(1, memory_order_release);
+	
+	// Notify searching threads that are sleeping
+	sequence.notify_all();
+}
+
+// Wait until started
+uint32_t SearchingThreadsHandoff::waitUntilStarted(const uint32_t previousSequence) const noexcept {
+
+	// Go through the spins while the sequence hasn't changed
+	for(unsigned int i = 0; i < numberOfSpins && sequence.load(memory_order_relaxed) == previousSequence; ++i) {
+	
+		// Spin
+		spin();
+	}
+	
+	// Go through all times the sequence hasn't changed
+	uint32_t currentSequence;
+	while((currentSequence = sequence.load(memory_order_acquire)) == previousSequence) {
+	
+		// Sleep until the sequence changes
+		sequence.wait(previousSequence, memory_order_acquire);
+	}
+	
+	// Return current sequence
+	return currentSequence;
+}
+
+// Finished
+void SearchingThreadsHandoff::finished() noexcept {
+
+	// Check if the searching thread is the last searching thread to finish (This releases the searching thread's results to the trimming thread)
+	if(numberOfSearchingThreadsRemaining.fetch_sub(1, memory_order_acq_rel) == 1) {
+	
+		// Notify the trimming thread if it's sleeping
+		numberOfSearchingThreadsRemaining.notify_one();
+	}
+}
+
+// Wait until finished
+void SearchingThreadsHandoff::waitUntilFinished() const noexcept {
+
+	// Go through the spins while searching threads haven't finished
+	for(unsigned int i = 0; i < numberOfSpins && numberOfSearchingThreadsRemaining.load(memory_order_relaxed); ++i) {
+	
+		// Spin
+		spin();
+	}
+	
+	// Go through all times searching threads haven't finished
+	uint32_t currentNumberOfSearchingThreadsRemaining;
+	while((currentNumberOfSearchingThreadsRemaining = numberOfSearchingThreadsRemaining.load(memory_order_acquire))) {
+	
+		// Sleep until the number of searching threads remaining changes
+		numberOfSearchingThreadsRemaining.wait(currentNumberOfSearchingThreadsRemaining, memory_order_acquire);
+	}
+}
+
+// Spin
+void SearchingThreadsHandoff::spin() noexcept {
+
+	// Check if using x86
+	#if defined __x86_64__ || defined __i386__
+	
+		// Tell the CPU that this is a spin loop
+		__builtin_ia32_pause();
+		
+	// Otherwise check if using ARM
+	#elif defined __aarch64__ || defined __arm__
+	
+		// Tell the CPU that this is a spin loop
+		__asm__ __volatile__("yield");
+	#endif
+}
+
+
+#endif
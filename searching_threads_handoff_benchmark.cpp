@@ -0,0 +1,399 @@
+// Constants
+
+// OpenCL target version (OpenCL v1.2)
+#define CL_TARGET_OPENCL_VERSION 120
+
+// Metal target version (Metal v3.0)
+#define METAL_TARGET_VERSION MTL::LanguageVersion3_0
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// System version
+	#define _WIN32_WINNT _WIN32_WINNT_VISTA
+	
+	// Use Unicode
+	#define UNICODE
+	#define _UNICODE
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Use Metal
+	#define MTL_PRIVATE_IMPLEMENTATION
+	
+	// Use NS
+	#define NS_PRIVATE_IMPLEMENTATION
+	
+	// Use bounds-checking interfaces
+	#define __STDC_WANT_LIB_EXT1__ 1
+#endif
+
+
+// Header files
+
+// Check if using Windows
+#ifdef _WIN32
+
+	// Header files
+	#include <ws2tcpip.h>
+	#include <CL/cl.h>
+	
+// Otherwise check if using an Apple device
+#elif defined __APPLE__
+
+	// Header files
+	#include <TargetConditionals.h>
+	#include <arpa/inet.h>
+	#include <netdb.h>
+	#include <poll.h>
+	#include <sys/sysctl.h>
+	#include "./metal.h"
+	
+	// Check if using macOS
+	#if TARGET_OS_OSX == 1
+	
+		// Header files
+		#include <IOKit/pwr_mgt/IOPMLib.h>
+	#endif
+	
+	// Check if using OpenCL
+	#ifdef USE_OPENCL
+	
+		// Header files
+		#include <OpenCL/opencl.h>
+	#endif
+	
+// Otherwise
+#else
+
+	// Header files
+	#include <arpa/inet.h>
+	#include <CL/cl.h>
+	#include <CL/cl_ext.h>
+	#include <netdb.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+	
+	// Check if using FreeBSD
+	#ifdef __FreeBSD__
+	
+		// Header files
+		#include <pthread_np.h>
+	#endif
+	
+	// Check if not using Android
+	#ifndef __ANDROID__
+	
+		// Header files
+		#include <dbus/dbus.h>
+	#endif
+#endif
+
+// Header files
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cinttypes>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "./main.h"
+#include "./common.h"
+#include "./siphash.h"
+#include "./searching_threads_handoff.h"
+
+using namespace std;
+
+
+// Configurable constants
+
+// Number of seconds per run (Graphs are handed off to the searching threads for this long for every edge bits, number of searching threads, and handoff)
+#define NUMBER_OF_SECONDS_PER_RUN 1
+
+// Min edge bits
+#define MIN_EDGE_BITS 12
+
+// Max edge bits
+#define MAX_EDGE_BITS 20
+
+// Max number of searching threads
+#define MAX_NUMBER_OF_SEARCHING_THREADS 8
+
+// Number of edges per SipHash
+#define NUMBER_OF_EDGES_PER_SIPHASH 16
+
+
+// Classes
+
+// Mutex searching threads handoff class (This is the handoff that the searching threads handoff replaced, which hands graphs to the searching threads and back with a mutex and two condition variables)
+class MutexSearchingThreadsHandoff final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit MutexSearchingThreadsHandoff(const unsigned int numberOfSearchingThreads) noexcept;
+		
+		// Start
+		inline void start() noexcept;
+		
+		// Wait until started
+		inline uint32_t waitUntilStarted(const uint32_t previousSequence) noexcept;
+		
+		// Finished
+		inline void finished() noexcept;
+		
+		// Wait until finished
+		inline void waitUntilFinished() noexcept;
+		
+	// Private
+	private:
+	
+		// Number of searching threads
+		const unsigned int numberOfSearchingThreads;
+		
+		// Mutex
+		mutex handoffMutex;
+		
+		// Started condition
+		condition_variable startedCondition;
+		
+		// Finished condition
+		condition_variable finishedCondition;
+		
+		// Sequence
+		uint32_t sequence;
+		
+		// Number of searching threads remaining
+		uint32_t numberOfSearchingThreadsRemaining;
+};
+
+
+// Function prototypes
+
+// Get graphs per second
+template<typename Handoff> static inline double getGraphsPerSecond(const unsigned int edgeBits, const unsigned int numberOfSearchingThreads) noexcept;
+
+// Get edges' nodes
+static inline uint64_t getEdgesNodes(const uint64_t firstEdge, const uint64_t numberOfEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys) noexcept;
+
+
+// Main function
+int main() {
+
+	// Go through all edge bits
+	for(unsigned int edgeBits = MIN_EDGE_BITS; edgeBits <= MAX_EDGE_BITS; edgeBits += 2) {
+	
+		// Go through all numbers of searching threads
+		for(unsigned int numberOfSearchingThreads = 1; numberOfSearchingThreads <= MAX_NUMBER_OF_SEARCHING_THREADS; numberOfSearchingThreads *= 2) {
+		
+			// Get graphs per second with each handoff
+			const double mutexGraphsPerSecond = getGraphsPerSecond<MutexSearchingThreadsHandoff>(edgeBits, numberOfSearchingThreads);
+			const double graphsPerSecond = getGraphsPerSecond<SearchingThreadsHandoff>(edgeBits, numberOfSearchingThreads);
+			
+			// Display message
+			cout << "Cuckatoo" << edgeBits << " with " << numberOfSearchingThreads << " searching thread(s): mutex handoff " << mutexGraphsPerSecond << " graphs/s, searching threads handoff " << graphsPerSecond << " graphs/s (" << graphsPerSecond / mutexGraphsPerSecond << "x)" << endl;
+		}
+	}
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Constructor
+MutexSearchingThreadsHandoff::MutexSearchingThreadsHandoff(const unsigned int numberOfSearchingThreads) noexcept :
+
+	// Set number of searching threads
+	numberOfSearchingThreads(numberOfSearchingThreads),
+	
+	// Set sequence to zero
+	sequence(0),
+	
+	// Set number of searching threads remaining to the number of searching threads so that waiting until finished waits for them to initialize
+	numberOfSearchingThreadsRemaining(numberOfSearchingThreads)
+{
+}
+
+// Start
+void MutexSearchingThreadsHandoff::start() noexcept {
+
+	// Lock mutex
+	handoffMutex.lock();
+	
+	// Set number of searching threads remaining to the number of searching threads and increment sequence
+	numberOfSearchingThreadsRemaining = numberOfSearchingThreads;
+	++sequence;
+	
+	// Unlock mutex
+	handoffMutex.unlock();
+	
+	// Notify searching threads
+	startedCondition.notify_all();
+}
+
+// Wait until started
+uint32_t MutexSearchingThreadsHandoff::waitUntilStarted(const uint32_t previousSequence) noexcept {
+
+	// Wait until the sequence changes
+	unique_lock lock(handoffMutex);
+	startedCondition.wait(lock, [this, previousSequence]() noexcept {
+	
+		// Return if sequence changed
+		return sequence != previousSequence;
+	});
+	
+	// Return sequence
+	return sequence;
+}
+
+// Finished
+void MutexSearchingThreadsHandoff::finished() noexcept {
+
+	// Lock mutex
+	handoffMutex.lock();
+	
+	// Check if the searching thread is the last searching thread to finish
+	if(!--numberOfSearchingThreadsRemaining) {
+	
+		// Unlock mutex
+		handoffMutex.unlock();
+		
+		// Notify the trimming thread
+		finishedCondition.notify_one();
+	}
+	
+	// Otherwise
+	else {
+	
+		// Unlock mutex
+		handoffMutex.unlock();
+	}
+}
+
+// Wait until finished
+void MutexSearchingThreadsHandoff::waitUntilFinished() noexcept {
+
+	// Wait until all searching threads have finished
+	unique_lock lock(handoffMutex);
+	finishedCondition.wait(lock, [this]() noexcept {
+	
+		// Return if all searching threads have finished
+		return !numberOfSearchingThreadsRemaining;
+	});
+}
+
+// Get graphs per second (Each searching thread gets the nodes of its share of every graph's edges like the searching threads do when there's no trimming rounds, so small edge bits show the handoff's cost)
+template<typename Handoff> double getGraphsPerSecond(const unsigned int edgeBits, const unsigned int numberOfSearchingThreads) noexcept {
+
+	// Create handoff
+	Handoff handoff(numberOfSearchingThreads);
+	
+	// Go through all searching threads
+	const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys = {1, 2, 3, 4};
+	bool closeSearchingThreads = false;
+	uint64_t nodesChecksum = 0;
+	thread searchingThreads[MAX_NUMBER_OF_SEARCHING_THREADS];
+	for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
+	
+		// Create searching thread
+		searchingThreads[i] = thread([&handoff, &sipHashKeys, &closeSearchingThreads, &nodesChecksum, edgeBits, numberOfSearchingThreads, searchingThreadIndex = i]() noexcept {
+		
+			// Notify that the searching thread has initialized
+			handoff.finished();
+			
+			// Go through all graphs
+			for(uint32_t sequence = 0;;) {
+			
+				// Wait until a graph is started
+				sequence = handoff.waitUntilStarted(sequence);
+				
+				// Check if closing searching threads
+				if(closeSearchingThreads) {
+				
+					// Return
+					return;
+				}
+				
+				// Get nodes of the searching thread's share of the graph's edges
+				const uint64_t numberOfEdges = (static_cast<uint64_t>(1) << edgeBits) / numberOfSearchingThreads;
+				__atomic_fetch_xor(&nodesChecksum, getEdgesNodes(numberOfEdges * searchingThreadIndex, numberOfEdges, sipHashKeys), __ATOMIC_RELAXED);
+				
+				// Notify that the searching thread has finished
+				handoff.finished();
+			}
+		});
+	}
+	
+	// Wait until searching threads have initialized
+	handoff.waitUntilFinished();
+	
+	// Go through all graphs until the run's time has passed
+	uint64_t numberOfGraphs = 0;
+	const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+	chrono::high_resolution_clock::time_point endTime;
+	do {
+	
+		// Hand graph to the searching threads and wait until they've finished
+		handoff.start();
+		handoff.waitUntilFinished();
+		
+		// Increment number of graphs
+		++numberOfGraphs;
+		
+	} while((endTime = chrono::high_resolution_clock::now()) - startTime < chrono::seconds(NUMBER_OF_SECONDS_PER_RUN));
+	
+	// Close searching threads
+	closeSearchingThreads = true;
+	handoff.start();
+	
+	// Go through all searching threads
+	for(unsigned int i = 0; i < numberOfSearchingThreads; ++i) {
+	
+		// Join searching thread
+		searchingThreads[i].join();
+	}
+	
+	// Return graphs per second
+	return numberOfGraphs / static_cast<chrono::duration<double>>(endTime - startTime).count();
+}
+
+// Get edges' nodes
+uint64_t getEdgesNodes(const uint64_t firstEdge, const uint64_t numberOfEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys) noexcept {
+
+	// Go through all edges
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * NUMBER_OF_EDGES_PER_SIPHASH * 2))) nodesChecksum = {};
+	for(uint64_t edge = firstEdge; edge < firstEdge + numberOfEdges; edge += NUMBER_OF_EDGES_PER_SIPHASH) {
+	
+		// Go through all of the edges at a time
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * NUMBER_OF_EDGES_PER_SIPHASH * 2))) nonces;
+		for(uint_fast8_t i = 0; i < NUMBER_OF_EDGES_PER_SIPHASH * 2; ++i) {
+		
+			// Set nonce from the edge's index
+			nonces[i] = edge * 2 + i;
+		}
+		
+		// Get nodes from the nonces
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * NUMBER_OF_EDGES_PER_SIPHASH * 2))) nodes;
+		sipHash24<NUMBER_OF_EDGES_PER_SIPHASH * 2>(&nodes, sipHashKeys, &nonces);
+		nodesChecksum ^= nodes;
+	}
+	
+	// Go through all of the nodes checksum's components
+	uint64_t result = 0;
+	for(uint_fast8_t i = 0; i < NUMBER_OF_EDGES_PER_SIPHASH * 2; ++i) {
+	
+		// Add component to the result
+		result ^= nodesChecksum[i];
+	}
+	
+	// Return result
+	return result;
+}
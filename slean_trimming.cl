@@ -14,8 +14,8 @@ Repeat trimming round 6 if 8 trimming parts or until at most 6.25% of edges rema
 Trimming round 7: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four
 ...
 Trimming round n - 1: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four
-Trimming round n: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four
-Get result from edges bitmap
+Trimming round n: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four, clear first remaining edge, step thirty-five
+Get result from remaining edges
 
 This trimming algorithm can be made faster by switching to mean trimming once the number of trimming parts has been reduced to one.
 */
@@ -636,6 +636,16 @@ __kernel void trimEdgesStepThirtyThree(__global const uint2 *restrict sourceBuck
 // Trim edges step thirty-four
 __kernel void trimEdgesStepThirtyFour(__global const uint *restrict buckets, __global const uint *restrict numberOfEdgesPerBucket, __global uint *restrict edgesBitmap);
 
+// Check if work items per work group exists
+#ifdef TRIM_EDGES_STEP_THIRTY_FIVE_WORK_ITEMS_PER_WORK_GROUP
+
+	// Required work group size
+	__attribute__((reqd_work_group_size(TRIM_EDGES_STEP_THIRTY_FIVE_WORK_ITEMS_PER_WORK_GROUP, 1, 1)))
+#endif
+
+// Trim edges step thirty-five
+__kernel void trimEdgesStepThirtyFive(__global const ulong *restrict edgesBitmap, __global uint *restrict remainingEdges, const ulong4 sipHashKeys);
+
 // SipHash-2-4
 static inline uint sipHash24(ulong4 keys, const ulong nonce);
 
@@ -3442,6 +3452,84 @@ __kernel void trimEdgesStepThirtyFour(__global const uint *restrict buckets, __g
 	}
 }
 
+// Trim edges step thirty-five
+__kernel void trimEdgesStepThirtyFive(__global const ulong *restrict edgesBitmap, __global uint *restrict remainingEdges, const ulong4 sipHashKeys) {
+
+	// Declare number of edges and index
+	__local uint numberOfEdges;
+	__local uint index;
+	
+	// Get global ID
+	const uint globalId = get_global_id(0);
+	
+	// Get local ID
+	const ushort localId = get_local_id(0);
+	
+	// Check if this work item is the first in the work group
+	if(localId == 0) {
+	
+		// Set number of edges to zero
+		numberOfEdges = 0;
+	}
+	
+	// Synchronize work group
+	barrier(CLK_LOCAL_MEM_FENCE);
+	
+	// Get work item's edge indices
+	const uint indices = globalId * (char)(sizeof(ulong) * BITS_IN_A_BYTE);
+	
+	// Get this work item's edges
+	ulong edges = edgesBitmap[globalId];
+	
+	// Check if this work item has edges
+	uint offset = 0;
+	if(edges) {
+	
+		// Add this work item's number of edges to the work group's number of edges
+		offset = atomic_add(&numberOfEdges, (uint)popcount(edges));
+	}
+	
+	// Synchronize work group
+	barrier(CLK_LOCAL_MEM_FENCE);
+	
+	// Check if this work item is the first in the work group
+	if(localId == 0) {
+	
+		// Add work group's number of edges to the number of remaining edges
+		index = atomic_add(remainingEdges, numberOfEdges);
+	}
+	
+	// Synchronize work group
+	barrier(CLK_LOCAL_MEM_FENCE);
+	
+	// Go through all of this work item's enabled edges
+	for(uint i = index + offset; edges; ++i) {
+	
+		// Get edge's bit index
+		const char bitIndex = (char)(sizeof(ulong) * BITS_IN_A_BYTE) - 1 - clz(edges);
+		
+		// Disable edge
+		edges ^= (ulong)1 << bitIndex;
+		
+		// Get edge's index
+		const uint edgeIndex = indices + bitIndex;
+		
+		// Get edge's node
+		const uint node = sipHash24(sipHashKeys, (ulong)edgeIndex * 2);
+		
+		// Get edge's other node
+		const uint otherNode = sipHash24(sipHashKeys, ((ulong)edgeIndex * 2) | 1);
+		
+		// Get next remaining edge
+		__global uint *nextRemainingEdge = &remainingEdges[min(i, (uint)(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING - 1)) * EDGE_NUMBER_OF_COMPONENTS + 1];
+		
+		// Set next remaining edge to the edge and its nodes
+		nextRemainingEdge[0] = edgeIndex;
+		nextRemainingEdge[1] = node;
+		nextRemainingEdge[2] = otherNode;
+	}
+}
+
 // SipHash-2-4
 uint sipHash24(ulong4 keys, const ulong nonce) {
 
@@ -55,13 +55,13 @@ using namespace std;
 #if defined __APPLE__ && !defined USE_OPENCL
 
 	// Slean trimming required RAM bytes
-	#define SLEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + static_cast<uint64_t>(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(uint32_t) + SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * SLEAN_TRIMMING_PARTS * sizeof(uint32_t) + NUMBER_OF_EDGES / BITS_IN_A_BYTE * 3)
+	#define SLEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + static_cast<uint64_t>(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(uint32_t) + SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * SLEAN_TRIMMING_PARTS * sizeof(uint32_t) + NUMBER_OF_EDGES / BITS_IN_A_BYTE * 3 + (sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t)) * REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS)
 	
 // Otherwise
 #else
 
 	// Slean trimming required RAM bytes
-	#define SLEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + static_cast<uint64_t>(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint) + SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * SLEAN_TRIMMING_PARTS * sizeof(cl_uint) + NUMBER_OF_EDGES / BITS_IN_A_BYTE * 3)
+	#define SLEAN_TRIMMING_REQUIRED_RAM_BYTES (static_cast<uint64_t>(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + static_cast<uint64_t>(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint) + SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint) + SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * SLEAN_TRIMMING_PARTS * sizeof(cl_uint) + NUMBER_OF_EDGES / BITS_IN_A_BYTE * 3 + (sizeof(cl_uint) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(cl_uint)) * REMAINING_EDGES_RING_BUFFER_NUMBER_OF_SLOTS)
 #endif
 
 // Slean trimming required work group RAM bytes
@@ -95,7 +95,7 @@ using namespace std;
 #else
 
 	// Create slean trimming context
-	static inline cl_context createSleanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const unsigned int deviceIndex) noexcept;
+	static inline cl_context createSleanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const cl_device_type deviceTypes, const unsigned int deviceIndex) noexcept;
 	
 	// Perform slean trimming loop
 	static inline bool performSleanTrimmingLoop(const cl_context context) noexcept;
@@ -195,7 +195,7 @@ using namespace std;
 #else
 
 	// Create slean trimming context
-	cl_context createSleanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const unsigned int deviceIndex) noexcept {
+	cl_context createSleanTrimmingContext(const cl_platform_id platforms[], const cl_uint numberOfPlatforms, const cl_device_type deviceTypes, const unsigned int deviceIndex) noexcept {
 	
 		// Set index to zero
 		unsigned int index = 0;
@@ -205,11 +205,11 @@ using namespace std;
 			
 			// Check if getting platform's number of devices was successful and devices exist
 			cl_uint numberOfDevices;
-			if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
+			if(clGetDeviceIDs(platforms[i], deviceTypes, 0, nullptr, &numberOfDevices) == CL_SUCCESS && numberOfDevices) {
 			
 				// Check if getting platform's devices was successful
 				cl_device_id devices[numberOfDevices];
-				if(clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
+				if(clGetDeviceIDs(platforms[i], deviceTypes, numberOfDevices, devices, nullptr) == CL_SUCCESS) {
 				
 					// Go through all of the platform's devices
 					for(cl_uint j = 0; j < numberOfDevices; ++j) {
@@ -315,6 +315,9 @@ using namespace std;
 			// Edge bits value
 			MTLSTR(TO_STRING(EDGE_BITS)),
 			
+			// Edge number of components value
+			MTLSTR(TO_STRING(EDGE_NUMBER_OF_COMPONENTS)),
+			
 			// Slean trimming parts value
 			MTLSTR(TO_STRING(SLEAN_TRIMMING_PARTS)),
 			
@@ -412,6 +415,14 @@ using namespace std;
 				// Free local buckets size value
 				localBucketsSizeValue->release();
 				
+			}).get(),
+			
+			// Max number of edges after trimming value
+			unique_ptr<NS::Number, void(*)(NS::Number *)>(NS::Number::alloc()->init(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING), [](NS::Number *maxNumberOfEdgesAfterTrimmingValue) noexcept {
+			
+				// Free max number of edges after trimming value
+				maxNumberOfEdgesAfterTrimmingValue->release();
+				
 			}).get()
 		
 		}, (const NS::Object *[]){
@@ -419,6 +430,9 @@ using namespace std;
 			// Edge bits key
 			MTLSTR("EDGE_BITS"),
 			
+			// Edge number of components key
+			MTLSTR("EDGE_NUMBER_OF_COMPONENTS"),
+			
 			// Slean trimming parts key
 			MTLSTR("SLEAN_TRIMMING_PARTS"),
 			
@@ -456,9 +470,12 @@ using namespace std;
 			MTLSTR("INITIAL_BUCKETS_NUMBER_OF_BUCKETS"),
 			
 			// Local buckets size key
-			MTLSTR("LOCAL_BUCKETS_SIZE")
+			MTLSTR("LOCAL_BUCKETS_SIZE"),
+			
+			// Max number of edges after trimming key
+			MTLSTR("MAX_NUMBER_OF_EDGES_AFTER_TRIMMING")
 		
-		}, 14), [](NS::Dictionary *preprocessorMacros) noexcept {
+		}, 16), [](NS::Dictionary *preprocessorMacros) noexcept {
 		
 			// Free preprocessor macros
 			preprocessorMacros->release();
@@ -698,6 +715,11 @@ using namespace std;
 			// Free step thirty-four kernel
 			stepThirtyFourKernel->release();
 		});
+		const unique_ptr<MTL::Function, void(*)(MTL::Function *)> stepThirtyFiveKernel(library->newFunction(MTLSTR("trimEdgesStepThirtyFive")), [](MTL::Function *stepThirtyFiveKernel) noexcept {
+		
+			// Free step thirty-five kernel
+			stepThirtyFiveKernel->release();
+		});
 		const unique_ptr<MTL::Function, void(*)(MTL::Function *)> clearNumberOfEdgesPerSourceBucketKernel(library->newFunction(MTLSTR("clearNumberOfEdgesPerSourceBucket")), [](MTL::Function *clearNumberOfEdgesPerSourceBucketKernel) noexcept {
 		
 			// Free clear number of edges per source bucket kernel
@@ -728,7 +750,7 @@ using namespace std;
 			// Free clear number of edges per destination bucket sixteen kernel
 			clearNumberOfEdgesPerDestinationBucketSixteenKernel->release();
 		});
-		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !stepSixKernel || !stepSevenKernel || !stepEightKernel || !stepNineKernel || !stepTenKernel || !stepElevenKernel || !stepTwelveKernel || !stepThirteenKernel || !stepFourteenKernel || !stepFifteenKernel || !stepSixteenKernel || !stepSeventeenKernel || !stepEighteenKernel || !stepNineteenKernel || !stepTwentyKernel || !stepTwentyOneKernel || !stepTwentyTwoKernel || !stepTwentyThreeKernel || !stepTwentyFourKernel || !stepTwentyFiveKernel || !stepTwentySixKernel || !stepTwentySevenKernel || !stepTwentyEightKernel || !stepTwentyNineKernel || !stepThirtyKernel || !stepThirtyOneKernel || !stepThirtyTwoKernel || !stepThirtyThreeKernel || !stepThirtyFourKernel || !clearNumberOfEdgesPerSourceBucketKernel || !clearNumberOfEdgesPerDestinationBucketOneKernel || !clearNumberOfEdgesPerDestinationBucketTwoKernel || !clearNumberOfEdgesPerDestinationBucketFourKernel || !clearNumberOfEdgesPerDestinationBucketEightKernel || !clearNumberOfEdgesPerDestinationBucketSixteenKernel) {
+		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !stepSixKernel || !stepSevenKernel || !stepEightKernel || !stepNineKernel || !stepTenKernel || !stepElevenKernel || !stepTwelveKernel || !stepThirteenKernel || !stepFourteenKernel || !stepFifteenKernel || !stepSixteenKernel || !stepSeventeenKernel || !stepEighteenKernel || !stepNineteenKernel || !stepTwentyKernel || !stepTwentyOneKernel || !stepTwentyTwoKernel || !stepTwentyThreeKernel || !stepTwentyFourKernel || !stepTwentyFiveKernel || !stepTwentySixKernel || !stepTwentySevenKernel || !stepTwentyEightKernel || !stepTwentyNineKernel || !stepThirtyKernel || !stepThirtyOneKernel || !stepThirtyTwoKernel || !stepThirtyThreeKernel || !stepThirtyFourKernel || !stepThirtyFiveKernel || !clearNumberOfEdgesPerSourceBucketKernel || !clearNumberOfEdgesPerDestinationBucketOneKernel || !clearNumberOfEdgesPerDestinationBucketTwoKernel || !clearNumberOfEdgesPerDestinationBucketFourKernel || !clearNumberOfEdgesPerDestinationBucketEightKernel || !clearNumberOfEdgesPerDestinationBucketSixteenKernel) {
 		
 			// Display message
 			cout << "Getting kernels from the library failed." << endl;
@@ -942,6 +964,12 @@ using namespace std;
 			// Free step thirty-four pipeline
 			stepThirtyFourPipeline->release();
 		});
+		NS::Error *createPipelineThirtyFiveError;
+		unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)> stepThirtyFivePipeline(device->newComputePipelineState(stepThirtyFiveKernel.get(), &createPipelineThirtyFiveError), [](MTL::ComputePipelineState *stepThirtyFivePipeline) noexcept {
+		
+			// Free step thirty-five pipeline
+			stepThirtyFivePipeline->release();
+		});
 		NS::Error *createPipelineClearNumberOfEdgesPerSourceBucketError;
 		unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)> clearNumberOfEdgesPerSourceBucketPipeline(device->newComputePipelineState(clearNumberOfEdgesPerSourceBucketKernel.get(), &createPipelineClearNumberOfEdgesPerSourceBucketError), [](MTL::ComputePipelineState *clearNumberOfEdgesPerSourceBucketPipeline) noexcept {
 		
@@ -978,7 +1006,7 @@ using namespace std;
 			// Free clear number of edges per destination bucket sixteen pipeline
 			clearNumberOfEdgesPerDestinationBucketSixteenPipeline->release();
 		});
-		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !stepFivePipeline || !stepSixPipeline || !stepSevenPipeline || !stepEightPipeline || !stepNinePipeline || !stepTenPipeline || !stepElevenPipeline || !stepTwelvePipeline || !stepThirteenPipeline || !stepFourteenPipeline || !stepFifteenPipeline || !stepSixteenPipeline || !stepSeventeenPipeline || !stepEighteenPipeline || !stepNineteenPipeline || !stepTwentyPipeline || !stepTwentyOnePipeline || !stepTwentyTwoPipeline || !stepTwentyThreePipeline || !stepTwentyFourPipeline || !stepTwentyFivePipeline || !stepTwentySixPipeline || !stepTwentySevenPipeline || !stepTwentyEightPipeline || !stepTwentyNinePipeline || !stepThirtyPipeline || !stepThirtyOnePipeline || !stepThirtyTwoPipeline || !stepThirtyThreePipeline || !stepThirtyFourPipeline || !clearNumberOfEdgesPerSourceBucketPipeline || !clearNumberOfEdgesPerDestinationBucketOnePipeline || !clearNumberOfEdgesPerDestinationBucketTwoPipeline || !clearNumberOfEdgesPerDestinationBucketFourPipeline || !clearNumberOfEdgesPerDestinationBucketEightPipeline || !clearNumberOfEdgesPerDestinationBucketSixteenPipeline) {
+		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !stepFivePipeline || !stepSixPipeline || !stepSevenPipeline || !stepEightPipeline || !stepNinePipeline || !stepTenPipeline || !stepElevenPipeline || !stepTwelvePipeline || !stepThirteenPipeline || !stepFourteenPipeline || !stepFifteenPipeline || !stepSixteenPipeline || !stepSeventeenPipeline || !stepEighteenPipeline || !stepNineteenPipeline || !stepTwentyPipeline || !stepTwentyOnePipeline || !stepTwentyTwoPipeline || !stepTwentyThreePipeline || !stepTwentyFourPipeline || !stepTwentyFivePipeline || !stepTwentySixPipeline || !stepTwentySevenPipeline || !stepTwentyEightPipeline || !stepTwentyNinePipeline || !stepThirtyPipeline || !stepThirtyOnePipeline || !stepThirtyTwoPipeline || !stepThirtyThreePipeline || !stepThirtyFourPipeline || !stepThirtyFivePipeline || !clearNumberOfEdgesPerSourceBucketPipeline || !clearNumberOfEdgesPerDestinationBucketOnePipeline || !clearNumberOfEdgesPerDestinationBucketTwoPipeline || !clearNumberOfEdgesPerDestinationBucketFourPipeline || !clearNumberOfEdgesPerDestinationBucketEightPipeline || !clearNumberOfEdgesPerDestinationBucketSixteenPipeline) {
 		
 			// Display message
 			cout << "Creating pipelines for the GPU failed." << endl;
@@ -1561,6 +1589,23 @@ using namespace std;
 				}
 			}
 			
+			// Check if creating pipeline thirty-five failed and an error exists
+			if(!stepThirtyFivePipeline && createPipelineThirtyFiveError) {
+			
+				// Check if error's localized description exists
+				const NS::String *localizedDescription = createPipelineThirtyFiveError->localizedDescription();
+				if(localizedDescription) {
+				
+					// Check if localized description's UTF-8 string exists
+					const char *utf8String = localizedDescription->utf8String();
+					if(utf8String) {
+					
+						// Display message
+						cout << utf8String << endl;
+					}
+				}
+			}
+			
 			// Check if creating pipeline clear number of edges per source bucket failed and an error exists
 			if(!clearNumberOfEdgesPerSourceBucketPipeline && createPipelineClearNumberOfEdgesPerSourceBucketError) {
 			
@@ -1772,6 +1817,9 @@ using namespace std;
 			// Trim edges step thirty-four kernel
 			{SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 16 * min(bit_floor(device->maxThreadsPerThreadgroup().width), bit_floor(static_cast<NS::UInteger>(INT16_MAX / 2))), 1, 1},
 			
+			// Trim edges step thirty-five kernel
+			{NUMBER_OF_EDGES / (sizeof(uint64_t) * BITS_IN_A_BYTE), 1, 1},
+			
 			// Clear number of edges per source bucket kernel
 			{(SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(uint32_t) + sizeof(uint64_t) - 1) / sizeof(uint64_t), 1, 1},
 			
@@ -1896,23 +1944,26 @@ using namespace std;
 			// Trim edges step thirty-four kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), bit_floor(static_cast<NS::UInteger>(INT16_MAX / 2))), 1, 1},
 			
-			// Clear number of edges per source bucket kernel
+			// Trim edges step thirty-five kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[34].width), 1, 1},
 			
-			// Clear number of edges per destination bucket one kernel
+			// Clear number of edges per source bucket kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[35].width), 1, 1},
 			
-			// Clear number of edges per destination bucket two kernel
+			// Clear number of edges per destination bucket one kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[36].width), 1, 1},
 			
-			// Clear number of edges per destination bucket four kernel
+			// Clear number of edges per destination bucket two kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[37].width), 1, 1},
 			
-			// Clear number of edges per destination bucket eight kernel
+			// Clear number of edges per destination bucket four kernel
 			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[38].width), 1, 1},
 			
+			// Clear number of edges per destination bucket eight kernel
+			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[39].width), 1, 1},
+			
 			// Clear number of edges per destination bucket sixteen kernel
-			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[39].width), 1, 1}
+			{min(bit_floor(device->maxThreadsPerThreadgroup().width), totalNumberOfWorkItems[40].width), 1, 1}
 		};
 		
 		// Check if creating pipeline descriptors failed
@@ -2086,6 +2137,11 @@ using namespace std;
 			// Free step thirty-four pipeline descriptor
 			stepThirtyFourPipelineDescriptor->release();
 		});
+		const unique_ptr<MTL::ComputePipelineDescriptor, void(*)(MTL::ComputePipelineDescriptor *)> stepThirtyFivePipelineDescriptor(MTL::ComputePipelineDescriptor::alloc()->init(), [](MTL::ComputePipelineDescriptor *stepThirtyFivePipelineDescriptor) noexcept {
+		
+			// Free step thirty-five pipeline descriptor
+			stepThirtyFivePipelineDescriptor->release();
+		});
 		const unique_ptr<MTL::ComputePipelineDescriptor, void(*)(MTL::ComputePipelineDescriptor *)> clearNumberOfEdgesPerSourceBucketPipelineDescriptor(MTL::ComputePipelineDescriptor::alloc()->init(), [](MTL::ComputePipelineDescriptor *clearNumberOfEdgesPerSourceBucketPipelineDescriptor) noexcept {
 		
 			// Free clear number of edges per source bucket pipeline descriptor
@@ -2116,7 +2172,7 @@ using namespace std;
 			// Free clear number of edges per destination bucket sixteen pipeline descriptor
 			clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor->release();
 		});
-		if(!stepOnePipelineDescriptor || !stepTwoPipelineDescriptor || !stepThreePipelineDescriptor || !stepFourPipelineDescriptor || !stepFivePipelineDescriptor || !stepSixPipelineDescriptor || !stepSevenPipelineDescriptor || !stepEightPipelineDescriptor || !stepNinePipelineDescriptor || !stepTenPipelineDescriptor || !stepElevenPipelineDescriptor || !stepTwelvePipelineDescriptor || !stepThirteenPipelineDescriptor || !stepFourteenPipelineDescriptor || !stepFifteenPipelineDescriptor || !stepSixteenPipelineDescriptor || !stepSeventeenPipelineDescriptor || !stepEighteenPipelineDescriptor || !stepNineteenPipelineDescriptor || !stepTwentyPipelineDescriptor || !stepTwentyOnePipelineDescriptor || !stepTwentyTwoPipelineDescriptor || !stepTwentyThreePipelineDescriptor || !stepTwentyFourPipelineDescriptor || !stepTwentyFivePipelineDescriptor || !stepTwentySixPipelineDescriptor || !stepTwentySevenPipelineDescriptor || !stepTwentyEightPipelineDescriptor || !stepTwentyNinePipelineDescriptor || !stepThirtyPipelineDescriptor || !stepThirtyOnePipelineDescriptor || !stepThirtyTwoPipelineDescriptor || !stepThirtyThreePipelineDescriptor || !stepThirtyFourPipelineDescriptor || !clearNumberOfEdgesPerSourceBucketPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor) {
+		if(!stepOnePipelineDescriptor || !stepTwoPipelineDescriptor || !stepThreePipelineDescriptor || !stepFourPipelineDescriptor || !stepFivePipelineDescriptor || !stepSixPipelineDescriptor || !stepSevenPipelineDescriptor || !stepEightPipelineDescriptor || !stepNinePipelineDescriptor || !stepTenPipelineDescriptor || !stepElevenPipelineDescriptor || !stepTwelvePipelineDescriptor || !stepThirteenPipelineDescriptor || !stepFourteenPipelineDescriptor || !stepFifteenPipelineDescriptor || !stepSixteenPipelineDescriptor || !stepSeventeenPipelineDescriptor || !stepEighteenPipelineDescriptor || !stepNineteenPipelineDescriptor || !stepTwentyPipelineDescriptor || !stepTwentyOnePipelineDescriptor || !stepTwentyTwoPipelineDescriptor || !stepTwentyThreePipelineDescriptor || !stepTwentyFourPipelineDescriptor || !stepTwentyFivePipelineDescriptor || !stepTwentySixPipelineDescriptor || !stepTwentySevenPipelineDescriptor || !stepTwentyEightPipelineDescriptor || !stepTwentyNinePipelineDescriptor || !stepThirtyPipelineDescriptor || !stepThirtyOnePipelineDescriptor || !stepThirtyTwoPipelineDescriptor || !stepThirtyThreePipelineDescriptor || !stepThirtyFourPipelineDescriptor || !stepThirtyFivePipelineDescriptor || !clearNumberOfEdgesPerSourceBucketPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor || !clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor) {
 		
 			// Display message
 			cout << "Creating pipeline descriptors failed." << endl;
@@ -2262,29 +2318,33 @@ using namespace std;
 		stepThirtyFourPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[33].width);
 		stepThirtyFourPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[33].width % stepThirtyFourPipeline->threadExecutionWidth() == 0);
 		
+		stepThirtyFivePipelineDescriptor->setComputeFunction(stepThirtyFiveKernel.get());
+		stepThirtyFivePipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[34].width);
+		stepThirtyFivePipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[34].width % stepThirtyFivePipeline->threadExecutionWidth() == 0);
+		
 		clearNumberOfEdgesPerSourceBucketPipelineDescriptor->setComputeFunction(clearNumberOfEdgesPerSourceBucketKernel.get());
-		clearNumberOfEdgesPerSourceBucketPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[34].width);
-		clearNumberOfEdgesPerSourceBucketPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[34].width % clearNumberOfEdgesPerSourceBucketPipeline->threadExecutionWidth() == 0);
+		clearNumberOfEdgesPerSourceBucketPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[35].width);
+		clearNumberOfEdgesPerSourceBucketPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[35].width % clearNumberOfEdgesPerSourceBucketPipeline->threadExecutionWidth() == 0);
 		
 		clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor->setComputeFunction(clearNumberOfEdgesPerDestinationBucketOneKernel.get());
-		clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[35].width);
-		clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[35].width % clearNumberOfEdgesPerDestinationBucketOnePipeline->threadExecutionWidth() == 0);
+		clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[36].width);
+		clearNumberOfEdgesPerDestinationBucketOnePipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[36].width % clearNumberOfEdgesPerDestinationBucketOnePipeline->threadExecutionWidth() == 0);
 		
 		clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor->setComputeFunction(clearNumberOfEdgesPerDestinationBucketTwoKernel.get());
-		clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[36].width);
-		clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[36].width % clearNumberOfEdgesPerDestinationBucketTwoPipeline->threadExecutionWidth() == 0);
+		clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[37].width);
+		clearNumberOfEdgesPerDestinationBucketTwoPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[37].width % clearNumberOfEdgesPerDestinationBucketTwoPipeline->threadExecutionWidth() == 0);
 		
 		clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor->setComputeFunction(clearNumberOfEdgesPerDestinationBucketFourKernel.get());
-		clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[37].width);
-		clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[37].width % clearNumberOfEdgesPerDestinationBucketFourPipeline->threadExecutionWidth() == 0);
+		clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[38].width);
+		clearNumberOfEdgesPerDestinationBucketFourPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[38].width % clearNumberOfEdgesPerDestinationBucketFourPipeline->threadExecutionWidth() == 0);
 		
 		clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor->setComputeFunction(clearNumberOfEdgesPerDestinationBucketEightKernel.get());
-		clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[38].width);
-		clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[38].width % clearNumberOfEdgesPerDestinationBucketEightPipeline->threadExecutionWidth() == 0);
+		clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[39].width);
+		clearNumberOfEdgesPerDestinationBucketEightPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[39].width % clearNumberOfEdgesPerDestinationBucketEightPipeline->threadExecutionWidth() == 0);
 		
 		clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor->setComputeFunction(clearNumberOfEdgesPerDestinationBucketSixteenKernel.get());
-		clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[39].width);
-		clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[39].width % clearNumberOfEdgesPerDestinationBucketSixteenPipeline->threadExecutionWidth() == 0);
+		clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor->setMaxTotalThreadsPerThreadgroup(workItemsPerWorkGroup[40].width);
+		clearNumberOfEdgesPerDestinationBucketSixteenPipelineDescriptor->setThreadGroupSizeIsMultipleOfThreadExecutionWidth(workItemsPerWorkGroup[40].width % clearNumberOfEdgesPerDestinationBucketSixteenPipeline->threadExecutionWidth() == 0);
 		
 		// Check if recreating pipelines for the device with hardcoded work items per work group failed
 		stepOnePipeline = unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)>(device->newComputePipelineState(stepOnePipelineDescriptor.get(), MTL::PipelineOptionNone, nullptr, &createPipelineOneError), [](MTL::ComputePipelineState *stepOnePipeline) noexcept {
@@ -2458,6 +2518,11 @@ using namespace std;
 			// Free step thirty-four pipeline
 			stepThirtyFourPipeline->release();
 		});
+		stepThirtyFivePipeline = unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)>(device->newComputePipelineState(stepThirtyFivePipelineDescriptor.get(), MTL::PipelineOptionNone, nullptr, &createPipelineThirtyFiveError), [](MTL::ComputePipelineState *stepThirtyFivePipeline) noexcept {
+		
+			// Free step thirty-five pipeline
+			stepThirtyFivePipeline->release();
+		});
 		clearNumberOfEdgesPerSourceBucketPipeline = unique_ptr<MTL::ComputePipelineState, void(*)(MTL::ComputePipelineState *)>(device->newComputePipelineState(clearNumberOfEdgesPerSourceBucketPipelineDescriptor.get(), MTL::PipelineOptionNone, nullptr, &createPipelineClearNumberOfEdgesPerSourceBucketError), [](MTL::ComputePipelineState *clearNumberOfEdgesPerSourceBucketPipeline) noexcept {
 		
 			// Free clear number of edges per source bucket pipeline
@@ -2488,7 +2553,7 @@ using namespace std;
 			// Free clear number of edges per destination bucket sixteen pipeline
 			clearNumberOfEdgesPerDestinationBucketSixteenPipeline->release();
 		});
-		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !stepFivePipeline || !stepSixPipeline || !stepSevenPipeline || !stepEightPipeline || !stepNinePipeline || !stepTenPipeline || !stepElevenPipeline || !stepTwelvePipeline || !stepThirteenPipeline || !stepFourteenPipeline || !stepFifteenPipeline || !stepSixteenPipeline || !stepSeventeenPipeline || !stepEighteenPipeline || !stepNineteenPipeline || !stepTwentyPipeline || !stepTwentyOnePipeline || !stepTwentyTwoPipeline || !stepTwentyThreePipeline || !stepTwentyFourPipeline || !stepTwentyFivePipeline || !stepTwentySixPipeline || !stepTwentySevenPipeline || !stepTwentyEightPipeline || !stepTwentyNinePipeline || !stepThirtyPipeline || !stepThirtyOnePipeline || !stepThirtyTwoPipeline || !stepThirtyThreePipeline || !stepThirtyFourPipeline || !clearNumberOfEdgesPerSourceBucketPipeline || !clearNumberOfEdgesPerDestinationBucketOnePipeline || !clearNumberOfEdgesPerDestinationBucketTwoPipeline || !clearNumberOfEdgesPerDestinationBucketFourPipeline || !clearNumberOfEdgesPerDestinationBucketEightPipeline || !clearNumberOfEdgesPerDestinationBucketSixteenPipeline) {
+		if(!stepOnePipeline || !stepTwoPipeline || !stepThreePipeline || !stepFourPipeline || !stepFivePipeline || !stepSixPipeline || !stepSevenPipeline || !stepEightPipeline || !stepNinePipeline || !stepTenPipeline || !stepElevenPipeline || !stepTwelvePipeline || !stepThirteenPipeline || !stepFourteenPipeline || !stepFifteenPipeline || !stepSixteenPipeline || !stepSeventeenPipeline || !stepEighteenPipeline || !stepNineteenPipeline || !stepTwentyPipeline || !stepTwentyOnePipeline || !stepTwentyTwoPipeline || !stepTwentyThreePipeline || !stepTwentyFourPipeline || !stepTwentyFivePipeline || !stepTwentySixPipeline || !stepTwentySevenPipeline || !stepTwentyEightPipeline || !stepTwentyNinePipeline || !stepThirtyPipeline || !stepThirtyOnePipeline || !stepThirtyTwoPipeline || !stepThirtyThreePipeline || !stepThirtyFourPipeline || !stepThirtyFivePipeline || !clearNumberOfEdgesPerSourceBucketPipeline || !clearNumberOfEdgesPerDestinationBucketOnePipeline || !clearNumberOfEdgesPerDestinationBucketTwoPipeline || !clearNumberOfEdgesPerDestinationBucketFourPipeline || !clearNumberOfEdgesPerDestinationBucketEightPipeline || !clearNumberOfEdgesPerDestinationBucketSixteenPipeline) {
 		
 			// Display message
 			cout << "Creating pipelines for the GPU failed." << endl;
@@ -3071,6 +3136,23 @@ using namespace std;
 				}
 			}
 			
+			// Check if recreating pipeline thirty-five failed and an error exists
+			if(!stepThirtyFivePipeline && createPipelineThirtyFiveError) {
+			
+				// Check if error's localized description exists
+				const NS::String *localizedDescription = createPipelineThirtyFiveError->localizedDescription();
+				if(localizedDescription) {
+				
+					// Check if localized description's UTF-8 string exists
+					const char *utf8String = localizedDescription->utf8String();
+					if(utf8String) {
+					
+						// Display message
+						cout << utf8String << endl;
+					}
+				}
+			}
+			
 			// Check if recreating pipeline clear number of edges per source bucket failed and an error exists
 			if(!clearNumberOfEdgesPerSourceBucketPipeline && createPipelineClearNumberOfEdgesPerSourceBucketError) {
 			
@@ -3203,12 +3285,12 @@ using namespace std;
 			// Free number of edges per bucket two
 			numberOfEdgesPerBucketTwo->release();
 		});
-		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapOne(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapOne) noexcept {
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapOne(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModePrivate | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapOne) noexcept {
 		
 			// Free edges bitmap one
 			edgesBitmapOne->release();
 		});
-		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapTwo(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapTwo) noexcept {
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> edgesBitmapTwo(device->newBuffer(NUMBER_OF_EDGES / BITS_IN_A_BYTE, MTL::ResourceStorageModePrivate | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *edgesBitmapTwo) noexcept {
 		
 			// Free edges bitmap two
 			edgesBitmapTwo->release();
@@ -3218,6 +3300,16 @@ using namespace std;
 			// Free nodes bitmap
 			nodesBitmap->release();
 		});
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> remainingEdgesOne(device->newBuffer(sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t), MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *remainingEdgesOne) noexcept {
+		
+			// Free remaining edges one
+			remainingEdgesOne->release();
+		});
+		const unique_ptr<MTL::Buffer, void(*)(MTL::Buffer *)> remainingEdgesTwo(device->newBuffer(sizeof(uint32_t) + static_cast<uint64_t>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) * EDGE_NUMBER_OF_COMPONENTS * sizeof(uint32_t), MTL::ResourceStorageModeShared | MTL::ResourceHazardTrackingModeUntracked), [](MTL::Buffer *remainingEdgesTwo) noexcept {
+		
+			// Free remaining edges two
+			remainingEdgesTwo->release();
+		});
 		if(!bucketsOne || (bucketsOneNumberOfBuckets != SLEAN_TRIMMING_NUMBER_OF_BUCKETS && !bucketsOneSecondPart) || !bucketsTwo || !numberOfEdgesPerBucketOne || !numberOfEdgesPerBucketTwo || !edgesBitmapOne || !edgesBitmapTwo || !nodesBitmap) {
 		
 			// Display message
@@ -3303,9 +3395,12 @@ using namespace std;
 		uint64_t heightOne = jobHeight;
 		uint64_t idOne = jobId;
 		uint64_t nonceOne = jobNonce++;
-		blake2b(sipHashKeysOne, jobHeader, nonceOne);
+		blake2b(sipHashKeysOne, jobHeaderMidstate, nonceOne);
 		
-		// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, and edges bitmap arguments
+		// Clear the beginning of remaining edges one
+		reinterpret_cast<uint32_t *>(remainingEdgesOne->contents())[0] = 0;
+		
+		// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, edges bitmap, and remaining edges arguments
 		computePassEncoder->setBuffer(bucketsOne.get(), 0, 0);
 		computePassEncoder->setBuffer(numberOfEdgesPerBucketOne.get(), 0, 1);
 		computePassEncoder->setBytes(&sipHashKeysOne, sizeof(sipHashKeysOne), 2);
@@ -3313,6 +3408,7 @@ using namespace std;
 		computePassEncoder->setBuffer(bucketsTwo.get(), 0, 6);
 		computePassEncoder->setBuffer(numberOfEdgesPerBucketTwo.get(), 0, 7);
 		computePassEncoder->setBuffer(edgesBitmapOne.get(), 0, 8);
+		computePassEncoder->setBuffer(remainingEdgesOne.get(), 0, 10);
 		
 		// Check if using buckets one second part
 		if(bucketsOneNumberOfBuckets != SLEAN_TRIMMING_NUMBER_OF_BUCKETS) {
@@ -3323,7 +3419,7 @@ using namespace std;
 		
 		// Add clearing number of edges per bucket one to the compute pass
 		computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 		
 		// Set compute pass's part argument
 		computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(0)), sizeof(uint8_t), 3);
@@ -3341,7 +3437,7 @@ using namespace std;
 		
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Set compute pass's part argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -3363,7 +3459,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket two to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 				
 				// Add running step four to the compute pass
 				computePassEncoder->setComputePipelineState(stepFourPipeline.get());
@@ -3380,7 +3476,7 @@ using namespace std;
 		
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Set compute pass's part argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -3391,7 +3487,7 @@ using namespace std;
 			
 			// Add clearing number of edges per bucket two to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 			
 			// Add running step six to the compute pass
 			computePassEncoder->setComputePipelineState(stepSixPipeline.get());
@@ -3407,7 +3503,7 @@ using namespace std;
 		
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Add running step seven to the compute pass
 			computePassEncoder->setComputePipelineState(stepSevenPipeline.get());
@@ -3422,7 +3518,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -3444,7 +3540,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 					
 					// Add running step ten to the compute pass
 					computePassEncoder->setComputePipelineState(stepTenPipeline.get());
@@ -3461,7 +3557,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -3472,7 +3568,7 @@ using namespace std;
 				
 				// Add clearing number of edges per bucket two to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 				
 				// Add running step twelve to the compute pass
 				computePassEncoder->setComputePipelineState(stepTwelvePipeline.get());
@@ -3488,7 +3584,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Add running step thirteen to the compute pass
 				computePassEncoder->setComputePipelineState(stepThirteenPipeline.get());
@@ -3506,7 +3602,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket one to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 						
 						// Set compute pass's part argument
 						computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -3528,7 +3624,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket two to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 							
 							// Add running step sixteen to the compute pass
 							computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -3542,7 +3638,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 					
 					// Add running step sixteen to the compute pass
 					computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -3558,7 +3654,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Set compute pass's part argument
 					computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -3569,7 +3665,7 @@ using namespace std;
 					
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 					
 					// Add running step eighteen to the compute pass
 					computePassEncoder->setComputePipelineState(stepEighteenPipeline.get());
@@ -3588,7 +3684,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket one to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 						
 						// Set compute pass's nodes in second partition argument
 						computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -3609,7 +3705,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's part argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -3631,7 +3727,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 									
 									// Add running step twenty-two to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -3645,7 +3741,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket two to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 							
 							// Add running step twenty-two to the compute pass
 							computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -3661,7 +3757,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's part argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -3672,7 +3768,7 @@ using namespace std;
 							
 							// Add clearing number of edges per bucket two to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 							
 							// Add running step twenty-three to the compute pass
 							computePassEncoder->setComputePipelineState(stepTwentyThreePipeline.get());
@@ -3692,7 +3788,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's nodes in second partition argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -3713,7 +3809,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -3735,7 +3831,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 										
 										// Add running step twenty-five to the compute pass
 										computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -3749,7 +3845,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 								
 								// Add running step twenty-five to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -3765,7 +3861,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's part argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -3776,7 +3872,7 @@ using namespace std;
 								
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 								
 								// Add running step twenty-seven to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentySevenPipeline.get());
@@ -3796,7 +3892,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's nodes in second partition argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -3817,7 +3913,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's part argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -3839,7 +3935,7 @@ using namespace std;
 										
 											// Add clearing number of edges per bucket two to the compute pass
 											computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 											
 											// Add running step twenty-nine to the compute pass
 											computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -3853,7 +3949,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 									
 									// Add running step twenty-nine to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -3869,7 +3965,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -3880,7 +3976,7 @@ using namespace std;
 									
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 									
 									// Add running step thirty-one to the compute pass
 									computePassEncoder->setComputePipelineState(stepThirtyOnePipeline.get());
@@ -3900,7 +3996,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's nodes in second partition argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -3911,7 +4007,7 @@ using namespace std;
 									
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketSixteenPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[40], workItemsPerWorkGroup[40]);
 									
 									// Add running step thirty-three to the compute pass
 									computePassEncoder->setComputePipelineState(stepThirtyThreePipeline.get());
@@ -3928,6 +4024,10 @@ using namespace std;
 			}
 		}
 		
+		// Add running step thirty-five to the compute pass
+		computePassEncoder->setComputePipelineState(stepThirtyFivePipeline.get());
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+		
 		// Finish adding commands to the compute pass
 		computePassEncoder->endEncoding();
 		
@@ -4008,9 +4108,12 @@ using namespace std;
 		uint64_t heightTwo = jobHeight;
 		uint64_t idTwo = jobId;
 		uint64_t nonceTwo = jobNonce++;
-		blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
+		blake2b(sipHashKeysTwo, jobHeaderMidstate, nonceTwo);
 		
-		// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, and edges bitmap arguments
+		// Clear the beginning of remaining edges two
+		reinterpret_cast<uint32_t *>(remainingEdgesTwo->contents())[0] = 0;
+		
+		// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, edges bitmap, and remaining edges arguments
 		computePassEncoder->setBuffer(bucketsOne.get(), 0, 0);
 		computePassEncoder->setBuffer(numberOfEdgesPerBucketOne.get(), 0, 1);
 		computePassEncoder->setBytes(&sipHashKeysTwo, sizeof(sipHashKeysTwo), 2);
@@ -4018,6 +4121,7 @@ using namespace std;
 		computePassEncoder->setBuffer(bucketsTwo.get(), 0, 6);
 		computePassEncoder->setBuffer(numberOfEdgesPerBucketTwo.get(), 0, 7);
 		computePassEncoder->setBuffer(edgesBitmapTwo.get(), 0, 8);
+		computePassEncoder->setBuffer(remainingEdgesTwo.get(), 0, 10);
 		
 		// Check if using buckets one second part
 		if(bucketsOneNumberOfBuckets != SLEAN_TRIMMING_NUMBER_OF_BUCKETS) {
@@ -4028,7 +4132,7 @@ using namespace std;
 		
 		// Add clearing number of edges per bucket one to the compute pass
 		computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 		
 		// Set compute pass's part argument
 		computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(0)), sizeof(uint8_t), 3);
@@ -4046,7 +4150,7 @@ using namespace std;
 		
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Set compute pass's part argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4068,7 +4172,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket two to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 				
 				// Add running step four to the compute pass
 				computePassEncoder->setComputePipelineState(stepFourPipeline.get());
@@ -4085,7 +4189,7 @@ using namespace std;
 		
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Set compute pass's part argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4096,7 +4200,7 @@ using namespace std;
 			
 			// Add clearing number of edges per bucket two to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 			
 			// Add running step six to the compute pass
 			computePassEncoder->setComputePipelineState(stepSixPipeline.get());
@@ -4112,7 +4216,7 @@ using namespace std;
 		
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Add running step seven to the compute pass
 			computePassEncoder->setComputePipelineState(stepSevenPipeline.get());
@@ -4127,7 +4231,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4149,7 +4253,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 					
 					// Add running step ten to the compute pass
 					computePassEncoder->setComputePipelineState(stepTenPipeline.get());
@@ -4166,7 +4270,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4177,7 +4281,7 @@ using namespace std;
 				
 				// Add clearing number of edges per bucket two to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 				
 				// Add running step twelve to the compute pass
 				computePassEncoder->setComputePipelineState(stepTwelvePipeline.get());
@@ -4193,7 +4297,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Add running step thirteen to the compute pass
 				computePassEncoder->setComputePipelineState(stepThirteenPipeline.get());
@@ -4211,7 +4315,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket one to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 						
 						// Set compute pass's part argument
 						computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4233,7 +4337,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket two to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 							
 							// Add running step sixteen to the compute pass
 							computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -4247,7 +4351,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 					
 					// Add running step sixteen to the compute pass
 					computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -4263,7 +4367,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Set compute pass's part argument
 					computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4274,7 +4378,7 @@ using namespace std;
 					
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 					
 					// Add running step eighteen to the compute pass
 					computePassEncoder->setComputePipelineState(stepEighteenPipeline.get());
@@ -4293,7 +4397,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket one to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 						
 						// Set compute pass's nodes in second partition argument
 						computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -4314,7 +4418,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's part argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -4336,7 +4440,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 									
 									// Add running step twenty-two to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -4350,7 +4454,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket two to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 							
 							// Add running step twenty-two to the compute pass
 							computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -4366,7 +4470,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's part argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -4377,7 +4481,7 @@ using namespace std;
 							
 							// Add clearing number of edges per bucket two to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 							
 							// Add running step twenty-three to the compute pass
 							computePassEncoder->setComputePipelineState(stepTwentyThreePipeline.get());
@@ -4397,7 +4501,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's nodes in second partition argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -4418,7 +4522,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -4440,7 +4544,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 										
 										// Add running step twenty-five to the compute pass
 										computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -4454,7 +4558,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 								
 								// Add running step twenty-five to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -4470,7 +4574,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's part argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -4481,7 +4585,7 @@ using namespace std;
 								
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 								
 								// Add running step twenty-seven to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentySevenPipeline.get());
@@ -4501,7 +4605,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's nodes in second partition argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -4522,7 +4626,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's part argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -4544,7 +4648,7 @@ using namespace std;
 										
 											// Add clearing number of edges per bucket two to the compute pass
 											computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 											
 											// Add running step twenty-nine to the compute pass
 											computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -4558,7 +4662,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 									
 									// Add running step twenty-nine to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -4574,7 +4678,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -4585,7 +4689,7 @@ using namespace std;
 									
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 									
 									// Add running step thirty-one to the compute pass
 									computePassEncoder->setComputePipelineState(stepThirtyOnePipeline.get());
@@ -4605,7 +4709,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's nodes in second partition argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -4616,7 +4720,7 @@ using namespace std;
 									
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketSixteenPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[40], workItemsPerWorkGroup[40]);
 									
 									// Add running step thirty-three to the compute pass
 									computePassEncoder->setComputePipelineState(stepThirtyThreePipeline.get());
@@ -4633,6 +4737,10 @@ using namespace std;
 			}
 		}
 		
+		// Add running step thirty-five to the compute pass
+		computePassEncoder->setComputePipelineState(stepThirtyFivePipeline.get());
+		computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+		
 		// Finish adding commands to the compute pass
 		computePassEncoder->endEncoding();
 		
@@ -4643,7 +4751,7 @@ using namespace std;
 		commandBuffer->commit();
 		
 		// Trimming finished
-		trimmingFinished(edgesBitmapOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
+		trimmingFinished(remainingEdgesOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
 		
 		// Wait until the compute pass has finished
 		commandBuffer->waitUntilCompleted();
@@ -4711,9 +4819,12 @@ using namespace std;
 			heightOne = jobHeight;
 			idOne = jobId;
 			nonceOne = jobNonce++;
-			blake2b(sipHashKeysOne, jobHeader, nonceOne);
+			blake2b(sipHashKeysOne, jobHeaderMidstate, nonceOne);
 			
-			// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, and edges bitmap arguments
+			// Clear the beginning of remaining edges one
+			reinterpret_cast<uint32_t *>(remainingEdgesOne->contents())[0] = 0;
+			
+			// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, edges bitmap, and remaining edges arguments
 			computePassEncoder->setBuffer(bucketsOne.get(), 0, 0);
 			computePassEncoder->setBuffer(numberOfEdgesPerBucketOne.get(), 0, 1);
 			computePassEncoder->setBytes(&sipHashKeysOne, sizeof(sipHashKeysOne), 2);
@@ -4721,6 +4832,7 @@ using namespace std;
 			computePassEncoder->setBuffer(bucketsTwo.get(), 0, 6);
 			computePassEncoder->setBuffer(numberOfEdgesPerBucketTwo.get(), 0, 7);
 			computePassEncoder->setBuffer(edgesBitmapOne.get(), 0, 8);
+			computePassEncoder->setBuffer(remainingEdgesOne.get(), 0, 10);
 			
 			// Check if using buckets one second part
 			if(bucketsOneNumberOfBuckets != SLEAN_TRIMMING_NUMBER_OF_BUCKETS) {
@@ -4731,7 +4843,7 @@ using namespace std;
 			
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Set compute pass's part argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(0)), sizeof(uint8_t), 3);
@@ -4749,7 +4861,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4771,7 +4883,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 					
 					// Add running step four to the compute pass
 					computePassEncoder->setComputePipelineState(stepFourPipeline.get());
@@ -4788,7 +4900,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4799,7 +4911,7 @@ using namespace std;
 				
 				// Add clearing number of edges per bucket two to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 				
 				// Add running step six to the compute pass
 				computePassEncoder->setComputePipelineState(stepSixPipeline.get());
@@ -4815,7 +4927,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Add running step seven to the compute pass
 				computePassEncoder->setComputePipelineState(stepSevenPipeline.get());
@@ -4830,7 +4942,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Set compute pass's part argument
 					computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4852,7 +4964,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket two to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 						
 						// Add running step ten to the compute pass
 						computePassEncoder->setComputePipelineState(stepTenPipeline.get());
@@ -4869,7 +4981,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Set compute pass's part argument
 					computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4880,7 +4992,7 @@ using namespace std;
 					
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 					
 					// Add running step twelve to the compute pass
 					computePassEncoder->setComputePipelineState(stepTwelvePipeline.get());
@@ -4896,7 +5008,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Add running step thirteen to the compute pass
 					computePassEncoder->setComputePipelineState(stepThirteenPipeline.get());
@@ -4914,7 +5026,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's part argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4936,7 +5048,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 								
 								// Add running step sixteen to the compute pass
 								computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -4950,7 +5062,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket two to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 						
 						// Add running step sixteen to the compute pass
 						computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -4966,7 +5078,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket one to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 						
 						// Set compute pass's part argument
 						computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -4977,7 +5089,7 @@ using namespace std;
 						
 						// Add clearing number of edges per bucket two to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 						
 						// Add running step eighteen to the compute pass
 						computePassEncoder->setComputePipelineState(stepEighteenPipeline.get());
@@ -4996,7 +5108,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's nodes in second partition argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5017,7 +5129,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5039,7 +5151,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 										
 										// Add running step twenty-two to the compute pass
 										computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -5053,7 +5165,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 								
 								// Add running step twenty-two to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -5069,7 +5181,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's part argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5080,7 +5192,7 @@ using namespace std;
 								
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 								
 								// Add running step twenty-three to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentyThreePipeline.get());
@@ -5100,7 +5212,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's nodes in second partition argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5121,7 +5233,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's part argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5143,7 +5255,7 @@ using namespace std;
 										
 											// Add clearing number of edges per bucket two to the compute pass
 											computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 											
 											// Add running step twenty-five to the compute pass
 											computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -5157,7 +5269,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 									
 									// Add running step twenty-five to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -5173,7 +5285,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5184,7 +5296,7 @@ using namespace std;
 									
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 									
 									// Add running step twenty-seven to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentySevenPipeline.get());
@@ -5204,7 +5316,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's nodes in second partition argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5225,7 +5337,7 @@ using namespace std;
 										
 											// Add clearing number of edges per bucket one to the compute pass
 											computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 											
 											// Set compute pass's part argument
 											computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5247,7 +5359,7 @@ using namespace std;
 											
 												// Add clearing number of edges per bucket two to the compute pass
 												computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-												computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+												computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 												
 												// Add running step twenty-nine to the compute pass
 												computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -5261,7 +5373,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 										
 										// Add running step twenty-nine to the compute pass
 										computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -5277,7 +5389,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's part argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5288,7 +5400,7 @@ using namespace std;
 										
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 										
 										// Add running step thirty-one to the compute pass
 										computePassEncoder->setComputePipelineState(stepThirtyOnePipeline.get());
@@ -5308,7 +5420,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's nodes in second partition argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5319,7 +5431,7 @@ using namespace std;
 										
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketSixteenPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[40], workItemsPerWorkGroup[40]);
 										
 										// Add running step thirty-three to the compute pass
 										computePassEncoder->setComputePipelineState(stepThirtyThreePipeline.get());
@@ -5336,6 +5448,10 @@ using namespace std;
 				}
 			}
 			
+			// Add running step thirty-five to the compute pass
+			computePassEncoder->setComputePipelineState(stepThirtyFivePipeline.get());
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			
 			// Finish adding commands to the compute pass
 			computePassEncoder->endEncoding();
 			
@@ -5346,7 +5462,7 @@ using namespace std;
 			commandBuffer->commit();
 			
 			// Trimming finished
-			trimmingFinished(edgesBitmapTwo->contents(), sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
+			trimmingFinished(remainingEdgesTwo->contents(), sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
 			
 			// Wait until the compute pass has finished
 			commandBuffer->waitUntilCompleted();
@@ -5418,9 +5534,12 @@ using namespace std;
 			heightTwo = jobHeight;
 			idTwo = jobId;
 			nonceTwo = jobNonce++;
-			blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
+			blake2b(sipHashKeysTwo, jobHeaderMidstate, nonceTwo);
+			
+			// Clear the beginning of remaining edges two
+			reinterpret_cast<uint32_t *>(remainingEdgesTwo->contents())[0] = 0;
 			
-			// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, and edges bitmap arguments
+			// Set compute pass's buckets, number of edges per bucket, SipHash keys, nodes bitmap, destination buckets, number of edges per destination bucket, edges bitmap, and remaining edges arguments
 			computePassEncoder->setBuffer(bucketsOne.get(), 0, 0);
 			computePassEncoder->setBuffer(numberOfEdgesPerBucketOne.get(), 0, 1);
 			computePassEncoder->setBytes(&sipHashKeysTwo, sizeof(sipHashKeysTwo), 2);
@@ -5428,6 +5547,7 @@ using namespace std;
 			computePassEncoder->setBuffer(bucketsTwo.get(), 0, 6);
 			computePassEncoder->setBuffer(numberOfEdgesPerBucketTwo.get(), 0, 7);
 			computePassEncoder->setBuffer(edgesBitmapTwo.get(), 0, 8);
+			computePassEncoder->setBuffer(remainingEdgesTwo.get(), 0, 10);
 			
 			// Check if using buckets one second part
 			if(bucketsOneNumberOfBuckets != SLEAN_TRIMMING_NUMBER_OF_BUCKETS) {
@@ -5438,7 +5558,7 @@ using namespace std;
 			
 			// Add clearing number of edges per bucket one to the compute pass
 			computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 			
 			// Set compute pass's part argument
 			computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(0)), sizeof(uint8_t), 3);
@@ -5456,7 +5576,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -5478,7 +5598,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 					
 					// Add running step four to the compute pass
 					computePassEncoder->setComputePipelineState(stepFourPipeline.get());
@@ -5495,7 +5615,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Set compute pass's part argument
 				computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -5506,7 +5626,7 @@ using namespace std;
 				
 				// Add clearing number of edges per bucket two to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 				
 				// Add running step six to the compute pass
 				computePassEncoder->setComputePipelineState(stepSixPipeline.get());
@@ -5522,7 +5642,7 @@ using namespace std;
 			
 				// Add clearing number of edges per bucket one to the compute pass
 				computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+				computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 				
 				// Add running step seven to the compute pass
 				computePassEncoder->setComputePipelineState(stepSevenPipeline.get());
@@ -5537,7 +5657,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Set compute pass's part argument
 					computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -5559,7 +5679,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket two to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 						
 						// Add running step ten to the compute pass
 						computePassEncoder->setComputePipelineState(stepTenPipeline.get());
@@ -5576,7 +5696,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Set compute pass's part argument
 					computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -5587,7 +5707,7 @@ using namespace std;
 					
 					// Add clearing number of edges per bucket two to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketOnePipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
 					
 					// Add running step twelve to the compute pass
 					computePassEncoder->setComputePipelineState(stepTwelvePipeline.get());
@@ -5603,7 +5723,7 @@ using namespace std;
 				
 					// Add clearing number of edges per bucket one to the compute pass
 					computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+					computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 					
 					// Add running step thirteen to the compute pass
 					computePassEncoder->setComputePipelineState(stepThirteenPipeline.get());
@@ -5621,7 +5741,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's part argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -5643,7 +5763,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 								
 								// Add running step sixteen to the compute pass
 								computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -5657,7 +5777,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket two to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 						
 						// Add running step sixteen to the compute pass
 						computePassEncoder->setComputePipelineState(stepSixteenPipeline.get());
@@ -5673,7 +5793,7 @@ using namespace std;
 					
 						// Add clearing number of edges per bucket one to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 						
 						// Set compute pass's part argument
 						computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i)), sizeof(uint8_t), 3);
@@ -5684,7 +5804,7 @@ using namespace std;
 						
 						// Add clearing number of edges per bucket two to the compute pass
 						computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+						computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 						
 						// Add running step eighteen to the compute pass
 						computePassEncoder->setComputePipelineState(stepEighteenPipeline.get());
@@ -5703,7 +5823,7 @@ using namespace std;
 						
 							// Add clearing number of edges per bucket one to the compute pass
 							computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+							computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 							
 							// Set compute pass's nodes in second partition argument
 							computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5724,7 +5844,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5746,7 +5866,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 										
 										// Add running step twenty-two to the compute pass
 										computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -5760,7 +5880,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 								
 								// Add running step twenty-two to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentyTwoPipeline.get());
@@ -5776,7 +5896,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's part argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5787,7 +5907,7 @@ using namespace std;
 								
 								// Add clearing number of edges per bucket two to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketTwoPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[36], workItemsPerWorkGroup[36]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
 								
 								// Add running step twenty-three to the compute pass
 								computePassEncoder->setComputePipelineState(stepTwentyThreePipeline.get());
@@ -5807,7 +5927,7 @@ using namespace std;
 							
 								// Add clearing number of edges per bucket one to the compute pass
 								computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+								computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 								
 								// Set compute pass's nodes in second partition argument
 								computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5828,7 +5948,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's part argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5850,7 +5970,7 @@ using namespace std;
 										
 											// Add clearing number of edges per bucket two to the compute pass
 											computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 											
 											// Add running step twenty-five to the compute pass
 											computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -5864,7 +5984,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 									
 									// Add running step twenty-five to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentyFivePipeline.get());
@@ -5880,7 +6000,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's part argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5891,7 +6011,7 @@ using namespace std;
 									
 									// Add clearing number of edges per bucket two to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketFourPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[37], workItemsPerWorkGroup[37]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
 									
 									// Add running step twenty-seven to the compute pass
 									computePassEncoder->setComputePipelineState(stepTwentySevenPipeline.get());
@@ -5911,7 +6031,7 @@ using namespace std;
 								
 									// Add clearing number of edges per bucket one to the compute pass
 									computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+									computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 									
 									// Set compute pass's nodes in second partition argument
 									computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -5932,7 +6052,7 @@ using namespace std;
 										
 											// Add clearing number of edges per bucket one to the compute pass
 											computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+											computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 											
 											// Set compute pass's part argument
 											computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5954,7 +6074,7 @@ using namespace std;
 											
 												// Add clearing number of edges per bucket two to the compute pass
 												computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-												computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+												computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 												
 												// Add running step twenty-nine to the compute pass
 												computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -5968,7 +6088,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 										
 										// Add running step twenty-nine to the compute pass
 										computePassEncoder->setComputePipelineState(stepTwentyNinePipeline.get());
@@ -5984,7 +6104,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's part argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(j)), sizeof(uint8_t), 3);
@@ -5995,7 +6115,7 @@ using namespace std;
 										
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketEightPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[38], workItemsPerWorkGroup[38]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
 										
 										// Add running step thirty-one to the compute pass
 										computePassEncoder->setComputePipelineState(stepThirtyOnePipeline.get());
@@ -6015,7 +6135,7 @@ using namespace std;
 									
 										// Add clearing number of edges per bucket one to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerSourceBucketPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[35], workItemsPerWorkGroup[35]);
 										
 										// Set compute pass's nodes in second partition argument
 										computePassEncoder->setBytes(&unmove(static_cast<uint8_t>(i % 2)), sizeof(uint8_t), 9);
@@ -6026,7 +6146,7 @@ using namespace std;
 										
 										// Add clearing number of edges per bucket two to the compute pass
 										computePassEncoder->setComputePipelineState(clearNumberOfEdgesPerDestinationBucketSixteenPipeline.get());
-										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[39], workItemsPerWorkGroup[39]);
+										computePassEncoder->dispatchThreads(totalNumberOfWorkItems[40], workItemsPerWorkGroup[40]);
 										
 										// Add running step thirty-three to the compute pass
 										computePassEncoder->setComputePipelineState(stepThirtyThreePipeline.get());
@@ -6043,6 +6163,10 @@ using namespace std;
 				}
 			}
 			
+			// Add running step thirty-five to the compute pass
+			computePassEncoder->setComputePipelineState(stepThirtyFivePipeline.get());
+			computePassEncoder->dispatchThreads(totalNumberOfWorkItems[34], workItemsPerWorkGroup[34]);
+			
 			// Finish adding commands to the compute pass
 			computePassEncoder->endEncoding();
 			
@@ -6053,7 +6177,7 @@ using namespace std;
 			commandBuffer->commit();
 			
 			// Trimming finished
-			trimmingFinished(edgesBitmapOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
+			trimmingFinished(remainingEdgesOne->contents(), sipHashKeysOne, heightOne, idOne, nonceOne);
 			
 			// Wait until the compute pass has finished
 			commandBuffer->waitUntilCompleted();
@@ -6080,11 +6204,11 @@ using namespace std;
 			return false;
 		}
 		
-		// Check if getting device's max work group size, max memory allocation size, or work group memory size failed, or its max work group size don't exists
+		// Check if getting device's max work group size, max memory allocation size, or work group memory size failed
 		size_t maxWorkGroupSize;
 		cl_ulong maxMemoryAllocationSize;
 		cl_ulong workGroupMemorySize;
-		if(clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(maxWorkGroupSize), &maxWorkGroupSize, nullptr) != CL_SUCCESS || clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxMemoryAllocationSize), &maxMemoryAllocationSize, nullptr) != CL_SUCCESS || clGetDeviceInfo(device, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(workGroupMemorySize), &workGroupMemorySize, nullptr) != CL_SUCCESS || !maxWorkGroupSize) {
+		if(!getOpenClDeviceMaxWorkGroupSize(device, maxWorkGroupSize) || clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxMemoryAllocationSize), &maxMemoryAllocationSize, nullptr) != CL_SUCCESS || !getOpenClDeviceWorkGroupMemorySize(device, workGroupMemorySize)) {
 		
 			// Display message
 			cout << "Getting GPU's info failed." << endl;
@@ -6130,7 +6254,7 @@ using namespace std;
 		const unsigned int localBucketsSize = min(bit_floor((workGroupMemorySize - (SLEAN_TRIMMING_NUMBER_OF_BUCKETS + sizeof(cl_uint) - 1)) / (sizeof(cl_uint) * SLEAN_TRIMMING_NUMBER_OF_BUCKETS) + 1), SLEAN_TRIMMING_MAX_LOCAL_BUCKETS_SIZE);
 		
 		// Check if building program for the device failed
-		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DSLEAN_TRIMMING_PARTS=" TO_STRING(SLEAN_TRIMMING_PARTS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(SLEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DNUMBER_OF_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES) + " -DNUMBER_OF_BUCKETS=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BUCKETS) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING) + " -DINITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING) + " -DNUMBER_OF_REMAINING_EDGES_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BITMAP_BYTES) + " -DINITIAL_BUCKETS_NUMBER_OF_BUCKETS=" + to_string(bucketsOneNumberOfBuckets) + " -DLOCAL_BUCKETS_SIZE=" + to_string(localBucketsSize)).c_str(), nullptr, nullptr) != CL_SUCCESS) {
+		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DEDGE_NUMBER_OF_COMPONENTS=" TO_STRING(EDGE_NUMBER_OF_COMPONENTS) " -DSLEAN_TRIMMING_PARTS=" TO_STRING(SLEAN_TRIMMING_PARTS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(SLEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DNUMBER_OF_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES) + " -DNUMBER_OF_BUCKETS=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BUCKETS) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING) + " -DINITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING) + " -DNUMBER_OF_REMAINING_EDGES_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BITMAP_BYTES) + " -DINITIAL_BUCKETS_NUMBER_OF_BUCKETS=" + to_string(bucketsOneNumberOfBuckets) + " -DLOCAL_BUCKETS_SIZE=" + to_string(localBucketsSize) + " -DMAX_NUMBER_OF_EDGES_AFTER_TRIMMING=" + to_string(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING)).c_str(), nullptr, nullptr) != CL_SUCCESS) {
 		
 			// Display message
 			cout << "Building program for the GPU failed." << endl;
@@ -6187,7 +6311,8 @@ using namespace std;
 		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepThirtyTwoKernel(clCreateKernel(program.get(), "trimEdgesStepThirtyTwo", nullptr), clReleaseKernel);
 		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepThirtyThreeKernel(clCreateKernel(program.get(), "trimEdgesStepThirtyThree", nullptr), clReleaseKernel);
 		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepThirtyFourKernel(clCreateKernel(program.get(), "trimEdgesStepThirtyFour", nullptr), clReleaseKernel);
-		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !stepSixKernel || !stepSevenKernel || !stepEightKernel || !stepNineKernel || !stepTenKernel || !stepElevenKernel || !stepTwelveKernel || !stepThirteenKernel || !stepFourteenKernel || !stepFifteenKernel || !stepSixteenKernel || !stepSeventeenKernel || !stepEighteenKernel || !stepNineteenKernel || !stepTwentyKernel || !stepTwentyOneKernel || !stepTwentyTwoKernel || !stepTwentyThreeKernel || !stepTwentyFourKernel || !stepTwentyFiveKernel || !stepTwentySixKernel || !stepTwentySevenKernel || !stepTwentyEightKernel || !stepTwentyNineKernel || !stepThirtyKernel || !stepThirtyOneKernel || !stepThirtyTwoKernel || !stepThirtyThreeKernel || !stepThirtyFourKernel) {
+		unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)> stepThirtyFiveKernel(clCreateKernel(program.get(), "trimEdgesStepThirtyFive", nullptr), clReleaseKernel);
+		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !stepSixKernel || !stepSevenKernel || !stepEightKernel || !stepNineKernel || !stepTenKernel || !stepElevenKernel || !stepTwelveKernel || !stepThirteenKernel || !stepFourteenKernel || !stepFifteenKernel || !stepSixteenKernel || !stepSeventeenKernel || !stepEighteenKernel || !stepNineteenKernel || !stepTwentyKernel || !stepTwentyOneKernel || !stepTwentyTwoKernel || !stepTwentyThreeKernel || !stepTwentyFourKernel || !stepTwentyFiveKernel || !stepTwentySixKernel || !stepTwentySevenKernel || !stepTwentyEightKernel || !stepTwentyNineKernel || !stepThirtyKernel || !stepThirtyOneKernel || !stepThirtyTwoKernel || !stepThirtyThreeKernel || !stepThirtyFourKernel || !stepThirtyFiveKernel) {
 		
 			// Display message
 			cout << "Creating kernels for the GPU failed." << endl;
@@ -6299,7 +6424,10 @@ using namespace std;
 			SLEAN_TRIMMING_NUMBER_OF_BUCKETS * min(bit_floor(maxWorkGroupSize), bit_floor(static_cast<size_t>(INT16_MAX / 2))),
 			
 			// Trim edges step thirty-four kernel
-			SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 16 * min(bit_floor(maxWorkGroupSize), bit_floor(static_cast<size_t>(INT16_MAX / 2)))
+			SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 16 * min(bit_floor(maxWorkGroupSize), bit_floor(static_cast<size_t>(INT16_MAX / 2))),
+			
+			// Trim edges step thirty-five kernel
+			NUMBER_OF_EDGES / (sizeof(cl_ulong) * BITS_IN_A_BYTE)
 		};
 		
 		// Set work items per work group based on the total number of work items and max work group size
@@ -6405,7 +6533,10 @@ using namespace std;
 			min(bit_floor(maxWorkGroupSize), bit_floor(static_cast<size_t>(INT16_MAX / 2))),
 			
 			// Trim edges step thirty-four kernel
-			min(bit_floor(maxWorkGroupSize), bit_floor(static_cast<size_t>(INT16_MAX / 2)))
+			min(bit_floor(maxWorkGroupSize), bit_floor(static_cast<size_t>(INT16_MAX / 2))),
+			
+			// Trim edges step thirty-five kernel
+			min(bit_floor(maxWorkGroupSize), totalNumberOfWorkItems[34])
 		};
 		
 		// Free kernels
@@ -6443,6 +6574,7 @@ using namespace std;
 		stepThirtyTwoKernel.reset();
 		stepThirtyThreeKernel.reset();
 		stepThirtyFourKernel.reset();
+		stepThirtyFiveKernel.reset();
 		
 		// Check if recreating program for the device failed
 		program = unique_ptr<remove_pointer<cl_program>::type, decltype(&clReleaseProgram)>(clCreateProgramWithSource(context, 1, &source, &sourceSize, nullptr), clReleaseProgram);
@@ -6456,7 +6588,7 @@ using namespace std;
 		}
 		
 		// Check if rebuilding program for the device with hardcoded work items per work groups failed
-		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DSLEAN_TRIMMING_PARTS=" TO_STRING(SLEAN_TRIMMING_PARTS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(SLEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DNUMBER_OF_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES) + " -DNUMBER_OF_BUCKETS=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BUCKETS) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING) + " -DINITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING) + " -DNUMBER_OF_REMAINING_EDGES_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BITMAP_BYTES) + " -DINITIAL_BUCKETS_NUMBER_OF_BUCKETS=" + to_string(bucketsOneNumberOfBuckets) + " -DLOCAL_BUCKETS_SIZE=" + to_string(localBucketsSize) + " -DTRIM_EDGES_STEP_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[0]) + " -DTRIM_EDGES_STEP_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[1]) + " -DTRIM_EDGES_STEP_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[2]) + " -DTRIM_EDGES_STEP_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[3]) + " -DTRIM_EDGES_STEP_FIVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[4]) + " -DTRIM_EDGES_STEP_SIX_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[5]) + " -DTRIM_EDGES_STEP_SEVEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[6]) + " -DTRIM_EDGES_STEP_EIGHT_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[7]) + " -DTRIM_EDGES_STEP_NINE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[8]) + " -DTRIM_EDGES_STEP_TEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[9]) + " -DTRIM_EDGES_STEP_ELEVEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[10]) + " -DTRIM_EDGES_STEP_TWELVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[11]) + " -DTRIM_EDGES_STEP_THIRTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[12]) + " -DTRIM_EDGES_STEP_FOURTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[13]) + " -DTRIM_EDGES_STEP_FIFTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[14]) + " -DTRIM_EDGES_STEP_SIXTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[15]) + " -DTRIM_EDGES_STEP_SEVENTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[16]) + " -DTRIM_EDGES_STEP_EIGHTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[17]) + " -DTRIM_EDGES_STEP_NINETEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[18]) + " -DTRIM_EDGES_STEP_TWENTY_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[19]) + " -DTRIM_EDGES_STEP_TWENTY_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[20]) + " -DTRIM_EDGES_STEP_TWENTY_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[21]) + " -DTRIM_EDGES_STEP_TWENTY_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[22]) + " -DTRIM_EDGES_STEP_TWENTY_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[23]) + " -DTRIM_EDGES_STEP_TWENTY_FIVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[24]) + " -DTRIM_EDGES_STEP_TWENTY_SIX_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[25]) + " -DTRIM_EDGES_STEP_TWENTY_SEVEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[26]) + " -DTRIM_EDGES_STEP_TWENTY_EIGHT_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[27]) + " -DTRIM_EDGES_STEP_TWENTY_NINE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[28]) + " -DTRIM_EDGES_STEP_THIRTY_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[29]) + " -DTRIM_EDGES_STEP_THIRTY_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[30]) + " -DTRIM_EDGES_STEP_THIRTY_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[31]) + " -DTRIM_EDGES_STEP_THIRTY_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[32]) + " -DTRIM_EDGES_STEP_THIRTY_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[33])).c_str(), nullptr, nullptr) != CL_SUCCESS) {
+		if(clBuildProgram(program.get(), 1, &device, ("-cl-std=CL1.2 -Werror -DEDGE_BITS=" TO_STRING(EDGE_BITS) " -DEDGE_NUMBER_OF_COMPONENTS=" TO_STRING(EDGE_NUMBER_OF_COMPONENTS) " -DSLEAN_TRIMMING_PARTS=" TO_STRING(SLEAN_TRIMMING_PARTS) " -DNUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM=" + to_string(SLEAN_TRIMMING_NUMBER_OF_EDGES_PER_STEP_ONE_WORK_ITEM) + " -DNUMBER_OF_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BITMAP_BYTES) + " -DNUMBER_OF_BUCKETS=" + to_string(SLEAN_TRIMMING_NUMBER_OF_BUCKETS) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_BUCKET_SORTING) + " -DINITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_INITIAL_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_BUCKET) + " -DAFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET=" + to_string(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) + " -DNUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING=" + to_string(SLEAN_TRIMMING_NUMBER_OF_LEAST_SIGNIFICANT_BITS_IGNORED_DURING_REMAINING_EDGES_BUCKET_SORTING) + " -DNUMBER_OF_REMAINING_EDGES_BITMAP_BYTES=" + to_string(SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BITMAP_BYTES) + " -DINITIAL_BUCKETS_NUMBER_OF_BUCKETS=" + to_string(bucketsOneNumberOfBuckets) + " -DLOCAL_BUCKETS_SIZE=" + to_string(localBucketsSize) + " -DMAX_NUMBER_OF_EDGES_AFTER_TRIMMING=" + to_string(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) + " -DTRIM_EDGES_STEP_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[0]) + " -DTRIM_EDGES_STEP_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[1]) + " -DTRIM_EDGES_STEP_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[2]) + " -DTRIM_EDGES_STEP_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[3]) + " -DTRIM_EDGES_STEP_FIVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[4]) + " -DTRIM_EDGES_STEP_SIX_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[5]) + " -DTRIM_EDGES_STEP_SEVEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[6]) + " -DTRIM_EDGES_STEP_EIGHT_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[7]) + " -DTRIM_EDGES_STEP_NINE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[8]) + " -DTRIM_EDGES_STEP_TEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[9]) + " -DTRIM_EDGES_STEP_ELEVEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[10]) + " -DTRIM_EDGES_STEP_TWELVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[11]) + " -DTRIM_EDGES_STEP_THIRTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[12]) + " -DTRIM_EDGES_STEP_FOURTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[13]) + " -DTRIM_EDGES_STEP_FIFTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[14]) + " -DTRIM_EDGES_STEP_SIXTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[15]) + " -DTRIM_EDGES_STEP_SEVENTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[16]) + " -DTRIM_EDGES_STEP_EIGHTEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[17]) + " -DTRIM_EDGES_STEP_NINETEEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[18]) + " -DTRIM_EDGES_STEP_TWENTY_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[19]) + " -DTRIM_EDGES_STEP_TWENTY_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[20]) + " -DTRIM_EDGES_STEP_TWENTY_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[21]) + " -DTRIM_EDGES_STEP_TWENTY_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[22]) + " -DTRIM_EDGES_STEP_TWENTY_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[23]) + " -DTRIM_EDGES_STEP_TWENTY_FIVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[24]) + " -DTRIM_EDGES_STEP_TWENTY_SIX_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[25]) + " -DTRIM_EDGES_STEP_TWENTY_SEVEN_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[26]) + " -DTRIM_EDGES_STEP_TWENTY_EIGHT_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[27]) + " -DTRIM_EDGES_STEP_TWENTY_NINE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[28]) + " -DTRIM_EDGES_STEP_THIRTY_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[29]) + " -DTRIM_EDGES_STEP_THIRTY_ONE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[30]) + " -DTRIM_EDGES_STEP_THIRTY_TWO_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[31]) + " -DTRIM_EDGES_STEP_THIRTY_THREE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[32]) + " -DTRIM_EDGES_STEP_THIRTY_FOUR_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[33]) + " -DTRIM_EDGES_STEP_THIRTY_FIVE_WORK_ITEMS_PER_WORK_GROUP=" + to_string(workItemsPerWorkGroup[34])).c_str(), nullptr, nullptr) != CL_SUCCESS) {
 		
 			// Display message
 			cout << "Building program for the GPU failed." << endl;
@@ -6513,7 +6645,8 @@ using namespace std;
 		stepThirtyTwoKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepThirtyTwo", nullptr), clReleaseKernel);
 		stepThirtyThreeKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepThirtyThree", nullptr), clReleaseKernel);
 		stepThirtyFourKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepThirtyFour", nullptr), clReleaseKernel);
-		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !stepSixKernel || !stepSevenKernel || !stepEightKernel || !stepNineKernel || !stepTenKernel || !stepElevenKernel || !stepTwelveKernel || !stepThirteenKernel || !stepFourteenKernel || !stepFifteenKernel || !stepSixteenKernel || !stepSeventeenKernel || !stepEighteenKernel || !stepNineteenKernel || !stepTwentyKernel || !stepTwentyOneKernel || !stepTwentyTwoKernel || !stepTwentyThreeKernel || !stepTwentyFourKernel || !stepTwentyFiveKernel || !stepTwentySixKernel || !stepTwentySevenKernel || !stepTwentyEightKernel || !stepTwentyNineKernel || !stepThirtyKernel || !stepThirtyOneKernel || !stepThirtyTwoKernel || !stepThirtyThreeKernel || !stepThirtyFourKernel) {
+		stepThirtyFiveKernel = unique_ptr<remove_pointer<cl_kernel>::type, decltype(&clReleaseKernel)>(clCreateKernel(program.get(), "trimEdgesStepThirtyFive", nullptr), clReleaseKernel);
+		if(!stepOneKernel || !stepTwoKernel || !stepThreeKernel || !stepFourKernel || !stepFiveKernel || !stepSixKernel || !stepSevenKernel || !stepEightKernel || !stepNineKernel || !stepTenKernel || !stepElevenKernel || !stepTwelveKernel || !stepThirteenKernel || !stepFourteenKernel || !stepFifteenKernel || !stepSixteenKernel || !stepSeventeenKernel || !stepEighteenKernel || !stepNineteenKernel || !stepTwentyKernel || !stepTwentyOneKernel || !stepTwentyTwoKernel || !stepTwentyThreeKernel || !stepTwentyFourKernel || !stepTwentyFiveKernel || !stepTwentySixKernel || !stepTwentySevenKernel || !stepTwentyEightKernel || !stepTwentyNineKernel || !stepThirtyKernel || !stepThirtyOneKernel || !stepThirtyTwoKernel || !stepThirtyThreeKernel || !stepThirtyFourKernel || !stepThirtyFiveKernel) {
 		
 			// Display message
 			cout << "Creating kernels for the GPU failed." << endl;
@@ -6528,68 +6661,35 @@ using namespace std;
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> bucketsTwo(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, static_cast<uint64_t>(SLEAN_TRIMMING_AFTER_TRIMMING_ROUND_MAX_NUMBER_OF_EDGES_PER_REMAINING_EDGES_BUCKET) * SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> numberOfEdgesPerBucketOne(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> numberOfEdgesPerBucketTwo(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * SLEAN_TRIMMING_PARTS * sizeof(cl_uint), nullptr, nullptr), clReleaseMemObject);
-		static unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapOne(nullptr, clReleaseMemObject);
-		edgesBitmapOne = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
-		static unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapTwo(nullptr, clReleaseMemObject);
-		edgesBitmapTwo = unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)>(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_READ_ONLY | CL_MEM_ALLOC_HOST_PTR, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
+		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapOne(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
+		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> edgesBitmapTwo(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
 		const unique_ptr<remove_pointer<cl_mem>::type, decltype(&clReleaseMemObject)> nodesBitmap(clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS, NUMBER_OF_EDGES / BITS_IN_A_BYTE, nullptr, nullptr), clReleaseMemObject);
 		if(!bucketsOne || (bucketsOneNumberOfBuckets != SLEAN_TRIMMING_NUMBER_OF_BUCKETS && !bucketsOneSecondPart) || !bucketsTwo || !numberOfEdgesPerBucketOne || !numberOfEdgesPerBucketTwo || !edgesBitmapOne || !edgesBitmapTwo || !nodesBitmap) {
 		
 			// Display message
 			cout << "Allocating memory on the GPU failed." << endl;
 			
-			// Free edges bitmap one and two
-			edgesBitmapOne.reset();
-			edgesBitmapTwo.reset();
-			
 			// Return false
 			return false;
 		}
 		
 		// Check if creating command queue for the device failed
-		static uint64_t *resultOne = nullptr;
-		static uint64_t *resultTwo = nullptr;
-		const unique_ptr<remove_pointer<cl_command_queue>::type, void(*)(cl_command_queue)> commandQueue(clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, nullptr), [](cl_command_queue commandQueue) noexcept {
-		
-			// Wait for all commands in the queue to finish
-			clFinish(commandQueue);
-			
-			// Check if result one exists
-			if(resultOne) {
-			
-				// Queue unmapping result one
-				clEnqueueUnmapMemObject(commandQueue, edgesBitmapOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr);
-			}
-			
-			// Check if result two exists
-			if(resultTwo) {
-			
-				// Queue unmapping result two
-				clEnqueueUnmapMemObject(commandQueue, edgesBitmapTwo.get(), reinterpret_cast<void *>(resultTwo), 0, nullptr, nullptr);
-			}
-			
-			// Wait for all commands in the queue to finish
-			clFinish(commandQueue);
-			
-			// Free command queue
-			clReleaseCommandQueue(commandQueue);
-			
-			// Reset result one and two
-			resultOne = nullptr;
-			resultTwo = nullptr;
-			
-			// Free edges bitmap one and two
-			edgesBitmapOne.reset();
-			edgesBitmapTwo.reset();
-		});
+		const unique_ptr<remove_pointer<cl_command_queue>::type, decltype(&clReleaseCommandQueue)> commandQueue(clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, nullptr), clReleaseCommandQueue);
 		if(!commandQueue) {
 		
 			// Display message
 			cout << "Creating command queue for the GPU failed." << endl;
 			
-			// Free edges bitmap one and two
-			edgesBitmapOne.reset();
-			edgesBitmapTwo.reset();
+			// Return false
+			return false;
+		}
+		
+		// Check if allocating memory for the remaining edges ring buffer on the device failed
+		RemainingEdgesRingBuffer remainingEdgesRingBuffer(context, commandQueue.get());
+		if(!remainingEdgesRingBuffer) {
+		
+			// Display message
+			cout << "Allocating memory on the GPU failed." << endl;
 			
 			// Return false
 			return false;
@@ -6677,5534 +6777,21 @@ using namespace std;
 		// Set previous graph processed time to now
 		previousGraphProcessedTime = chrono::high_resolution_clock::now();
 		
-		// Check if queuing clearing number of edges per bucket one on the device failed
-		Event firstCommandEvent;
-		if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
+		// Perform trimming with the remaining edges ring buffer
+		return remainingEdgesRingBuffer.perform([&](const cl_mem remainingEdges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, cl_event *firstCommandEvent) noexcept -> bool {
 		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
+			// Check if queuing clearing number of edges per bucket one on the device failed
+			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent) != CL_SUCCESS) {
 			
-			// Return false
-			return false;
-		}
-		
-		// Get SipHash keys from job's header and nonce
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeysOne;
-		uint64_t heightOne = jobHeight;
-		uint64_t idOne = jobId;
-		uint64_t nonceOne = jobNonce++;
-		blake2b(sipHashKeysOne, jobHeader, nonceOne);
-		
-		// Check if setting program's SipHash keys or part arguments failed
-		if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
+				// Display message
+				cout << "Preparing program's arguments on the GPU failed." << endl;
+				
+				// Return false
+				return false;
+			}
 			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step one on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepTwoKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step two on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check is slean trimming parts isn't two
-		if(SLEAN_TRIMMING_PARTS != 2) {
-		
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Go through all remaining trimming parts
-		for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS; ++i) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if not the last trimming part
-			if(i != SLEAN_TRIMMING_PARTS - 1) {
-			
-				// Check if queuing running step three on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Otherwise
-			else {
-			
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepFourKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step four on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-		}
-		
-		// Check if setting program's edges bitmap or part arguments failed
-		if(clSetKernelArg(stepFiveKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step five on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepSixKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Go through all remaining trimming parts except the last one
-		for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS - 1; ++i) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing clearing number of edges per bucket two on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step six on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[5], &workItemsPerWorkGroup[5], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step five on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Check if trimming more than one round
-		if(TRIMMING_ROUNDS > 1) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's edges bitmap, SipHash keys, or part arguments failed
-			if(clSetKernelArg(stepSevenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step seven on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepEightKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step eight on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[7], &workItemsPerWorkGroup[7], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check is slean trimming parts isn't two
-			if(SLEAN_TRIMMING_PARTS != 2) {
-			
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepNineKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Go through all remaining trimming parts
-			for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS; ++i) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step seven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if not the last trimming part
-				if(i != SLEAN_TRIMMING_PARTS - 1) {
-				
-					// Check if queuing running step nine on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[8], &workItemsPerWorkGroup[8], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepTenKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step ten on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepTenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[9], &workItemsPerWorkGroup[9], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-			}
-			
-			// Check if setting program's edges bitmap or part arguments failed
-			if(clSetKernelArg(stepElevenKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step eleven on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepElevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[10], &workItemsPerWorkGroup[10], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepTwelveKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Go through all remaining trimming parts except the last one
-			for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS - 1; ++i) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step seven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepTwelveKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step twelve on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwelveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[11], &workItemsPerWorkGroup[11], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step eleven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepElevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[10], &workItemsPerWorkGroup[10], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Check if trimming more than two rounds
-			if(TRIMMING_ROUNDS > 2) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's edges bitmap or SipHash keys arguments failed
-				if(clSetKernelArg(stepThirteenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirteenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if queuing running step thirteen on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFourteenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step fourteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[13], &workItemsPerWorkGroup[13], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFifteenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Go through all remaining trimming parts
-					for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS / 2; ++i) {
-					
-						// Check if queuing clearing number of edges per bucket one on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step thirteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if not the last trimming part
-						if(i != SLEAN_TRIMMING_PARTS / 2 - 1) {
-						
-							// Check if queuing running step fifteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepFifteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[14], &workItemsPerWorkGroup[14], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Otherwise
-						else {
-						
-							// Check if queuing clearing number of edges per bucket two on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's SipHash keys argument failed
-							if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step sixteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[15], &workItemsPerWorkGroup[15], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step sixteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[15], &workItemsPerWorkGroup[15], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if setting program's edges bitmap argument failed
-				if(clSetKernelArg(stepSeventeenKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 2 - 1))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if queuing running step seventeen on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepEighteenKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Go through all remaining trimming parts except the last one
-				for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS / 2 - 1; ++i) {
-				
-					// Check if queuing clearing number of edges per bucket one on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step thirteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepEighteenKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step eighteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepEighteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[17], &workItemsPerWorkGroup[17], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step seventeen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if trimming more than three rounds
-				if(TRIMMING_ROUNDS > 3) {
-				
-					// Check if setting program's edges bitmap or SipHash keys arguments failed
-					if(clSetKernelArg(stepNineteenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepNineteenKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Go through several remaining trimming rounds
-					for(unsigned int i = 3; i < ((SLEAN_TRIMMING_PARTS == 2 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN); ++i) {
-					
-						// Check if queuing clearing number of edges per bucket one on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's nodes in second partition argument failed
-						if(clSetKernelArg(stepNineteenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Check if queuing running step nineteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if queuing running step twenty on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through all remaining trimming parts
-							for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 2; ++j) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step nineteen on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if not the last trimming part
-								if(j != SLEAN_TRIMMING_PARTS / 2 - 1) {
-								
-									// Check if queuing running step twenty-one on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Otherwise
-								else {
-								
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-two on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[21], &workItemsPerWorkGroup[21], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-						}
-						
-						// Otherwise
-						else {
-						
-							// Check if queuing clearing number of edges per bucket two on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step twenty-two on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[21], &workItemsPerWorkGroup[21], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 2 - 1))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Check if queuing running step seventeen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Go through all remaining trimming parts except the last one
-						for(unsigned int j = 0; j < SLEAN_TRIMMING_PARTS / 2 - 1; ++j) {
-						
-							// Check if queuing clearing number of edges per bucket one on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step nineteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing clearing number of edges per bucket two on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepTwentyThreeKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step twenty-three on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[22], &workItemsPerWorkGroup[22], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step seventeen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-					}
-					
-					// Check if slean trimming parts isn't two and trimming more rounds
-					if(SLEAN_TRIMMING_PARTS != 2 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) {
-					
-						// Check if setting program's edges bitmap or SipHash keys arguments failed
-						if(clSetKernelArg(stepTwentyFourKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyFourKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepTwentySixKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Go through several remaining trimming rounds
-						for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN; i < ((SLEAN_TRIMMING_PARTS == 4 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN); ++i) {
-						
-							// Check if queuing clearing number of edges per bucket one on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's nodes in second partition argument failed
-							if(clSetKernelArg(stepTwentyFourKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check is slean trimming parts isn't four
-							if(SLEAN_TRIMMING_PARTS != 4) {
-							
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check if queuing running step twenty-four on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check is slean trimming parts isn't four
-							if(SLEAN_TRIMMING_PARTS != 4) {
-							
-								// Check if queuing running step twenty on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming parts
-								for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 4; ++j) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-four on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if not the last trimming part
-									if(j != (SLEAN_TRIMMING_PARTS + 4 - 1) / 4 - 1) {
-									
-										// Check if queuing running step twenty-one on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-									
-									// Otherwise
-									else {
-									
-										// Check if queuing clearing number of edges per bucket two on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-five on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[24], &workItemsPerWorkGroup[24], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-								}
-							}
-							
-							// Otherwise
-							else {
-							
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-five on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[24], &workItemsPerWorkGroup[24], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check is slean trimming parts isn't four
-							if(SLEAN_TRIMMING_PARTS != 4) {
-							
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentySixKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 4 - 1))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check if queuing running step twenty-six on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[25], &workItemsPerWorkGroup[25], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through all remaining trimming parts except the last one
-							for(unsigned int j = 0; j < (SLEAN_TRIMMING_PARTS + 4 - 1) / 4 - 1; ++j) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-four on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentySevenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-seven on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[26], &workItemsPerWorkGroup[26], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentySixKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-six on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[25], &workItemsPerWorkGroup[25], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-						}
-						
-						// Check if slean trimming parts isn't four and trimming more rounds
-						if(SLEAN_TRIMMING_PARTS != 4 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) {
-						
-							// Check if setting program's edges bitmap or SipHash keys arguments failed
-							if(clSetKernelArg(stepTwentyEightKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyEightKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepThirtyKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through several remaining trimming rounds
-							for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN; i < ((SLEAN_TRIMMING_PARTS == 8 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN); ++i) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's nodes in second partition argument failed
-								if(clSetKernelArg(stepTwentyEightKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check is slean trimming parts isn't eight
-								if(SLEAN_TRIMMING_PARTS != 8) {
-								
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check if queuing running step twenty-eight on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check is slean trimming parts isn't eight
-								if(SLEAN_TRIMMING_PARTS != 8) {
-								
-									// Check if queuing running step twenty on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Go through all remaining trimming parts
-									for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 8; ++j) {
-									
-										// Check if queuing clearing number of edges per bucket one on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-eight on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if not the last trimming part
-										if(j != (SLEAN_TRIMMING_PARTS + 8 - 1) / 8 - 1) {
-										
-											// Check if queuing running step twenty-one on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-										}
-										
-										// Otherwise
-										else {
-										
-											// Check if queuing clearing number of edges per bucket two on the device failed
-											if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Preparing program's arguments on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-											
-											// Check if queuing running step twenty-nine on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[28], &workItemsPerWorkGroup[28], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-										}
-									}
-								}
-								
-								// Otherwise
-								else {
-								
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-nine on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[28], &workItemsPerWorkGroup[28], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check is slean trimming parts isn't four
-								if(SLEAN_TRIMMING_PARTS != 8) {
-								
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepThirtyKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 8 - 1))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check if queuing running step thirty on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[29], &workItemsPerWorkGroup[29], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming parts except the last one
-								for(unsigned int j = 0; j < (SLEAN_TRIMMING_PARTS + 8 - 1) / 8 - 1; ++j) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-eight on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepThirtyOneKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-one on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[30], &workItemsPerWorkGroup[30], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepThirtyKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[29], &workItemsPerWorkGroup[29], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-							
-							// Check if slean trimming parts isn't eight and trimming more rounds
-							if(SLEAN_TRIMMING_PARTS != 8 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) {
-							
-								// Check if setting program's edges bitmap or SipHash keys arguments failed
-								if(clSetKernelArg(stepThirtyTwoKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirtyTwoKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepThirtyFourKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming rounds
-								for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN; i < TRIMMING_ROUNDS; ++i) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's nodes in second partition argument failed
-									if(clSetKernelArg(stepThirtyTwoKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-two on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[31], &workItemsPerWorkGroup[31], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 16 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-three on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[32], &workItemsPerWorkGroup[32], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-four on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[33], &workItemsPerWorkGroup[33], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-		
-		// Check if queuing map result failed
-		Event mapEvent;
-		resultOne = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapOne.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-		if(!resultOne) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if closing
-		if(closing) {
-			
-			// Return true
-			return true;
-		}
-		
-		// Check if waiting for map event to finish failed
-		if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if getting trimming time failed
-		cl_ulong startTime;
-		cl_ulong endTime;
-		if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting GPU trimming time failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Display message
-		cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-		
-		// Check if queuing clearing number of edges per bucket one on the device failed
-		firstCommandEvent.free();
-		if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Preparing program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Get SipHash keys from job's header and nonce
-		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeysTwo;
-		uint64_t heightTwo = jobHeight;
-		uint64_t idTwo = jobId;
-		uint64_t nonceTwo = jobNonce++;
-		blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
-		
-		// Check if setting program's SipHash keys or part arguments failed
-		if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step one on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepTwoKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step two on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check is slean trimming parts isn't two
-		if(SLEAN_TRIMMING_PARTS != 2) {
-		
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Go through all remaining trimming parts
-		for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS; ++i) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if not the last trimming part
-			if(i != SLEAN_TRIMMING_PARTS - 1) {
-			
-				// Check if queuing running step three on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Otherwise
-			else {
-			
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepFourKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step four on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-		}
-		
-		// Check if setting program's edges bitmap or part arguments failed
-		if(clSetKernelArg(stepFiveKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if queuing running step five on the device failed
-		if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Running program on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Check if setting program's SipHash keys argument failed
-		if(clSetKernelArg(stepSixKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Setting program's arguments on the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Go through all remaining trimming parts except the last one
-		for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS - 1; ++i) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing clearing number of edges per bucket two on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step six on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[5], &workItemsPerWorkGroup[5], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's part argument failed
-			if(clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step five on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-		}
-		
-		// Check if trimming more than one round
-		if(TRIMMING_ROUNDS > 1) {
-		
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's edges bitmap, SipHash keys, or part arguments failed
-			if(clSetKernelArg(stepSevenKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step seven on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepEightKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step eight on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[7], &workItemsPerWorkGroup[7], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check is slean trimming parts isn't two
-			if(SLEAN_TRIMMING_PARTS != 2) {
-			
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepNineKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Go through all remaining trimming parts
-			for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS; ++i) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step seven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if not the last trimming part
-				if(i != SLEAN_TRIMMING_PARTS - 1) {
-				
-					// Check if queuing running step nine on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[8], &workItemsPerWorkGroup[8], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepTenKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step ten on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepTenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[9], &workItemsPerWorkGroup[9], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-			}
-			
-			// Check if setting program's edges bitmap or part arguments failed
-			if(clSetKernelArg(stepElevenKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step eleven on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepElevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[10], &workItemsPerWorkGroup[10], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepTwelveKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Go through all remaining trimming parts except the last one
-			for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS - 1; ++i) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step seven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepTwelveKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step twelve on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwelveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[11], &workItemsPerWorkGroup[11], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step eleven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepElevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[10], &workItemsPerWorkGroup[10], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Check if trimming more than two rounds
-			if(TRIMMING_ROUNDS > 2) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's edges bitmap or SipHash keys arguments failed
-				if(clSetKernelArg(stepThirteenKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThirteenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if queuing running step thirteen on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFourteenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step fourteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[13], &workItemsPerWorkGroup[13], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check is slean trimming parts isn't two
-					if(SLEAN_TRIMMING_PARTS != 2) {
-					
-						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepFifteenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Go through all remaining trimming parts
-					for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS / 2; ++i) {
-					
-						// Check if queuing clearing number of edges per bucket one on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step thirteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if not the last trimming part
-						if(i != SLEAN_TRIMMING_PARTS / 2 - 1) {
-						
-							// Check if queuing running step fifteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepFifteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[14], &workItemsPerWorkGroup[14], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Otherwise
-						else {
-						
-							// Check if queuing clearing number of edges per bucket two on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's SipHash keys argument failed
-							if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step sixteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[15], &workItemsPerWorkGroup[15], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step sixteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[15], &workItemsPerWorkGroup[15], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if setting program's edges bitmap argument failed
-				if(clSetKernelArg(stepSeventeenKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 2 - 1))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if queuing running step seventeen on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepEighteenKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Go through all remaining trimming parts except the last one
-				for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS / 2 - 1; ++i) {
-				
-					// Check if queuing clearing number of edges per bucket one on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step thirteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepEighteenKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step eighteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepEighteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[17], &workItemsPerWorkGroup[17], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step seventeen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if trimming more than three rounds
-				if(TRIMMING_ROUNDS > 3) {
-				
-					// Check if setting program's edges bitmap or SipHash keys arguments failed
-					if(clSetKernelArg(stepNineteenKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepNineteenKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Go through several remaining trimming rounds
-					for(unsigned int i = 3; i < ((SLEAN_TRIMMING_PARTS == 2 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN); ++i) {
-					
-						// Check if queuing clearing number of edges per bucket one on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's nodes in second partition argument failed
-						if(clSetKernelArg(stepNineteenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Check if queuing running step nineteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if queuing running step twenty on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through all remaining trimming parts
-							for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 2; ++j) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step nineteen on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if not the last trimming part
-								if(j != SLEAN_TRIMMING_PARTS / 2 - 1) {
-								
-									// Check if queuing running step twenty-one on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Otherwise
-								else {
-								
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-two on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[21], &workItemsPerWorkGroup[21], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-						}
-						
-						// Otherwise
-						else {
-						
-							// Check if queuing clearing number of edges per bucket two on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step twenty-two on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[21], &workItemsPerWorkGroup[21], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 2 - 1))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Check if queuing running step seventeen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Go through all remaining trimming parts except the last one
-						for(unsigned int j = 0; j < SLEAN_TRIMMING_PARTS / 2 - 1; ++j) {
-						
-							// Check if queuing clearing number of edges per bucket one on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step nineteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing clearing number of edges per bucket two on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepTwentyThreeKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step twenty-three on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[22], &workItemsPerWorkGroup[22], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step seventeen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-					}
-					
-					// Check if slean trimming parts isn't two and trimming more rounds
-					if(SLEAN_TRIMMING_PARTS != 2 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) {
-					
-						// Check if setting program's edges bitmap or SipHash keys arguments failed
-						if(clSetKernelArg(stepTwentyFourKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyFourKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepTwentySixKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Go through several remaining trimming rounds
-						for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN; i < ((SLEAN_TRIMMING_PARTS == 4 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN); ++i) {
-						
-							// Check if queuing clearing number of edges per bucket one on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's nodes in second partition argument failed
-							if(clSetKernelArg(stepTwentyFourKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check is slean trimming parts isn't four
-							if(SLEAN_TRIMMING_PARTS != 4) {
-							
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check if queuing running step twenty-four on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check is slean trimming parts isn't four
-							if(SLEAN_TRIMMING_PARTS != 4) {
-							
-								// Check if queuing running step twenty on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming parts
-								for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 4; ++j) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-four on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if not the last trimming part
-									if(j != (SLEAN_TRIMMING_PARTS + 4 - 1) / 4 - 1) {
-									
-										// Check if queuing running step twenty-one on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-									
-									// Otherwise
-									else {
-									
-										// Check if queuing clearing number of edges per bucket two on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-five on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[24], &workItemsPerWorkGroup[24], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-								}
-							}
-							
-							// Otherwise
-							else {
-							
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-five on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[24], &workItemsPerWorkGroup[24], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check is slean trimming parts isn't four
-							if(SLEAN_TRIMMING_PARTS != 4) {
-							
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentySixKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 4 - 1))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check if queuing running step twenty-six on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[25], &workItemsPerWorkGroup[25], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through all remaining trimming parts except the last one
-							for(unsigned int j = 0; j < (SLEAN_TRIMMING_PARTS + 4 - 1) / 4 - 1; ++j) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-four on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentySevenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-seven on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[26], &workItemsPerWorkGroup[26], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentySixKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-six on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[25], &workItemsPerWorkGroup[25], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-						}
-						
-						// Check if slean trimming parts isn't four and trimming more rounds
-						if(SLEAN_TRIMMING_PARTS != 4 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) {
-						
-							// Check if setting program's edges bitmap or SipHash keys arguments failed
-							if(clSetKernelArg(stepTwentyEightKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyEightKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepThirtyKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through several remaining trimming rounds
-							for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN; i < ((SLEAN_TRIMMING_PARTS == 8 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN); ++i) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's nodes in second partition argument failed
-								if(clSetKernelArg(stepTwentyEightKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check is slean trimming parts isn't eight
-								if(SLEAN_TRIMMING_PARTS != 8) {
-								
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check if queuing running step twenty-eight on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check is slean trimming parts isn't eight
-								if(SLEAN_TRIMMING_PARTS != 8) {
-								
-									// Check if queuing running step twenty on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Go through all remaining trimming parts
-									for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 8; ++j) {
-									
-										// Check if queuing clearing number of edges per bucket one on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-eight on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if not the last trimming part
-										if(j != (SLEAN_TRIMMING_PARTS + 8 - 1) / 8 - 1) {
-										
-											// Check if queuing running step twenty-one on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-										}
-										
-										// Otherwise
-										else {
-										
-											// Check if queuing clearing number of edges per bucket two on the device failed
-											if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Preparing program's arguments on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-											
-											// Check if queuing running step twenty-nine on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[28], &workItemsPerWorkGroup[28], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-										}
-									}
-								}
-								
-								// Otherwise
-								else {
-								
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-nine on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[28], &workItemsPerWorkGroup[28], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check is slean trimming parts isn't four
-								if(SLEAN_TRIMMING_PARTS != 8) {
-								
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepThirtyKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 8 - 1))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check if queuing running step thirty on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[29], &workItemsPerWorkGroup[29], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming parts except the last one
-								for(unsigned int j = 0; j < (SLEAN_TRIMMING_PARTS + 8 - 1) / 8 - 1; ++j) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-eight on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepThirtyOneKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-one on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[30], &workItemsPerWorkGroup[30], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepThirtyKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[29], &workItemsPerWorkGroup[29], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-							
-							// Check if slean trimming parts isn't eight and trimming more rounds
-							if(SLEAN_TRIMMING_PARTS != 8 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) {
-							
-								// Check if setting program's edges bitmap or SipHash keys arguments failed
-								if(clSetKernelArg(stepThirtyTwoKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThirtyTwoKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepThirtyFourKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming rounds
-								for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN; i < TRIMMING_ROUNDS; ++i) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's nodes in second partition argument failed
-									if(clSetKernelArg(stepThirtyTwoKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-two on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[31], &workItemsPerWorkGroup[31], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 16 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-three on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[32], &workItemsPerWorkGroup[32], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step thirty-four on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[33], &workItemsPerWorkGroup[33], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
-		
-		// Check if queuing map result failed
-		mapEvent.free();
-		resultTwo = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapTwo.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-		if(!resultTwo) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Perform commands in queue
-		clFlush(commandQueue.get());
-		
-		// Trimming finished
-		trimmingFinished(resultOne, sipHashKeysOne, heightOne, idOne, nonceOne);
-		
-		// Check if queuing unmap result failed
-		if(clEnqueueUnmapMemObject(commandQueue.get(), edgesBitmapOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr) != CL_SUCCESS) {
-		
-			// Display message
-			cout << "Getting result from the GPU failed." << endl;
-			
-			// Return false
-			return false;
-		}
-		
-		// Set that result one doesn't exist
-		resultOne = nullptr;
-		
-		// While not closing
-		while(!closing) {
-		
-			// Check if waiting for map event to finish failed
-			if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if getting trimming time failed
-			if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting GPU trimming time failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Display message
-			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-			
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			firstCommandEvent.free();
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Get SipHash keys from job's header and nonce
-			heightOne = jobHeight;
-			idOne = jobId;
-			nonceOne = jobNonce++;
-			blake2b(sipHashKeysOne, jobHeader, nonceOne);
-			
-			// Check if setting program's SipHash keys or part arguments failed
-			if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step one on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepTwoKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step two on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[1], &workItemsPerWorkGroup[1], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check is slean trimming parts isn't two
-			if(SLEAN_TRIMMING_PARTS != 2) {
-			
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Go through all remaining trimming parts
-			for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS; ++i) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step one on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if not the last trimming part
-				if(i != SLEAN_TRIMMING_PARTS - 1) {
-				
-					// Check if queuing running step three on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[2], &workItemsPerWorkGroup[2], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Otherwise
-				else {
-				
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFourKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step four on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[3], &workItemsPerWorkGroup[3], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-			}
-			
-			// Check if setting program's edges bitmap or part arguments failed
-			if(clSetKernelArg(stepFiveKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if queuing running step five on the device failed
-			if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Running program on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Setting program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Go through all remaining trimming parts except the last one
-			for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS - 1; ++i) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step one on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[0], &workItemsPerWorkGroup[0], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing clearing number of edges per bucket two on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepSixKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step six on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[5], &workItemsPerWorkGroup[5], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's part argument failed
-				if(clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step five on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[4], &workItemsPerWorkGroup[4], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-			}
-			
-			// Check if trimming more than one round
-			if(TRIMMING_ROUNDS > 1) {
-			
-				// Check if queuing clearing number of edges per bucket one on the device failed
-				if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Preparing program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's edges bitmap, SipHash keys, or part arguments failed
-				if(clSetKernelArg(stepSevenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step seven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepEightKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step eight on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[7], &workItemsPerWorkGroup[7], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check is slean trimming parts isn't two
-				if(SLEAN_TRIMMING_PARTS != 2) {
-				
-					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepNineKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Go through all remaining trimming parts
-				for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS; ++i) {
-				
-					// Check if queuing clearing number of edges per bucket one on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step seven on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if not the last trimming part
-					if(i != SLEAN_TRIMMING_PARTS - 1) {
-					
-						// Check if queuing running step nine on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[8], &workItemsPerWorkGroup[8], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Otherwise
-					else {
-					
-						// Check if queuing clearing number of edges per bucket two on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepTenKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step ten on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepTenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[9], &workItemsPerWorkGroup[9], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-				}
-				
-				// Check if setting program's edges bitmap or part arguments failed
-				if(clSetKernelArg(stepElevenKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if queuing running step eleven on the device failed
-				if(clEnqueueNDRangeKernel(commandQueue.get(), stepElevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[10], &workItemsPerWorkGroup[10], 0, nullptr, nullptr) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Running program on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepTwelveKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-				
-					// Display message
-					cout << "Setting program's arguments on the GPU failed." << endl;
-					
-					// Return false
-					return false;
-				}
-				
-				// Go through all remaining trimming parts except the last one
-				for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS - 1; ++i) {
-				
-					// Check if queuing clearing number of edges per bucket one on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step seven on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[6], &workItemsPerWorkGroup[6], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing clearing number of edges per bucket two on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepTwelveKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step twelve on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwelveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[11], &workItemsPerWorkGroup[11], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's part argument failed
-					if(clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if queuing running step eleven on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepElevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[10], &workItemsPerWorkGroup[10], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-				}
-				
-				// Check if trimming more than two rounds
-				if(TRIMMING_ROUNDS > 2) {
-				
-					// Check if queuing clearing number of edges per bucket one on the device failed
-					if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Preparing program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check if setting program's edges bitmap or SipHash keys arguments failed
-					if(clSetKernelArg(stepThirteenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirteenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check is slean trimming parts isn't two
-					if(SLEAN_TRIMMING_PARTS != 2) {
-					
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Check if queuing running step thirteen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check is slean trimming parts isn't two
-					if(SLEAN_TRIMMING_PARTS != 2) {
-					
-						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepFourteenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step fourteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepFourteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[13], &workItemsPerWorkGroup[13], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check is slean trimming parts isn't two
-						if(SLEAN_TRIMMING_PARTS != 2) {
-						
-							// Check if setting program's SipHash keys argument failed
-							if(clSetKernelArg(stepFifteenKernel.get(), 3, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-						}
-						
-						// Go through all remaining trimming parts
-						for(unsigned int i = 1; i < SLEAN_TRIMMING_PARTS / 2; ++i) {
-						
-							// Check if queuing clearing number of edges per bucket one on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's part argument failed
-							if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if queuing running step thirteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if not the last trimming part
-							if(i != SLEAN_TRIMMING_PARTS / 2 - 1) {
-							
-								// Check if queuing running step fifteen on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepFifteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[14], &workItemsPerWorkGroup[14], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Otherwise
-							else {
-							
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's SipHash keys argument failed
-								if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step sixteen on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[15], &workItemsPerWorkGroup[15], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-						}
-					}
-					
-					// Otherwise
-					else {
-					
-						// Check if queuing clearing number of edges per bucket two on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step sixteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepSixteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[15], &workItemsPerWorkGroup[15], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Check if setting program's edges bitmap argument failed
-					if(clSetKernelArg(stepSeventeenKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Setting program's arguments on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check is slean trimming parts isn't two
-					if(SLEAN_TRIMMING_PARTS != 2) {
-					
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 2 - 1))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Check if queuing running step seventeen on the device failed
-					if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-					
-						// Display message
-						cout << "Running program on the GPU failed." << endl;
-						
-						// Return false
-						return false;
-					}
-					
-					// Check is slean trimming parts isn't two
-					if(SLEAN_TRIMMING_PARTS != 2) {
-					
-						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepEighteenKernel.get(), 5, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Go through all remaining trimming parts except the last one
-					for(unsigned int i = 0; i < SLEAN_TRIMMING_PARTS / 2 - 1; ++i) {
-					
-						// Check if queuing clearing number of edges per bucket one on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepThirteenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step thirteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[12], &workItemsPerWorkGroup[12], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing clearing number of edges per bucket two on the device failed
-						if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Preparing program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepEighteenKernel.get(), 6, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step eighteen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepEighteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[17], &workItemsPerWorkGroup[17], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if setting program's part argument failed
-						if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i))) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Check if queuing running step seventeen on the device failed
-						if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Running program on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-					}
-					
-					// Check if trimming more than three rounds
-					if(TRIMMING_ROUNDS > 3) {
-					
-						// Check if setting program's edges bitmap or SipHash keys arguments failed
-						if(clSetKernelArg(stepNineteenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepNineteenKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS) {
-						
-							// Display message
-							cout << "Setting program's arguments on the GPU failed." << endl;
-							
-							// Return false
-							return false;
-						}
-						
-						// Go through several remaining trimming rounds
-						for(unsigned int i = 3; i < ((SLEAN_TRIMMING_PARTS == 2 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN); ++i) {
-						
-							// Check if queuing clearing number of edges per bucket one on the device failed
-							if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Preparing program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check if setting program's nodes in second partition argument failed
-							if(clSetKernelArg(stepNineteenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check is slean trimming parts isn't two
-							if(SLEAN_TRIMMING_PARTS != 2) {
-							
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check if queuing running step nineteen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Check is slean trimming parts isn't two
-							if(SLEAN_TRIMMING_PARTS != 2) {
-							
-								// Check if queuing running step twenty on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming parts
-								for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 2; ++j) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step nineteen on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if not the last trimming part
-									if(j != SLEAN_TRIMMING_PARTS / 2 - 1) {
-									
-										// Check if queuing running step twenty-one on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-									
-									// Otherwise
-									else {
-									
-										// Check if queuing clearing number of edges per bucket two on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-two on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[21], &workItemsPerWorkGroup[21], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-								}
-							}
-							
-							// Otherwise
-							else {
-							
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-two on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[21], &workItemsPerWorkGroup[21], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check is slean trimming parts isn't two
-							if(SLEAN_TRIMMING_PARTS != 2) {
-							
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 2 - 1))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-							
-							// Check if queuing running step seventeen on the device failed
-							if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Running program on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through all remaining trimming parts except the last one
-							for(unsigned int j = 0; j < SLEAN_TRIMMING_PARTS / 2 - 1; ++j) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepNineteenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step nineteen on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepNineteenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[18], &workItemsPerWorkGroup[18], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing clearing number of edges per bucket two on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 2 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepTwentyThreeKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step twenty-three on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[22], &workItemsPerWorkGroup[22], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's part argument failed
-								if(clSetKernelArg(stepSeventeenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if queuing running step seventeen on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepSeventeenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[16], &workItemsPerWorkGroup[16], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-							}
-						}
-						
-						// Check if slean trimming parts isn't two and trimming more rounds
-						if(SLEAN_TRIMMING_PARTS != 2 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) {
-						
-							// Check if setting program's edges bitmap or SipHash keys arguments failed
-							if(clSetKernelArg(stepTwentyFourKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyFourKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepTwentySixKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-							
-								// Display message
-								cout << "Setting program's arguments on the GPU failed." << endl;
-								
-								// Return false
-								return false;
-							}
-							
-							// Go through several remaining trimming rounds
-							for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN; i < ((SLEAN_TRIMMING_PARTS == 4 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN); ++i) {
-							
-								// Check if queuing clearing number of edges per bucket one on the device failed
-								if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Preparing program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check if setting program's nodes in second partition argument failed
-								if(clSetKernelArg(stepTwentyFourKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check is slean trimming parts isn't four
-								if(SLEAN_TRIMMING_PARTS != 4) {
-								
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check if queuing running step twenty-four on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Check is slean trimming parts isn't four
-								if(SLEAN_TRIMMING_PARTS != 4) {
-								
-									// Check if queuing running step twenty on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Go through all remaining trimming parts
-									for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 4; ++j) {
-									
-										// Check if queuing clearing number of edges per bucket one on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-four on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if not the last trimming part
-										if(j != (SLEAN_TRIMMING_PARTS + 4 - 1) / 4 - 1) {
-										
-											// Check if queuing running step twenty-one on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-										}
-										
-										// Otherwise
-										else {
-										
-											// Check if queuing clearing number of edges per bucket two on the device failed
-											if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Preparing program's arguments on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-											
-											// Check if queuing running step twenty-five on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[24], &workItemsPerWorkGroup[24], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-										}
-									}
-								}
-								
-								// Otherwise
-								else {
-								
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-five on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[24], &workItemsPerWorkGroup[24], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check is slean trimming parts isn't four
-								if(SLEAN_TRIMMING_PARTS != 4) {
-								
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentySixKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 4 - 1))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-								
-								// Check if queuing running step twenty-six on the device failed
-								if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[25], &workItemsPerWorkGroup[25], 0, nullptr, nullptr) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Running program on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through all remaining trimming parts except the last one
-								for(unsigned int j = 0; j < (SLEAN_TRIMMING_PARTS + 4 - 1) / 4 - 1; ++j) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentyFourKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-four on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[23], &workItemsPerWorkGroup[23], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing clearing number of edges per bucket two on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 4 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentySevenKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-seven on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySevenKernel.get(), 1, nullptr, &totalNumberOfWorkItems[26], &workItemsPerWorkGroup[26], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's part argument failed
-									if(clSetKernelArg(stepTwentySixKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if queuing running step twenty-six on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentySixKernel.get(), 1, nullptr, &totalNumberOfWorkItems[25], &workItemsPerWorkGroup[25], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-								}
-							}
-							
-							// Check if slean trimming parts isn't four and trimming more rounds
-							if(SLEAN_TRIMMING_PARTS != 4 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) {
-							
-								// Check if setting program's edges bitmap or SipHash keys arguments failed
-								if(clSetKernelArg(stepTwentyEightKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyEightKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepThirtyKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-								
-									// Display message
-									cout << "Setting program's arguments on the GPU failed." << endl;
-									
-									// Return false
-									return false;
-								}
-								
-								// Go through several remaining trimming rounds
-								for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN; i < ((SLEAN_TRIMMING_PARTS == 8 || TRIMMING_ROUNDS < SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) ? TRIMMING_ROUNDS : SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN); ++i) {
-								
-									// Check if queuing clearing number of edges per bucket one on the device failed
-									if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Preparing program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check if setting program's nodes in second partition argument failed
-									if(clSetKernelArg(stepTwentyEightKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check is slean trimming parts isn't eight
-									if(SLEAN_TRIMMING_PARTS != 8) {
-									
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-									
-									// Check if queuing running step twenty-eight on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Check is slean trimming parts isn't eight
-									if(SLEAN_TRIMMING_PARTS != 8) {
-									
-										// Check if queuing running step twenty on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[19], &workItemsPerWorkGroup[19], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Go through all remaining trimming parts
-										for(unsigned int j = 1; j < SLEAN_TRIMMING_PARTS / 8; ++j) {
-										
-											// Check if queuing clearing number of edges per bucket one on the device failed
-											if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Preparing program's arguments on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-											
-											// Check if setting program's part argument failed
-											if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Setting program's arguments on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-											
-											// Check if queuing running step twenty-eight on the device failed
-											if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-											
-												// Display message
-												cout << "Running program on the GPU failed." << endl;
-												
-												// Return false
-												return false;
-											}
-											
-											// Check if not the last trimming part
-											if(j != (SLEAN_TRIMMING_PARTS + 8 - 1) / 8 - 1) {
-											
-												// Check if queuing running step twenty-one on the device failed
-												if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[20], &workItemsPerWorkGroup[20], 0, nullptr, nullptr) != CL_SUCCESS) {
-												
-													// Display message
-													cout << "Running program on the GPU failed." << endl;
-													
-													// Return false
-													return false;
-												}
-											}
-											
-											// Otherwise
-											else {
-											
-												// Check if queuing clearing number of edges per bucket two on the device failed
-												if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-												
-													// Display message
-													cout << "Preparing program's arguments on the GPU failed." << endl;
-													
-													// Return false
-													return false;
-												}
-												
-												// Check if queuing running step twenty-nine on the device failed
-												if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[28], &workItemsPerWorkGroup[28], 0, nullptr, nullptr) != CL_SUCCESS) {
-												
-													// Display message
-													cout << "Running program on the GPU failed." << endl;
-													
-													// Return false
-													return false;
-												}
-											}
-										}
-									}
-									
-									// Otherwise
-									else {
-									
-										// Check if queuing clearing number of edges per bucket two on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-nine on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyNineKernel.get(), 1, nullptr, &totalNumberOfWorkItems[28], &workItemsPerWorkGroup[28], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-									
-									// Check is slean trimming parts isn't four
-									if(SLEAN_TRIMMING_PARTS != 8) {
-									
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepThirtyKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS / 8 - 1))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-									
-									// Check if queuing running step thirty on the device failed
-									if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[29], &workItemsPerWorkGroup[29], 0, nullptr, nullptr) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Running program on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Go through all remaining trimming parts except the last one
-									for(unsigned int j = 0; j < (SLEAN_TRIMMING_PARTS + 8 - 1) / 8 - 1; ++j) {
-									
-										// Check if queuing clearing number of edges per bucket one on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepTwentyEightKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step twenty-eight on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepTwentyEightKernel.get(), 1, nullptr, &totalNumberOfWorkItems[27], &workItemsPerWorkGroup[27], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing clearing number of edges per bucket two on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 8 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepThirtyOneKernel.get(), 5, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step thirty-one on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyOneKernel.get(), 1, nullptr, &totalNumberOfWorkItems[30], &workItemsPerWorkGroup[30], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's part argument failed
-										if(clSetKernelArg(stepThirtyKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(j))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step thirty on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyKernel.get(), 1, nullptr, &totalNumberOfWorkItems[29], &workItemsPerWorkGroup[29], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-								}
-								
-								// Check if slean trimming parts isn't eight and trimming more rounds
-								if(SLEAN_TRIMMING_PARTS != 8 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) {
-								
-									// Check if setting program's edges bitmap or SipHash keys arguments failed
-									if(clSetKernelArg(stepThirtyTwoKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirtyTwoKernel.get(), 4, sizeof(sipHashKeysOne), &sipHashKeysOne) != CL_SUCCESS || clSetKernelArg(stepThirtyFourKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
-									
-										// Display message
-										cout << "Setting program's arguments on the GPU failed." << endl;
-										
-										// Return false
-										return false;
-									}
-									
-									// Go through all remaining trimming rounds
-									for(unsigned int i = SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN; i < TRIMMING_ROUNDS; ++i) {
-									
-										// Check if queuing clearing number of edges per bucket one on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if setting program's nodes in second partition argument failed
-										if(clSetKernelArg(stepThirtyTwoKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(i % 2))) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Setting program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step thirty-two on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyTwoKernel.get(), 1, nullptr, &totalNumberOfWorkItems[31], &workItemsPerWorkGroup[31], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing clearing number of edges per bucket two on the device failed
-										if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketTwo.get(), (const cl_ulong[]){0}, sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_REMAINING_EDGES_BUCKETS * 16 * sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Preparing program's arguments on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step thirty-three on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyThreeKernel.get(), 1, nullptr, &totalNumberOfWorkItems[32], &workItemsPerWorkGroup[32], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-										
-										// Check if queuing running step thirty-four on the device failed
-										if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyFourKernel.get(), 1, nullptr, &totalNumberOfWorkItems[33], &workItemsPerWorkGroup[33], 0, nullptr, nullptr) != CL_SUCCESS) {
-										
-											// Display message
-											cout << "Running program on the GPU failed." << endl;
-											
-											// Return false
-											return false;
-										}
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-			
-			// Check if queuing map result failed
-			mapEvent.free();
-			resultOne = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapOne.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-			if(!resultOne) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Perform commands in queue
-			clFlush(commandQueue.get());
-			
-			// Trimming finished
-			trimmingFinished(resultTwo, sipHashKeysTwo, heightTwo, idTwo, nonceTwo);
-			
-			// Check if queuing unmap result failed
-			if(clEnqueueUnmapMemObject(commandQueue.get(), edgesBitmapTwo.get(), reinterpret_cast<void *>(resultTwo), 0, nullptr, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Set that result two doesn't exist
-			resultTwo = nullptr;
-			
-			// Check if closing
-			if(closing) {
-			
-				// Return true
-				return true;
-			}
-			
-			// Check if waiting for map event to finish failed
-			if(clWaitForEvents(1, mapEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting result from the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Check if getting trimming time failed
-			if(clGetEventProfilingInfo(firstCommandEvent.get(), CL_PROFILING_COMMAND_QUEUED, sizeof(startTime), &startTime, nullptr) != CL_SUCCESS || clGetEventProfilingInfo(mapEvent.get(), CL_PROFILING_COMMAND_END, sizeof(endTime), &endTime, nullptr) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Getting GPU trimming time failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Display message
-			cout << "\tTrimming time:\t " << static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(endTime - startTime)).count() << " second(s)" << endl;
-			
-			// Check if queuing clearing number of edges per bucket one on the device failed
-			firstCommandEvent.free();
-			if(clEnqueueFillBuffer(commandQueue.get(), numberOfEdgesPerBucketOne.get(), (const cl_ulong[]){0}, (SLEAN_TRIMMING_NUMBER_OF_BUCKETS == 1) ? sizeof(cl_uint) : sizeof(cl_ulong), 0, SLEAN_TRIMMING_NUMBER_OF_BUCKETS * sizeof(cl_uint), 0, nullptr, firstCommandEvent.getAddress()) != CL_SUCCESS) {
-			
-				// Display message
-				cout << "Preparing program's arguments on the GPU failed." << endl;
-				
-				// Return false
-				return false;
-			}
-			
-			// Get SipHash keys from job's header and nonce
-			heightTwo = jobHeight;
-			idTwo = jobId;
-			nonceTwo = jobNonce++;
-			blake2b(sipHashKeysTwo, jobHeader, nonceTwo);
-			
-			// Check if setting program's SipHash keys or part arguments failed
-			if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
+			// Check if setting program's SipHash keys or part arguments failed
+			if(clSetKernelArg(stepOneKernel.get(), 2, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS || clSetKernelArg(stepOneKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12224,7 +6811,7 @@ using namespace std;
 			}
 			
 			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepTwoKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+			if(clSetKernelArg(stepTwoKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12247,7 +6834,7 @@ using namespace std;
 			if(SLEAN_TRIMMING_PARTS != 2) {
 			
 				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+				if(clSetKernelArg(stepThreeKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 				
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12318,7 +6905,7 @@ using namespace std;
 					}
 					
 					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepFourKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+					if(clSetKernelArg(stepFourKernel.get(), 5, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 					
 						// Display message
 						cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12340,7 +6927,7 @@ using namespace std;
 			}
 			
 			// Check if setting program's edges bitmap or part arguments failed
-			if(clSetKernelArg(stepFiveKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
+			if(clSetKernelArg(stepFiveKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepFiveKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12360,7 +6947,7 @@ using namespace std;
 			}
 			
 			// Check if setting program's SipHash keys argument failed
-			if(clSetKernelArg(stepSixKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+			if(clSetKernelArg(stepSixKernel.get(), 5, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
 				// Display message
 				cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12467,7 +7054,7 @@ using namespace std;
 				}
 				
 				// Check if setting program's edges bitmap, SipHash keys, or part arguments failed
-				if(clSetKernelArg(stepSevenKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
+				if(clSetKernelArg(stepSevenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS || clSetKernelArg(stepSevenKernel.get(), 4, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(0))) != CL_SUCCESS) {
 				
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12487,7 +7074,7 @@ using namespace std;
 				}
 				
 				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepEightKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+				if(clSetKernelArg(stepEightKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 				
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12510,7 +7097,7 @@ using namespace std;
 				if(SLEAN_TRIMMING_PARTS != 2) {
 				
 					// Check if setting program's SipHash keys argument failed
-					if(clSetKernelArg(stepNineKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+					if(clSetKernelArg(stepNineKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 					
 						// Display message
 						cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12581,7 +7168,7 @@ using namespace std;
 						}
 						
 						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepTenKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+						if(clSetKernelArg(stepTenKernel.get(), 5, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 						
 							// Display message
 							cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12603,7 +7190,7 @@ using namespace std;
 				}
 				
 				// Check if setting program's edges bitmap or part arguments failed
-				if(clSetKernelArg(stepElevenKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
+				if(clSetKernelArg(stepElevenKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepElevenKernel.get(), 3, sizeof(cl_uchar), &unmove(static_cast<cl_uchar>(SLEAN_TRIMMING_PARTS - 1))) != CL_SUCCESS) {
 				
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12623,7 +7210,7 @@ using namespace std;
 				}
 				
 				// Check if setting program's SipHash keys argument failed
-				if(clSetKernelArg(stepTwelveKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+				if(clSetKernelArg(stepTwelveKernel.get(), 5, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 				
 					// Display message
 					cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12730,7 +7317,7 @@ using namespace std;
 					}
 					
 					// Check if setting program's edges bitmap or SipHash keys arguments failed
-					if(clSetKernelArg(stepThirteenKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThirteenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+					if(clSetKernelArg(stepThirteenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirteenKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 					
 						// Display message
 						cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12767,7 +7354,7 @@ using namespace std;
 					if(SLEAN_TRIMMING_PARTS != 2) {
 					
 						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepFourteenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+						if(clSetKernelArg(stepFourteenKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 						
 							// Display message
 							cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12790,7 +7377,7 @@ using namespace std;
 						if(SLEAN_TRIMMING_PARTS != 2) {
 						
 							// Check if setting program's SipHash keys argument failed
-							if(clSetKernelArg(stepFifteenKernel.get(), 3, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+							if(clSetKernelArg(stepFifteenKernel.get(), 3, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 							
 								// Display message
 								cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12861,7 +7448,7 @@ using namespace std;
 								}
 								
 								// Check if setting program's SipHash keys argument failed
-								if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+								if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 								
 									// Display message
 									cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12897,7 +7484,7 @@ using namespace std;
 						}
 						
 						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+						if(clSetKernelArg(stepSixteenKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 						
 							// Display message
 							cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12918,7 +7505,7 @@ using namespace std;
 					}
 					
 					// Check if setting program's edges bitmap argument failed
-					if(clSetKernelArg(stepSeventeenKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
+					if(clSetKernelArg(stepSeventeenKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
 					
 						// Display message
 						cout << "Setting program's arguments on the GPU failed." << endl;
@@ -12955,7 +7542,7 @@ using namespace std;
 					if(SLEAN_TRIMMING_PARTS != 2) {
 					
 						// Check if setting program's SipHash keys argument failed
-						if(clSetKernelArg(stepEighteenKernel.get(), 5, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+						if(clSetKernelArg(stepEighteenKernel.get(), 5, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 						
 							// Display message
 							cout << "Setting program's arguments on the GPU failed." << endl;
@@ -13053,7 +7640,7 @@ using namespace std;
 					if(TRIMMING_ROUNDS > 3) {
 					
 						// Check if setting program's edges bitmap or SipHash keys arguments failed
-						if(clSetKernelArg(stepNineteenKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepNineteenKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS) {
+						if(clSetKernelArg(stepNineteenKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepNineteenKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 						
 							// Display message
 							cout << "Setting program's arguments on the GPU failed." << endl;
@@ -13332,7 +7919,7 @@ using namespace std;
 						if(SLEAN_TRIMMING_PARTS != 2 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_FOURTH_OF_EDGES_REMAIN) {
 						
 							// Check if setting program's edges bitmap or SipHash keys arguments failed
-							if(clSetKernelArg(stepTwentyFourKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyFourKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepTwentySixKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
+							if(clSetKernelArg(stepTwentyFourKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyFourKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS || clSetKernelArg(stepTwentySixKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
 							
 								// Display message
 								cout << "Setting program's arguments on the GPU failed." << endl;
@@ -13611,7 +8198,7 @@ using namespace std;
 							if(SLEAN_TRIMMING_PARTS != 4 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_AN_EIGHTH_OF_EDGES_REMAIN) {
 							
 								// Check if setting program's edges bitmap or SipHash keys arguments failed
-								if(clSetKernelArg(stepTwentyEightKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyEightKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepThirtyKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
+								if(clSetKernelArg(stepTwentyEightKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepTwentyEightKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS || clSetKernelArg(stepThirtyKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
 								
 									// Display message
 									cout << "Setting program's arguments on the GPU failed." << endl;
@@ -13890,7 +8477,7 @@ using namespace std;
 								if(SLEAN_TRIMMING_PARTS != 8 && TRIMMING_ROUNDS > SLEAN_TRIMMING_TRIMMING_ROUNDS_BEFORE_A_SIXTEENTH_OF_EDGES_REMAIN) {
 								
 									// Check if setting program's edges bitmap or SipHash keys arguments failed
-									if(clSetKernelArg(stepThirtyTwoKernel.get(), 0, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS || clSetKernelArg(stepThirtyTwoKernel.get(), 4, sizeof(sipHashKeysTwo), &sipHashKeysTwo) != CL_SUCCESS || clSetKernelArg(stepThirtyFourKernel.get(), 2, sizeof(edgesBitmapTwo.get()), &unmove(edgesBitmapTwo.get())) != CL_SUCCESS) {
+									if(clSetKernelArg(stepThirtyTwoKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirtyTwoKernel.get(), 4, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS || clSetKernelArg(stepThirtyFourKernel.get(), 2, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS) {
 									
 										// Display message
 										cout << "Setting program's arguments on the GPU failed." << endl;
@@ -13969,40 +8556,40 @@ using namespace std;
 				}
 			}
 			
-			// Check if queuing map result failed
-			mapEvent.free();
-			resultTwo = reinterpret_cast<uint64_t *>(clEnqueueMapBuffer(commandQueue.get(), edgesBitmapTwo.get(), CL_FALSE, CL_MAP_READ, 0, NUMBER_OF_EDGES / BITS_IN_A_BYTE, 0, nullptr, mapEvent.getAddress(), nullptr));
-			if(!resultTwo) {
+			// Check if queuing clearing the beginning of remaining edges on the device failed
+			if(clEnqueueFillBuffer(commandQueue.get(), remainingEdges, (const cl_uint[]){0}, sizeof(cl_uint), 0, sizeof(cl_uint), 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
-				cout << "Getting result from the GPU failed." << endl;
+				cout << "Preparing program's arguments on the GPU failed." << endl;
 				
 				// Return false
 				return false;
 			}
 			
-			// Perform commands in queue
-			clFlush(commandQueue.get());
+			// Check if setting program's edges bitmap, remaining edges, or SipHash keys arguments failed
+			if(clSetKernelArg(stepThirtyFiveKernel.get(), 0, sizeof(edgesBitmapOne.get()), &unmove(edgesBitmapOne.get())) != CL_SUCCESS || clSetKernelArg(stepThirtyFiveKernel.get(), 1, sizeof(remainingEdges), &remainingEdges) != CL_SUCCESS || clSetKernelArg(stepThirtyFiveKernel.get(), 2, sizeof(sipHashKeys), &sipHashKeys) != CL_SUCCESS) {
 			
-			// Trimming finished
-			trimmingFinished(resultOne, sipHashKeysOne, heightOne, idOne, nonceOne);
+				// Display message
+				cout << "Setting program's arguments on the GPU failed." << endl;
+				
+				// Return false
+				return false;
+			}
 			
-			// Check if queuing unmap result failed
-			if(clEnqueueUnmapMemObject(commandQueue.get(), edgesBitmapOne.get(), reinterpret_cast<void *>(resultOne), 0, nullptr, nullptr) != CL_SUCCESS) {
+			// Check if queuing running step thirty-five on the device failed
+			if(clEnqueueNDRangeKernel(commandQueue.get(), stepThirtyFiveKernel.get(), 1, nullptr, &totalNumberOfWorkItems[34], &workItemsPerWorkGroup[34], 0, nullptr, nullptr) != CL_SUCCESS) {
 			
 				// Display message
-				cout << "Getting result from the GPU failed." << endl;
+				cout << "Running program on the GPU failed." << endl;
 				
 				// Return false
 				return false;
 			}
 			
-			// Set that result one doesn't exist
-			resultOne = nullptr;
-		}
-		
-		// Return true
-		return true;
+			
+			// Return true
+			return true;
+		});
 	}
 #endif
 
@@ -14,8 +14,8 @@ Repeat trimming round 6 if 8 trimming parts or until at most 6.25% of edges rema
 Trimming round 7: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four
 ...
 Trimming round n - 1: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four
-Trimming round n: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four
-Get result from edges bitmap
+Trimming round n: clear number of edges per bucket one, step thirty-two, clear number of edges per bucket two, step thirty-three, step thirty-four, clear first remaining edge, step thirty-five
+Get result from remaining edges
 
 This trimming algorithm can be made faster by switching to mean trimming once the number of trimming parts has been reduced to one.
 */
@@ -404,6 +404,9 @@ using namespace metal;
 // Trim edges step thirty-four
 [[kernel]] void trimEdgesStepThirtyFour(device const uint *__restrict buckets, device const uint *__restrict numberOfEdgesPerBucket, device uint *__restrict edgesBitmap, const ushort localId, const ushort localSize, const uint groupId);
 
+// Trim edges step thirty-five
+[[kernel]] void trimEdgesStepThirtyFive(device const ulong *__restrict edgesBitmap, device atomic_uint *__restrict remainingEdges, constant const ulong4 &__restrict sipHashKeys, const uint globalId, const ushort localId);
+
 // Check if number of buckets is one
 #if NUMBER_OF_BUCKETS == 1
 
@@ -2993,6 +2996,78 @@ static inline bool isBitSetInBitmap(threadgroup const uint *bitmap, const uint i
 	}
 }
 
+// Trim edges step thirty-five
+[[kernel]] void trimEdgesStepThirtyFive(device const ulong *__restrict edgesBitmap [[buffer(8)]], device atomic_uint *__restrict remainingEdges [[buffer(10)]], constant const ulong4 &__restrict sipHashKeys [[buffer(2)]], const uint globalId [[thread_position_in_grid]], const ushort localId [[thread_position_in_threadgroup]]) {
+
+	// Declare number of edges and index
+	threadgroup atomic_uint numberOfEdges;
+	threadgroup uint index;
+	
+	// Check if this work item is the first in the work group
+	if(localId == 0) {
+	
+		// Set number of edges to zero
+		atomic_store_explicit(&numberOfEdges, 0, memory_order_relaxed);
+	}
+	
+	// Synchronize work group
+	threadgroup_barrier(mem_flags::mem_threadgroup);
+	
+	// Get work item's edge indices
+	const uint indices = globalId * static_cast<char>(sizeof(ulong) * BITS_IN_A_BYTE);
+	
+	// Get this work item's edges
+	ulong edges = edgesBitmap[globalId];
+	
+	// Check if this work item has edges
+	uint offset = 0;
+	if(edges) {
+	
+		// Add this work item's number of edges to the work group's number of edges
+		offset = atomic_fetch_add_explicit(&numberOfEdges, static_cast<uint>(popcount(edges)), memory_order_relaxed);
+	}
+	
+	// Synchronize work group
+	threadgroup_barrier(mem_flags::mem_threadgroup);
+	
+	// Check if this work item is the first in the work group
+	if(localId == 0) {
+	
+		// Add work group's number of edges to the number of remaining edges
+		index = atomic_fetch_add_explicit(remainingEdges, atomic_load_explicit(&numberOfEdges, memory_order_relaxed), memory_order_relaxed);
+	}
+	
+	// Synchronize work group
+	threadgroup_barrier(mem_flags::mem_threadgroup);
+	
+	// Go through all of this work item's enabled edges
+	for(uint i = index + offset; edges; ++i) {
+	
+		// Get edge's bit index
+		const char bitIndex = static_cast<char>(sizeof(ulong) * BITS_IN_A_BYTE) - 1 - clz(edges);
+		
+		// Disable edge
+		edges ^= static_cast<ulong>(1) << bitIndex;
+		
+		// Get edge's index
+		const uint edgeIndex = indices + bitIndex;
+		
+		// Get edge's node
+		const uint node = sipHash24(sipHashKeys, static_cast<ulong>(edgeIndex) * 2);
+		
+		// Get edge's other node
+		const uint otherNode = sipHash24(sipHashKeys, (static_cast<ulong>(edgeIndex) * 2) | 1);
+		
+		// Get next remaining edge
+		device atomic_uint *nextRemainingEdge = &remainingEdges[min(i, static_cast<uint>(MAX_NUMBER_OF_EDGES_AFTER_TRIMMING - 1)) * EDGE_NUMBER_OF_COMPONENTS + 1];
+		
+		// Set next remaining edge to the edge and its nodes
+		atomic_store_explicit(&nextRemainingEdge[0], edgeIndex, memory_order_relaxed);
+		atomic_store_explicit(&nextRemainingEdge[1], node, memory_order_relaxed);
+		atomic_store_explicit(&nextRemainingEdge[2], otherNode, memory_order_relaxed);
+	}
+}
+
 // Check if number of buckets is one
 #if NUMBER_OF_BUCKETS == 1
 
@@ -0,0 +1,279 @@
+// Header guard
+#ifndef STRATUM_SERVER_WATCHER_H
+#define STRATUM_SERVER_WATCHER_H
+
+
+// Header files
+using namespace std;
+
+
+// Configurable constants
+
+// Stratum server watcher poll timeout milliseconds (The stratum server watcher stops polling the socket this often so that reconnecting to the stratum server doesn't have to wait long for it)
+#define STRATUM_SERVER_WATCHER_POLL_TIMEOUT_MILLISECONDS 100
+
+// Stratum server watcher peek delay milliseconds (The stratum server watcher waits this long for more of the responses from the stratum server to arrive before looking at them again when they don't contain a job)
+#define STRATUM_SERVER_WATCHER_PEEK_DELAY_MILLISECONDS 10
+
+
+// Classes
+
+// Stratum server watcher class (Looks at the responses from the stratum server while the trimming thread is busy mining and sets the newest job height as soon as a job for a new block arrives, so graphs for the previous block can be abandoned before the trimming thread gets to receive the job)
+class StratumServerWatcher final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit StratumServerWatcher() noexcept;
+		
+		// Destructor
+		inline ~StratumServerWatcher() noexcept;
+		
+		// Responses received
+		inline void responsesReceived() noexcept;
+		
+		// Pause
+		inline void pause() noexcept;
+		
+		// Resume
+		inline void resume() noexcept;
+		
+	// Private
+	private:
+	
+		// State
+		enum class State : uint8_t {
+		
+			// Watching state
+			WATCHING,
+			
+			// Responses available state
+			RESPONSES_AVAILABLE,
+			
+			// Closing state
+			CLOSING
+		};
+		
+		// Run thread
+		inline void runThread() noexcept;
+		
+		// Get job height
+		static inline uint64_t getJobHeight(char *responses) noexcept;
+		
+		// Socket mutex (This is locked while the socket is polled and while reconnecting to the stratum server so that the socket isn't closed while it's being polled)
+		mutex socketMutex;
+		
+		// State
+		atomic<State> state;
+		
+		// Responses
+		char responses[SERVER_RESPONSE_SIZE];
+		
+		// Thread
+		thread watcherThread;
+};
+
+
+// Global variables
+
+// Stratum server watcher
+static unique_ptr<StratumServerWatcher> stratumServerWatcher;
+
+
+// Function prototypes
+
+// Create stratum server watcher
+static inline void createStratumServerWatcher() noexcept;
+
+
+// Supporting function implementation
+
+// Constructor
+StratumServerWatcher::StratumServerWatcher() noexcept :
+
+	// Set state to watching
+	state(State::WATCHING)
+{
+
+	// Create thread
+	watcherThread = thread(&StratumServerWatcher::runThread, this);
+}
+
+// Destructor
+StratumServerWatcher::~StratumServerWatcher() noexcept {
+
+	// Set state to closing
+	state.store(State::CLOSING, memory_order_relaxed);
+	
+	// Notify thread if it's sleeping
+	state.notify_one();
+	
+	// Join thread
+	watcherThread.join();
+}
+
+// Responses received
+void StratumServerWatcher::responsesReceived() noexcept {
+
+	// Check if the thread is waiting for the responses to be received
+	State expectedState = State::RESPONSES_AVAILABLE;
+	if(state.compare_exchange_strong(expectedState, State::WATCHING, memory_order_relaxed)) {
+	
+		// Notify thread
+		state.notify_one();
+	}
+}
+
+// Pause
+void StratumServerWatcher::pause() noexcept {
+
+	// Lock socket mutex
+	socketMutex.lock();
+}
+
+// Resume
+void StratumServerWatcher::resume() noexcept {
+
+	// Unlock socket mutex
+	socketMutex.unlock();
+}
+
+// Run thread
+void StratumServerWatcher::runThread() noexcept {
+
+	// Loop while not closing
+	while(state.load(memory_order_relaxed) != State::CLOSING) {
+	
+		// Lock socket mutex
+		socketMutex.lock();
+		
+		// Set poll info to check if a response from the stratum server exists
+		pollfd pollInfo = {
+		
+			// Socket descriptor
+			.fd = socketDescriptor,
+			
+			// Events
+			.events = POLLIN
+		};
+		
+		// Check if using Windows
+		#ifdef _WIN32
+		
+			// Get if a response from the stratum server exists
+			const int responseAvailable = WSAPoll(&pollInfo, 1, STRATUM_SERVER_WATCHER_POLL_TIMEOUT_MILLISECONDS);
+			
+		// Otherwise
+		#else
+		
+			// Get if a response from the stratum server exists
+			const int responseAvailable = poll(&pollInfo, 1, STRATUM_SERVER_WATCHER_POLL_TIMEOUT_MILLISECONDS);
+		#endif
+		
+		// Set to wait for the responses to be received if getting if a response from the stratum server exists failed (Failures are left for the trimming thread to find when it receives the responses)
+		bool waitForResponsesToBeReceived = responseAvailable < 0;
+		
+		// Check if a response from the stratum server exists
+		if(responseAvailable > 0) {
+		
+			// Check if looking at the responses from the stratum server without receiving them was successful
+			const decltype(function(recv))::result_type received = recv(socketDescriptor, responses, sizeof(responses) - sizeof('\0'), MSG_PEEK);
+			if(received > 0) {
+			
+				// Null terminate responses
+				responses[received] = '\0';
+				
+				// Check if the responses contain a job
+				const uint64_t height = getJobHeight(responses);
+				if(height) {
+				
+					// Go through all times the job's height is newer than the newest job height (Heights are only raised here since the trimming thread could have already received a newer job than the one looked at)
+					for(uint64_t currentNewestJobHeight = newestJobHeight.load(memory_order_relaxed); height > currentNewestJobHeight && !newestJobHeight.compare_exchange_weak(currentNewestJobHeight, height, memory_order_relaxed););
+					
+					// Set to wait for the responses to be received
+					waitForResponsesToBeReceived = true;
+				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Set to wait for the responses to be received
+				waitForResponsesToBeReceived = true;
+			}
+		}
+		
+		// Unlock socket mutex
+		socketMutex.unlock();
+		
+		// Check if waiting for the responses to be received
+		if(waitForResponsesToBeReceived) {
+		
+			// Check if not closing
+			State expectedState = State::WATCHING;
+			if(state.compare_exchange_strong(expectedState, State::RESPONSES_AVAILABLE, memory_order_relaxed)) {
+			
+				// Sleep until the trimming thread receives the responses or closing
+				state.wait(State::RESPONSES_AVAILABLE, memory_order_relaxed);
+			}
+		}
+		
+		// Otherwise check if a response from the stratum server exists (The responses don't contain a job, and polling would return right away since they haven't been received)
+		else if(responseAvailable) {
+		
+			// Wait for more of the responses to arrive
+			this_thread::sleep_for(chrono::milliseconds(STRATUM_SERVER_WATCHER_PEEK_DELAY_MILLISECONDS));
+		}
+	}
+}
+
+// Get job height
+uint64_t StratumServerWatcher::getJobHeight(char *responses) noexcept {
+
+	// Go through all complete responses
+	uint64_t jobHeight = 0;
+	for(char *responseStart = responses, *responseEnd = strchr(responseStart, '\n'); responseEnd; responseStart = &responseEnd[sizeof('\n')], responseEnd = strchr(responseStart, '\n')) {
+	
+		// Null terminate the response
+		*responseEnd = '\0';
+		
+		// Check if response's method is job or get job template
+		const char *method = strstr(responseStart, "\"method\":");
+		if(method && (strstr(method, "\"job\"") || strstr(method, "\"getjobtemplate\""))) {
+		
+			// Check if response contains a height
+			const char *height = strstr(responseStart, "\"height\":");
+			if(height) {
+			
+				// Check if getting height was successful
+				const size_t heightValueOffset = height[sizeof("\"height\":") - sizeof('\0')] == ' ';
+				char *end;
+				const unsigned long long value = strtoull(&height[sizeof("\"height\":") - sizeof('\0') + heightValueOffset], &end, DECIMAL_NUMBER_BASE);
+				if(end != &height[sizeof("\"height\":") - sizeof('\0') + heightValueOffset] && isdigit(height[sizeof("\"height\":") - sizeof('\0') + heightValueOffset]) && value <= UINT64_MAX) {
+				
+					// Set job height to the response's height
+					jobHeight = value;
+				}
+			}
+		}
+	}
+	
+	// Return job height
+	return jobHeight;
+}
+
+// Create stratum server watcher
+void createStratumServerWatcher() noexcept {
+
+	// Check if creating stratum server watcher failed
+	stratumServerWatcher = unique_ptr<StratumServerWatcher>(new(nothrow) StratumServerWatcher());
+	if(!stratumServerWatcher) {
+	
+		// Display message
+		cout << "Allocating memory for watching the stratum server failed. Mining without abandoning graphs for previous blocks." << endl;
+	}
+}
+
+
+#endif
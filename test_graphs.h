@@ -0,0 +1,99 @@
+// Header guard
+#ifndef TEST_GRAPHS_H
+#define TEST_GRAPHS_H
+
+
+// Header files
+using namespace std;
+
+
+// Function prototypes
+
+// Get test graph's edges
+static inline void getTestGraphsEdges(uint32_t *edges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys) noexcept;
+
+// Trim test graph's edges
+static inline uint64_t trimTestGraphsEdges(uint32_t *trimmedEdges, const uint64_t maximumNumberOfTrimmedEdges, const uint32_t *edges, const unsigned int numberOfTrimmingRounds, uint32_t *nodesDegrees, bool *edgesRemoved) noexcept;
+
+
+// Supporting function implementation
+
+// Get test graph's edges
+void getTestGraphsEdges(uint32_t *edges, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys) noexcept {
+
+	// Go through all edges
+	for(uint64_t i = 0; i < NUMBER_OF_EDGES; ++i) {
+	
+		// Get edge's nodes from its index
+		const uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nonces = {i * 2, (i * 2) | 1};
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * 2))) nodes;
+		sipHash24<2>(&nodes, sipHashKeys, &nonces);
+		
+		// Set edge's index and nodes
+		edges[i * EDGE_NUMBER_OF_COMPONENTS] = i;
+		edges[i * EDGE_NUMBER_OF_COMPONENTS + 1] = nodes[0];
+		edges[i * EDGE_NUMBER_OF_COMPONENTS + 2] = nodes[1];
+	}
+}
+
+// Trim test graph's edges (An edge is removed when its node's pair on the round's partition has no edges, so it can't be part of a cycle, and only up to the max number of trimmed edges are gotten but all of them are counted)
+uint64_t trimTestGraphsEdges(uint32_t *trimmedEdges, const uint64_t maximumNumberOfTrimmedEdges, const uint32_t *edges, const unsigned int numberOfTrimmingRounds, uint32_t *nodesDegrees, bool *edgesRemoved) noexcept {
+
+	// Set that no edges are removed
+	memset(edgesRemoved, false, sizeof(bool) * NUMBER_OF_EDGES);
+	
+	// Go through all trimming rounds
+	for(unsigned int round = 0; round < numberOfTrimmingRounds; ++round) {
+	
+		// Get round's partition
+		const uint_fast8_t partition = 1 + round % 2;
+		
+		// Go through all edges
+		memset(nodesDegrees, 0, sizeof(uint32_t) * NUMBER_OF_EDGES);
+		for(uint64_t i = 0; i < NUMBER_OF_EDGES; ++i) {
+		
+			// Check if edge isn't removed
+			if(!edgesRemoved[i]) {
+			
+				// Increment edge's node's degree
+				++nodesDegrees[edges[i * EDGE_NUMBER_OF_COMPONENTS + partition]];
+			}
+		}
+		
+		// Go through all edges
+		for(uint64_t i = 0; i < NUMBER_OF_EDGES; ++i) {
+		
+			// Check if edge isn't removed
+			if(!edgesRemoved[i]) {
+			
+				// Set that edge is removed if its node's pair doesn't have an edge
+				edgesRemoved[i] = !nodesDegrees[edges[i * EDGE_NUMBER_OF_COMPONENTS + partition] ^ 1];
+			}
+		}
+	}
+	
+	// Go through all edges
+	uint64_t numberOfTrimmedEdges = 0;
+	for(uint64_t i = 0; i < NUMBER_OF_EDGES; ++i) {
+	
+		// Check if edge isn't removed
+		if(!edgesRemoved[i]) {
+		
+			// Check if trimmed edges aren't full
+			if(numberOfTrimmedEdges < maximumNumberOfTrimmedEdges) {
+			
+				// Add edge to the trimmed edges
+				memcpy(&trimmedEdges[numberOfTrimmedEdges * EDGE_NUMBER_OF_COMPONENTS], &edges[i * EDGE_NUMBER_OF_COMPONENTS], sizeof(uint32_t) * EDGE_NUMBER_OF_COMPONENTS);
+			}
+			
+			// Increment number of trimmed edges
+			++numberOfTrimmedEdges;
+		}
+	}
+	
+	// Return number of trimmed edges
+	return numberOfTrimmedEdges;
+}
+
+
+#endif
@@ -0,0 +1,292 @@
+// Header guard
+#ifndef WORK_STEALING_SCHEDULER_H
+#define WORK_STEALING_SCHEDULER_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Work stealing scheduler class (Each thread gets its share of the tasks in its own Chase-Lev deque and takes them from the bottom, and a thread that runs out of tasks steals from the top of the other threads' deques so that threads finish at about the same time even when tasks or cores aren't equally fast)
+class WorkStealingScheduler final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit WorkStealingScheduler(const unsigned int numberOfThreads, const uint32_t numberOfTasks) noexcept;
+		
+		// Bool operator
+		inline explicit operator bool() const noexcept;
+		
+		// Distribute
+		inline void distribute(const unsigned int threadIndex) noexcept;
+		
+		// Perform
+		template<typename Function> inline void perform(const unsigned int threadIndex, const Function &function) noexcept;
+		
+		// Arrive and wait
+		inline void arriveAndWait(const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept;
+		
+		// Get number of threads
+		inline unsigned int getNumberOfThreads() const noexcept;
+		
+		// Get idle time
+		inline double getIdleTime(const unsigned int threadIndex) const noexcept;
+		
+		// Reset idle times
+		inline void resetIdleTimes() noexcept;
+		
+	// Private
+	private:
+	
+		// Steal result
+		enum StealResult {
+		
+			// Stolen
+			STOLEN,
+			
+			// Empty
+			EMPTY,
+			
+			// Contended
+			CONTENDED
+		};
+		
+		// Deque (The top is on a different cache line than the bottom since it's written by the threads stealing from the deque while the bottom and idle time are only written by the deque's thread)
+		struct Deque {
+		
+			// Top
+			alignas(64) atomic<int64_t> top;
+			
+			// Bottom
+			alignas(64) atomic<int64_t> bottom;
+			
+			// Idle time
+			uint64_t idleTime;
+		};
+		
+		// Pop
+		inline bool pop(const unsigned int threadIndex, uint32_t &task) noexcept;
+		
+		// Steal
+		inline StealResult steal(const unsigned int victimThreadIndex, uint32_t &task) noexcept;
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Number of tasks
+		const uint32_t numberOfTasks;
+		
+		// Deque capacity
+		const uint32_t dequeCapacity;
+		
+		// Deques
+		const unique_ptr<Deque[]> deques;
+		
+		// Tasks
+		const unique_ptr<uint32_t[]> tasks;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+WorkStealingScheduler::WorkStealingScheduler(const unsigned int numberOfThreads, const uint32_t numberOfTasks) noexcept :
+
+	// Set number of threads
+	numberOfThreads(numberOfThreads),
+	
+	// Set number of tasks
+	numberOfTasks(numberOfTasks),
+	
+	// Set deque capacity to the most tasks that a thread's share can have
+	dequeCapacity((numberOfTasks + numberOfThreads - 1) / numberOfThreads),
+	
+	// Create deques
+	deques(new(nothrow) Deque[numberOfThreads]),
+	
+	// Create tasks
+	tasks(new(nothrow) uint32_t[static_cast<uint64_t>(numberOfThreads) * dequeCapacity])
+{
+
+	// Check if creating deques was successful
+	if(deques) {
+	
+		// Go through all deques
+		for(unsigned int i = 0; i < numberOfThreads; ++i) {
+		
+			// Set that the deque is empty
+			deques[i].top.store(0, memory_order_relaxed);
+			deques[i].bottom.store(0, memory_order_relaxed);
+			
+			// Set deque's idle time to zero
+			deques[i].idleTime = 0;
+		}
+	}
+}
+
+// Bool operator
+WorkStealingScheduler::operator bool() const noexcept {
+
+	// Return if creating deques and tasks was successful
+	return deques && tasks;
+}
+
+// Distribute
+void WorkStealingScheduler::distribute(const unsigned int threadIndex) noexcept {
+
+	// Get thread's share of the tasks
+	const uint32_t tasksStart = static_cast<uint64_t>(numberOfTasks) * threadIndex / numberOfThreads;
+	const uint32_t tasksEnd = static_cast<uint64_t>(numberOfTasks) * (threadIndex + 1) / numberOfThreads;
+	
+	// Go through all of the thread's tasks backwards so that the thread takes them in order
+	uint32_t *threadsTasks = &tasks[static_cast<uint64_t>(threadIndex) * dequeCapacity];
+	for(uint32_t i = 0; i < tasksEnd - tasksStart; ++i) {
+	
+		// Add task to the thread's tasks
+		threadsTasks[i] = tasksEnd - 1 - i;
+	}
+	
+	// Set that the thread's deque contains its tasks (The threads must wait at a barrier before using the deque since other threads could still be stealing from it until then)
+	deques[threadIndex].top.store(0, memory_order_relaxed);
+	deques[threadIndex].bottom.store(tasksEnd - tasksStart, memory_order_relaxed);
+}
+
+// Perform
+template<typename Function> void WorkStealingScheduler::perform(const unsigned int threadIndex, const Function &function) noexcept {
+
+	// Go through all tasks in the thread's deque
+	uint32_t task;
+	while(pop(threadIndex, task)) {
+	
+		// Perform task
+		function(task);
+	}
+	
+	// Go through all other threads
+	for(unsigned int i = 1; i < numberOfThreads; ++i) {
+	
+		// Go through all tasks in the other thread's deque (Tasks aren't added to deques while performing them, so a deque that's empty stays empty)
+		const unsigned int victimThreadIndex = (threadIndex + i) % numberOfThreads;
+		for(StealResult stealResult; (stealResult = steal(victimThreadIndex, task)) != EMPTY;) {
+		
+			// Check if stealing the task was successful
+			if(stealResult == STOLEN) {
+			
+				// Perform task
+				function(task);
+			}
+		}
+	}
+}
+
+// Arrive and wait
+void WorkStealingScheduler::arriveAndWait(const unsigned int threadIndex, barrier<> &threadsBarrier) noexcept {
+
+	// Record start time
+	const chrono::high_resolution_clock::time_point startTime = chrono::high_resolution_clock::now();
+	
+	// Wait for all threads to finish performing the tasks
+	threadsBarrier.arrive_and_wait();
+	
+	// Add time waiting to the thread's idle time
+	deques[threadIndex].idleTime += chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - startTime).count();
+}
+
+// Get number of threads
+unsigned int WorkStealingScheduler::getNumberOfThreads() const noexcept {
+
+	// Return number of threads
+	return numberOfThreads;
+}
+
+// Get idle time
+double WorkStealingScheduler::getIdleTime(const unsigned int threadIndex) const noexcept {
+
+	// Return thread's idle time in seconds
+	return static_cast<chrono::duration<double>>(static_cast<chrono::nanoseconds>(deques[threadIndex].idleTime)).count();
+}
+
+// Reset idle times
+void WorkStealingScheduler::resetIdleTimes() noexcept {
+
+	// Go through all deques
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Set deque's idle time to zero
+		deques[i].idleTime = 0;
+	}
+}
+
+// Pop
+bool WorkStealingScheduler::pop(const unsigned int threadIndex, uint32_t &task) noexcept {
+
+	// Claim the task at the bottom of the thread's deque
+	Deque &deque = deques[threadIndex];
+	const int64_t bottom = deque.bottom.load(memory_order_relaxed) - 1;
+	deque.bottom.store(bottom, memory_order_relaxed);
+	
+	// Make the claim visible to threads stealing from the deque before checking the top
+	atomic_thread_fence(memory_order_seq_cst);
+	
+	// Check if the deque isn't empty
+	int64_t top = deque.top.load(memory_order_relaxed);
+	if(top <= bottom) {
+	
+		// Get task
+		task = tasks[static_cast<uint64_t>(threadIndex) * dequeCapacity + bottom];
+		
+		// Check if the task is the deque's last task
+		if(top == bottom) {
+		
+			// Check if another thread stole the task
+			const bool taskWasStolen = !deque.top.compare_exchange_strong(top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+			
+			// Restore bottom
+			deque.bottom.store(bottom + 1, memory_order_relaxed);
+			
+			// Return if the task wasn't stolen
+			return !taskWasStolen;
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Restore bottom
+	deque.bottom.store(bottom + 1, memory_order_relaxed);
+	
+	// Return false
+	return false;
+}
+
+// Steal
+WorkStealingScheduler::StealResult WorkStealingScheduler::steal(const unsigned int victimThreadIndex, uint32_t &task) noexcept {
+
+	// Get top of the victim thread's deque
+	Deque &deque = deques[victimThreadIndex];
+	int64_t top = deque.top.load(memory_order_acquire);
+	
+	// Make sure the top is read before the bottom
+	atomic_thread_fence(memory_order_seq_cst);
+	
+	// Check if the deque is empty
+	const int64_t bottom = deque.bottom.load(memory_order_acquire);
+	if(top >= bottom) {
+	
+		// Return empty
+		return EMPTY;
+	}
+	
+	// Get task
+	task = tasks[static_cast<uint64_t>(victimThreadIndex) * dequeCapacity + top];
+	
+	// Return if claiming the task was successful
+	return deque.top.compare_exchange_strong(top, top + 1, memory_order_seq_cst, memory_order_relaxed) ? STOLEN : CONTENDED;
+}
+
+
+#endif